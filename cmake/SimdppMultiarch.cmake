@@ -201,6 +201,124 @@ set(SIMDPP_X86_XOP_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512F")
+set(SIMDPP_X86_AVX512F_CXX_FLAGS "-mavx512f -DSIMDPP_ARCH_X86_AVX512F")
+set(SIMDPP_X86_AVX512F_SUFFIX "-x86_avx512f")
+set(SIMDPP_X86_AVX512F_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        union {
+            volatile float a[16];
+            __m512 align;
+        };
+        __m512 one = _mm512_load_ps((float*)(a));
+        one = _mm512_add_ps(one, one);
+        _mm512_store_ps((float*)(a), one);
+    }"
+)
+
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_POPCNT")
+set(SIMDPP_X86_POPCNT_CXX_FLAGS "-mpopcnt -DSIMDPP_ARCH_X86_POPCNT")
+set(SIMDPP_X86_POPCNT_SUFFIX "-x86_popcnt")
+set(SIMDPP_X86_POPCNT_TEST_CODE
+    "#include <nmmintrin.h>
+    int main()
+    {
+        volatile unsigned a = 0x1234;
+        a = _mm_popcnt_u32(a);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_SSE4_2")
+set(SIMDPP_X86_SSE4_2_CXX_FLAGS "-msse4.2 -DSIMDPP_ARCH_X86_SSE4_2")
+set(SIMDPP_X86_SSE4_2_SUFFIX "-x86_sse4_2")
+set(SIMDPP_X86_SSE4_2_TEST_CODE
+    "#include <nmmintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[16];
+            __m128i align;
+        };
+        __m128i one = _mm_load_si128((__m128i*)(a));
+        one = _mm_cmpgt_epi64(one, one);
+        _mm_store_si128((__m128i*)(a), one);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_PCLMULQDQ")
+set(SIMDPP_X86_PCLMULQDQ_CXX_FLAGS "-msse2 -mpclmul -DSIMDPP_ARCH_X86_PCLMULQDQ")
+set(SIMDPP_X86_PCLMULQDQ_SUFFIX "-x86_pclmulqdq")
+set(SIMDPP_X86_PCLMULQDQ_TEST_CODE
+    "#include <wmmintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[16];
+            __m128i align;
+        };
+        __m128i one = _mm_load_si128((__m128i*)(a));
+        one = _mm_clmulepi64_si128(one, one, 0x00);
+        _mm_store_si128((__m128i*)(a), one);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_F16C")
+set(SIMDPP_X86_F16C_CXX_FLAGS "-mavx -mf16c -DSIMDPP_ARCH_X86_F16C")
+set(SIMDPP_X86_F16C_SUFFIX "-x86_f16c")
+set(SIMDPP_X86_F16C_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[16];
+            __m128i align;
+        };
+        __m128i one = _mm_load_si128((__m128i*)(a));
+        __m128 f = _mm_cvtph_ps(one);
+        one = _mm_cvtps_ph(f, 0);
+        _mm_store_si128((__m128i*)(a), one);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_LZCNT")
+set(SIMDPP_X86_LZCNT_CXX_FLAGS "-mlzcnt -DSIMDPP_ARCH_X86_LZCNT")
+set(SIMDPP_X86_LZCNT_SUFFIX "-x86_lzcnt")
+set(SIMDPP_X86_LZCNT_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        volatile unsigned a = 0x1234;
+        a = _lzcnt_u32(a);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI1")
+set(SIMDPP_X86_BMI1_CXX_FLAGS "-mbmi -DSIMDPP_ARCH_X86_BMI1")
+set(SIMDPP_X86_BMI1_SUFFIX "-x86_bmi1")
+set(SIMDPP_X86_BMI1_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        volatile unsigned a = 0x1234;
+        a = _tzcnt_u32(a) + _blsr_u32(a);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI2")
+set(SIMDPP_X86_BMI2_CXX_FLAGS "-mbmi2 -DSIMDPP_ARCH_X86_BMI2")
+set(SIMDPP_X86_BMI2_SUFFIX "-x86_bmi2")
+set(SIMDPP_X86_BMI2_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        volatile unsigned a = 0x1234;
+        a = _pdep_u32(a, 0xf0f0) + _pext_u32(a, 0xff00);
+    }"
+)
+
 
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon -DSIMDPP_ARCH_ARM_NEON")
@@ -298,7 +416,12 @@ endfunction()
 #
 #   The following identifiers are currently supported:
 #   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1, X86_AVX, X86_AVX2, X86_FMA3,
-#   X86_FMA4, X86_XOP, ARM_NEON, ARM_NEON_FLT_SP
+#   X86_FMA4, X86_XOP, X86_AVX512F, X86_POPCNT, X86_SSE4_2, X86_PCLMULQDQ,
+#   X86_F16C, X86_LZCNT, X86_BMI1, X86_BMI2, ARM_NEON, ARM_NEON_FLT_SP
+#
+#   X86_POPCNT, X86_LZCNT, X86_BMI1 and X86_BMI2 don't imply any vector
+#   instruction set, thus they are usually combined with one, e.g.
+#   "X86_AVX2,X86_BMI2".
 #
 function(simdpp_multiarch FILE_LIST_VAR SRC_FILE)
     if(NOT EXISTS "${CMAKE_CURRENT_SOURCE_DIR}/${SRC_FILE}")
@@ -382,6 +505,9 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
             list(APPEND ALL_ARCHS "X86_AVX,X86_XOP")
         endif()
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_AVX512F)
+        list(APPEND ALL_ARCHS "X86_AVX512F")
+    endif()
     if(DEFINED ARCH_SUPPORTED_ARM_NEON)
         list(APPEND ALL_ARCHS "ARM_NEON")
         list(APPEND ALL_ARCHS "ARM_NEON_FLT_SP")
@@ -0,0 +1,480 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Measures the memory bandwidth of the load, store and stream primitives on
+    buffers of increasing size, from the L1 cache to DRAM.
+*/
+
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "perf_report.h"
+
+using namespace simdpp;
+
+// the widest integer vector that is natively supported
+using V = uint32<SIMDPP_FAST_INT32_SIZE>;
+using Clock = std::chrono::steady_clock;
+
+// the distance in bytes at which the prefetch variants fetch data ahead
+const std::size_t PREFETCH_DISTANCE = 512;
+// the distances in bytes that are measured by the prefetch distance sweep
+const std::size_t SWEEP_DISTANCES[] = { 64, 128, 256, 512, 1024, 2048, 4096 };
+// the misalignment of the unaligned variants in bytes
+const std::size_t MISALIGNMENT = 4;
+
+struct BandwidthOptions {
+    /// The smallest and the largest buffer size in bytes. The largest size
+    /// is chosen automatically if zero
+    std::size_t min_size = 4 << 10;
+    std::size_t max_size = 0;
+    /// The number of bytes processed in each measured run
+    std::size_t run_bytes = 256 << 20;
+    /// The number of measured runs, the best is reported
+    unsigned repeat = 5;
+    /// Whether to print the results for all buffer sizes
+    bool sweep = false;
+    /// Whether to measure prefetch_cursor for each distance in SWEEP_DISTANCES
+    bool prefetch_sweep = false;
+};
+
+// the results are stored here so that the loads are not optimized out
+alignas(64) char work_area[64];
+// the value that is stored, opaque to the compiler
+volatile uint32_t seed = 1;
+
+inline void consume(const V& v)
+{
+    store(work_area, v);
+}
+
+/*  Each kernel processes @a size bytes starting at @a p once. @a size is a
+    multiple of 4 vectors.
+*/
+void k_load(char* p, std::size_t size)
+{
+    V a0 = make_uint(0), a1 = make_uint(0), a2 = make_uint(0), a3 = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        a0 = bit_xor(a0, load<V>(p + i));
+        a1 = bit_xor(a1, load<V>(p + i + sizeof(V)));
+        a2 = bit_xor(a2, load<V>(p + i + 2 * sizeof(V)));
+        a3 = bit_xor(a3, load<V>(p + i + 3 * sizeof(V)));
+    }
+    consume(bit_xor(bit_xor(a0, a1), bit_xor(a2, a3)));
+}
+
+void k_load_u(char* p, std::size_t size)
+{
+    V a0 = make_uint(0), a1 = make_uint(0), a2 = make_uint(0), a3 = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        a0 = bit_xor(a0, load_u<V>(p + i));
+        a1 = bit_xor(a1, load_u<V>(p + i + sizeof(V)));
+        a2 = bit_xor(a2, load_u<V>(p + i + 2 * sizeof(V)));
+        a3 = bit_xor(a3, load_u<V>(p + i + 3 * sizeof(V)));
+    }
+    consume(bit_xor(bit_xor(a0, a1), bit_xor(a2, a3)));
+}
+
+void k_stream_load(char* p, std::size_t size)
+{
+    V a0 = make_uint(0), a1 = make_uint(0), a2 = make_uint(0), a3 = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        a0 = bit_xor(a0, stream_load<V>(p + i));
+        a1 = bit_xor(a1, stream_load<V>(p + i + sizeof(V)));
+        a2 = bit_xor(a2, stream_load<V>(p + i + 2 * sizeof(V)));
+        a3 = bit_xor(a3, stream_load<V>(p + i + 3 * sizeof(V)));
+    }
+    consume(bit_xor(bit_xor(a0, a1), bit_xor(a2, a3)));
+}
+
+void k_load_prefetch(char* p, std::size_t size)
+{
+    V a0 = make_uint(0), a1 = make_uint(0), a2 = make_uint(0), a3 = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        prefetch_read(p + i + PREFETCH_DISTANCE);
+        a0 = bit_xor(a0, load<V>(p + i));
+        a1 = bit_xor(a1, load<V>(p + i + sizeof(V)));
+        a2 = bit_xor(a2, load<V>(p + i + 2 * sizeof(V)));
+        a3 = bit_xor(a3, load<V>(p + i + 3 * sizeof(V)));
+    }
+    consume(bit_xor(bit_xor(a0, a1), bit_xor(a2, a3)));
+}
+
+void k_load_packed2(char* p, std::size_t size)
+{
+    V a = make_uint(0), b = make_uint(0), acc = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        load_packed2(a, b, p + i);
+        acc = bit_xor(acc, bit_xor(a, b));
+        load_packed2(a, b, p + i + 2 * sizeof(V));
+        acc = bit_xor(acc, bit_xor(a, b));
+    }
+    consume(acc);
+}
+
+void k_load_packed3(char* p, std::size_t size)
+{
+    V a = make_uint(0), b = make_uint(0), c = make_uint(0), acc = make_uint(0);
+    for (std::size_t i = 0; i + 3 * sizeof(V) <= size; i += 3 * sizeof(V)) {
+        load_packed3(a, b, c, p + i);
+        acc = bit_xor(acc, bit_xor(a, bit_xor(b, c)));
+    }
+    consume(acc);
+}
+
+void k_load_packed4(char* p, std::size_t size)
+{
+    V a = make_uint(0), b = make_uint(0), c = make_uint(0), d = make_uint(0);
+    V acc = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        load_packed4(a, b, c, d, p + i);
+        acc = bit_xor(acc, bit_xor(bit_xor(a, b), bit_xor(c, d)));
+    }
+    consume(acc);
+}
+
+void k_store(char* p, std::size_t size)
+{
+    V v = make_uint(seed);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        store(p + i, v);
+        store(p + i + sizeof(V), v);
+        store(p + i + 2 * sizeof(V), v);
+        store(p + i + 3 * sizeof(V), v);
+    }
+}
+
+void k_store_prefetch(char* p, std::size_t size)
+{
+    V v = make_uint(seed);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        prefetch_write(p + i + PREFETCH_DISTANCE);
+        store(p + i, v);
+        store(p + i + sizeof(V), v);
+        store(p + i + 2 * sizeof(V), v);
+        store(p + i + 3 * sizeof(V), v);
+    }
+}
+
+void k_stream(char* p, std::size_t size)
+{
+    V v = make_uint(seed);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        stream(p + i, v);
+        stream(p + i + sizeof(V), v);
+        stream(p + i + 2 * sizeof(V), v);
+        stream(p + i + 3 * sizeof(V), v);
+    }
+#if SIMDPP_USE_SSE2
+    // the non-temporal stores are weakly ordered
+    _mm_sfence();
+#endif
+}
+
+// copies the first half of the buffer to the second half. Both the read and
+// the written bytes are counted
+void k_stream_copy(char* p, std::size_t size)
+{
+    stream_copy(p + size / 2, p, size / 2);
+}
+
+// the distance at which k_load_cursor prefetches data ahead
+std::size_t cursor_distance = PREFETCH_DISTANCE;
+
+template<prefetch_hint H>
+void k_load_cursor(char* p, std::size_t size)
+{
+    prefetch_cursor<V, H> c(p, cursor_distance);
+    V a0 = make_uint(0), a1 = make_uint(0), a2 = make_uint(0), a3 = make_uint(0);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        a0 = bit_xor(a0, c.load());
+        a1 = bit_xor(a1, c.load());
+        a2 = bit_xor(a2, c.load());
+        a3 = bit_xor(a3, c.load());
+    }
+    consume(bit_xor(bit_xor(a0, a1), bit_xor(a2, a3)));
+}
+
+void k_store_packed2(char* p, std::size_t size)
+{
+    V a = make_uint(seed), b = make_uint(seed + 1);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        store_packed2(p + i, a, b);
+        store_packed2(p + i + 2 * sizeof(V), a, b);
+    }
+}
+
+void k_store_packed3(char* p, std::size_t size)
+{
+    V a = make_uint(seed), b = make_uint(seed + 1), c = make_uint(seed + 2);
+    for (std::size_t i = 0; i + 3 * sizeof(V) <= size; i += 3 * sizeof(V)) {
+        store_packed3(p + i, a, b, c);
+    }
+}
+
+void k_store_packed4(char* p, std::size_t size)
+{
+    V a = make_uint(seed), b = make_uint(seed + 1), c = make_uint(seed + 2),
+      d = make_uint(seed + 3);
+    for (std::size_t i = 0; i < size; i += 4 * sizeof(V)) {
+        store_packed4(p + i, a, b, c, d);
+    }
+}
+
+struct Kernel {
+    const char* name;
+    void (*run)(char*, std::size_t);
+    /// The offset of the processed data from the aligned buffer start
+    std::size_t offset;
+};
+
+const Kernel kernels[] = {
+    { "load", k_load, 0 },
+    { "load_u", k_load_u, 0 },
+    { "load_u/unaligned", k_load_u, MISALIGNMENT },
+    { "load+prefetch_read", k_load_prefetch, 0 },
+    { "stream_load", k_stream_load, 0 },
+    { "load_packed2", k_load_packed2, 0 },
+    { "load_packed3", k_load_packed3, 0 },
+    { "load_packed4", k_load_packed4, 0 },
+    { "store", k_store, 0 },
+    { "store+prefetch_write", k_store_prefetch, 0 },
+    { "stream", k_stream, 0 },
+    { "stream_copy", k_stream_copy, 0 },
+    { "store_packed2", k_store_packed2, 0 },
+    { "store_packed3", k_store_packed3, 0 },
+    { "store_packed4", k_store_packed4, 0 },
+};
+
+// measured for each distance in SWEEP_DISTANCES when --prefetch-sweep is given
+const Kernel cursor_kernels[] = {
+    { "cursor/l1", k_load_cursor<prefetch_hint::l1>, 0 },
+    { "cursor/l2", k_load_cursor<prefetch_hint::l2>, 0 },
+    { "cursor/l3", k_load_cursor<prefetch_hint::l3>, 0 },
+    { "cursor/nt", k_load_cursor<prefetch_hint::nt>, 0 },
+};
+
+/*  Runs @a k over a buffer of @a size bytes repeatedly until about
+    opt.run_bytes bytes are processed. Returns the best bandwidth of
+    opt.repeat runs in GB/s.
+*/
+double measure(const BandwidthOptions& opt, const Kernel& k, char* buf,
+               std::size_t size)
+{
+    std::size_t passes = std::max<std::size_t>(1, opt.run_bytes / size);
+    char* p = buf + k.offset;
+
+    // bring the buffer into the caches, if it fits
+    k.run(p, size);
+
+    double best = 0;
+    for (unsigned r = 0; r < opt.repeat; ++r) {
+        auto begin = Clock::now();
+        for (std::size_t i = 0; i < passes; ++i) {
+            k.run(p, size);
+        }
+        auto end = Clock::now();
+        std::chrono::duration<double> diff = end - begin;
+        best = std::max(best, double(size) * passes / diff.count() / 1e9);
+    }
+    return best;
+}
+
+/// Returns the size of the data cache of the given level, or zero if unknown
+std::size_t cache_size(int level)
+{
+    long r = 0;
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    switch (level) {
+    case 1: r = sysconf(_SC_LEVEL1_DCACHE_SIZE); break;
+    case 2: r = sysconf(_SC_LEVEL2_CACHE_SIZE); break;
+    case 3: r = sysconf(_SC_LEVEL3_CACHE_SIZE); break;
+    }
+#else
+    (void) level;
+#endif
+    return r > 0 ? r : 0;
+}
+
+std::string format_size(std::size_t size)
+{
+    if (size >= (1 << 20)) {
+        return std::to_string(size >> 20) + "M";
+    }
+    return std::to_string(size >> 10) + "K";
+}
+
+void print_usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options]\n"
+                 "  --min-size=N  smallest buffer size in KiB (default 4)\n"
+                 "  --max-size=N  largest buffer size in KiB (default: 4 times the last level\n"
+                 "                cache, at least 64 MiB)\n"
+                 "  --repeat=N    number of measured runs (default 5)\n"
+                 "  --sweep       print the results for all buffer sizes\n"
+                 "  --prefetch-sweep\n"
+                 "                measure loads via prefetch_cursor with each locality hint\n"
+                 "                and prefetch distances from 64 to 4096 bytes\n";
+}
+
+bool parse_options(int argc, char** argv, BandwidthOptions& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::strlen(prefix);
+            return arg.compare(0, len, prefix) == 0 ? argv[i] + len : nullptr;
+        };
+        if (const char* v = value("--min-size=")) {
+            opt.min_size = std::max(1ul, std::strtoul(v, nullptr, 10)) << 10;
+        } else if (const char* v = value("--max-size=")) {
+            opt.max_size = std::max(1ul, std::strtoul(v, nullptr, 10)) << 10;
+        } else if (const char* v = value("--repeat=")) {
+            opt.repeat = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (arg == "--sweep") {
+            opt.sweep = true;
+        } else if (arg == "--prefetch-sweep") {
+            opt.prefetch_sweep = true;
+        } else {
+            return false;
+        }
+    }
+    return opt.max_size == 0 || opt.min_size <= opt.max_size;
+}
+
+int main(int argc, char** argv)
+{
+    BandwidthOptions opt;
+    if (!parse_options(argc, argv, opt)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if (opt.max_size == 0) {
+        std::size_t llc = std::max(cache_size(2), cache_size(3));
+        opt.max_size = std::max<std::size_t>(64 << 20, llc * 4);
+    }
+    opt.max_size = std::max(opt.max_size, opt.min_size);
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t s = opt.min_size; s <= opt.max_size; s *= 2) {
+        sizes.push_back(s);
+    }
+
+    /*  The size that represents each level of the memory hierarchy is the
+        largest swept size that fills at most half of the cache. DRAM is
+        represented by the largest size, if it exceeds the last level cache
+        at least twice.
+    */
+    std::vector<std::string> level_names;
+    std::vector<std::size_t> level_sizes;
+    std::size_t last_cache = 0;
+    for (int level = 1; level <= 3; ++level) {
+        std::size_t cs = cache_size(level);
+        if (cs == 0) {
+            continue;
+        }
+        last_cache = cs;
+        std::size_t best = 0;
+        for (std::size_t s : sizes) {
+            if (s <= cs / 2) {
+                best = s;
+            }
+        }
+        if (best != 0 && std::find(level_sizes.begin(), level_sizes.end(),
+                                   best) == level_sizes.end()) {
+            level_names.push_back("L" + std::to_string(level));
+            level_sizes.push_back(best);
+        }
+    }
+    if (sizes.back() >= last_cache * 2) {
+        level_names.push_back("DRAM");
+        level_sizes.push_back(sizes.back());
+    }
+    if (opt.sweep || level_sizes.empty()) {
+        level_names.clear();
+        level_sizes = sizes;
+        for (std::size_t s : sizes) {
+            level_names.push_back(format_size(s));
+        }
+    }
+
+    // the buffer is padded so that the unaligned and the prefetching
+    // variants stay within it
+    std::size_t max_distance = *std::max_element(std::begin(SWEEP_DISTANCES),
+                                                 std::end(SWEEP_DISTANCES));
+    std::size_t padding = std::max(PREFETCH_DISTANCE, max_distance) + 64;
+    std::vector<char, aligned_allocator<char, 64>> buf(sizes.back() + padding);
+    std::memset(buf.data(), 1, buf.size());
+
+    std::cout << "vector: " << sizeof(V) * 8 << "-bit, compiler: "
+              << perf_compiler_name() << ", bandwidth in GB/s\n";
+    for (std::size_t i = 0; i < level_names.size(); ++i) {
+        std::cout << level_names[i] << ": " << format_size(level_sizes[i])
+                  << (i + 1 == level_names.size() ? "\n\n" : ", ");
+    }
+
+    std::cout << std::setw(22) << "";
+    for (const std::string& n : level_names) {
+        std::cout << std::setw(8) << n;
+    }
+    std::cout << '\n' << std::fixed << std::setprecision(1);
+
+    for (const Kernel& k : kernels) {
+        std::cout << std::setw(22) << k.name << std::flush;
+        for (std::size_t s : level_sizes) {
+            std::cout << std::setw(8) << measure(opt, k, buf.data(), s)
+                      << std::flush;
+        }
+        std::cout << '\n';
+    }
+
+    if (!opt.prefetch_sweep) {
+        return 0;
+    }
+    std::cout << "\nprefetch_cursor, hint/distance in bytes\n";
+    for (const Kernel& k : cursor_kernels) {
+        for (std::size_t d : SWEEP_DISTANCES) {
+            cursor_distance = d;
+            std::string name = std::string(k.name) + "/" + std::to_string(d);
+            std::cout << std::setw(22) << name << std::flush;
+            for (std::size_t s : level_sizes) {
+                std::cout << std::setw(8) << measure(opt, k, buf.data(), s)
+                          << std::flush;
+            }
+            std::cout << '\n';
+        }
+    }
+}
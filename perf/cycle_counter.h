@@ -0,0 +1,350 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_PERF_CYCLE_COUNTER_H
+#define LIBSIMDPP_PERF_CYCLE_COUNTER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__i386__) || defined(__x86_64__)
+#define PERF_HAS_RDTSCP 1
+#include <x86intrin.h>
+#endif
+
+#if defined(__linux__)
+#define PERF_HAS_PERF_EVENT 1
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*  Keeps the compiler from assuming anything about the value of @a x. Used to
+    build dependency chains that can't be folded.
+*/
+#if __GNUC__
+#define PERF_OPAQUE(x) __asm__ __volatile__("" : "+r"(x))
+#else
+#define PERF_OPAQUE(x) do { volatile auto perf_opaque_tmp = x; x = perf_opaque_tmp; } while (0)
+#endif
+
+/// The result of a single measured interval
+struct CounterSample {
+    /// Core clock cycles
+    double cycles = 0;
+    /// Retired instructions. Zero if the counter is not available
+    double instructions = 0;
+};
+
+/** Measures intervals of code execution in core clock cycles.
+
+    Three sources are supported, the most precise available one is selected
+    at construction:
+
+    * Linux perf_event_open hardware counters. The cycle count is exact and the
+      number of retired instructions is available too.
+    * x86 rdtscp with lfence serialization. The time stamp counter runs at a
+      fixed reference frequency, thus the ticks are scaled by the ratio of the
+      core and reference frequencies.
+    * std::chrono::steady_clock scaled by the core frequency.
+
+    The core frequency is detected by timing a chain of dependent integer
+    additions, each of which takes one cycle on all supported processors.
+*/
+class CycleCounter {
+public:
+    enum Source {
+        SOURCE_PERF_EVENT,
+        SOURCE_RDTSCP,
+        SOURCE_CLOCK
+    };
+
+    /** Sets up the counter.
+
+        @param mhz The core frequency in MHz. If zero, it is detected
+            automatically.
+        @param allow_perf_event Whether to try the perf_event_open counters
+    */
+    CycleCounter(double mhz = 0, bool allow_perf_event = true)
+    {
+        pin_to_current_cpu();
+        core_mhz_ = mhz > 0 ? mhz : detect_core_mhz();
+        tsc_mhz_ = detect_tsc_mhz();
+
+        source_ = SOURCE_CLOCK;
+#if PERF_HAS_RDTSCP
+        if (tsc_mhz_ > 0) {
+            source_ = SOURCE_RDTSCP;
+        }
+#endif
+#if PERF_HAS_PERF_EVENT
+        if (allow_perf_event && open_perf_events()) {
+            source_ = SOURCE_PERF_EVENT;
+        }
+#else
+        (void) allow_perf_event;
+#endif
+    }
+
+    ~CycleCounter()
+    {
+#if PERF_HAS_PERF_EVENT
+        if (fd_cycles_ >= 0) close(fd_cycles_);
+        if (fd_instr_ >= 0) close(fd_instr_);
+#endif
+    }
+
+    CycleCounter(const CycleCounter&) = delete;
+    CycleCounter& operator=(const CycleCounter&) = delete;
+
+    /// Marks the beginning of the measured interval
+    void start()
+    {
+        switch (source_) {
+#if PERF_HAS_PERF_EVENT
+        case SOURCE_PERF_EVENT:
+            ioctl(fd_cycles_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fd_cycles_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            return;
+#endif
+#if PERF_HAS_RDTSCP
+        case SOURCE_RDTSCP:
+            // lfence prevents the preceding instructions from being executed
+            // after, and the measured ones before reading the counter
+            _mm_lfence();
+            tsc_begin_ = __rdtsc();
+            _mm_lfence();
+            return;
+#endif
+        default:
+            clock_begin_ = Clock::now();
+        }
+    }
+
+    /// Marks the end of the measured interval and returns its duration
+    CounterSample stop()
+    {
+        CounterSample r;
+        switch (source_) {
+#if PERF_HAS_PERF_EVENT
+        case SOURCE_PERF_EVENT: {
+            ioctl(fd_cycles_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            // PERF_FORMAT_GROUP: nr, then the values in the order of creation
+            std::uint64_t data[3] = {};
+            if (read(fd_cycles_, data, sizeof(data)) < 0) {
+                return r;
+            }
+            r.cycles = data[1];
+            r.instructions = data[0] > 1 ? data[2] : 0;
+            return r;
+        }
+#endif
+#if PERF_HAS_RDTSCP
+        case SOURCE_RDTSCP: {
+            // rdtscp waits for the preceding instructions to complete, lfence
+            // keeps the following ones from starting before the read
+            unsigned aux;
+            std::uint64_t end = __rdtscp(&aux);
+            _mm_lfence();
+            r.cycles = double(end - tsc_begin_) * core_mhz_ / tsc_mhz_;
+            return r;
+        }
+#endif
+        default: {
+            std::chrono::duration<double, std::micro> d = Clock::now() - clock_begin_;
+            r.cycles = d.count() * core_mhz_;
+            return r;
+        }
+        }
+    }
+
+    Source source() const { return source_; }
+
+    const char* source_name() const
+    {
+        switch (source_) {
+        case SOURCE_PERF_EVENT: return "perf_event_open";
+        case SOURCE_RDTSCP: return "rdtscp";
+        default: return "steady_clock";
+        }
+    }
+
+    /// Whether instruction counts are available
+    bool has_instructions() const
+    {
+#if PERF_HAS_PERF_EVENT
+        return source_ == SOURCE_PERF_EVENT && fd_instr_ >= 0;
+#else
+        return false;
+#endif
+    }
+
+    /// The core frequency in MHz
+    double core_mhz() const { return core_mhz_; }
+
+    /// The frequency of the time stamp counter in MHz, zero if not available
+    double tsc_mhz() const { return tsc_mhz_; }
+
+    /** Detects the core frequency by timing a chain of dependent additions.
+        The minimum of several runs is taken to reduce the influence of
+        interrupts.
+    */
+    static double detect_core_mhz()
+    {
+        const unsigned count = 1 << 22;
+        double best = 0;
+        for (unsigned rep = 0; rep < 7; ++rep) {
+            unsigned x = rep;
+            auto begin = Clock::now();
+            for (unsigned i = 0; i < count; ++i) {
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+                x += 1; PERF_OPAQUE(x);
+            }
+            auto end = Clock::now();
+            sink() = x;
+            std::chrono::duration<double, std::micro> d = end - begin;
+            best = std::max(best, 8.0 * count / d.count());
+        }
+        return best;
+    }
+
+    /// Detects the frequency of the time stamp counter in MHz
+    static double detect_tsc_mhz()
+    {
+#if PERF_HAS_RDTSCP
+        auto begin = Clock::now();
+        std::uint64_t tsc_begin = __rdtsc();
+        auto end = begin;
+        while (end - begin < std::chrono::milliseconds(50)) {
+            end = Clock::now();
+        }
+        std::uint64_t tsc_end = __rdtsc();
+        std::chrono::duration<double, std::micro> d = end - begin;
+        return double(tsc_end - tsc_begin) / d.count();
+#else
+        return 0;
+#endif
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /*  Migrations between cores reset the cache state and, with perf_event,
+        may lose counts. Stay on the CPU we started on.
+    */
+    static void pin_to_current_cpu()
+    {
+#if PERF_HAS_PERF_EVENT && defined(CPU_SET)
+        int cpu = sched_getcpu();
+        if (cpu >= 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            sched_setaffinity(0, sizeof(set), &set);
+        }
+#endif
+    }
+
+#if PERF_HAS_PERF_EVENT
+    static int open_perf_event(std::uint64_t config, int group_fd)
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = group_fd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+    }
+
+    bool open_perf_events()
+    {
+        fd_cycles_ = open_perf_event(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (fd_cycles_ < 0) {
+            return false;
+        }
+        fd_instr_ = open_perf_event(PERF_COUNT_HW_INSTRUCTIONS, fd_cycles_);
+
+        // some virtual machines accept the events, but never count anything
+        Source prev = source_;
+        source_ = SOURCE_PERF_EVENT;
+        start();
+        sink() = sink() + detect_dummy_work();
+        CounterSample s = stop();
+        source_ = prev;
+        if (s.cycles == 0) {
+            close(fd_cycles_);
+            if (fd_instr_ >= 0) close(fd_instr_);
+            fd_cycles_ = fd_instr_ = -1;
+            return false;
+        }
+        return true;
+    }
+
+    static unsigned detect_dummy_work()
+    {
+        unsigned x = 0;
+        for (unsigned i = 0; i < 1000; ++i) {
+            x += i; PERF_OPAQUE(x);
+        }
+        return x;
+    }
+
+    int fd_cycles_ = -1;
+    int fd_instr_ = -1;
+#endif
+
+    Source source_;
+    double core_mhz_;
+    double tsc_mhz_;
+    std::uint64_t tsc_begin_ = 0;
+    Clock::time_point clock_begin_;
+
+    // stores the results of the calibration loops so that they are not
+    // optimized out
+    static volatile unsigned& sink()
+    {
+        static volatile unsigned s;
+        return s;
+    }
+};
+
+#endif
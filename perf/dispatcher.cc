@@ -0,0 +1,318 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Measures the cost of dispatching:
+
+    * the steady-state cost of a call through the dispatcher compared to a
+      direct call of the same function,
+    * the latency of the first call, which selects the version. It includes
+      the callback that determines the supported architecture and the
+      locking of the dispatcher mutex,
+    * the latency of the first call when many threads call an unresolved
+      dispatcher at the same time.
+*/
+
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define SIMDPP_USER_ARCH_INFO ::simdpp::get_arch_raw_cpuid
+
+unsigned perf_dispatch_add(unsigned a, unsigned b);
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+#if __GNUC__
+__attribute__((noinline))
+#endif
+unsigned perf_dispatch_add(unsigned a, unsigned b)
+{
+    return a + b;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER_RET2(perf_dispatch_add, unsigned, unsigned, unsigned)
+
+using Clock = std::chrono::steady_clock;
+using FunPtr = unsigned(*)(unsigned, unsigned);
+using Tag = simdpp_perf_dispatch_add_tag;
+using simdpp::detail::Dispatcher;
+
+struct DispatcherOptions {
+    /// The number of calls to measure the steady-state cost
+    unsigned count = 100000000;
+    /// The number of measured first calls
+    unsigned repeat = 1000;
+    /// The number of threads that call an unresolved dispatcher at once
+    unsigned threads = 64;
+    /// The number of rounds of the contended measurement
+    unsigned rounds = 20;
+};
+
+double elapsed_ns(Clock::time_point begin, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::nano>(end - begin).count();
+}
+
+/*  Calls @a f @a count times, feeding each result into the next call so that
+    the calls can't be elided. Returns the average time of a call in
+    nanoseconds.
+*/
+template<class F>
+double measure_calls(unsigned count, F f)
+{
+    volatile unsigned sink;
+    unsigned r = 0;
+    auto begin = Clock::now();
+    for (unsigned i = 0; i < count; ++i) {
+        r = f(r, i);
+    }
+    auto end = Clock::now();
+    sink = r;
+    (void) sink;
+    return elapsed_ns(begin, end) / count;
+}
+
+/// Returns the median of @a v
+double median(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+/*  Measures @a repeat first calls through an unresolved dispatcher that uses
+    @a cb to determine the supported architecture. Returns the median latency
+    in nanoseconds.
+*/
+template<class Cb>
+double measure_first_call(unsigned repeat, const Cb& cb)
+{
+    std::vector<double> v;
+    volatile unsigned sink;
+    for (unsigned i = 0; i < repeat; ++i) {
+        simdpp::reset_dispatchers();
+        auto begin = Clock::now();
+        sink = Dispatcher<Tag,FunPtr>::get_fun_ptr(cb)(i, 1);
+        v.push_back(elapsed_ns(begin, Clock::now()));
+    }
+    (void) sink;
+    return median(v);
+}
+
+/// Returns the median latency of @a repeat calls of @a cb in nanoseconds
+template<class Cb>
+double measure_callback(unsigned repeat, const Cb& cb)
+{
+    std::vector<double> v;
+    volatile unsigned sink;
+    for (unsigned i = 0; i < repeat; ++i) {
+        auto begin = Clock::now();
+        sink = static_cast<unsigned>(cb());
+        v.push_back(elapsed_ns(begin, Clock::now()));
+    }
+    (void) sink;
+    return median(v);
+}
+
+struct ContentionResult {
+    /// The median over the rounds of the median latency of the threads
+    double median = 0;
+    /// The median over the rounds of the maximum latency of the threads
+    double max = 0;
+};
+
+/*  Releases @a opt.threads threads at once, each of which calls the
+    unresolved dispatcher that uses @a cb. The latency of each call is
+    measured from the moment the threads are released, thus it includes the
+    time spent waiting for the dispatcher mutex.
+*/
+template<class Cb>
+ContentionResult measure_contention(const DispatcherOptions& opt,
+                                    const Cb& cb)
+{
+    std::vector<double> medians, maxima;
+    for (unsigned round = 0; round < opt.rounds; ++round) {
+        simdpp::reset_dispatchers();
+
+        std::atomic<unsigned> ready(0);
+        std::atomic<bool> go(false);
+        Clock::time_point release;
+        std::vector<double> latency(opt.threads);
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t < opt.threads; ++t) {
+            threads.emplace_back([&, t]() {
+                ready++;
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                volatile unsigned sink =
+                        Dispatcher<Tag,FunPtr>::get_fun_ptr(cb)(t, 1);
+                (void) sink;
+                latency[t] = elapsed_ns(release, Clock::now());
+            });
+        }
+        while (ready != opt.threads) {
+            std::this_thread::yield();
+        }
+        release = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& th : threads) {
+            th.join();
+        }
+
+        medians.push_back(median(latency));
+        maxima.push_back(*std::max_element(latency.begin(), latency.end()));
+    }
+
+    ContentionResult r;
+    r.median = median(medians);
+    r.max = median(maxima);
+    return r;
+}
+
+void print_result(const char* id, double ns, double baseline)
+{
+    std::cout << std::setw(44) << id << ':'
+              << std::setw(12) << std::setprecision(3) << std::fixed << ns
+              << " ns/call (" << ns - baseline << " ns over direct call)\n";
+}
+
+void print_latency(const char* id, double ns)
+{
+    std::cout << std::setw(44) << id << ':'
+              << std::setw(12) << std::setprecision(1) << std::fixed << ns
+              << " ns\n";
+}
+
+void print_usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options]\n"
+                 "  --count=N    calls to measure the steady-state cost (default 100000000)\n"
+                 "  --repeat=N   measured first calls (default 1000)\n"
+                 "  --threads=N  threads calling an unresolved dispatcher at once (default 64)\n"
+                 "  --rounds=N   rounds of the contended measurement (default 20)\n";
+}
+
+bool parse_options(int argc, char** argv, DispatcherOptions& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::strlen(prefix);
+            return arg.compare(0, len, prefix) == 0 ? argv[i] + len : nullptr;
+        };
+        if (const char* v = value("--count=")) {
+            opt.count = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--repeat=")) {
+            opt.repeat = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--threads=")) {
+            opt.threads = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--rounds=")) {
+            opt.rounds = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (i == 1 && arg.find_first_not_of("0123456789") ==
+                             std::string::npos) {
+            // the number of calls used to be the only argument
+            opt.count = std::max(1ul, std::strtoul(argv[i], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    DispatcherOptions opt;
+    if (!parse_options(argc, argv, opt)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // resolve the dispatcher, so that only the steady state is measured
+    perf_dispatch_add(0, 0);
+
+    double direct = measure_calls(opt.count, [](unsigned a, unsigned b) {
+        return SIMDPP_ARCH_NAMESPACE::perf_dispatch_add(a, b);
+    });
+
+    double dispatched = measure_calls(opt.count, [](unsigned a, unsigned b) {
+        return perf_dispatch_add(a, b);
+    });
+
+    /*  Emulates the call path where std::function is constructed from
+        SIMDPP_USER_ARCH_INFO on each call.
+    */
+    double dispatched_fn = measure_calls(opt.count, [](unsigned a, unsigned b) {
+        return Dispatcher<Tag,FunPtr>::get_fun_ptr(
+                    simdpp::GetArchCb(SIMDPP_USER_ARCH_INFO))(a, b);
+    });
+
+    std::cout << "steady state, " << opt.count << " calls:\n";
+    print_result("direct call", direct, direct);
+    print_result("dispatched call", dispatched, direct);
+    print_result("dispatched call, std::function per call",
+                 dispatched_fn, direct);
+
+    double raw_cpuid = measure_callback(opt.repeat,
+                                        simdpp::get_arch_raw_cpuid);
+    double cpuinfo = measure_callback(opt.repeat,
+                                      simdpp::get_arch_linux_cpuinfo);
+    double first_raw_cpuid = measure_first_call(opt.repeat,
+                                                simdpp::get_arch_raw_cpuid);
+    double first_cpuinfo = measure_first_call(opt.repeat,
+                                              simdpp::get_arch_linux_cpuinfo);
+
+    std::cout << "\nfirst call, median of " << opt.repeat << ":\n";
+    print_latency("get_arch_raw_cpuid alone", raw_cpuid);
+    print_latency("get_arch_linux_cpuinfo alone", cpuinfo);
+    print_latency("first call, get_arch_raw_cpuid", first_raw_cpuid);
+    print_latency("first call, get_arch_linux_cpuinfo", first_cpuinfo);
+
+    ContentionResult c_raw_cpuid =
+            measure_contention(opt, simdpp::get_arch_raw_cpuid);
+    ContentionResult c_cpuinfo =
+            measure_contention(opt, simdpp::get_arch_linux_cpuinfo);
+
+    std::cout << "\nfirst call, " << opt.threads
+              << " threads at once, median of " << opt.rounds << " rounds:\n";
+    print_latency("median thread, get_arch_raw_cpuid", c_raw_cpuid.median);
+    print_latency("slowest thread, get_arch_raw_cpuid", c_raw_cpuid.max);
+    print_latency("median thread, get_arch_linux_cpuinfo", c_cpuinfo.median);
+    print_latency("slowest thread, get_arch_linux_cpuinfo", c_cpuinfo.max);
+}
@@ -0,0 +1,457 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Measures end-to-end kernels built from the public API. Each kernel is
+    compiled for every supported instruction set (see kernels_simd.cc) and
+    every version that the processor can run is measured by pinning the
+    dispatcher to it. The results of each version are checked against a plain
+    C++ reference implementation, which is also used as the baseline for the
+    reported speedups.
+*/
+
+#include "kernels.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "cycle_counter.h"
+#include "perf_report.h"
+
+using simdpp::Arch;
+
+template<class T>
+using Buffer = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+struct KernelsOptions {
+    /// The number of elements processed by each kernel
+    unsigned size = 1 << 16;
+    /// The number of measured runs of each kernel
+    unsigned repeat = 15;
+    /// The core frequency in MHz. Detected automatically if zero
+    double mhz = 0;
+    /// Whether to use the Linux perf_event_open counters when available
+    bool perf_event = true;
+    /// The format of the output
+    PerfFormat format = PerfFormat::TEXT;
+};
+
+/// The inputs and the outputs of all kernels
+struct KernelData {
+    KernelData(unsigned size) :
+        n(size), side(8), a(size), b(size), y(size), c(size), rgb(3 * size),
+        r(size), g(size), bl(size), bytes(size), u8(size), hist(256), dot(0)
+    {
+        while ((side + 8) * (side + 8) <= n) {
+            side += 8;
+        }
+        m32.resize(side * side);
+        t32.resize(side * side);
+        m16.resize(side * side);
+        t16.resize(side * side);
+
+        // a fixed LCG makes the data identical for all versions
+        std::uint32_t s = 12345;
+        auto next = [&]() { s = s * 1103515245 + 12345; return s >> 8; };
+        for (unsigned i = 0; i < n; ++i) {
+            a[i] = (next() & 0xffff) / 65536.0f;
+            b[i] = (next() & 0xffff) / 65536.0f;
+            y[i] = (next() & 0xffff) / 65536.0f;
+            c[i] = (next() & 0xffff) / 32768.0f - 0.5f;
+            bytes[i] = next();
+        }
+        for (std::uint8_t& v : rgb) {
+            v = next();
+        }
+        for (unsigned i = 0; i < side * side; ++i) {
+            m32[i] = float(i);
+            m16[i] = i;
+        }
+    }
+
+    unsigned n;
+    /// The size of the transposed square matrices
+    unsigned side;
+    Buffer<float> a, b, y, c;
+    Buffer<std::uint8_t> rgb, r, g, bl, bytes, u8;
+    Buffer<float> m32, t32;
+    Buffer<std::uint16_t> m16, t16;
+    Buffer<std::uint32_t> hist;
+    float dot;
+};
+
+const float saxpy_a = 0.999f;
+const float convert_scale = 200.0f;
+
+/// Plain C++ versions of the kernels
+void ref_dot(KernelData& d)
+{
+    float r = 0;
+    for (unsigned i = 0; i < d.n; ++i) {
+        r += d.a[i] * d.b[i];
+    }
+    d.dot = r;
+}
+
+void ref_saxpy(KernelData& d)
+{
+    for (unsigned i = 0; i < d.n; ++i) {
+        d.y[i] = saxpy_a * d.a[i] + d.y[i];
+    }
+}
+
+void ref_rgb_deinterleave(KernelData& d)
+{
+    for (unsigned i = 0; i < d.n; ++i) {
+        d.r[i] = d.rgb[3 * i];
+        d.g[i] = d.rgb[3 * i + 1];
+        d.bl[i] = d.rgb[3 * i + 2];
+    }
+}
+
+template<class T>
+void ref_transpose(T* dst, const T* src, unsigned n)
+{
+    for (unsigned i = 0; i < n; ++i) {
+        for (unsigned j = 0; j < n; ++j) {
+            dst[j * n + i] = src[i * n + j];
+        }
+    }
+}
+
+void ref_histogram(KernelData& d)
+{
+    std::fill(d.hist.begin(), d.hist.end(), 0);
+    for (unsigned i = 0; i < d.n; ++i) {
+        d.hist[d.bytes[i]]++;
+    }
+}
+
+void ref_clamp_convert(KernelData& d)
+{
+    for (unsigned i = 0; i < d.n; ++i) {
+        float x = d.c[i] * convert_scale + 0.5f;
+        x = std::min(std::max(x, 0.0f), 255.0f);
+        d.u8[i] = std::uint8_t(x);
+    }
+}
+
+bool same_float(const Buffer<float>& x, const Buffer<float>& y)
+{
+    for (unsigned i = 0; i < x.size(); ++i) {
+        if (std::abs(x[i] - y[i]) > 1e-5f * std::max(1.0f, std::abs(y[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the conversion may round differently if the multiplication and the
+// addition are fused
+bool same_u8_rounded(const Buffer<std::uint8_t>& x,
+                     const Buffer<std::uint8_t>& y)
+{
+    for (unsigned i = 0; i < x.size(); ++i) {
+        if (std::abs(int(x[i]) - int(y[i])) > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Kernel {
+    const char* name;
+    /// The type of the processed elements
+    const char* type;
+    /// The number of elements processed by one run
+    unsigned (*elements)(const KernelData& d);
+    /// Runs the dispatched version
+    void (*run)(KernelData& d);
+    /// Runs the reference version
+    void (*reference)(KernelData& d);
+    /// Compares the outputs of the dispatched and the reference version
+    bool (*check)(const KernelData& out, const KernelData& ref);
+};
+
+unsigned all_elements(const KernelData& d) { return d.n; }
+unsigned matrix_elements(const KernelData& d) { return d.side * d.side; }
+
+const Kernel kernels[] = {
+    { "dot", "float32", all_elements,
+      [](KernelData& d) { d.dot = kernel_dot(d.a.data(), d.b.data(), d.n); },
+      ref_dot,
+      [](const KernelData& out, const KernelData& ref) {
+          return std::abs(out.dot - ref.dot) <=
+                 1e-4f * std::max(1.0f, std::abs(ref.dot));
+      } },
+    { "saxpy", "float32", all_elements,
+      [](KernelData& d) {
+          kernel_saxpy(d.y.data(), d.a.data(), saxpy_a, d.n);
+      },
+      ref_saxpy,
+      [](const KernelData& out, const KernelData& ref) {
+          return same_float(out.y, ref.y);
+      } },
+    { "rgb_deinterleave", "uint8", all_elements,
+      [](KernelData& d) {
+          kernel_rgb_deinterleave(d.r.data(), d.g.data(), d.bl.data(),
+                                  d.rgb.data(), d.n);
+      },
+      ref_rgb_deinterleave,
+      [](const KernelData& out, const KernelData& ref) {
+          return out.r == ref.r && out.g == ref.g && out.bl == ref.bl;
+      } },
+    { "transpose4", "float32", matrix_elements,
+      [](KernelData& d) {
+          kernel_transpose4(d.t32.data(), d.m32.data(), d.side);
+      },
+      [](KernelData& d) {
+          ref_transpose(d.t32.data(), d.m32.data(), d.side);
+      },
+      [](const KernelData& out, const KernelData& ref) {
+          return out.t32 == ref.t32;
+      } },
+    { "transpose8", "uint16", matrix_elements,
+      [](KernelData& d) {
+          kernel_transpose8(d.t16.data(), d.m16.data(), d.side);
+      },
+      [](KernelData& d) {
+          ref_transpose(d.t16.data(), d.m16.data(), d.side);
+      },
+      [](const KernelData& out, const KernelData& ref) {
+          return out.t16 == ref.t16;
+      } },
+    { "histogram", "uint8", all_elements,
+      [](KernelData& d) {
+          kernel_histogram(d.hist.data(), d.bytes.data(), d.n);
+      },
+      ref_histogram,
+      [](const KernelData& out, const KernelData& ref) {
+          return out.hist == ref.hist;
+      } },
+    { "clamp_convert", "float32", all_elements,
+      [](KernelData& d) {
+          kernel_clamp_convert(d.u8.data(), d.c.data(), convert_scale, d.n);
+      },
+      ref_clamp_convert,
+      [](const KernelData& out, const KernelData& ref) {
+          return same_u8_rounded(out.u8, ref.u8);
+      } },
+};
+
+/*  Returns the instruction sets that the kernels have been compiled for and
+    that the processor supports, in ascending order.
+*/
+std::vector<Arch> runnable_versions()
+{
+    std::vector<Arch> r;
+    Arch supported = SIMDPP_USER_ARCH_INFO();
+    for (const auto& info : simdpp::get_dispatcher_info()) {
+        if (std::strcmp(info.name, "kernel_dot") != 0) {
+            continue;
+        }
+        for (Arch v : info.versions) {
+            if ((v & ~supported) == Arch::NONE_NULL) {
+                r.push_back(v);
+            }
+        }
+    }
+    std::sort(r.begin(), r.end(), [](Arch x, Arch y) {
+        return static_cast<std::uint32_t>(x) < static_cast<std::uint32_t>(y);
+    });
+    return r;
+}
+
+/// Makes all dispatched functions select the version for @a arch
+void select_version(Arch arch)
+{
+    simdpp::set_arch_override(simdpp::ArchOverride::PIN, arch);
+    simdpp::reset_dispatchers();
+}
+
+/// Runs @a f opt.repeat times and returns the statistics of cycles per element
+PerfRecord measure(CycleCounter& counter, const KernelsOptions& opt,
+                   const Kernel& k, void (*f)(KernelData&))
+{
+    KernelData d(opt.size);
+    double elements = k.elements(d);
+    f(d); // warms up the caches and resolves the dispatcher
+
+    std::vector<double> v;
+    for (unsigned i = 0; i < opt.repeat; ++i) {
+        counter.start();
+        f(d);
+        v.push_back(counter.stop().cycles / elements);
+    }
+    std::sort(v.begin(), v.end());
+
+    PerfRecord r;
+    r.op = k.name;
+    r.type = k.type;
+    r.mode = "kernel";
+    r.cycles = v[v.size() / 2];
+    r.min = v.front();
+    double sum = 0, sum2 = 0;
+    for (double x : v) {
+        sum += x;
+        sum2 += x * x;
+    }
+    double mean = sum / v.size();
+    r.stddev = std::sqrt(std::max(0.0, sum2 / v.size() - mean * mean));
+    return r;
+}
+
+void print_row(const std::string& arch, const PerfRecord& r, double speedup,
+               bool ok)
+{
+    std::cout << std::setw(18) << r.op << std::setw(9) << r.type
+              << std::setw(26) << arch << std::setprecision(3)
+              << std::setw(10) << r.cycles << std::setw(10) << r.min
+              << std::setprecision(2) << std::setw(9) << speedup << 'x'
+              << (ok ? "" : "  WRONG RESULT") << std::endl;
+}
+
+void print_usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options]\n"
+                 "  --size=N         elements processed by each kernel (default 65536)\n"
+                 "  --repeat=N       number of measured runs per kernel (default 15)\n"
+                 "  --mhz=N          core frequency, detected automatically by default\n"
+                 "  --no-perf-event  don't use the perf_event_open counters\n"
+                 "  --format=F       text (default), json or csv\n";
+}
+
+bool parse_options(int argc, char** argv, KernelsOptions& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::strlen(prefix);
+            return arg.compare(0, len, prefix) == 0 ? argv[i] + len : nullptr;
+        };
+        if (const char* v = value("--size=")) {
+            opt.size = std::max(64ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--repeat=")) {
+            opt.repeat = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--mhz=")) {
+            opt.mhz = std::strtod(v, nullptr);
+        } else if (const char* v = value("--format=")) {
+            std::string format = v;
+            if (format == "text") {
+                opt.format = PerfFormat::TEXT;
+            } else if (format == "json") {
+                opt.format = PerfFormat::JSON;
+            } else if (format == "csv") {
+                opt.format = PerfFormat::CSV;
+            } else {
+                return false;
+            }
+        } else if (arg == "--no-perf-event") {
+            opt.perf_event = false;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    KernelsOptions opt;
+    if (!parse_options(argc, argv, opt)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    CycleCounter counter(opt.mhz, opt.perf_event);
+    PerfReport report(opt.format, std::cout, "scalar", "-O2");
+    bool text = opt.format == PerfFormat::TEXT;
+
+    std::vector<Arch> versions = runnable_versions();
+    std::vector<std::string> names;
+    for (Arch v : versions) {
+        select_version(v);
+        names.push_back(kernels_arch());
+    }
+
+    if (text) {
+        std::cout << "counter: " << counter.source_name()
+                  << std::fixed << std::setprecision(0)
+                  << ", core clock: " << counter.core_mhz() << " MHz"
+                  << ", elements: " << opt.size << ", runs: " << opt.repeat
+                  << "\ncycles per element (median and minimum), speedup "
+                     "relative to the scalar reference\n\n"
+                  << std::setw(18) << "kernel" << std::setw(9) << "type"
+                  << std::setw(26) << "arch" << std::setw(10) << "cycles"
+                  << std::setw(10) << "min" << std::setw(10) << "speedup"
+                  << '\n';
+    }
+    report.begin(counter.source_name(), counter.core_mhz());
+
+    bool all_ok = true;
+    for (const Kernel& k : kernels) {
+        KernelData ref(opt.size);
+        k.reference(ref);
+
+        PerfRecord base = measure(counter, opt, k, k.reference);
+        if (text) {
+            print_row("scalar", base, 1.0, true);
+        }
+        report.set_arch("scalar");
+        report.add(base);
+
+        for (unsigned i = 0; i < versions.size(); ++i) {
+            select_version(versions[i]);
+
+            KernelData out(opt.size);
+            k.run(out);
+            bool ok = k.check(out, ref);
+            if (!ok) {
+                all_ok = false;
+                std::cerr << k.name << ": wrong result on " << names[i]
+                          << '\n';
+            }
+
+            PerfRecord r = measure(counter, opt, k, k.run);
+            if (text) {
+                print_row(names[i], r, base.cycles / r.cycles, ok);
+            }
+            report.set_arch(names[i]);
+            report.add(r);
+        }
+    }
+    report.end();
+
+    simdpp::set_arch_override(simdpp::ArchOverride::NONE);
+    simdpp::reset_dispatchers();
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_PERF_KERNELS_H
+#define LIBSIMDPP_PERF_KERNELS_H
+
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <cstdint>
+#include <string>
+
+#define SIMDPP_USER_ARCH_INFO ::simdpp::get_arch_raw_cpuid
+
+/*  The kernels are compiled for each instruction set by kernels_simd.cc and
+    called through the dispatcher. All pointers must be aligned to 64 bytes.
+    Unless noted otherwise, @a n is the number of elements and need not be a
+    multiple of the vector size.
+*/
+
+/// Returns the instruction set of the selected versions, e.g. x86_avx2
+std::string kernels_arch();
+
+/// Returns the sum of a[i]*b[i]
+float kernel_dot(const float* a, const float* b, unsigned n);
+
+/// Computes y[i] = a*x[i] + y[i]
+void kernel_saxpy(float* y, const float* x, float a, unsigned n);
+
+/// Splits @a n packed RGB pixels into separate planes
+void kernel_rgb_deinterleave(std::uint8_t* r, std::uint8_t* g, std::uint8_t* b,
+                             const std::uint8_t* rgb, unsigned n);
+
+/// Transposes a @a n x @a n matrix in 4x4 blocks. @a n must be a multiple of 4
+void kernel_transpose4(float* dst, const float* src, unsigned n);
+
+/// Transposes a @a n x @a n matrix in 8x8 blocks. @a n must be a multiple of 8
+void kernel_transpose8(std::uint16_t* dst, const std::uint16_t* src,
+                       unsigned n);
+
+/// Counts the occurrences of each byte value. @a hist has 256 elements
+void kernel_histogram(std::uint32_t* hist, const std::uint8_t* src,
+                      unsigned n);
+
+/// Computes dst[i] = clamp(src[i]*scale + 0.5, 0, 255) truncated to integer
+void kernel_clamp_convert(std::uint8_t* dst, const float* src, float scale,
+                          unsigned n);
+
+#endif
@@ -0,0 +1,235 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The versions of the kernels declared in kernels.h. This file is compiled
+    once for each instruction set. Only the public API is used.
+*/
+
+#include "kernels.h"
+#include <simdpp/simd.h>
+#include "perf_report.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+using namespace simdpp;
+
+using F = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+using U8 = uint8<SIMDPP_FAST_INT8_SIZE>;
+using U32 = uint32<SIMDPP_FAST_INT32_SIZE>;
+
+std::string kernels_arch()
+{
+    return perf_arch_name();
+}
+
+float kernel_dot(const float* a, const float* b, unsigned n)
+{
+    // four independent accumulators hide the latency of the additions
+    F s0 = make_float(0), s1 = s0, s2 = s0, s3 = s0;
+    unsigned i = 0;
+    for (; i + 4 * F::length <= n; i += 4 * F::length) {
+        F a0 = load(a + i),                a1 = load(a + i + F::length),
+          a2 = load(a + i + 2 * F::length), a3 = load(a + i + 3 * F::length);
+        F b0 = load(b + i),                b1 = load(b + i + F::length),
+          b2 = load(b + i + 2 * F::length), b3 = load(b + i + 3 * F::length);
+        s0 = add(s0, mul(a0, b0));
+        s1 = add(s1, mul(a1, b1));
+        s2 = add(s2, mul(a2, b2));
+        s3 = add(s3, mul(a3, b3));
+    }
+    F s = add(add(s0, s1), add(s2, s3));
+
+    alignas(64) float lanes[F::length];
+    store(lanes, s);
+    float r = 0;
+    for (unsigned j = 0; j < F::length; ++j) {
+        r += lanes[j];
+    }
+    for (; i < n; ++i) {
+        r += a[i] * b[i];
+    }
+    return r;
+}
+
+void kernel_saxpy(float* y, const float* x, float a, unsigned n)
+{
+    F va = make_float(a);
+    unsigned i = 0;
+    for (; i + F::length <= n; i += F::length) {
+        F vx = load(x + i);
+        F vy = load(y + i);
+        store(y + i, add(mul(va, vx), vy));
+    }
+    for (; i < n; ++i) {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+void kernel_rgb_deinterleave(std::uint8_t* r, std::uint8_t* g, std::uint8_t* b,
+                             const std::uint8_t* rgb, unsigned n)
+{
+    unsigned i = 0;
+    for (; i + U8::length <= n; i += U8::length) {
+        U8 vr, vg, vb;
+        load_packed3(vr, vg, vb, rgb + 3 * i);
+        store(r + i, vr);
+        store(g + i, vg);
+        store(b + i, vb);
+    }
+    for (; i < n; ++i) {
+        r[i] = rgb[3 * i];
+        g[i] = rgb[3 * i + 1];
+        b[i] = rgb[3 * i + 2];
+    }
+}
+
+void kernel_transpose4(float* dst, const float* src, unsigned n)
+{
+    for (unsigned bi = 0; bi < n; bi += 4) {
+        for (unsigned bj = 0; bj < n; bj += 4) {
+            const float* s = src + bi * n + bj;
+            float32x4 r0 = load(s);
+            float32x4 r1 = load(s + n);
+            float32x4 r2 = load(s + 2 * n);
+            float32x4 r3 = load(s + 3 * n);
+            transpose4(r0, r1, r2, r3);
+            float* d = dst + bj * n + bi;
+            store(d, r0);
+            store(d + n, r1);
+            store(d + 2 * n, r2);
+            store(d + 3 * n, r3);
+        }
+    }
+}
+
+void kernel_transpose8(std::uint16_t* dst, const std::uint16_t* src,
+                       unsigned n)
+{
+    for (unsigned bi = 0; bi < n; bi += 8) {
+        for (unsigned bj = 0; bj < n; bj += 8) {
+            const std::uint16_t* s = src + bi * n + bj;
+            uint16x8 r0 = load(s),         r1 = load(s + n),
+                     r2 = load(s + 2 * n), r3 = load(s + 3 * n),
+                     r4 = load(s + 4 * n), r5 = load(s + 5 * n),
+                     r6 = load(s + 6 * n), r7 = load(s + 7 * n);
+            transpose8(r0, r1, r2, r3, r4, r5, r6, r7);
+            std::uint16_t* d = dst + bj * n + bi;
+            store(d, r0);
+            store(d + n, r1);
+            store(d + 2 * n, r2);
+            store(d + 3 * n, r3);
+            store(d + 4 * n, r4);
+            store(d + 5 * n, r5);
+            store(d + 6 * n, r6);
+            store(d + 7 * n, r7);
+        }
+    }
+}
+
+/*  The increments are scalar, as the counts can't be updated with vector
+    instructions without a scatter. They are spread over four tables to break
+    the dependency between consecutive equal bytes. Clearing and merging of
+    the tables is vectorized.
+*/
+void kernel_histogram(std::uint32_t* hist, const std::uint8_t* src,
+                      unsigned n)
+{
+    alignas(64) std::uint32_t t[4][256];
+
+    U32 zero = make_uint(0);
+    for (unsigned i = 0; i < 4 * 256; i += U32::length) {
+        store(&t[0][0] + i, zero);
+    }
+
+    unsigned i = 0;
+    for (; i + 4 <= n; i += 4) {
+        t[0][src[i]]++;
+        t[1][src[i + 1]]++;
+        t[2][src[i + 2]]++;
+        t[3][src[i + 3]]++;
+    }
+    for (; i < n; ++i) {
+        t[0][src[i]]++;
+    }
+
+    for (unsigned j = 0; j < 256; j += U32::length) {
+        U32 c0 = load(t[0] + j), c1 = load(t[1] + j),
+            c2 = load(t[2] + j), c3 = load(t[3] + j);
+        store(hist + j, add(add(c0, c1), add(c2, c3)));
+    }
+}
+
+/*  Converts 16 values per iteration. The 128-bit vectors are used on all
+    instruction sets, as to_int32 accepts only float32x4 everywhere. The
+    results are narrowed by taking the low halves of the elements twice.
+*/
+void kernel_clamp_convert(std::uint8_t* dst, const float* src, float scale,
+                          unsigned n)
+{
+    float32x4 vs = make_float(scale);
+    float32x4 half = make_float(0.5);
+    float32x4 lo = make_float(0);
+    float32x4 hi = make_float(255);
+
+    unsigned i = 0;
+    for (; i + 16 <= n; i += 16) {
+        int32x4 q[4];
+        for (unsigned k = 0; k < 4; ++k) {
+            float32x4 x = load(src + i + 4 * k);
+            x = add(mul(x, vs), half);
+            x = min(max(x, lo), hi);
+            q[k] = to_int32(x);
+        }
+        uint16x8 p0 = unzip8_lo(bit_cast<uint16x8>(q[0]),
+                                bit_cast<uint16x8>(q[1]));
+        uint16x8 p1 = unzip8_lo(bit_cast<uint16x8>(q[2]),
+                                bit_cast<uint16x8>(q[3]));
+        uint8x16 r = unzip16_lo(bit_cast<uint8x16>(p0),
+                                bit_cast<uint8x16>(p1));
+        store(dst + i, r);
+    }
+    for (; i < n; ++i) {
+        float x = src[i] * scale + 0.5f;
+        x = x < 0 ? 0 : (x > 255 ? 255 : x);
+        dst[i] = std::uint8_t(x);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER_RET0(kernels_arch, std::string)
+SIMDPP_MAKE_DISPATCHER_RET3(kernel_dot, float, const float*, const float*, unsigned)
+SIMDPP_MAKE_DISPATCHER_VOID4(kernel_saxpy, float*, const float*, float, unsigned)
+SIMDPP_MAKE_DISPATCHER_VOID5(kernel_rgb_deinterleave, std::uint8_t*, std::uint8_t*,
+                             std::uint8_t*, const std::uint8_t*, unsigned)
+SIMDPP_MAKE_DISPATCHER_VOID3(kernel_transpose4, float*, const float*, unsigned)
+SIMDPP_MAKE_DISPATCHER_VOID3(kernel_transpose8, std::uint16_t*,
+                             const std::uint16_t*, unsigned)
+SIMDPP_MAKE_DISPATCHER_VOID3(kernel_histogram, std::uint32_t*,
+                             const std::uint8_t*, unsigned)
+SIMDPP_MAKE_DISPATCHER_VOID4(kernel_clamp_convert, std::uint8_t*, const float*,
+                             float, unsigned)
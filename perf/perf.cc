@@ -25,9 +25,8 @@
     POSSIBILITY OF SUCH DAMAGE.
 */
 
-#define SIMDPP_ARCH_X86_SSE3
+
+// The instruction set is selected by the SIMDPP_ARCH_* macros passed on the
+// command line. See CMakeLists.txt
 #include <simdpp/simd.h>
 #include "perf.h"
-
-
-
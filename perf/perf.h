@@ -25,336 +25,505 @@
     POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <iostream>
-#include <ctime>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iomanip>
-#include <vector>
+#include <iostream>
 #include <string>
+#include <type_traits>
+#include <vector>
+#include "cycle_counter.h"
+#include "perf_report.h"
+
+// The compilation flags, recorded in the machine readable output
+#ifndef PERF_CXX_FLAGS
+#define PERF_CXX_FLAGS ""
+#endif
 
 struct UnaryTag {};
 struct BinaryTag {};
 
 enum {
-    WORKAREA_SIZE = 1024
+    // the number of independent accumulators in throughput mode
+    PERF_ACCUMULATORS = 8,
+    /*  The measurement loops are run with PERF_UNROLL and 2*PERF_UNROLL
+        operations per iteration. The difference of the two is the cost of
+        PERF_UNROLL operations. The loop overhead, which is the same in both
+        cases, cancels out.
+    */
+    PERF_UNROLL = 8
 };
 
-alignas(32) char work_area[WORKAREA_SIZE*32];
+// the results are stored here so that the computations are not optimized out
+alignas(64) char work_area[64];
 
 using namespace simdpp;
 
-// The following functions attempt to perform an operation on a and b such that
-// the compiler is unable to perform any optimizations
-inline gint8x16 isolate(gint8x16 a, gint8x16 b)
+/// Options that control the measurement
+struct PerfOptions {
+    /// The number of measured runs of each function
+    unsigned repeat = 15;
+    /// The number of loop iterations within a single run
+    unsigned count = 1 << 18;
+    /// The core frequency in MHz. Detected automatically if zero
+    double mhz = 0;
+    /// Whether to use the Linux perf_event_open counters when available
+    bool perf_event = true;
+    /// Whether to measure the latency
+    bool latency = true;
+    /// Whether to measure the reciprocal throughput
+    bool throughput = true;
+    /// The format of the output
+    PerfFormat format = PerfFormat::TEXT;
+};
+
+/// The state shared by all measurements
+struct PerfContext {
+    PerfContext(const PerfOptions& o) :
+        opt(o),
+        counter(o.mhz, o.perf_event),
+        report(o.format, std::cout, perf_arch_name(), PERF_CXX_FLAGS)
+    {}
+
+    PerfOptions opt;
+    CycleCounter counter;
+    PerfReport report;
+};
+
+/** Hides the value of @a v from the compiler. This prevents it from folding
+    or reordering the chains of measured operations (e.g. bit_and(bit_and(a,
+    b), b) into bit_and(a, b)) while not emitting any instructions.
+*/
+template<class V>
+inline void perf_opaque(V& v)
 {
-    return avg((uint16x8)a, (uint16x8)b);
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+#if SIMDPP_USE_NULL
+        for (unsigned j = 0; j < V::base_vector_type::length; ++j) {
+            PERF_OPAQUE(v[i].el(j));
+        }
+#else
+        typename V::base_vector_type::native_type n = v[i];
+#if __GNUC__ && (SIMDPP_USE_AVX512F || SIMDPP_USE_ALTIVEC)
+        __asm__ __volatile__("" : "+v"(n));
+#elif __GNUC__ && SIMDPP_USE_SSE2
+        __asm__ __volatile__("" : "+x"(n));
+#elif __GNUC__ && SIMDPP_USE_NEON
+        __asm__ __volatile__("" : "+w"(n));
+#else
+        volatile typename V::base_vector_type::native_type tmp = n;
+        n = tmp;
+#endif
+        v[i] = n;
+#endif
+    }
 }
 
-inline gint16x8 isolate(gint16x8 a, gint16x8 b)
+/** Folds a vector twice as wide as @a V into @a V. Used to measure the
+    functions that widen their arguments, e.g. to_int16 or mull. The cost of
+    the additional split and bit_xor is included in the result.
+*/
+template<class V, class W>
+inline V perf_fold(const W& w)
 {
-    return avg((uint16x8)a, (uint16x8)b);
+    using U = uint32<W::length_bytes/4>;
+    using H = uint32<W::length_bytes/8>;
+    H lo, hi;
+    split(bit_cast<U>(w), lo, hi);
+    return bit_cast<V>(bit_xor(lo, hi));
 }
 
-inline gint32x4 isolate(gint32x4 a, gint32x4 b)
+template<class V, class R>
+inline V perf_result(const R& r, std::integral_constant<int, 1>)
 {
-    return avg((uint16x8)a, (uint16x8)b);
+    return bit_cast<V>(r);
 }
 
-inline gint64x2 isolate(gint64x2 a, gint64x2 b)
+template<class V, class R>
+inline V perf_result(const R& r, std::integral_constant<int, 2>)
 {
-    return avg((uint16x8)a, (uint16x8)b);
+    return perf_fold<V>(r);
 }
 
-inline float32x4 isolate(float32x4 a, float32x4 b)
+template<class V, class R>
+inline V perf_result(const R& r, std::integral_constant<int, 0>)
 {
-    return mul(a, b);
+    using H = uint32<R::length_bytes/4>;
+    return bit_cast<V>(combine(bit_cast<H>(r), bit_cast<H>(r)));
 }
 
-/* Benchmarking instruction performance without highel level abstractions is
-    painful. One must ensure that the measurement loop is quite expensive by
-    itself, otherwise we're measuring the bandwidth of the caches (e.g. on
-    Cortex-9 and older ARMs the total load/save bandwidth is only 64
-    bits/cycle). On top of that we must ensure that the compiler doesn't
-    optimize anything out
+/** Converts the result of a measured function back to @ V. Masks are
+    converted to vectors, results twice as wide as @a V are folded with
+    perf_fold and results half as wide are duplicated. The cost of the
+    conversion is included in the result.
 */
+template<class V, class R>
+inline V perf_result(const R& r)
+{
+    using E = decltype(r.eval());
+    constexpr int ratio = E::length_bytes == V::length_bytes ? 1 :
+                          E::length_bytes > V::length_bytes ? 2 : 0;
+    return perf_result<V>(r.eval(), std::integral_constant<int, ratio>());
+}
+
+/// Returns a vector with all elements set to one. Chains of all measured
+/// operations stay within the range of normal numbers when starting from it.
+template<class V>
+inline V perf_initial()
+{
+    V v;
+    if (V::type_tag == SIMDPP_TAG_FLOAT) {
+        v = make_float(1.0);
+    } else {
+        v = make_uint(1);
+    }
+    perf_opaque(v);
+    return v;
+}
+
+template<class V>
+inline void perf_sink(const V& v)
+{
+    store(work_area, bit_cast<uint8<V::length_bytes>>(v));
+}
+
+/// Applies @a f to @a a once. In the binary case @a c is the second argument
 template<class V, class F>
-inline V perf_one_iteration(UnaryTag, V v1, V v2, V c1, V c2, F f)
+inline void perf_step(UnaryTag, V& a, const V&, F f)
 {
-    V v3 = bit_xor(v1, v2);
-
-    V a1 = bit_cast<V>(isolate(v1, c1));
-    V a2 = bit_cast<V>(isolate(v1, c2));
-    V a3 = bit_cast<V>(isolate(v2, c1));
-    V a4 = bit_cast<V>(isolate(v2, c2));
-    V a5 = bit_cast<V>(isolate(v1, v3));
-    V a6 = bit_cast<V>(isolate(v2, v3));
-
-    V b1 = bit_cast<V>(f(a1));
-    V b2 = bit_cast<V>(f(a2));
-    V b3 = bit_cast<V>(f(a3));
-    V b4 = bit_cast<V>(f(a4));
-    V b5 = bit_cast<V>(f(a5));
-    V b6 = bit_cast<V>(f(a6));
-
-    a1 = bit_cast<V>(isolate(b1, v2));
-    a2 = bit_cast<V>(isolate(b2, c1));
-    a3 = bit_cast<V>(isolate(b3, c2));
-    a4 = bit_cast<V>(isolate(b4, v1));
-    a5 = bit_cast<V>(isolate(b5, v2));
-    a6 = bit_cast<V>(isolate(b6, v1));
-
-    a1 = bit_cast<V>(bit_xor(a1, a2));
-    a3 = bit_cast<V>(bit_xor(a3, a4));
-    a5 = bit_cast<V>(bit_xor(a5, a6));
-    a1 = bit_cast<V>(bit_or(a1, a3));
-    a1 = bit_cast<V>(bit_or(a1, a5));
-    return a1;
+    a = bit_cast<V>(f(a));
+    perf_opaque(a);
 }
 
 template<class V, class F>
-inline V perf_one_iteration(BinaryTag, V v1, V v2, V c1, V c2, F f)
+inline void perf_step(BinaryTag, V& a, const V& c, F f)
 {
-    V v3 = bit_xor(v1, v2);
-
-    V a1 = bit_cast<V>(isolate(v1, c1));
-    V a2 = bit_cast<V>(isolate(v1, c2));
-    V a3 = bit_cast<V>(isolate(v2, c1));
-    V a4 = bit_cast<V>(isolate(v2, c2));
-    V a5 = bit_cast<V>(isolate(v1, v3));
-    V a6 = bit_cast<V>(isolate(v2, v3));
-
-    V b1 = bit_cast<V>(f(a1, c2));
-    V b2 = bit_cast<V>(f(a2, v2));
-    V b3 = bit_cast<V>(f(a3, v2));
-    V b4 = bit_cast<V>(f(a4, c1));
-    V b5 = bit_cast<V>(f(a5, c2));
-    V b6 = bit_cast<V>(f(a6, c1));
-
-    a1 = bit_cast<V>(isolate(b1, v2));
-    a2 = bit_cast<V>(isolate(b2, c1));
-    a3 = bit_cast<V>(isolate(b3, c2));
-    a4 = bit_cast<V>(isolate(b4, v1));
-    a5 = bit_cast<V>(isolate(b5, v2));
-    a6 = bit_cast<V>(isolate(b6, v1));
-
-    a1 = bit_cast<V>(bit_xor(a1, a2));
-    a3 = bit_cast<V>(bit_xor(a3, a4));
-    a5 = bit_cast<V>(bit_xor(a5, a6));
-    a1 = bit_cast<V>(bit_or(a1, a3));
-    a1 = bit_cast<V>(bit_or(a1, a5));
-    return a1;
+    a = bit_cast<V>(f(a, c));
+    perf_opaque(a);
 }
 
-/// Applies @a f @a count*6 times.
-template<class V, class Tag, class F>
-inline void perf_cycle(Tag, unsigned count, F f)
+/// Applies @a f to @a a @a K times, each call depending on the previous
+template<unsigned K>
+struct PerfChain {
+    template<class Tag, class V, class F>
+    static void run(Tag, V& a, const V& c, F f)
+    {
+        perf_step(Tag(), a, c, f);
+        PerfChain<K-1>::run(Tag(), a, c, f);
+    }
+};
+
+template<>
+struct PerfChain<0> {
+    template<class Tag, class V, class F>
+    static void run(Tag, V&, const V&, F) {}
+};
+
+/** Latency mode. The result of each call is the first argument of the next,
+    thus the cost per operation is the latency of @a f. Applies @a f
+    count * K times.
+*/
+template<class V, unsigned K, class Tag, class F>
+inline void perf_latency_loop(Tag, unsigned count, F f)
 {
-    using E = typename V::element_type;
-    constexpr unsigned length = V::length;
-
-    unsigned z = 0;
-
-    // count is much larger than workarea_size
-    for (unsigned i = 0; i < count / WORKAREA_SIZE; i++) {
-        E* src;
-        E* dst;
-        src = dst = reinterpret_cast<E*>(work_area);
-
-        V c1, c2;
-        load(c1, src+length*z++);
-        load(c2, src+length*z++);
-
-        z = z % (WORKAREA_SIZE - 2);
-        for (unsigned j = 0; j < WORKAREA_SIZE; j++) {
-            V v1, v2;
-            load(v1, src);
-            load(v2, src + length);
-            v1 = perf_one_iteration(Tag(), v1, v2, c1, c2, f);
-            store(dst, v1);
-            src+= length*2;
-            dst+= length*2;
-        }
+    V a = perf_initial<V>();
+    V c = perf_initial<V>();
+
+    for (unsigned i = 0; i < count; i++) {
+        PerfChain<K>::run(Tag(), a, c, f);
     }
+    perf_sink(a);
 }
 
-template<class V>
-inline int get_baseline(UnaryTag, unsigned mhz, unsigned ms)
+/** Reciprocal throughput mode. PERF_ACCUMULATORS independent chains are
+    advanced in parallel, which is enough to saturate the execution ports
+    for operations with latency up to PERF_ACCUMULATORS / ports cycles.
+    Applies @a f count * K times.
+
+    Note that vectors wider than the native vector occupy several
+    registers each. The accumulators of e.g. uint8x32 on SSE2 don't fit
+    into the register file and are spilled.
+*/
+template<class V, unsigned K, class Tag, class F>
+inline void perf_throughput_loop(Tag, unsigned count, F f)
 {
-    std::clock_t c_begin = std::clock();
-    for (unsigned i = 0; i < mhz; i++) {
-        perf_cycle<V>(UnaryTag(), 1000*ms, [](V a) { return a; });
+    static_assert(PERF_ACCUMULATORS == 8 && K % 8 == 0,
+                  "The number of operations must be divisible by the number"
+                  " of accumulators");
+    const unsigned L = K / PERF_ACCUMULATORS;
+
+    V a0 = perf_initial<V>(), a1 = perf_initial<V>();
+    V a2 = perf_initial<V>(), a3 = perf_initial<V>();
+    V a4 = perf_initial<V>(), a5 = perf_initial<V>();
+    V a6 = perf_initial<V>(), a7 = perf_initial<V>();
+    V c = perf_initial<V>();
+
+    for (unsigned i = 0; i < count; i++) {
+        PerfChain<L>::run(Tag(), a0, c, f);
+        PerfChain<L>::run(Tag(), a1, c, f);
+        PerfChain<L>::run(Tag(), a2, c, f);
+        PerfChain<L>::run(Tag(), a3, c, f);
+        PerfChain<L>::run(Tag(), a4, c, f);
+        PerfChain<L>::run(Tag(), a5, c, f);
+        PerfChain<L>::run(Tag(), a6, c, f);
+        PerfChain<L>::run(Tag(), a7, c, f);
     }
-    std::clock_t c_end = std::clock();
+    a0 = bit_xor(bit_xor(a0, a1), bit_xor(a2, a3));
+    a4 = bit_xor(bit_xor(a4, a5), bit_xor(a6, a7));
+    perf_sink(bit_xor(a0, a4).eval());
+}
 
-    return c_end - c_begin;
+enum class PerfMode {
+    LATENCY,
+    THROUGHPUT
+};
+
+/// Runs the measurement loop of the given mode with @a K operations per
+/// iteration once and returns the counter values
+template<class V, unsigned K, class Tag, class F>
+inline CounterSample perf_run(PerfContext& ctx, PerfMode mode, Tag, F f)
+{
+    ctx.counter.start();
+    if (mode == PerfMode::LATENCY) {
+        perf_latency_loop<V, K>(Tag(), ctx.opt.count, f);
+    } else {
+        perf_throughput_loop<V, K>(Tag(), ctx.opt.count, f);
+    }
+    return ctx.counter.stop();
 }
 
-template<class V>
-inline int get_baseline(BinaryTag, unsigned mhz, unsigned ms)
+/// Summary of repeated measurements
+struct PerfStats {
+    double median = 0;
+    double min = 0;
+    double stddev = 0;
+    /// The median number of instructions per operation, zero if unknown
+    double instructions = 0;
+};
+
+inline PerfStats compute_stats(std::vector<double> v)
+{
+    PerfStats r;
+    if (v.empty()) {
+        return r;
+    }
+    std::sort(v.begin(), v.end());
+    std::size_t n = v.size();
+    r.median = n % 2 ? v[n/2] : (v[n/2-1] + v[n/2]) / 2;
+    r.min = v.front();
+
+    double mean = 0;
+    for (double x : v) {
+        mean += x;
+    }
+    mean /= n;
+    double var = 0;
+    for (double x : v) {
+        var += (x - mean) * (x - mean);
+    }
+    r.stddev = n > 1 ? std::sqrt(var / (n - 1)) : 0;
+    return r;
+}
+
+/** Measures @a f in the given mode. The short and the long variants of the
+    measurement loop are run alternately @a ctx.opt.repeat times so that slow
+    changes of the processor state (e.g. frequency scaling) affect both
+    equally. The per-operation cost is the difference between the two
+    divided by the number of additional operations.
+*/
+template<class V, class Tag, class F>
+inline PerfStats measure_mode(PerfContext& ctx, PerfMode mode, Tag, F f)
+{
+    double ops = double(ctx.opt.count) * PERF_UNROLL;
+
+    // warm up the caches and the branch predictors
+    perf_run<V, PERF_UNROLL>(ctx, mode, Tag(), f);
+    perf_run<V, PERF_UNROLL*2>(ctx, mode, Tag(), f);
+
+    std::vector<double> cycles, instr;
+    for (unsigned i = 0; i < ctx.opt.repeat; ++i) {
+        CounterSample s1 = perf_run<V, PERF_UNROLL>(ctx, mode, Tag(), f);
+        CounterSample s2 = perf_run<V, PERF_UNROLL*2>(ctx, mode, Tag(), f);
+        cycles.push_back(std::max(0.0, s2.cycles - s1.cycles) / ops);
+        instr.push_back((s2.instructions - s1.instructions) / ops);
+    }
+
+    PerfStats r = compute_stats(cycles);
+    r.instructions = compute_stats(instr).median;
+    return r;
+}
+
+/// The result of measuring a single function on a single type
+struct PerfResult {
+    std::string id;
+    bool has_latency = false;
+    bool has_throughput = false;
+    PerfStats latency;
+    PerfStats throughput;
+};
+
+inline void print_stats(const PerfContext& ctx, const char* name,
+                        const PerfStats& st)
 {
-    std::clock_t c_begin = std::clock();
-    for (unsigned i = 0; i < mhz; i++) {
-        perf_cycle<V>(BinaryTag(), 1000*ms, [](V a, V) { return a; });
+    std::cout << "  " << name << std::setw(8) << st.median
+              << " (min " << st.min << ", stddev " << st.stddev;
+    if (ctx.counter.has_instructions()) {
+        std::cout << ", " << st.instructions << " instr/op";
     }
-    std::clock_t c_end = std::clock();
+    std::cout << ")";
+}
 
-    return c_end - c_begin;
+inline void print_result(const PerfContext& ctx, const PerfResult& r)
+{
+    std::cout << std::setw(30) << r.id << ':'
+              << std::fixed << std::setprecision(3);
+    if (r.has_latency) {
+        print_stats(ctx, "latency", r.latency);
+    }
+    if (r.has_throughput) {
+        print_stats(ctx, "rthroughput", r.throughput);
+    }
+    std::cout << std::endl;
 }
-/** Measures the performance of function f. The results are printed to the
-    standard output.
 
-    @param mhz The speed of the processor in MHz
-    @param ms A coefficient determining the duration of the test. The actual
-        duration is a multiple of @a ms milliseconds
+inline void report_result(PerfContext& ctx, const PerfResult& r)
+{
+    PerfRecord rec;
+    std::size_t pos = r.id.rfind('/');
+    rec.op = r.id.substr(0, pos);
+    rec.type = r.id.substr(pos + 1);
+    auto add = [&](const char* mode, const PerfStats& st) {
+        rec.mode = mode;
+        rec.cycles = st.median;
+        rec.min = st.min;
+        rec.stddev = st.stddev;
+        rec.instructions = ctx.counter.has_instructions() ? st.instructions : 0;
+        ctx.report.add(rec);
+    };
+    if (r.has_latency) {
+        add("latency", r.latency);
+    }
+    if (r.has_throughput) {
+        add("throughput", r.throughput);
+    }
+}
+
+/** Measures the latency and the reciprocal throughput of function f in
+    clock cycles. The results are printed to the standard output in the
+    format selected by @a ctx.opt.format.
+
+    @param ctx The measurement context
     @param id An identification string to print.
     @param f A function object that returns a value of type V if called with
-        two parameters of type V.
+        one (UnaryTag) or two (BinaryTag) parameters of type V.
 */
 template<class V, class Tag, class F>
-inline void measure_func(Tag, unsigned mhz, unsigned ms, const char* id, F f)
+inline void measure_func(Tag, PerfContext& ctx, const char* id, F f)
 {
-    // unforutunately we must run this for each measurement
-    int baseline = get_baseline<V>(Tag(), mhz, ms);
-
-    std::clock_t c_begin = std::clock();
-    for (unsigned i = 0; i < mhz; i++) {
-        perf_cycle<V>(Tag(), 1000*ms, f);
+    PerfResult r;
+    r.id = id;
+    if (ctx.opt.latency) {
+        r.has_latency = true;
+        r.latency = measure_mode<V>(ctx, PerfMode::LATENCY, Tag(), f);
     }
-    std::clock_t c_end = std::clock();
+    if (ctx.opt.throughput) {
+        r.has_throughput = true;
+        r.throughput = measure_mode<V>(ctx, PerfMode::THROUGHPUT, Tag(), f);
+    }
+    if (ctx.opt.format == PerfFormat::TEXT) {
+        print_result(ctx, r);
+    } else {
+        report_result(ctx, r);
+    }
+}
 
-    int diff0 = c_end - c_begin;
-    int diff = diff0 - baseline;
+inline void print_usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options]\n"
+                 "  --mode=M         latency, throughput or both (default)\n"
+                 "  --repeat=N       number of measured runs per function (default 15)\n"
+                 "  --count=N        loop iterations per run (default 262144)\n"
+                 "  --mhz=N          core frequency, detected automatically by default\n"
+                 "  --no-perf-event  don't use the perf_event_open counters\n"
+                 "  --format=F       text (default), json or csv\n";
+}
 
-    float res0 = (1000.0 / ms) * (float(diff0) / (CLOCKS_PER_SEC));
-    float res = (1000.0 / ms) * (float(diff) / (CLOCKS_PER_SEC));
-    if (res < 0) {
-        res = 0.0;
+/// Parses the command line. Returns false on invalid arguments
+inline bool parse_perf_options(int argc, char** argv, PerfOptions& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::strlen(prefix);
+            return arg.compare(0, len, prefix) == 0 ? argv[i] + len : nullptr;
+        };
+        if (const char* v = value("--mode=")) {
+            std::string mode = v;
+            opt.latency = mode == "latency" || mode == "both";
+            opt.throughput = mode == "throughput" || mode == "both";
+            if (!opt.latency && !opt.throughput) {
+                return false;
+            }
+        } else if (const char* v = value("--repeat=")) {
+            opt.repeat = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--count=")) {
+            opt.count = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--mhz=")) {
+            opt.mhz = std::strtod(v, nullptr);
+        } else if (const char* v = value("--format=")) {
+            std::string format = v;
+            if (format == "text") {
+                opt.format = PerfFormat::TEXT;
+            } else if (format == "json") {
+                opt.format = PerfFormat::JSON;
+            } else if (format == "csv") {
+                opt.format = PerfFormat::CSV;
+            } else {
+                return false;
+            }
+        } else if (arg == "--no-perf-event") {
+            opt.perf_event = false;
+        } else {
+            return false;
+        }
     }
-    res /= 6;   // 6 operations per iteration
-    res0 /= 6;
-    std::cout << std::setw(30) << id << ':'
-              << std::setw(10) << res << " clock/ops   ( "
-              << res0 << " clock/ops total) " << std::endl;
-
+    return true;
 }
 
-// 64-bit floating point operations are not yet supported
-
-#define TEST_PERF_T1(mhz, ms, V, F)                               \
-    measure_func<V>(UnaryTag(), mhz, ms, #F "/" #V, [](V a) { return F(a); });
-
-#define TEST_PERF_T2(mhz, ms, V, F)                               \
-    measure_func<V>(BinaryTag(), mhz, ms, #F "/" #V, [](V a, V b) { return F(a,b); });
-
-#define TEST_PERF_NO_I64_T1(mhz, ms, F)                           \
-    TEST_PERF_T1(mhz, ms, int8x16, F)                             \
-    TEST_PERF_T1(mhz, ms, int16x8, F)                             \
-    TEST_PERF_T1(mhz, ms, int32x4, F)                             \
-    TEST_PERF_T1(mhz, ms, float32x4, F)                           \
-//    TEST_PERF_T1(mhz, ms, float64x2, F)
-
-#define TEST_PERF_ALL_T1(mhz, ms, F)                              \
-    TEST_PERF_T1(mhz, ms, int8x16, F)                             \
-    TEST_PERF_T1(mhz, ms, int16x8, F)                             \
-    TEST_PERF_T1(mhz, ms, int32x4, F)                             \
-    TEST_PERF_T1(mhz, ms, int64x2, F)                             \
-    TEST_PERF_T1(mhz, ms, float32x4, F)                           \
- //   TEST_PERF_T1(mhz, ms, float64x2, F)
-
-#define TEST_PERF_NO_I64_T2(mhz, ms, F)                           \
-    TEST_PERF_T2(mhz, ms, int8x16, F)                             \
-    TEST_PERF_T2(mhz, ms, int16x8, F)                             \
-    TEST_PERF_T2(mhz, ms, int32x4, F)                             \
-    TEST_PERF_T2(mhz, ms, float32x4, F)                           \
- //   TEST_PERF_T2(mhz, ms, float64x2, F)
-
-#define TEST_PERF_ALL_T2(mhz, ms, F)                              \
-    TEST_PERF_T2(mhz, ms, int8x16, F)                             \
-    TEST_PERF_T2(mhz, ms, int16x8, F)                             \
-    TEST_PERF_T2(mhz, ms, int32x4, F)                             \
-    TEST_PERF_T2(mhz, ms, int64x2, F)                             \
-    TEST_PERF_T2(mhz, ms, float32x4, F)                           \
- //   TEST_PERF_T2(mhz, ms, baseline, float64x2, F)
+// The name of the measured function is passed as variadic argument, because
+// it may contain commas, e.g. permute4<1,1,1,1>
+#define TEST_PERF_T1(ctx, V, ...)                                       \
+    measure_func<V>(UnaryTag(), ctx, #__VA_ARGS__ "/" #V,               \
+                    [](V a) { return perf_result<V>(__VA_ARGS__(a)); });
+
+#define TEST_PERF_T2(ctx, V, ...)                                       \
+    measure_func<V>(BinaryTag(), ctx, #__VA_ARGS__ "/" #V,              \
+                    [](V a, V b) { return perf_result<V>(__VA_ARGS__(a, b)); });
 
 int main(int argc, char** argv)
 {
-    unsigned mhz, ms;
-
-    if (argc < 3) {
-        std::cerr << "Please specify the speed of the processor in MHz as the"
-                     " first argument\n and the duration of each test in "
-                     " milliseconds as the second \n";
+    PerfOptions opt;
+    if (!parse_perf_options(argc, argv, opt)) {
+        print_usage(argv[0]);
         return 1;
     }
-    mhz = std::stol(argv[1]);
-    ms = std::stol(argv[2]);
-
-    // logic
-    TEST_PERF_ALL_T2(mhz,ms, bit_and);
-    TEST_PERF_ALL_T2(mhz,ms, bit_or);
-    TEST_PERF_ALL_T2(mhz,ms, bit_xor);
-
-    // compare
-    TEST_PERF_NO_I64_T2(mhz,ms, cmp_eq);
-    TEST_PERF_NO_I64_T2(mhz,ms, cmp_neq);
-    TEST_PERF_NO_I64_T2(mhz,ms, cmp_lt);
-    TEST_PERF_NO_I64_T2(mhz,ms, cmp_gt);
-
-    // convert
-    TEST_PERF_T1(mhz,ms, int8x16, to_int16x8);
-    TEST_PERF_T1(mhz,ms, uint8x16, to_int16x8);
-    TEST_PERF_T1(mhz,ms, int16x8, to_int32x4);
-    TEST_PERF_T1(mhz,ms, uint16x8, to_int32x4);
-    TEST_PERF_T1(mhz,ms, float32x4, to_int32x4);
-    TEST_PERF_T1(mhz,ms, int32x4, to_int64x2);
-    TEST_PERF_T1(mhz,ms, uint32x4, to_int64x2);
-    TEST_PERF_T1(mhz,ms, int32x4, to_float32x4);
-
-    // math (many missing)
-    TEST_PERF_ALL_T2(mhz,ms, add);
-    TEST_PERF_ALL_T2(mhz,ms, sub);
-    TEST_PERF_NO_I64_T2(mhz,ms, min);
-    TEST_PERF_NO_I64_T2(mhz,ms, max);
-    TEST_PERF_T2(mhz,ms, uint8x16, avg);
-    TEST_PERF_T2(mhz,ms, uint16x8, avg);
-    TEST_PERF_T2(mhz,ms, float32x4, mul);
-    //TEST_PERF_T2(mhz,ms, float64x2, mul);
-    TEST_PERF_T2(mhz,ms, int16x8, mul_lo);
-    TEST_PERF_T2(mhz,ms, int16x8, mul_hi);
-    TEST_PERF_T2(mhz,ms, int32x4, mul_lo);
-    TEST_PERF_T2(mhz,ms, int16x8, mull_lo);
-    TEST_PERF_T2(mhz,ms, int16x8, mull_hi);
-
-    // shift
-    //TEST_PERF_T1(mhz,ms, int16x8, shift_l);
-    //TEST_PERF_T1(mhz,ms, int32x4, shift_l);
-    //TEST_PERF_T1(mhz,ms, int64x2, shift_l);
-    TEST_PERF_T1(mhz,ms, int16x8, shift_l<0>);
-    TEST_PERF_T1(mhz,ms, int32x4, shift_l<0>);
-    TEST_PERF_T1(mhz,ms, int64x2, shift_l<0>);
-    TEST_PERF_T1(mhz,ms, int16x8, shift_l<2>);
-    TEST_PERF_T1(mhz,ms, int32x4, shift_l<2>);
-    TEST_PERF_T1(mhz,ms, int64x2, shift_l<2>);
-    //TEST_PERF_T1(mhz,ms, int16x8, shift_r);
-    //TEST_PERF_T1(mhz,ms, int32x4, shift_r);
-    //TEST_PERF_T1(mhz,ms, int64x2, shift_r);
-    TEST_PERF_T1(mhz,ms, int16x8, shift_r<0>);
-    TEST_PERF_T1(mhz,ms, int32x4, shift_r<0>);
-    TEST_PERF_T1(mhz,ms, int64x2, shift_r<0>);
-    TEST_PERF_T1(mhz,ms, int16x8, shift_r<2>);
-    TEST_PERF_T1(mhz,ms, int32x4, shift_r<2>);
-    TEST_PERF_T1(mhz,ms, int64x2, shift_r<2>);
-
-    // shuffle
-    TEST_PERF_ALL_T2(mhz,ms, zip_lo);
-    TEST_PERF_ALL_T2(mhz,ms, zip_hi);
-    TEST_PERF_ALL_T2(mhz,ms, unzip_lo);
-    TEST_PERF_ALL_T2(mhz,ms, unzip_hi);
-    TEST_PERF_ALL_T1(mhz,ms, move_l<0>);
-    TEST_PERF_ALL_T1(mhz,ms, move_l<1>);
-    TEST_PERF_ALL_T1(mhz,ms, move_r<0>);
-    TEST_PERF_ALL_T1(mhz,ms, move_r<1>);
-    TEST_PERF_ALL_T1(mhz,ms, broadcast<0>);
-    TEST_PERF_ALL_T1(mhz,ms, broadcast<1>);
-    TEST_PERF_ALL_T2(mhz,ms, align<0>);
-    TEST_PERF_ALL_T2(mhz,ms, align<1>);
+
+    PerfContext ctx(opt);
+    if (opt.format == PerfFormat::TEXT) {
+        std::cout << "arch: " << perf_arch_name()
+                  << ", counter: " << ctx.counter.source_name()
+                  << std::fixed << std::setprecision(0)
+                  << ", core clock: " << ctx.counter.core_mhz() << " MHz";
+        if (ctx.counter.tsc_mhz() > 0) {
+            std::cout << ", TSC: " << ctx.counter.tsc_mhz() << " MHz";
+        }
+        std::cout << ", runs: " << opt.repeat << "\n\n";
+    }
+    ctx.report.begin(ctx.counter.source_name(), ctx.counter.core_mhz());
+
+#include "perf_ops.inl"
+
+    ctx.report.end();
 }
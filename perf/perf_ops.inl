@@ -0,0 +1,1337 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file is generated by tools/gen_perf_ops.py. Do not edit.
+
+// align16<1>
+TEST_PERF_T2(ctx, int8x16, align16<1>)
+TEST_PERF_T2(ctx, uint8x16, align16<1>)
+TEST_PERF_T2(ctx, int8x32, align16<1>)
+TEST_PERF_T2(ctx, uint8x32, align16<1>)
+
+// align8<1>
+TEST_PERF_T2(ctx, int16x8, align8<1>)
+TEST_PERF_T2(ctx, uint16x8, align8<1>)
+TEST_PERF_T2(ctx, int16x16, align8<1>)
+TEST_PERF_T2(ctx, uint16x16, align8<1>)
+
+// align4<1>
+TEST_PERF_T2(ctx, int32x4, align4<1>)
+TEST_PERF_T2(ctx, uint32x4, align4<1>)
+TEST_PERF_T2(ctx, float32x4, align4<1>)
+TEST_PERF_T2(ctx, int32x8, align4<1>)
+TEST_PERF_T2(ctx, uint32x8, align4<1>)
+TEST_PERF_T2(ctx, float32x8, align4<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, align4<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, align4<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, align4<1>)
+#endif
+
+// align2<1>
+TEST_PERF_T2(ctx, int64x2, align2<1>)
+TEST_PERF_T2(ctx, uint64x2, align2<1>)
+TEST_PERF_T2(ctx, float64x2, align2<1>)
+TEST_PERF_T2(ctx, int64x4, align2<1>)
+TEST_PERF_T2(ctx, uint64x4, align2<1>)
+TEST_PERF_T2(ctx, float64x4, align2<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, align2<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, align2<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, align2<1>)
+#endif
+
+// bit_and
+TEST_PERF_T2(ctx, int8x16, bit_and)
+TEST_PERF_T2(ctx, uint8x16, bit_and)
+TEST_PERF_T2(ctx, int16x8, bit_and)
+TEST_PERF_T2(ctx, uint16x8, bit_and)
+TEST_PERF_T2(ctx, int32x4, bit_and)
+TEST_PERF_T2(ctx, uint32x4, bit_and)
+TEST_PERF_T2(ctx, int64x2, bit_and)
+TEST_PERF_T2(ctx, uint64x2, bit_and)
+TEST_PERF_T2(ctx, float32x4, bit_and)
+TEST_PERF_T2(ctx, float64x2, bit_and)
+TEST_PERF_T2(ctx, int8x32, bit_and)
+TEST_PERF_T2(ctx, uint8x32, bit_and)
+TEST_PERF_T2(ctx, int16x16, bit_and)
+TEST_PERF_T2(ctx, uint16x16, bit_and)
+TEST_PERF_T2(ctx, int32x8, bit_and)
+TEST_PERF_T2(ctx, uint32x8, bit_and)
+TEST_PERF_T2(ctx, int64x4, bit_and)
+TEST_PERF_T2(ctx, uint64x4, bit_and)
+TEST_PERF_T2(ctx, float32x8, bit_and)
+TEST_PERF_T2(ctx, float64x4, bit_and)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, bit_and)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, bit_and)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, bit_and)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, bit_and)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, bit_and)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, bit_and)
+#endif
+
+// bit_andnot
+TEST_PERF_T2(ctx, int8x16, bit_andnot)
+TEST_PERF_T2(ctx, uint8x16, bit_andnot)
+TEST_PERF_T2(ctx, int16x8, bit_andnot)
+TEST_PERF_T2(ctx, uint16x8, bit_andnot)
+TEST_PERF_T2(ctx, int32x4, bit_andnot)
+TEST_PERF_T2(ctx, uint32x4, bit_andnot)
+TEST_PERF_T2(ctx, int64x2, bit_andnot)
+TEST_PERF_T2(ctx, uint64x2, bit_andnot)
+TEST_PERF_T2(ctx, float32x4, bit_andnot)
+TEST_PERF_T2(ctx, float64x2, bit_andnot)
+TEST_PERF_T2(ctx, int8x32, bit_andnot)
+TEST_PERF_T2(ctx, uint8x32, bit_andnot)
+TEST_PERF_T2(ctx, int16x16, bit_andnot)
+TEST_PERF_T2(ctx, uint16x16, bit_andnot)
+TEST_PERF_T2(ctx, int32x8, bit_andnot)
+TEST_PERF_T2(ctx, uint32x8, bit_andnot)
+TEST_PERF_T2(ctx, int64x4, bit_andnot)
+TEST_PERF_T2(ctx, uint64x4, bit_andnot)
+TEST_PERF_T2(ctx, float32x8, bit_andnot)
+TEST_PERF_T2(ctx, float64x4, bit_andnot)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, bit_andnot)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, bit_andnot)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, bit_andnot)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, bit_andnot)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, bit_andnot)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, bit_andnot)
+#endif
+
+// bit_not
+TEST_PERF_T1(ctx, int8x16, bit_not)
+TEST_PERF_T1(ctx, uint8x16, bit_not)
+TEST_PERF_T1(ctx, int16x8, bit_not)
+TEST_PERF_T1(ctx, uint16x8, bit_not)
+TEST_PERF_T1(ctx, int32x4, bit_not)
+TEST_PERF_T1(ctx, uint32x4, bit_not)
+TEST_PERF_T1(ctx, int64x2, bit_not)
+TEST_PERF_T1(ctx, uint64x2, bit_not)
+TEST_PERF_T1(ctx, float32x4, bit_not)
+TEST_PERF_T1(ctx, float64x2, bit_not)
+TEST_PERF_T1(ctx, int8x32, bit_not)
+TEST_PERF_T1(ctx, uint8x32, bit_not)
+TEST_PERF_T1(ctx, int16x16, bit_not)
+TEST_PERF_T1(ctx, uint16x16, bit_not)
+TEST_PERF_T1(ctx, int32x8, bit_not)
+TEST_PERF_T1(ctx, uint32x8, bit_not)
+TEST_PERF_T1(ctx, int64x4, bit_not)
+TEST_PERF_T1(ctx, uint64x4, bit_not)
+TEST_PERF_T1(ctx, float32x8, bit_not)
+TEST_PERF_T1(ctx, float64x4, bit_not)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, bit_not)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, bit_not)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, bit_not)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, bit_not)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, bit_not)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, bit_not)
+#endif
+
+// bit_or
+TEST_PERF_T2(ctx, int8x16, bit_or)
+TEST_PERF_T2(ctx, uint8x16, bit_or)
+TEST_PERF_T2(ctx, int16x8, bit_or)
+TEST_PERF_T2(ctx, uint16x8, bit_or)
+TEST_PERF_T2(ctx, int32x4, bit_or)
+TEST_PERF_T2(ctx, uint32x4, bit_or)
+TEST_PERF_T2(ctx, int64x2, bit_or)
+TEST_PERF_T2(ctx, uint64x2, bit_or)
+TEST_PERF_T2(ctx, float32x4, bit_or)
+TEST_PERF_T2(ctx, float64x2, bit_or)
+TEST_PERF_T2(ctx, int8x32, bit_or)
+TEST_PERF_T2(ctx, uint8x32, bit_or)
+TEST_PERF_T2(ctx, int16x16, bit_or)
+TEST_PERF_T2(ctx, uint16x16, bit_or)
+TEST_PERF_T2(ctx, int32x8, bit_or)
+TEST_PERF_T2(ctx, uint32x8, bit_or)
+TEST_PERF_T2(ctx, int64x4, bit_or)
+TEST_PERF_T2(ctx, uint64x4, bit_or)
+TEST_PERF_T2(ctx, float32x8, bit_or)
+TEST_PERF_T2(ctx, float64x4, bit_or)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, bit_or)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, bit_or)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, bit_or)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, bit_or)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, bit_or)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, bit_or)
+#endif
+
+// bit_xor
+TEST_PERF_T2(ctx, int8x16, bit_xor)
+TEST_PERF_T2(ctx, uint8x16, bit_xor)
+TEST_PERF_T2(ctx, int16x8, bit_xor)
+TEST_PERF_T2(ctx, uint16x8, bit_xor)
+TEST_PERF_T2(ctx, int32x4, bit_xor)
+TEST_PERF_T2(ctx, uint32x4, bit_xor)
+TEST_PERF_T2(ctx, int64x2, bit_xor)
+TEST_PERF_T2(ctx, uint64x2, bit_xor)
+TEST_PERF_T2(ctx, float32x4, bit_xor)
+TEST_PERF_T2(ctx, float64x2, bit_xor)
+TEST_PERF_T2(ctx, int8x32, bit_xor)
+TEST_PERF_T2(ctx, uint8x32, bit_xor)
+TEST_PERF_T2(ctx, int16x16, bit_xor)
+TEST_PERF_T2(ctx, uint16x16, bit_xor)
+TEST_PERF_T2(ctx, int32x8, bit_xor)
+TEST_PERF_T2(ctx, uint32x8, bit_xor)
+TEST_PERF_T2(ctx, int64x4, bit_xor)
+TEST_PERF_T2(ctx, uint64x4, bit_xor)
+TEST_PERF_T2(ctx, float32x8, bit_xor)
+TEST_PERF_T2(ctx, float64x4, bit_xor)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, bit_xor)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, bit_xor)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, bit_xor)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, bit_xor)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, bit_xor)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, bit_xor)
+#endif
+
+// cmp_eq
+TEST_PERF_T2(ctx, int8x16, cmp_eq)
+TEST_PERF_T2(ctx, uint8x16, cmp_eq)
+TEST_PERF_T2(ctx, int16x8, cmp_eq)
+TEST_PERF_T2(ctx, uint16x8, cmp_eq)
+TEST_PERF_T2(ctx, int32x4, cmp_eq)
+TEST_PERF_T2(ctx, uint32x4, cmp_eq)
+TEST_PERF_T2(ctx, int64x2, cmp_eq)
+TEST_PERF_T2(ctx, uint64x2, cmp_eq)
+TEST_PERF_T2(ctx, float32x4, cmp_eq)
+TEST_PERF_T2(ctx, float64x2, cmp_eq)
+TEST_PERF_T2(ctx, int8x32, cmp_eq)
+TEST_PERF_T2(ctx, uint8x32, cmp_eq)
+TEST_PERF_T2(ctx, int16x16, cmp_eq)
+TEST_PERF_T2(ctx, uint16x16, cmp_eq)
+TEST_PERF_T2(ctx, int32x8, cmp_eq)
+TEST_PERF_T2(ctx, uint32x8, cmp_eq)
+TEST_PERF_T2(ctx, int64x4, cmp_eq)
+TEST_PERF_T2(ctx, uint64x4, cmp_eq)
+TEST_PERF_T2(ctx, float32x8, cmp_eq)
+TEST_PERF_T2(ctx, float64x4, cmp_eq)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, cmp_eq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, cmp_eq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, cmp_eq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, cmp_eq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, cmp_eq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, cmp_eq)
+#endif
+
+// cmp_ge
+TEST_PERF_T2(ctx, float32x4, cmp_ge)
+TEST_PERF_T2(ctx, float64x2, cmp_ge)
+TEST_PERF_T2(ctx, float32x8, cmp_ge)
+TEST_PERF_T2(ctx, float64x4, cmp_ge)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, cmp_ge)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, cmp_ge)
+#endif
+
+// cmp_gt
+TEST_PERF_T2(ctx, int8x16, cmp_gt)
+TEST_PERF_T2(ctx, uint8x16, cmp_gt)
+TEST_PERF_T2(ctx, int16x8, cmp_gt)
+TEST_PERF_T2(ctx, uint16x8, cmp_gt)
+TEST_PERF_T2(ctx, int32x4, cmp_gt)
+TEST_PERF_T2(ctx, uint32x4, cmp_gt)
+TEST_PERF_T2(ctx, float32x4, cmp_gt)
+TEST_PERF_T2(ctx, float64x2, cmp_gt)
+TEST_PERF_T2(ctx, int8x32, cmp_gt)
+TEST_PERF_T2(ctx, uint8x32, cmp_gt)
+TEST_PERF_T2(ctx, int16x16, cmp_gt)
+TEST_PERF_T2(ctx, uint16x16, cmp_gt)
+TEST_PERF_T2(ctx, int32x8, cmp_gt)
+TEST_PERF_T2(ctx, uint32x8, cmp_gt)
+TEST_PERF_T2(ctx, float32x8, cmp_gt)
+TEST_PERF_T2(ctx, float64x4, cmp_gt)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, cmp_gt)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, cmp_gt)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, cmp_gt)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, cmp_gt)
+#endif
+
+// cmp_le
+TEST_PERF_T2(ctx, float32x4, cmp_le)
+TEST_PERF_T2(ctx, float64x2, cmp_le)
+TEST_PERF_T2(ctx, float32x8, cmp_le)
+TEST_PERF_T2(ctx, float64x4, cmp_le)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, cmp_le)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, cmp_le)
+#endif
+
+// cmp_lt
+TEST_PERF_T2(ctx, int8x16, cmp_lt)
+TEST_PERF_T2(ctx, uint8x16, cmp_lt)
+TEST_PERF_T2(ctx, int16x8, cmp_lt)
+TEST_PERF_T2(ctx, uint16x8, cmp_lt)
+TEST_PERF_T2(ctx, int32x4, cmp_lt)
+TEST_PERF_T2(ctx, uint32x4, cmp_lt)
+TEST_PERF_T2(ctx, float32x4, cmp_lt)
+TEST_PERF_T2(ctx, float64x2, cmp_lt)
+TEST_PERF_T2(ctx, int8x32, cmp_lt)
+TEST_PERF_T2(ctx, uint8x32, cmp_lt)
+TEST_PERF_T2(ctx, int16x16, cmp_lt)
+TEST_PERF_T2(ctx, uint16x16, cmp_lt)
+TEST_PERF_T2(ctx, int32x8, cmp_lt)
+TEST_PERF_T2(ctx, uint32x8, cmp_lt)
+TEST_PERF_T2(ctx, float32x8, cmp_lt)
+TEST_PERF_T2(ctx, float64x4, cmp_lt)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, cmp_lt)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, cmp_lt)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, cmp_lt)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, cmp_lt)
+#endif
+
+// cmp_neq
+TEST_PERF_T2(ctx, int8x16, cmp_neq)
+TEST_PERF_T2(ctx, uint8x16, cmp_neq)
+TEST_PERF_T2(ctx, int16x8, cmp_neq)
+TEST_PERF_T2(ctx, uint16x8, cmp_neq)
+TEST_PERF_T2(ctx, int32x4, cmp_neq)
+TEST_PERF_T2(ctx, uint32x4, cmp_neq)
+TEST_PERF_T2(ctx, int64x2, cmp_neq)
+TEST_PERF_T2(ctx, uint64x2, cmp_neq)
+TEST_PERF_T2(ctx, float32x4, cmp_neq)
+TEST_PERF_T2(ctx, float64x2, cmp_neq)
+TEST_PERF_T2(ctx, int8x32, cmp_neq)
+TEST_PERF_T2(ctx, uint8x32, cmp_neq)
+TEST_PERF_T2(ctx, int16x16, cmp_neq)
+TEST_PERF_T2(ctx, uint16x16, cmp_neq)
+TEST_PERF_T2(ctx, int32x8, cmp_neq)
+TEST_PERF_T2(ctx, uint32x8, cmp_neq)
+TEST_PERF_T2(ctx, int64x4, cmp_neq)
+TEST_PERF_T2(ctx, uint64x4, cmp_neq)
+TEST_PERF_T2(ctx, float32x8, cmp_neq)
+TEST_PERF_T2(ctx, float64x4, cmp_neq)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, cmp_neq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, cmp_neq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, cmp_neq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, cmp_neq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, cmp_neq)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, cmp_neq)
+#endif
+
+// abs
+TEST_PERF_T1(ctx, int8x16, abs)
+TEST_PERF_T1(ctx, int16x8, abs)
+TEST_PERF_T1(ctx, int32x4, abs)
+TEST_PERF_T1(ctx, int64x2, abs)
+TEST_PERF_T1(ctx, float32x4, abs)
+TEST_PERF_T1(ctx, float64x2, abs)
+TEST_PERF_T1(ctx, int8x32, abs)
+TEST_PERF_T1(ctx, int16x16, abs)
+TEST_PERF_T1(ctx, int32x8, abs)
+TEST_PERF_T1(ctx, int64x4, abs)
+TEST_PERF_T1(ctx, float32x8, abs)
+TEST_PERF_T1(ctx, float64x4, abs)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, abs)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, abs)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, abs)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, abs)
+#endif
+
+// add
+TEST_PERF_T2(ctx, int8x16, add)
+TEST_PERF_T2(ctx, uint8x16, add)
+TEST_PERF_T2(ctx, int16x8, add)
+TEST_PERF_T2(ctx, uint16x8, add)
+TEST_PERF_T2(ctx, int32x4, add)
+TEST_PERF_T2(ctx, uint32x4, add)
+TEST_PERF_T2(ctx, int64x2, add)
+TEST_PERF_T2(ctx, uint64x2, add)
+TEST_PERF_T2(ctx, float32x4, add)
+TEST_PERF_T2(ctx, float64x2, add)
+TEST_PERF_T2(ctx, int8x32, add)
+TEST_PERF_T2(ctx, uint8x32, add)
+TEST_PERF_T2(ctx, int16x16, add)
+TEST_PERF_T2(ctx, uint16x16, add)
+TEST_PERF_T2(ctx, int32x8, add)
+TEST_PERF_T2(ctx, uint32x8, add)
+TEST_PERF_T2(ctx, int64x4, add)
+TEST_PERF_T2(ctx, uint64x4, add)
+TEST_PERF_T2(ctx, float32x8, add)
+TEST_PERF_T2(ctx, float64x4, add)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, add)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, add)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, add)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, add)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, add)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, add)
+#endif
+
+// ceil
+TEST_PERF_T1(ctx, float32x4, ceil)
+TEST_PERF_T1(ctx, float32x8, ceil)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, ceil)
+#endif
+
+// div
+TEST_PERF_T2(ctx, float32x4, div)
+TEST_PERF_T2(ctx, float64x2, div)
+TEST_PERF_T2(ctx, float32x8, div)
+TEST_PERF_T2(ctx, float64x4, div)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, div)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, div)
+#endif
+
+// floor
+TEST_PERF_T1(ctx, float32x4, floor)
+TEST_PERF_T1(ctx, float32x8, floor)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, floor)
+#endif
+
+// isnan
+TEST_PERF_T1(ctx, float32x4, isnan)
+TEST_PERF_T1(ctx, float64x2, isnan)
+TEST_PERF_T1(ctx, float32x8, isnan)
+TEST_PERF_T1(ctx, float64x4, isnan)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, isnan)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, isnan)
+#endif
+
+// isnan2
+TEST_PERF_T2(ctx, float32x4, isnan2)
+TEST_PERF_T2(ctx, float64x2, isnan2)
+TEST_PERF_T2(ctx, float32x8, isnan2)
+TEST_PERF_T2(ctx, float64x4, isnan2)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, isnan2)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, isnan2)
+#endif
+
+// max
+TEST_PERF_T2(ctx, int8x16, max)
+TEST_PERF_T2(ctx, uint8x16, max)
+TEST_PERF_T2(ctx, int16x8, max)
+TEST_PERF_T2(ctx, uint16x8, max)
+TEST_PERF_T2(ctx, int32x4, max)
+TEST_PERF_T2(ctx, uint32x4, max)
+TEST_PERF_T2(ctx, float32x4, max)
+TEST_PERF_T2(ctx, float64x2, max)
+TEST_PERF_T2(ctx, int8x32, max)
+TEST_PERF_T2(ctx, uint8x32, max)
+TEST_PERF_T2(ctx, int16x16, max)
+TEST_PERF_T2(ctx, uint16x16, max)
+TEST_PERF_T2(ctx, int32x8, max)
+TEST_PERF_T2(ctx, uint32x8, max)
+TEST_PERF_T2(ctx, float32x8, max)
+TEST_PERF_T2(ctx, float64x4, max)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, max)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, max)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, max)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, max)
+#endif
+
+// min
+TEST_PERF_T2(ctx, int8x16, min)
+TEST_PERF_T2(ctx, uint8x16, min)
+TEST_PERF_T2(ctx, int16x8, min)
+TEST_PERF_T2(ctx, uint16x8, min)
+TEST_PERF_T2(ctx, int32x4, min)
+TEST_PERF_T2(ctx, uint32x4, min)
+TEST_PERF_T2(ctx, float32x4, min)
+TEST_PERF_T2(ctx, float64x2, min)
+TEST_PERF_T2(ctx, int8x32, min)
+TEST_PERF_T2(ctx, uint8x32, min)
+TEST_PERF_T2(ctx, int16x16, min)
+TEST_PERF_T2(ctx, uint16x16, min)
+TEST_PERF_T2(ctx, int32x8, min)
+TEST_PERF_T2(ctx, uint32x8, min)
+TEST_PERF_T2(ctx, float32x8, min)
+TEST_PERF_T2(ctx, float64x4, min)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, min)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, min)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, min)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, min)
+#endif
+
+// mul
+TEST_PERF_T2(ctx, float32x4, mul)
+TEST_PERF_T2(ctx, float64x2, mul)
+TEST_PERF_T2(ctx, float32x8, mul)
+TEST_PERF_T2(ctx, float64x4, mul)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, mul)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, mul)
+#endif
+
+// neg
+TEST_PERF_T1(ctx, int8x16, neg)
+TEST_PERF_T1(ctx, int16x8, neg)
+TEST_PERF_T1(ctx, int32x4, neg)
+TEST_PERF_T1(ctx, int64x2, neg)
+TEST_PERF_T1(ctx, float32x4, neg)
+TEST_PERF_T1(ctx, float64x2, neg)
+TEST_PERF_T1(ctx, int8x32, neg)
+TEST_PERF_T1(ctx, int16x16, neg)
+TEST_PERF_T1(ctx, int32x8, neg)
+TEST_PERF_T1(ctx, int64x4, neg)
+TEST_PERF_T1(ctx, float32x8, neg)
+TEST_PERF_T1(ctx, float64x4, neg)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, neg)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, neg)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, neg)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, neg)
+#endif
+
+// rcp_e
+TEST_PERF_T1(ctx, float32x4, rcp_e)
+TEST_PERF_T1(ctx, float32x8, rcp_e)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, rcp_e)
+#endif
+
+// rsqrt_e
+TEST_PERF_T1(ctx, float32x4, rsqrt_e)
+TEST_PERF_T1(ctx, float32x8, rsqrt_e)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, rsqrt_e)
+#endif
+
+// sign
+TEST_PERF_T1(ctx, float32x4, sign)
+TEST_PERF_T1(ctx, float64x2, sign)
+TEST_PERF_T1(ctx, float32x8, sign)
+TEST_PERF_T1(ctx, float64x4, sign)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, sign)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, sign)
+#endif
+
+// sub
+TEST_PERF_T2(ctx, int8x16, sub)
+TEST_PERF_T2(ctx, uint8x16, sub)
+TEST_PERF_T2(ctx, int16x8, sub)
+TEST_PERF_T2(ctx, uint16x8, sub)
+TEST_PERF_T2(ctx, int32x4, sub)
+TEST_PERF_T2(ctx, uint32x4, sub)
+TEST_PERF_T2(ctx, int64x2, sub)
+TEST_PERF_T2(ctx, uint64x2, sub)
+TEST_PERF_T2(ctx, float32x4, sub)
+TEST_PERF_T2(ctx, float64x2, sub)
+TEST_PERF_T2(ctx, int8x32, sub)
+TEST_PERF_T2(ctx, uint8x32, sub)
+TEST_PERF_T2(ctx, int16x16, sub)
+TEST_PERF_T2(ctx, uint16x16, sub)
+TEST_PERF_T2(ctx, int32x8, sub)
+TEST_PERF_T2(ctx, uint32x8, sub)
+TEST_PERF_T2(ctx, int64x4, sub)
+TEST_PERF_T2(ctx, uint64x4, sub)
+TEST_PERF_T2(ctx, float32x8, sub)
+TEST_PERF_T2(ctx, float64x4, sub)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, sub)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, sub)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, sub)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, sub)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, sub)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, sub)
+#endif
+
+// trunc
+TEST_PERF_T1(ctx, float32x4, trunc)
+TEST_PERF_T1(ctx, float32x8, trunc)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, trunc)
+#endif
+
+// adds
+TEST_PERF_T2(ctx, int8x16, adds)
+TEST_PERF_T2(ctx, uint8x16, adds)
+TEST_PERF_T2(ctx, int16x8, adds)
+TEST_PERF_T2(ctx, uint16x8, adds)
+TEST_PERF_T2(ctx, int8x32, adds)
+TEST_PERF_T2(ctx, uint8x32, adds)
+TEST_PERF_T2(ctx, int16x16, adds)
+TEST_PERF_T2(ctx, uint16x16, adds)
+
+// avg
+TEST_PERF_T2(ctx, int8x16, avg)
+TEST_PERF_T2(ctx, uint8x16, avg)
+TEST_PERF_T2(ctx, int16x8, avg)
+TEST_PERF_T2(ctx, uint16x8, avg)
+TEST_PERF_T2(ctx, int32x4, avg)
+TEST_PERF_T2(ctx, uint32x4, avg)
+TEST_PERF_T2(ctx, int8x32, avg)
+TEST_PERF_T2(ctx, uint8x32, avg)
+TEST_PERF_T2(ctx, int16x16, avg)
+TEST_PERF_T2(ctx, uint16x16, avg)
+TEST_PERF_T2(ctx, int32x8, avg)
+TEST_PERF_T2(ctx, uint32x8, avg)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, avg)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, avg)
+#endif
+
+// avg_trunc
+TEST_PERF_T2(ctx, int8x16, avg_trunc)
+TEST_PERF_T2(ctx, uint8x16, avg_trunc)
+TEST_PERF_T2(ctx, int16x8, avg_trunc)
+TEST_PERF_T2(ctx, uint16x8, avg_trunc)
+TEST_PERF_T2(ctx, int32x4, avg_trunc)
+TEST_PERF_T2(ctx, uint32x4, avg_trunc)
+TEST_PERF_T2(ctx, int8x32, avg_trunc)
+TEST_PERF_T2(ctx, uint8x32, avg_trunc)
+TEST_PERF_T2(ctx, int16x16, avg_trunc)
+TEST_PERF_T2(ctx, uint16x16, avg_trunc)
+TEST_PERF_T2(ctx, int32x8, avg_trunc)
+TEST_PERF_T2(ctx, uint32x8, avg_trunc)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, avg_trunc)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, avg_trunc)
+#endif
+
+// div_p<1>
+TEST_PERF_T2(ctx, uint8x16, div_p<1>)
+TEST_PERF_T2(ctx, uint16x8, div_p<1>)
+
+// mul_lo
+TEST_PERF_T2(ctx, int16x8, mul_lo)
+TEST_PERF_T2(ctx, uint16x8, mul_lo)
+TEST_PERF_T2(ctx, int32x4, mul_lo)
+TEST_PERF_T2(ctx, uint32x4, mul_lo)
+TEST_PERF_T2(ctx, int16x16, mul_lo)
+TEST_PERF_T2(ctx, uint16x16, mul_lo)
+TEST_PERF_T2(ctx, int32x8, mul_lo)
+TEST_PERF_T2(ctx, uint32x8, mul_lo)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, mul_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, mul_lo)
+#endif
+
+// mul_hi
+TEST_PERF_T2(ctx, int16x8, mul_hi)
+TEST_PERF_T2(ctx, uint16x8, mul_hi)
+TEST_PERF_T2(ctx, int16x16, mul_hi)
+TEST_PERF_T2(ctx, uint16x16, mul_hi)
+
+// mull
+TEST_PERF_T2(ctx, int16x8, mull)
+TEST_PERF_T2(ctx, uint16x8, mull)
+#if (!SIMDPP_USE_SSE2 || SIMDPP_USE_SSE4_1) && !SIMDPP_USE_ALTIVEC
+TEST_PERF_T2(ctx, int32x4, mull)
+#endif
+TEST_PERF_T2(ctx, uint32x4, mull)
+TEST_PERF_T2(ctx, int16x16, mull)
+TEST_PERF_T2(ctx, uint16x16, mull)
+#if (!SIMDPP_USE_SSE2 || SIMDPP_USE_SSE4_1) && !SIMDPP_USE_ALTIVEC
+TEST_PERF_T2(ctx, int32x8, mull)
+#endif
+TEST_PERF_T2(ctx, uint32x8, mull)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, mull)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, mull)
+#endif
+
+// shift_l<1>
+TEST_PERF_T1(ctx, int8x16, shift_l<1>)
+TEST_PERF_T1(ctx, uint8x16, shift_l<1>)
+TEST_PERF_T1(ctx, int16x8, shift_l<1>)
+TEST_PERF_T1(ctx, uint16x8, shift_l<1>)
+TEST_PERF_T1(ctx, int32x4, shift_l<1>)
+TEST_PERF_T1(ctx, uint32x4, shift_l<1>)
+TEST_PERF_T1(ctx, int64x2, shift_l<1>)
+TEST_PERF_T1(ctx, uint64x2, shift_l<1>)
+TEST_PERF_T1(ctx, int8x32, shift_l<1>)
+TEST_PERF_T1(ctx, uint8x32, shift_l<1>)
+TEST_PERF_T1(ctx, int16x16, shift_l<1>)
+TEST_PERF_T1(ctx, uint16x16, shift_l<1>)
+TEST_PERF_T1(ctx, int32x8, shift_l<1>)
+TEST_PERF_T1(ctx, uint32x8, shift_l<1>)
+TEST_PERF_T1(ctx, int64x4, shift_l<1>)
+TEST_PERF_T1(ctx, uint64x4, shift_l<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, shift_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, shift_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, shift_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, shift_l<1>)
+#endif
+
+// shift_r<1>
+TEST_PERF_T1(ctx, int8x16, shift_r<1>)
+TEST_PERF_T1(ctx, uint8x16, shift_r<1>)
+TEST_PERF_T1(ctx, int16x8, shift_r<1>)
+TEST_PERF_T1(ctx, uint16x8, shift_r<1>)
+TEST_PERF_T1(ctx, int32x4, shift_r<1>)
+TEST_PERF_T1(ctx, uint32x4, shift_r<1>)
+TEST_PERF_T1(ctx, int64x2, shift_r<1>)
+TEST_PERF_T1(ctx, uint64x2, shift_r<1>)
+TEST_PERF_T1(ctx, int8x32, shift_r<1>)
+TEST_PERF_T1(ctx, uint8x32, shift_r<1>)
+TEST_PERF_T1(ctx, int16x16, shift_r<1>)
+TEST_PERF_T1(ctx, uint16x16, shift_r<1>)
+TEST_PERF_T1(ctx, int32x8, shift_r<1>)
+TEST_PERF_T1(ctx, uint32x8, shift_r<1>)
+TEST_PERF_T1(ctx, int64x4, shift_r<1>)
+TEST_PERF_T1(ctx, uint64x4, shift_r<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, shift_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, shift_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, shift_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, shift_r<1>)
+#endif
+
+// subs
+TEST_PERF_T2(ctx, int8x16, subs)
+TEST_PERF_T2(ctx, uint8x16, subs)
+TEST_PERF_T2(ctx, int16x8, subs)
+TEST_PERF_T2(ctx, uint16x8, subs)
+TEST_PERF_T2(ctx, int8x32, subs)
+TEST_PERF_T2(ctx, uint8x32, subs)
+TEST_PERF_T2(ctx, int16x16, subs)
+TEST_PERF_T2(ctx, uint16x16, subs)
+
+// move16_l<1>
+TEST_PERF_T1(ctx, int8x16, move16_l<1>)
+TEST_PERF_T1(ctx, uint8x16, move16_l<1>)
+TEST_PERF_T1(ctx, int8x32, move16_l<1>)
+TEST_PERF_T1(ctx, uint8x32, move16_l<1>)
+
+// move8_l<1>
+TEST_PERF_T1(ctx, int16x8, move8_l<1>)
+TEST_PERF_T1(ctx, uint16x8, move8_l<1>)
+TEST_PERF_T1(ctx, int16x16, move8_l<1>)
+TEST_PERF_T1(ctx, uint16x16, move8_l<1>)
+
+// move4_l<1>
+TEST_PERF_T1(ctx, int32x4, move4_l<1>)
+TEST_PERF_T1(ctx, uint32x4, move4_l<1>)
+TEST_PERF_T1(ctx, float32x4, move4_l<1>)
+TEST_PERF_T1(ctx, int32x8, move4_l<1>)
+TEST_PERF_T1(ctx, uint32x8, move4_l<1>)
+TEST_PERF_T1(ctx, float32x8, move4_l<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, move4_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, move4_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, move4_l<1>)
+#endif
+
+// move2_l<1>
+TEST_PERF_T1(ctx, int64x2, move2_l<1>)
+TEST_PERF_T1(ctx, uint64x2, move2_l<1>)
+TEST_PERF_T1(ctx, float64x2, move2_l<1>)
+TEST_PERF_T1(ctx, int64x4, move2_l<1>)
+TEST_PERF_T1(ctx, uint64x4, move2_l<1>)
+TEST_PERF_T1(ctx, float64x4, move2_l<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, move2_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, move2_l<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, move2_l<1>)
+#endif
+
+// move16_r<1>
+TEST_PERF_T1(ctx, int8x16, move16_r<1>)
+TEST_PERF_T1(ctx, uint8x16, move16_r<1>)
+TEST_PERF_T1(ctx, int8x32, move16_r<1>)
+TEST_PERF_T1(ctx, uint8x32, move16_r<1>)
+
+// move8_r<1>
+TEST_PERF_T1(ctx, int16x8, move8_r<1>)
+TEST_PERF_T1(ctx, uint16x8, move8_r<1>)
+TEST_PERF_T1(ctx, int16x16, move8_r<1>)
+TEST_PERF_T1(ctx, uint16x16, move8_r<1>)
+
+// move4_r<1>
+TEST_PERF_T1(ctx, int32x4, move4_r<1>)
+TEST_PERF_T1(ctx, uint32x4, move4_r<1>)
+TEST_PERF_T1(ctx, float32x4, move4_r<1>)
+TEST_PERF_T1(ctx, int32x8, move4_r<1>)
+TEST_PERF_T1(ctx, uint32x8, move4_r<1>)
+TEST_PERF_T1(ctx, float32x8, move4_r<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, move4_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, move4_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, move4_r<1>)
+#endif
+
+// move2_r<1>
+TEST_PERF_T1(ctx, int64x2, move2_r<1>)
+TEST_PERF_T1(ctx, uint64x2, move2_r<1>)
+TEST_PERF_T1(ctx, float64x2, move2_r<1>)
+TEST_PERF_T1(ctx, int64x4, move2_r<1>)
+TEST_PERF_T1(ctx, uint64x4, move2_r<1>)
+TEST_PERF_T1(ctx, float64x4, move2_r<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int64x8, move2_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, move2_r<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, move2_r<1>)
+#endif
+
+// permute2<1,1>
+TEST_PERF_T1(ctx, uint16x8, permute2<1,1>)
+TEST_PERF_T1(ctx, uint32x4, permute2<1,1>)
+TEST_PERF_T1(ctx, uint64x2, permute2<1,1>)
+TEST_PERF_T1(ctx, float32x4, permute2<1,1>)
+TEST_PERF_T1(ctx, float64x2, permute2<1,1>)
+TEST_PERF_T1(ctx, uint16x16, permute2<1,1>)
+TEST_PERF_T1(ctx, uint32x8, permute2<1,1>)
+TEST_PERF_T1(ctx, uint64x4, permute2<1,1>)
+TEST_PERF_T1(ctx, float32x8, permute2<1,1>)
+TEST_PERF_T1(ctx, float64x4, permute2<1,1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, permute2<1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, permute2<1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, permute2<1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, permute2<1,1>)
+#endif
+
+// permute4<1,1,1,1>
+TEST_PERF_T1(ctx, uint16x8, permute4<1,1,1,1>)
+TEST_PERF_T1(ctx, uint32x4, permute4<1,1,1,1>)
+TEST_PERF_T1(ctx, float32x4, permute4<1,1,1,1>)
+TEST_PERF_T1(ctx, uint16x16, permute4<1,1,1,1>)
+TEST_PERF_T1(ctx, uint32x8, permute4<1,1,1,1>)
+TEST_PERF_T1(ctx, uint64x4, permute4<1,1,1,1>)
+TEST_PERF_T1(ctx, float32x8, permute4<1,1,1,1>)
+#if !SIMDPP_USE_AVX || SIMDPP_USE_AVX2
+TEST_PERF_T1(ctx, float64x4, permute4<1,1,1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, permute4<1,1,1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, permute4<1,1,1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, permute4<1,1,1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, permute4<1,1,1,1>)
+#endif
+
+// permute_bytes16
+#if !SIMDPP_USE_SSE2 || SIMDPP_USE_SSSE3
+TEST_PERF_T2(ctx, uint8x16, permute_bytes16)
+#endif
+#if !SIMDPP_USE_SSE2 || SIMDPP_USE_SSSE3
+TEST_PERF_T2(ctx, uint8x32, permute_bytes16)
+#endif
+
+// permute_zbytes16
+#if !SIMDPP_USE_SSE2 || SIMDPP_USE_SSSE3
+TEST_PERF_T2(ctx, uint8x16, permute_zbytes16)
+#endif
+#if !SIMDPP_USE_SSE2 || SIMDPP_USE_SSSE3
+TEST_PERF_T2(ctx, uint8x32, permute_zbytes16)
+#endif
+
+// shuffle1<1,1>
+TEST_PERF_T2(ctx, uint64x2, shuffle1<1,1>)
+TEST_PERF_T2(ctx, float64x2, shuffle1<1,1>)
+TEST_PERF_T2(ctx, uint64x4, shuffle1<1,1>)
+TEST_PERF_T2(ctx, float64x4, shuffle1<1,1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, shuffle1<1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, shuffle1<1,1>)
+#endif
+
+// shuffle2<1,1,1,1>
+TEST_PERF_T2(ctx, uint32x4, shuffle2<1,1,1,1>)
+TEST_PERF_T2(ctx, float32x4, shuffle2<1,1,1,1>)
+TEST_PERF_T2(ctx, uint32x8, shuffle2<1,1,1,1>)
+TEST_PERF_T2(ctx, float32x8, shuffle2<1,1,1,1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, shuffle2<1,1,1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, shuffle2<1,1,1,1>)
+#endif
+
+// shuffle2<1,1>
+TEST_PERF_T2(ctx, uint32x4, shuffle2<1,1>)
+TEST_PERF_T2(ctx, float32x4, shuffle2<1,1>)
+TEST_PERF_T2(ctx, uint32x8, shuffle2<1,1>)
+TEST_PERF_T2(ctx, float32x8, shuffle2<1,1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, shuffle2<1,1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, shuffle2<1,1>)
+#endif
+
+// splat<1>
+TEST_PERF_T1(ctx, uint8x16, splat<1>)
+TEST_PERF_T1(ctx, uint16x8, splat<1>)
+TEST_PERF_T1(ctx, uint32x4, splat<1>)
+TEST_PERF_T1(ctx, uint64x2, splat<1>)
+TEST_PERF_T1(ctx, float32x4, splat<1>)
+TEST_PERF_T1(ctx, float64x2, splat<1>)
+TEST_PERF_T1(ctx, uint8x32, splat<1>)
+TEST_PERF_T1(ctx, uint16x16, splat<1>)
+TEST_PERF_T1(ctx, uint32x8, splat<1>)
+TEST_PERF_T1(ctx, uint64x4, splat<1>)
+TEST_PERF_T1(ctx, float32x8, splat<1>)
+TEST_PERF_T1(ctx, float64x4, splat<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, splat<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, splat<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, splat<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, splat<1>)
+#endif
+
+// splat16<1>
+TEST_PERF_T1(ctx, uint8x16, splat16<1>)
+TEST_PERF_T1(ctx, uint8x32, splat16<1>)
+
+// splat8<1>
+TEST_PERF_T1(ctx, uint16x8, splat8<1>)
+TEST_PERF_T1(ctx, uint16x16, splat8<1>)
+
+// splat4<1>
+TEST_PERF_T1(ctx, uint32x4, splat4<1>)
+TEST_PERF_T1(ctx, float32x4, splat4<1>)
+TEST_PERF_T1(ctx, uint32x8, splat4<1>)
+TEST_PERF_T1(ctx, float32x8, splat4<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint32x16, splat4<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x16, splat4<1>)
+#endif
+
+// splat2<1>
+TEST_PERF_T1(ctx, uint64x2, splat2<1>)
+TEST_PERF_T1(ctx, float64x2, splat2<1>)
+TEST_PERF_T1(ctx, uint64x4, splat2<1>)
+TEST_PERF_T1(ctx, float64x4, splat2<1>)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, uint64x8, splat2<1>)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, splat2<1>)
+#endif
+
+// to_float32
+TEST_PERF_T1(ctx, int32x4, to_float32)
+TEST_PERF_T1(ctx, int32x8, to_float32)
+TEST_PERF_T1(ctx, float64x4, to_float32)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x16, to_float32)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float64x8, to_float32)
+#endif
+
+// to_float64
+TEST_PERF_T1(ctx, int32x4, to_float64)
+TEST_PERF_T1(ctx, float32x4, to_float64)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, int32x8, to_float64)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T1(ctx, float32x8, to_float64)
+#endif
+
+// to_int16
+TEST_PERF_T1(ctx, int8x16, to_int16)
+TEST_PERF_T1(ctx, uint8x16, to_int16)
+
+// to_int32
+TEST_PERF_T1(ctx, int16x8, to_int32)
+TEST_PERF_T1(ctx, float32x4, to_int32)
+TEST_PERF_T1(ctx, float64x4, to_int32)
+
+// to_int32x8
+#if !SIMDPP_USE_AVX || SIMDPP_USE_AVX2
+TEST_PERF_T1(ctx, float32x8, to_int32x8)
+#endif
+
+// to_int64
+TEST_PERF_T1(ctx, int32x4, to_int64)
+TEST_PERF_T1(ctx, uint32x4, to_int64)
+
+// unzip16_hi
+TEST_PERF_T2(ctx, uint8x16, unzip16_hi)
+TEST_PERF_T2(ctx, uint8x32, unzip16_hi)
+
+// unzip8_hi
+TEST_PERF_T2(ctx, uint16x8, unzip8_hi)
+TEST_PERF_T2(ctx, uint16x16, unzip8_hi)
+
+// unzip4_hi
+TEST_PERF_T2(ctx, uint32x4, unzip4_hi)
+TEST_PERF_T2(ctx, float32x4, unzip4_hi)
+TEST_PERF_T2(ctx, uint32x8, unzip4_hi)
+TEST_PERF_T2(ctx, float32x8, unzip4_hi)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, unzip4_hi)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, unzip4_hi)
+#endif
+
+// unzip2_hi
+TEST_PERF_T2(ctx, uint64x2, unzip2_hi)
+TEST_PERF_T2(ctx, float64x2, unzip2_hi)
+TEST_PERF_T2(ctx, uint64x4, unzip2_hi)
+TEST_PERF_T2(ctx, float64x4, unzip2_hi)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, unzip2_hi)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, unzip2_hi)
+#endif
+
+// unzip16_lo
+TEST_PERF_T2(ctx, uint8x16, unzip16_lo)
+TEST_PERF_T2(ctx, uint8x32, unzip16_lo)
+
+// unzip8_lo
+TEST_PERF_T2(ctx, uint16x8, unzip8_lo)
+TEST_PERF_T2(ctx, uint16x16, unzip8_lo)
+
+// unzip4_lo
+TEST_PERF_T2(ctx, uint32x4, unzip4_lo)
+TEST_PERF_T2(ctx, float32x4, unzip4_lo)
+TEST_PERF_T2(ctx, uint32x8, unzip4_lo)
+TEST_PERF_T2(ctx, float32x8, unzip4_lo)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, unzip4_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, unzip4_lo)
+#endif
+
+// unzip2_lo
+TEST_PERF_T2(ctx, uint64x2, unzip2_lo)
+TEST_PERF_T2(ctx, float64x2, unzip2_lo)
+TEST_PERF_T2(ctx, uint64x4, unzip2_lo)
+TEST_PERF_T2(ctx, float64x4, unzip2_lo)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, unzip2_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, unzip2_lo)
+#endif
+
+// zip16_hi
+TEST_PERF_T2(ctx, int8x16, zip16_hi)
+TEST_PERF_T2(ctx, uint8x16, zip16_hi)
+TEST_PERF_T2(ctx, int8x32, zip16_hi)
+TEST_PERF_T2(ctx, uint8x32, zip16_hi)
+
+// zip8_hi
+TEST_PERF_T2(ctx, int16x8, zip8_hi)
+TEST_PERF_T2(ctx, uint16x8, zip8_hi)
+TEST_PERF_T2(ctx, int16x16, zip8_hi)
+TEST_PERF_T2(ctx, uint16x16, zip8_hi)
+
+// zip4_hi
+TEST_PERF_T2(ctx, int32x4, zip4_hi)
+TEST_PERF_T2(ctx, uint32x4, zip4_hi)
+TEST_PERF_T2(ctx, float32x4, zip4_hi)
+TEST_PERF_T2(ctx, int32x8, zip4_hi)
+TEST_PERF_T2(ctx, uint32x8, zip4_hi)
+TEST_PERF_T2(ctx, float32x8, zip4_hi)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, zip4_hi)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, zip4_hi)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, zip4_hi)
+#endif
+
+// zip2_hi
+TEST_PERF_T2(ctx, int64x2, zip2_hi)
+TEST_PERF_T2(ctx, uint64x2, zip2_hi)
+TEST_PERF_T2(ctx, float64x2, zip2_hi)
+TEST_PERF_T2(ctx, int64x4, zip2_hi)
+TEST_PERF_T2(ctx, uint64x4, zip2_hi)
+TEST_PERF_T2(ctx, float64x4, zip2_hi)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, zip2_hi)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, zip2_hi)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, zip2_hi)
+#endif
+
+// zip16_lo
+TEST_PERF_T2(ctx, int8x16, zip16_lo)
+TEST_PERF_T2(ctx, uint8x16, zip16_lo)
+TEST_PERF_T2(ctx, int8x32, zip16_lo)
+TEST_PERF_T2(ctx, uint8x32, zip16_lo)
+
+// zip8_lo
+TEST_PERF_T2(ctx, int16x8, zip8_lo)
+TEST_PERF_T2(ctx, uint16x8, zip8_lo)
+TEST_PERF_T2(ctx, int16x16, zip8_lo)
+TEST_PERF_T2(ctx, uint16x16, zip8_lo)
+
+// zip4_lo
+TEST_PERF_T2(ctx, int32x4, zip4_lo)
+TEST_PERF_T2(ctx, uint32x4, zip4_lo)
+TEST_PERF_T2(ctx, float32x4, zip4_lo)
+TEST_PERF_T2(ctx, int32x8, zip4_lo)
+TEST_PERF_T2(ctx, uint32x8, zip4_lo)
+TEST_PERF_T2(ctx, float32x8, zip4_lo)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int32x16, zip4_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint32x16, zip4_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float32x16, zip4_lo)
+#endif
+
+// zip2_lo
+TEST_PERF_T2(ctx, int64x2, zip2_lo)
+TEST_PERF_T2(ctx, uint64x2, zip2_lo)
+TEST_PERF_T2(ctx, float64x2, zip2_lo)
+TEST_PERF_T2(ctx, int64x4, zip2_lo)
+TEST_PERF_T2(ctx, uint64x4, zip2_lo)
+TEST_PERF_T2(ctx, float64x4, zip2_lo)
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, int64x8, zip2_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, uint64x8, zip2_lo)
+#endif
+#if SIMDPP_USE_AVX512F
+TEST_PERF_T2(ctx, float64x8, zip2_lo)
+#endif
+
@@ -0,0 +1,236 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_PERF_PERF_REPORT_H
+#define LIBSIMDPP_PERF_PERF_REPORT_H
+
+#include <simdpp/simd.h>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+/// The format of the results printed by the perf programs
+enum class PerfFormat {
+    /// Human readable table
+    TEXT,
+    /// A JSON object with a list of records in the "results" member
+    JSON,
+    /// Comma separated values with a header line
+    CSV
+};
+
+/// A single measurement of a single operation on a single type
+struct PerfRecord {
+    std::string op;
+    std::string type;
+    /// "latency", "throughput" or a benchmark specific mode
+    std::string mode;
+    /// The median cost in core cycles
+    double cycles = 0;
+    double min = 0;
+    double stddev = 0;
+    /// The number of instructions per operation, zero if unknown
+    double instructions = 0;
+};
+
+/// Returns the name and the version of the compiler
+inline std::string perf_compiler_name()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+/** Returns the instruction set the program has been compiled for, e.g.
+    x86_avx2 or x86_avx+x86_fma3. Only the highest of the instruction sets
+    that imply each other is listed.
+
+    The result depends on the instruction set of the translation unit, thus
+    the function has internal linkage.
+*/
+static inline std::string perf_arch_name()
+{
+    std::string r = "null";
+#if SIMDPP_USE_AVX512F
+    r = "x86_avx512f";
+#elif SIMDPP_USE_AVX2
+    r = "x86_avx2";
+#elif SIMDPP_USE_AVX
+    r = "x86_avx";
+#elif SIMDPP_USE_SSE4_1
+    r = "x86_sse4_1";
+#elif SIMDPP_USE_SSSE3
+    r = "x86_ssse3";
+#elif SIMDPP_USE_SSE3
+    r = "x86_sse3";
+#elif SIMDPP_USE_SSE2
+    r = "x86_sse2";
+#elif SIMDPP_USE_NEON_FLT_SP
+    r = "arm_neon_flt_sp";
+#elif SIMDPP_USE_NEON
+    r = "arm_neon";
+#elif SIMDPP_USE_ALTIVEC
+    r = "power_altivec";
+#endif
+#if SIMDPP_USE_FMA3
+    r += "+x86_fma3";
+#endif
+#if SIMDPP_USE_FMA4
+    r += "+x86_fma4";
+#endif
+#if SIMDPP_USE_XOP
+    r += "+x86_xop";
+#endif
+    return r;
+}
+
+/** Writes the results as JSON or CSV. Each record contains all fields,
+    including the architecture, the compiler and the compilation flags, so
+    that the results of several programs can be concatenated and compared
+    with tools/perf_compare.py.
+*/
+class PerfReport {
+public:
+    PerfReport(PerfFormat format, std::ostream& os, const std::string& arch,
+               const std::string& flags) :
+        format_(format), os_(os), arch_(arch), flags_(flags),
+        compiler_(perf_compiler_name()), first_(true)
+    {}
+
+    /** Prints the beginning of the report. @a counter and @a mhz describe
+        the source of the cycle counts.
+    */
+    void begin(const std::string& counter, double mhz)
+    {
+        if (format_ == PerfFormat::JSON) {
+            os_ << "{\n  \"counter\": " << quote(counter)
+                << ",\n  \"core_mhz\": " << number(mhz)
+                << ",\n  \"results\": [";
+        } else if (format_ == PerfFormat::CSV) {
+            os_ << "arch,op,type,mode,cycles,min,stddev,instructions,"
+                   "compiler,flags\n";
+        }
+    }
+
+    /// Sets the architecture of the records added afterwards
+    void set_arch(const std::string& arch)
+    {
+        arch_ = arch;
+    }
+
+    void add(const PerfRecord& r)
+    {
+        if (format_ == PerfFormat::JSON) {
+            os_ << (first_ ? "\n" : ",\n")
+                << "    {\"arch\": " << quote(arch_)
+                << ", \"op\": " << quote(r.op)
+                << ", \"type\": " << quote(r.type)
+                << ", \"mode\": " << quote(r.mode)
+                << ", \"cycles\": " << number(r.cycles)
+                << ", \"min\": " << number(r.min)
+                << ", \"stddev\": " << number(r.stddev)
+                << ", \"instructions\": "
+                << (r.instructions > 0 ? number(r.instructions) : "null")
+                << ", \"compiler\": " << quote(compiler_)
+                << ", \"flags\": " << quote(flags_) << "}";
+        } else if (format_ == PerfFormat::CSV) {
+            os_ << csv(arch_) << ',' << csv(r.op) << ',' << csv(r.type) << ','
+                << csv(r.mode) << ',' << number(r.cycles) << ','
+                << number(r.min) << ',' << number(r.stddev) << ','
+                << (r.instructions > 0 ? number(r.instructions) : "") << ','
+                << csv(compiler_) << ',' << csv(flags_) << '\n';
+        }
+        first_ = false;
+        os_.flush();
+    }
+
+    /// Prints the end of the report
+    void end()
+    {
+        if (format_ == PerfFormat::JSON) {
+            os_ << "\n  ]\n}\n";
+        }
+        os_.flush();
+    }
+
+private:
+    static std::string number(double x)
+    {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.4f", x);
+        return buf;
+    }
+
+    static std::string quote(const std::string& s)
+    {
+        std::string r = "\"";
+        for (char c : s) {
+            if (c == '"' || c == '\\') {
+                r += '\\';
+                r += c;
+            } else if ((unsigned char)c < 0x20) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", (unsigned char)c);
+                r += buf;
+            } else {
+                r += c;
+            }
+        }
+        return r + "\"";
+    }
+
+    // quotes the field if it contains a separator or a quote
+    static std::string csv(const std::string& s)
+    {
+        if (s.find_first_of(",\"\n") == std::string::npos) {
+            return s;
+        }
+        std::string r = "\"";
+        for (char c : s) {
+            if (c == '"') {
+                r += '"';
+            }
+            r += c;
+        }
+        return r + "\"";
+    }
+
+    PerfFormat format_;
+    std::ostream& os_;
+    std::string arch_;
+    std::string flags_;
+    std::string compiler_;
+    bool first_;
+};
+
+#endif
@@ -0,0 +1,327 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Measures how the throughput of streaming kernels scales with the number of
+    threads. The threads are pinned to distinct CPUs and run the same kernel
+    simultaneously, either on private buffers or reading a shared one.
+*/
+
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cycle_counter.h"
+#include "perf_report.h"
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+using namespace simdpp;
+
+// the widest natively supported float vector
+using V = float32<SIMDPP_FAST_FLOAT32_SIZE>;
+using Buffer = std::vector<float, aligned_allocator<float, 64>>;
+using Clock = std::chrono::steady_clock;
+
+struct ScalingOptions {
+    /// The maximum number of threads, all CPUs if zero
+    unsigned threads = 0;
+    /// The size of each buffer in KiB
+    std::size_t size = 8 << 10;
+    /// The duration of each measurement in milliseconds
+    unsigned time = 200;
+};
+
+/*  Each kernel processes @a n floats of @a x and @a y once and returns the
+    number of bytes transferred to or from memory.
+*/
+
+// y = a*x + y. Memory bound
+std::size_t k_axpy(const float* x, float* y, std::size_t n)
+{
+    V a = make_float(1.0001);
+    for (std::size_t i = 0; i < n; i += V::length) {
+        V vx = load(x + i);
+        V vy = load(y + i);
+        store(y + i, add(mul(a, vx), vy));
+    }
+    return n * sizeof(float) * 3;
+}
+
+// y = p(x) where p is a polynomial of degree 8. Compute bound
+std::size_t k_poly8(const float* x, float* y, std::size_t n)
+{
+    V c0 = make_float(0.5), c1 = make_float(0.25), c2 = make_float(0.125);
+    for (std::size_t i = 0; i < n; i += V::length) {
+        V vx = load(x + i);
+        V r = c0;
+        r = add(mul(r, vx), c1);
+        r = add(mul(r, vx), c2);
+        r = add(mul(r, vx), c0);
+        r = add(mul(r, vx), c1);
+        r = add(mul(r, vx), c2);
+        r = add(mul(r, vx), c0);
+        r = add(mul(r, vx), c1);
+        r = add(mul(r, vx), c2);
+        store(y + i, r);
+    }
+    return n * sizeof(float) * 2;
+}
+
+struct Kernel {
+    const char* name;
+    std::size_t (*run)(const float*, float*, std::size_t);
+};
+
+const Kernel kernels[] = {
+    { "axpy", k_axpy },
+    { "poly8", k_poly8 },
+};
+
+/// Returns the list of CPUs the process may run on
+std::vector<int> allowed_cpus()
+{
+    std::vector<int> r;
+#if PERF_HAS_PERF_EVENT && defined(CPU_SET)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            if (CPU_ISSET(i, &set)) {
+                r.push_back(i);
+            }
+        }
+    }
+#endif
+    if (r.empty()) {
+        unsigned n = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < n; ++i) {
+            r.push_back(i);
+        }
+    }
+    return r;
+}
+
+void pin_to_cpu(int cpu)
+{
+#if PERF_HAS_PERF_EVENT && defined(CPU_SET)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void) cpu;
+#endif
+}
+
+struct ThreadResult {
+    /// The bytes transferred per second
+    double bandwidth = 0;
+    /// The average core frequency during the run in MHz, zero if unknown
+    double mhz = 0;
+};
+
+struct RunResult {
+    /// The aggregate bandwidth of all threads in GB/s
+    double bandwidth = 0;
+    /// The lowest average core frequency of all threads in MHz, zero if
+    /// unknown
+    double min_mhz = 0;
+};
+
+/*  Runs kernel @a k on @a nthreads threads for opt.time milliseconds. If
+    @a shared is true, all threads read the same input buffer.
+*/
+RunResult run_threads(const ScalingOptions& opt, const Kernel& k,
+                      const std::vector<int>& cpus, unsigned nthreads,
+                      bool shared)
+{
+    std::size_t n = opt.size * 1024 / sizeof(float);
+    Buffer shared_x;
+    if (shared) {
+        shared_x.assign(n, 0.5f);
+    }
+
+    std::atomic<unsigned> ready(0);
+    std::atomic<bool> go(false), stop(false);
+    std::vector<ThreadResult> results(nthreads);
+    std::vector<std::thread> threads;
+
+    for (unsigned t = 0; t < nthreads; ++t) {
+        threads.emplace_back([&, t]() {
+            pin_to_cpu(cpus[t % cpus.size()]);
+            // the buffers are allocated and touched by the thread itself, so
+            // that they are local to its NUMA node
+            Buffer x, y(n, 1.0f);
+            if (!shared) {
+                x.assign(n, 0.5f);
+            }
+            const float* px = shared ? shared_x.data() : x.data();
+            k.run(px, y.data(), n);
+
+            // the cycles are counted only by the hardware counters, the other
+            // sources don't measure the frequency
+            CycleCounter counter(1, true);
+            bool count_cycles =
+                    counter.source() == CycleCounter::SOURCE_PERF_EVENT;
+
+            ready++;
+            while (!go) {}
+
+            std::size_t bytes = 0;
+            auto begin = Clock::now();
+            if (count_cycles) {
+                counter.start();
+            }
+            while (!stop) {
+                bytes += k.run(px, y.data(), n);
+            }
+            CounterSample s;
+            if (count_cycles) {
+                s = counter.stop();
+            }
+            std::chrono::duration<double, std::micro> d = Clock::now() - begin;
+            results[t].bandwidth = bytes / d.count() * 1e6;
+            results[t].mhz = count_cycles ? s.cycles / d.count() : 0;
+        });
+    }
+
+    while (ready != nthreads) {
+        std::this_thread::yield();
+    }
+    go = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(opt.time));
+    stop = true;
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    RunResult r;
+    for (const ThreadResult& tr : results) {
+        r.bandwidth += tr.bandwidth / 1e9;
+        if (tr.mhz > 0 && (r.min_mhz == 0 || tr.mhz < r.min_mhz)) {
+            r.min_mhz = tr.mhz;
+        }
+    }
+    return r;
+}
+
+void print_usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " [options]\n"
+                 "  --threads=N  maximum number of threads (default: all CPUs)\n"
+                 "  --size=N     size of each buffer in KiB (default 8192)\n"
+                 "  --time=N     duration of each measurement in ms (default 200)\n";
+}
+
+bool parse_options(int argc, char** argv, ScalingOptions& opt)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            std::size_t len = std::strlen(prefix);
+            return arg.compare(0, len, prefix) == 0 ? argv[i] + len : nullptr;
+        };
+        if (const char* v = value("--threads=")) {
+            opt.threads = std::strtoul(v, nullptr, 10);
+        } else if (const char* v = value("--size=")) {
+            opt.size = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--time=")) {
+            opt.time = std::max(1ul, std::strtoul(v, nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    ScalingOptions opt;
+    if (!parse_options(argc, argv, opt)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<int> cpus = allowed_cpus();
+    unsigned max_threads = opt.threads ? opt.threads : cpus.size();
+
+    // 1, 2, 4, ... threads and the maximum
+    std::vector<unsigned> counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) {
+        counts.push_back(t);
+    }
+    counts.push_back(max_threads);
+
+    std::cout << "vector: " << V::length_bytes * 8 << "-bit, compiler: "
+              << perf_compiler_name() << ", CPUs: " << cpus.size()
+              << ", buffer: " << opt.size << " KiB per thread\n"
+              << "efficiency is the per-thread bandwidth relative to one "
+                 "thread, MHz is the\nlowest average core clock of the "
+                 "threads (needs perf_event_open)\n\n";
+
+    std::cout << std::setw(8) << "kernel" << std::setw(9) << "buffers"
+              << std::setw(9) << "threads" << std::setw(10) << "GB/s"
+              << std::setw(12) << "GB/s/thread" << std::setw(12)
+              << "efficiency" << std::setw(8) << "MHz" << '\n'
+              << std::fixed;
+
+    for (const Kernel& k : kernels) {
+        for (bool shared : { false, true }) {
+            double single = 0;
+            for (unsigned t : counts) {
+                RunResult r = run_threads(opt, k, cpus, t, shared);
+                if (t == 1) {
+                    single = r.bandwidth;
+                }
+                std::cout << std::setw(8) << k.name
+                          << std::setw(9) << (shared ? "shared" : "private")
+                          << std::setw(9) << t
+                          << std::setprecision(2)
+                          << std::setw(10) << r.bandwidth
+                          << std::setw(12) << r.bandwidth / t
+                          << std::setprecision(1)
+                          << std::setw(11) << r.bandwidth / t / single * 100
+                          << '%';
+                if (r.min_mhz > 0) {
+                    std::cout << std::setprecision(0) << std::setw(8)
+                              << r.min_mhz;
+                } else {
+                    std::cout << std::setw(8) << "-";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+}
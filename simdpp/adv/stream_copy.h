@@ -0,0 +1,89 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ADV_STREAM_COPY_H
+#define LIBSIMDPP_SIMDPP_ADV_STREAM_COPY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/stream.h>
+#include <simdpp/core/stream_load.h>
+#include <cstddef>
+#include <cstring>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Copies @a size bytes from @a src to @a dst without polluting the caches,
+    if possible. The data is copied in 64-byte blocks using stream_load()
+    and stream(). The remaining bytes, if any, are copied with memcpy().
+
+    Both @a dst and @a src must be aligned to 64 bytes. The memory regions
+    must not overlap.
+
+    If at least one block is copied, then on SSE4.1 and later a memory fence
+    is issued before the first streaming load so that it is ordered after the
+    preceding stores. On x86 a store fence is issued after the last streaming
+    store so that the copied data is visible to the other processors before
+    any subsequent store.
+*/
+inline void stream_copy(void* dst, const void* src, std::size_t size)
+{
+    char* d = reinterpret_cast<char*>(dst);
+    const char* s = reinterpret_cast<const char*>(src);
+
+    if (size < 64) {
+        std::memcpy(d, s, size);
+        return;
+    }
+
+#if SIMDPP_USE_SSE4_1
+    _mm_mfence();
+#endif
+    for (; size >= 64; size -= 64) {
+        uint32<16> v = stream_load<uint32<16>>(s);
+        stream(d, v);
+        s += 64;
+        d += 64;
+    }
+    std::memcpy(d, s, size);
+#if SIMDPP_USE_SSE2
+    _mm_sfence();
+#endif
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
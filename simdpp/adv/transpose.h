@@ -74,6 +74,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline void transpose2(uint16x8& a0, uint16x8& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_NULL
     null::transpose2(a0, a1);
 #elif SIMDPP_USE_SSE2
@@ -98,6 +99,7 @@ inline void transpose2(uint16x8& a0, uint16x8& a1)
 
 inline void transpose2(int16x8& a0, int16x8& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
     uint16x8 b0, b1;
     b0 = a0; b1 = a1;
     transpose2(b0, b1);
@@ -106,6 +108,7 @@ inline void transpose2(int16x8& a0, int16x8& a1)
 
 inline void transpose2(uint16x16& a0, uint16x16& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_AVX2
     uint32x8 b0, b1;
     b0 = zip8_lo(a0, a1);
@@ -120,6 +123,7 @@ inline void transpose2(uint16x16& a0, uint16x16& a1)
 
 inline void transpose2(int16x16& a0, int16x16& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
     uint16x16 b0, b1;
     b0 = a0; b1 = a1;
     transpose2(b0, b1);
@@ -150,6 +154,7 @@ inline void transpose2(int16x16& a0, int16x16& a1)
 */
 inline void transpose2(uint32x4& a0, uint32x4& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_NULL
     null::transpose2(a0, a1);
 #elif SIMDPP_USE_SSE2
@@ -174,6 +179,7 @@ inline void transpose2(uint32x4& a0, uint32x4& a1)
 
 inline void transpose2(int32x4& a0, int32x4& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
     uint32x4 b0, b1;
     b0 = a0; b1 = a1;
     transpose2(b0, b1);
@@ -182,6 +188,7 @@ inline void transpose2(int32x4& a0, int32x4& a1)
 
 inline void transpose2(uint32x8& a0, uint32x8& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_AVX2
     uint64x4 b0, b1;
     b0 = zip4_lo(a0, a1);
@@ -196,6 +203,7 @@ inline void transpose2(uint32x8& a0, uint32x8& a1)
 
 inline void transpose2(int32x8& a0, int32x8& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
     uint32x8 b0, b1;
     b0 = a0; b1 = a1;
     transpose2(b0, b1);
@@ -226,6 +234,7 @@ inline void transpose2(int32x8& a0, int32x8& a1)
 */
 inline void transpose2(uint64x2& a0, uint64x2& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_NULL
     null::transpose2(a0, a1);
 #elif SIMDPP_USE_SSE2
@@ -247,6 +256,7 @@ inline void transpose2(uint64x2& a0, uint64x2& a1)
 
 inline void transpose2(int64x2& a0, int64x2& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
     uint64x2 b0, b1;
     b0 = a0; b1 = a1;
     transpose2(b0, b1);
@@ -255,6 +265,7 @@ inline void transpose2(int64x2& a0, int64x2& a1)
 
 inline void transpose2(uint64x4& a0, uint64x4& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_AVX2
     uint64x4 b0;
     b0 = zip2_lo(a0, a1);
@@ -268,6 +279,7 @@ inline void transpose2(uint64x4& a0, uint64x4& a1)
 
 inline void transpose2(int64x4& a0, int64x4& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
     uint64x4 b0, b1;
     b0 = a0; b1 = a1;
     transpose2(b0, b1);
@@ -298,6 +310,7 @@ inline void transpose2(int64x4& a0, int64x4& a1)
 */
 inline void transpose2(float32x4& a0, float32x4& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_NULL
     null::transpose2(a0, a1);
 #elif SIMDPP_USE_SSE2
@@ -322,6 +335,7 @@ inline void transpose2(float32x4& a0, float32x4& a1)
 
 inline void transpose2(float32x8& a0, float32x8& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_AVX
     float64x4 b0, b1;
     b0 = bit_cast<float64x4>(zip4_lo(a0, a1));
@@ -357,6 +371,7 @@ inline void transpose2(float32x8& a0, float32x8& a1)
 */
 inline void transpose2(float64x2& a0, float64x2& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
     null::transpose2(a0, a1);
 #elif SIMDPP_USE_SSE2
@@ -374,6 +389,7 @@ inline void transpose2(float64x2& a0, float64x2& a1)
 
 inline void transpose2(float64x4& a0, float64x4& a1)
 {
+    SIMDPP_PROFILE_OP(transpose2, a0);
 #if SIMDPP_USE_AVX
     float64x4 b0;
     b0 = zip2_lo(a0, a1);
@@ -415,6 +431,7 @@ void transpose4(uint32x4& a0, uint32x4& a1,
 inline void transpose4(uint8x16& a0, uint8x16& a1,
                        uint8x16& a2, uint8x16& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     // [a0,a1,a2,a3 ... ]
     // [b0,b1,b2,b3 ... ]
     // [c0,c1,c2,c3 ... ]
@@ -459,6 +476,7 @@ inline void transpose4(uint8x16& a0, uint8x16& a1,
 inline void transpose4(int8x16& a0, int8x16& a1,
                        int8x16& a2, int8x16& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     uint8x16 b0, b1, b2, b3;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3;
     transpose4(b0, b1, b2, b3);
@@ -471,6 +489,7 @@ inline void transpose4(uint32x8& a0, uint32x8& a1,
 inline void transpose4(uint8x32& a0, uint8x32& a1,
                        uint8x32& a2, uint8x32& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_AVX2
     uint16x16 b0, b1, b2, b3;
     b0 = zip16_lo(a0, a1);
@@ -496,6 +515,7 @@ inline void transpose4(uint8x32& a0, uint8x32& a1,
 inline void transpose4(int8x32& a0, int8x32& a1,
                        int8x32& a2, int8x32& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     uint8x32 b0, b1, b2, b3;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3;
     transpose4(b0, b1, b2, b3);
@@ -530,6 +550,7 @@ inline void transpose4(int8x32& a0, int8x32& a1,
 inline void transpose4(uint16x8& a0, uint16x8& a1,
                        uint16x8& a2, uint16x8& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_NULL
     null::transpose4(a0, a1, a2, a3);
 #elif SIMDPP_USE_SSE2
@@ -573,6 +594,7 @@ inline void transpose4(uint16x8& a0, uint16x8& a1,
 inline void transpose4(int16x8& a0, int16x8& a1,
                        int16x8& a2, int16x8& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     uint16x8 b0, b1, b2, b3;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3;
     transpose4(b0, b1, b2, b3);
@@ -583,6 +605,7 @@ inline void transpose4(int16x8& a0, int16x8& a1,
 inline void transpose4(uint16x16& a0, uint16x16& a1,
                        uint16x16& a2, uint16x16& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_AVX2
     uint32x8 b0, b1, b2, b3;
     uint64x4 c0, c1, c2, c3;
@@ -609,6 +632,7 @@ inline void transpose4(uint16x16& a0, uint16x16& a1,
 inline void transpose4(int16x16& a0, int16x16& a1,
                        int16x16& a2, int16x16& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     uint16x16 b0, b1, b2, b3;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3;
     transpose4(b0, b1, b2, b3);
@@ -677,6 +701,7 @@ void sse_transpose4x32_impl(V& a0, V& a1, V& a2, V& a3)
 inline void transpose4(uint32x4& a0, uint32x4& a1,
                        uint32x4& a2, uint32x4& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_NULL
     null::transpose4(a0, a1, a2, a3);
 #elif SIMDPP_USE_SSE2
@@ -695,6 +720,7 @@ inline void transpose4(uint32x4& a0, uint32x4& a1,
 inline void transpose4(int32x4& a0, int32x4& a1,
                        int32x4& a2, int32x4& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     uint32x4 b0, b1, b2, b3;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3;
     transpose4(b0, b1, b2, b3);
@@ -704,6 +730,7 @@ inline void transpose4(int32x4& a0, int32x4& a1,
 inline void transpose4(uint32x8& a0, uint32x8& a1,
                        uint32x8& a2, uint32x8& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_AVX2
     detail::sse_transpose4x32_impl(a0, a1, a2, a3);
 #else
@@ -715,6 +742,7 @@ inline void transpose4(uint32x8& a0, uint32x8& a1,
 inline void transpose4(int32x8& a0, int32x8& a1,
                        int32x8& a2, int32x8& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
     uint32x8 b0, b1, b2, b3;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3;
     transpose4(b0, b1, b2, b3);
@@ -749,6 +777,7 @@ inline void transpose4(int32x8& a0, int32x8& a1,
 inline void transpose4(float32x4& a0, float32x4& a1,
                        float32x4& a2, float32x4& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_SSE2
     detail::sse_transpose4x32_impl(a0, a1, a2, a3);
 #else
@@ -762,6 +791,7 @@ inline void transpose4(float32x4& a0, float32x4& a1,
 inline void transpose4(float32x8& a0, float32x8& a1,
                        float32x8& a2, float32x8& a3)
 {
+    SIMDPP_PROFILE_OP(transpose4, a0);
 #if SIMDPP_USE_AVX
     detail::sse_transpose4x32_impl(a0, a1, a2, a3);
 #else
@@ -799,6 +829,7 @@ inline void transpose8(uint8x16& a0, uint8x16& a1,
                        uint8x16& a4, uint8x16& a5,
                        uint8x16& a6, uint8x16& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
 #if SIMDPP_USE_NULL
     null::transpose8(a0, a1, a2, a3, a4, a5, a6, a7);
 #elif SIMDPP_USE_SSE2
@@ -888,6 +919,7 @@ inline void transpose8(int8x16& a0, int8x16& a1,
                        int8x16& a4, int8x16& a5,
                        int8x16& a6, int8x16& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
     uint8x16 b0, b1, b2, b3, b4, b5, b6, b7;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3; b4 = a4; b5 = a5; b6 = a6; b7 = a7;
     transpose8(b0, b1, b2, b3, b4, b5, b6, b7);
@@ -900,6 +932,7 @@ inline void transpose8(uint8x32& a0, uint8x32& a1,
                        uint8x32& a4, uint8x32& a5,
                        uint8x32& a6, uint8x32& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
 #if SIMDPP_USE_AVX2
     detail::partial_transpose8(a0, a1, a2, a3, a4, a5, a6, a7);
 
@@ -926,6 +959,7 @@ inline void transpose8(int8x32& a0, int8x32& a1,
                        int8x32& a4, int8x32& a5,
                        int8x32& a6, int8x32& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
     uint8x32 b0, b1, b2, b3, b4, b5, b6, b7;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3; b4 = a4; b5 = a5; b6 = a6; b7 = a7;
     transpose8(b0, b1, b2, b3, b4, b5, b6, b7);
@@ -960,6 +994,7 @@ inline void transpose8(uint16x8& a0, uint16x8& a1,
                        uint16x8& a4, uint16x8& a5,
                        uint16x8& a6, uint16x8& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
     /*
     [a0,a1,a2,a3,a4,a5,a6,a7]
     [b0,b1,b2,b3,b4,b5,b6,b7]
@@ -1063,6 +1098,7 @@ inline void transpose8(int16x8& a0, int16x8& a1,
                        int16x8& a4, int16x8& a5,
                        int16x8& a6, int16x8& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
     uint16x8 b0, b1, b2, b3, b4, b5, b6, b7;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3; b4 = a4; b5 = a5; b6 = a6; b7 = a7;
     transpose8(b0, b1, b2, b3, b4, b5, b6, b7);
@@ -1074,6 +1110,7 @@ inline void transpose8(uint16x16& a0, uint16x16& a1,
                        uint16x16& a4, uint16x16& a5,
                        uint16x16& a6, uint16x16& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
 #if SIMDPP_USE_AVX2
     uint32x8 b0, b1, b2, b3, b4, b5, b6, b7;
     b0 = zip8_lo(a0, a1);
@@ -1115,6 +1152,7 @@ inline void transpose8(int16x16& a0, int16x16& a1,
                        int16x16& a4, int16x16& a5,
                        int16x16& a6, int16x16& a7)
 {
+    SIMDPP_PROFILE_OP(transpose8, a0);
     uint16x16 b0, b1, b2, b3, b4, b5, b6, b7;
     b0 = a0; b1 = a1; b2 = a2; b3 = a3; b4 = a4; b5 = a5; b6 = a6; b7 = a7;
     transpose8(b0, b1, b2, b3, b4, b5, b6, b7);
@@ -69,6 +69,7 @@ typename detail::get_expr2_nomask<V1, V2, void>::empty
     align16(const any_vec8<N,V1>& lower,
             const any_vec8<N,V2>& upper)
 {
+    SIMDPP_PROFILE_OP(align16, lower);
     static_assert(shift <= 16, "Shift out of bounds");
     if (shift == 0) return lower.vec().eval();
     if (shift == 16) return upper.vec().eval();
@@ -107,6 +108,7 @@ typename detail::get_expr2_nomask<V1, V2, void>::empty
     align8(const any_vec16<N,V1>& lower,
            const any_vec16<N,V2>& upper)
 {
+    SIMDPP_PROFILE_OP(align8, lower);
     static_assert(shift <= 8, "Shift out of bounds");
     if (shift == 0) return lower.vec().eval();
     if (shift == 8) return upper.vec().eval();
@@ -157,6 +159,7 @@ typename detail::get_expr2_nomask<V1, V2, void>::empty
     align4(const any_vec32<N,V1>& lower,
            const any_vec32<N,V2>& upper)
 {
+    SIMDPP_PROFILE_OP(align4, lower);
     static_assert(shift <= 4, "Shift out of bounds");
     if (shift == 0) return lower.vec().eval();
     if (shift == 4) return upper.vec().eval();
@@ -205,6 +208,7 @@ typename detail::get_expr2_nomask<V1, V2, void>::empty
     align2(const any_vec64<N,V1>& lower,
            const any_vec64<N,V2>& upper)
 {
+    SIMDPP_PROFILE_OP(align2, lower);
     static_assert(shift <= 2, "Shift out of bounds");
     if (shift == 0) return lower.vec().eval();
     if (shift == 2) return upper.vec().eval();
@@ -31,6 +31,7 @@
 #include <memory>
 #include <cstddef>
 #include <cstdint>
+#include <stdexcept>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
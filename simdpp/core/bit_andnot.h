@@ -57,7 +57,9 @@ template<unsigned N, class V1, class V2>
 typename detail::get_expr2<V1, V2, void>::empty
         bit_andnot(const any_vec<N,V1>& a, const any_vec<N,V2>& b)
 {
-    typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
+    SIMDPP_PROFILE_OP(bit_andnot, a);
+    typename detail::get_expr2_nosign<V1, V2, void>::type ra;
+    typename detail::get_expr_bitop_mask<V1, V2>::type rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
     return detail::insn::i_bit_andnot(ra, rb);
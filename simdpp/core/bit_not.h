@@ -56,6 +56,7 @@ template<unsigned N, class V>
 typename detail::get_expr<V, void>::empty
     bit_not(const any_vec<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(bit_not, a);
     typename detail::get_expr_nosign<V, void>::type ra;
     ra = a.vec().eval();
     return detail::insn::i_bit_not(ra);
@@ -65,11 +66,13 @@ typename detail::get_expr<V, void>::empty
 template<unsigned N, class E>
 mask_int32<N, expr_bit_not<mask_int32<N,E>>> bit_not(mask_int32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(bit_not, a);
     return { { a }, 0 };
 }
 template<unsigned N, class E>
 mask_int64<N, expr_bit_not<mask_int64<N,E>>> bit_not(mask_int64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(bit_not, a);
     return { { a }, 0 };
 }
 /// @}
@@ -78,11 +81,13 @@ mask_int64<N, expr_bit_not<mask_int64<N,E>>> bit_not(mask_int64<N,E> a)
 template<unsigned N, class E>
 mask_float32<N, expr_bit_not<mask_float32<N,E>>> bit_not(mask_float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(bit_not, a);
     return { { a }, 0 };
 }
 template<unsigned N, class E>
 mask_float64<N, expr_bit_not<mask_float64<N,E>>> bit_not(mask_float64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(bit_not, a);
     return { { a }, 0 };
 }
 /// @}*/
@@ -56,6 +56,7 @@ template<unsigned N, class V1, class V2>
 typename detail::get_expr2<V1, V2, void>::empty
         bit_or(const any_vec<N,V1>& a, const any_vec<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(bit_or, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -186,10 +186,13 @@ typename detail::get_expr_blend<V1, V2, V3>::type
     blend(const any_vec<N,V1>& on, const any_vec<N,V2>& off,
           const any_vec<N,V3>& mask)
 {
+    SIMDPP_PROFILE_OP(blend, on);
     using expr = detail::get_expr_blend<V1, V2, V3>;
+    // the mask is evaluated first: mask expressions are convertible both to
+    // the mask and to the vector type, which is ambiguous
     return { { typename expr::v1_type(on.vec()),
                typename expr::v2_type(off.vec()),
-               typename expr::v3_type(mask.vec()) }, 0 };
+               typename expr::v3_type(mask.vec().eval()) }, 0 };
 }
 
 /// @}
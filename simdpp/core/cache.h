@@ -71,6 +71,98 @@ inline void prefetch_write(const void* ptr)
     (void) ptr;
 }
 
+/// Locality hints for prefetch_read() and prefetch_write()
+enum class prefetch_hint {
+    /// Prefetch to all levels of the cache hierarchy (T0)
+    l1,
+    /// Prefetch to level 2 cache and higher (T1)
+    l2,
+    /// Prefetch to level 3 cache and higher (T2)
+    l3,
+    /// Prefetch to a non-temporal buffer close to the processor, to be read
+    /// once. Minimizes the pollution of the caches (NTA)
+    nt
+};
+
+namespace detail {
+
+// the temporal locality argument of __builtin_prefetch
+constexpr int prefetch_locality(prefetch_hint h)
+{
+    return h == prefetch_hint::l1 ? 3 :
+           h == prefetch_hint::l2 ? 2 :
+           h == prefetch_hint::l3 ? 1 : 0;
+}
+
+#if SIMDPP_USE_SSE2
+template<prefetch_hint H>
+void i_prefetch_sse(const char* p)
+{
+    switch (H) {
+    case prefetch_hint::l1: _mm_prefetch(p, _MM_HINT_T0); break;
+    case prefetch_hint::l2: _mm_prefetch(p, _MM_HINT_T1); break;
+    case prefetch_hint::l3: _mm_prefetch(p, _MM_HINT_T2); break;
+    case prefetch_hint::nt: _mm_prefetch(p, _MM_HINT_NTA); break;
+    }
+}
+#endif
+
+} // namespace detail
+
+/** Prefetches data for reading to the cache level given by @a H.
+
+    @code
+    prefetch_read<prefetch_hint::l2>(ptr);
+    @endcode
+
+    Currently supported instruction sets:
+
+    * SSE2-AVX2
+    * NEON (GCC)
+
+    If the current architecture is not supported, the function does not have
+    any effects.
+
+    @param ptr pointer to the data to prefetch
+*/
+template<prefetch_hint H>
+void prefetch_read(const void* ptr)
+{
+#if SIMDPP_USE_SSE2
+    detail::i_prefetch_sse<H>((const char*)ptr);
+#elif SIMDPP_USE_NEON
+#if __GNUC__
+    __builtin_prefetch(ptr, 0, detail::prefetch_locality(H));
+#endif
+#endif
+    (void) ptr;
+}
+
+/** Prefetches data for writing to the cache level given by @a H.
+
+    Currently supported instruction sets:
+
+    * SSE2-AVX2
+    * NEON (GCC)
+
+    If the current architecture is not supported, the function does not have
+    any effects.
+
+    @param ptr pointer to the data to prefetch
+*/
+template<prefetch_hint H>
+void prefetch_write(const void* ptr)
+{
+#if SIMDPP_USE_SSE2
+    detail::i_prefetch_sse<H>((const char*)ptr);
+#elif SIMDPP_USE_NEON
+#if __GNUC__
+    __builtin_prefetch(ptr, 1, detail::prefetch_locality(H));
+#endif
+#endif
+    (void) ptr;
+}
+
 /// @}
 
 
@@ -56,6 +56,7 @@ template<unsigned N, class V1, class V2>
 mask_int8<N, mask_int8<N>> cmp_eq(const any_int8<N,V1>& a,
                                   const any_int8<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_eq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -77,6 +78,7 @@ template<unsigned N, class V1, class V2>
 mask_int16<N, mask_int16<N>> cmp_eq(const any_int16<N,V1>& a,
                                     const any_int16<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_eq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -98,6 +100,7 @@ template<unsigned N, class V1, class V2>
 mask_int32<N, mask_int32<N>> cmp_eq(const any_int32<N,V1>& a,
                                     const any_int32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_eq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -128,6 +131,7 @@ template<unsigned N, class V1, class V2>
 mask_int64<N, mask_int64<N>> cmp_eq(const any_int64<N,V1>& a,
                                     const any_int64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_eq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -149,6 +153,7 @@ template<unsigned N, class V1, class V2>
 mask_float32<N, mask_float32<N>> cmp_eq(const any_float32<N,V1>& a,
                                         const any_float32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_eq, a);
     return detail::insn::i_cmp_eq(a.vec().eval(), b.vec().eval());
 }
 
@@ -171,6 +176,7 @@ template<unsigned N, class V1, class V2>
 mask_float64<N, mask_float64<N>> cmp_eq(const any_float64<N,V1>& a,
                                         const any_float64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_eq, a);
     return detail::insn::i_cmp_eq(a.vec().eval(), b.vec().eval());
 }
 
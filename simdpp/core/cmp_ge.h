@@ -57,6 +57,7 @@ template<unsigned N, class E1, class E2>
 mask_float32<N, mask_float32<N>> cmp_ge(float32<N,E1> a,
                                         float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_ge, a);
     return detail::insn::i_cmp_ge(a.eval(), b.eval());
 }
 /// @}
@@ -81,6 +82,7 @@ template<unsigned N, class E1, class E2>
 mask_float64<N, mask_float64<N>> cmp_ge(float64<N,E1> a,
                                         float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_ge, a);
     return detail::insn::i_cmp_ge(a.eval(), b.eval());
 }
 /// @}
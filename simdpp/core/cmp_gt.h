@@ -55,6 +55,7 @@ template<unsigned N, class E1, class E2>
 mask_int8<N, mask_int8<N>> cmp_gt(int8<N,E1> a,
                                   int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -80,6 +81,7 @@ template<unsigned N, class E1, class E2>
 mask_int8<N, mask_int8<N>> cmp_gt(uint8<N,E1> a,
                                   uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -98,6 +100,7 @@ template<unsigned N, class E1, class E2>
 mask_int16<N, mask_int16<N>> cmp_gt(int16<N,E1> a,
                                     int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -122,6 +125,7 @@ template<unsigned N, class E1, class E2>
 mask_int16<N, mask_int16<N>> cmp_gt(uint16<N,E1> a,
                                     uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -141,6 +145,7 @@ template<unsigned N, class E1, class E2>
 mask_int32<N, mask_int32<N>> cmp_gt(int32<N,E1> a,
                                     int32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -165,6 +170,7 @@ template<unsigned N, class E1, class E2>
 mask_int32<N, mask_int32<N>> cmp_gt(uint32<N,E1> a,
                                     uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -183,6 +189,7 @@ template<unsigned N, class E1, class E2>
 mask_float32<N, mask_float32<N>> cmp_gt(float32<N,E1> a,
                                         float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
@@ -205,6 +212,7 @@ template<unsigned N, class E1, class E2>
 mask_float64<N, mask_float64<N>> cmp_gt(float64<N,E1> a,
                                         float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_gt, a);
     return detail::insn::i_cmp_gt(a.eval(), b.eval());
 }
 
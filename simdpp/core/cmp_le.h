@@ -56,6 +56,7 @@ template<unsigned N, class E1, class E2>
 mask_float32<N, mask_float32<N>> cmp_le(float32<N,E1> a,
                                         float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_le, a);
     return detail::insn::i_cmp_le(a.eval(), b.eval());
 }
 /// @}
@@ -80,6 +81,7 @@ template<unsigned N, class E1, class E2>
 mask_float64<N, mask_float64<N>> cmp_le(float64<N,E1> a,
                                         float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_le, a);
     return detail::insn::i_cmp_le(a.eval(), b.eval());
 }
 /// @}
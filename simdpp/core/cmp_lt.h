@@ -56,6 +56,7 @@ template<unsigned N, class E1, class E2>
 mask_int8<N, mask_int8<N>> cmp_lt(int8<N,E1> a,
                                   int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -80,6 +81,7 @@ template<unsigned N, class E1, class E2>
 mask_int8<N, mask_int8<N>> cmp_lt(uint8<N,E1> a,
                                   uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -98,6 +100,7 @@ template<unsigned N, class E1, class E2>
 mask_int16<N, mask_int16<N>> cmp_lt(int16<N,E1> a,
                                     int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -122,6 +125,7 @@ template<unsigned N, class E1, class E2>
 mask_int16<N, mask_int16<N>> cmp_lt(uint16<N,E1> a,
                                     uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -140,6 +144,7 @@ template<unsigned N, class E1, class E2>
 mask_int32<N, mask_int32<N>> cmp_lt(int32<N,E1> a,
                                     int32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -164,6 +169,7 @@ template<unsigned N, class E1, class E2>
 mask_int32<N, mask_int32<N>> cmp_lt(uint32<N,E1> a,
                                     uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -182,6 +188,7 @@ template<unsigned N, class E1, class E2>
 mask_float32<N, mask_float32<N>> cmp_lt(float32<N,E1> a,
                                         float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -204,6 +211,7 @@ template<unsigned N, class E1, class E2>
 mask_float64<N, mask_float64<N>> cmp_lt(float64<N,E1> a,
                                         float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(cmp_lt, a);
     return detail::insn::i_cmp_lt(a.eval(), b.eval());
 }
 
@@ -62,6 +62,7 @@ template<unsigned N, class V1, class V2>
 mask_int8<N, mask_int8<N>> cmp_neq(const any_int8<N,V1>& a,
                                    const any_int8<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_neq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -89,6 +90,7 @@ template<unsigned N, class V1, class V2>
 mask_int16<N, mask_int16<N>> cmp_neq(const any_int16<N,V1>& a,
                                      const any_int16<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_neq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -116,6 +118,7 @@ template<unsigned N, class V1, class V2>
 mask_int32<N, mask_int32<N>> cmp_neq(const any_int32<N,V1>& a,
                                      const any_int32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_neq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -148,6 +151,7 @@ template<unsigned N, class V1, class V2>
 mask_int64<N, mask_int64<N>> cmp_neq(const any_int64<N,V1>& a,
                                      const any_int64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_neq, a);
     typename detail::get_expr2_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -173,6 +177,7 @@ template<unsigned N, class V1, class V2>
 mask_float32<N, mask_float32<N>> cmp_neq(const any_float32<N,V1>& a,
                                          const any_float32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_neq, a);
     return detail::insn::i_cmp_neq(a.vec().eval(), b.vec().eval());
 }
 
@@ -195,6 +200,7 @@ template<unsigned N, class V1, class V2>
 mask_float64<N, mask_float64<N>> cmp_neq(const any_float64<N,V1>& a,
                                          const any_float64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(cmp_neq, a);
     return detail::insn::i_cmp_neq(a.vec().eval(), b.vec().eval());
 }
 
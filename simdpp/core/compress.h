@@ -0,0 +1,88 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/compress.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Moves the elements for which @a mask is set to the beginning of the
+    vector, preserving their order. The rest of the elements are set to
+    zero.
+
+    @code
+    j = 0
+    for i in [0..N-1]:
+        if mask[i]:
+            r[j++] = a[i]
+    r[j..N-1] = 0
+    @endcode
+
+    @a mask must be of the mask type of @a a. Use store_compress() to store
+    the selected elements to memory.
+
+    On SSSE3 and later the elements of 128-bit vectors are moved with a
+    byte shuffle looked up in a table. On AVX2 the 32-bit and 64-bit
+    elements of 256-bit vectors are moved with a lane permute, the 8-bit and
+    16-bit elements are processed per 128-bit half. On AVX512F the 32-bit and
+    64-bit elements of 512-bit vectors are moved with the dedicated compress
+    instructions.
+
+    @novec{SSE2, NEON, ALTIVEC}
+*/
+template<unsigned N, class V, unsigned B, class M>
+typename detail::get_expr_nomask<V, void>::empty
+    compress(const any_vec<N,V>& a, const any_vec<B,M>& mask)
+{
+    SIMDPP_PROFILE_OP(compress, a);
+    static_assert(!is_mask<V>::value, "Mask types can not be compressed");
+    using R = typename detail::get_expr_nosign<V, void>::type;
+    R ra = a.vec().eval();
+    typename R::mask_vector_type m = mask.vec().eval();
+    R r;
+    detail::insn::i_compress(r, ra, m);
+    return r;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -62,6 +62,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned id>
 uint8_t extract(uint8x16 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     static_assert(id < 16, "index out of bounds");
 #if SIMDPP_USE_NULL
     return a.el(id);
@@ -86,6 +87,7 @@ uint8_t extract(uint8x16 a)
 template<unsigned id>
 int8_t extract(int8x16 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     return extract<id>(uint8x16(a));
 }
 /// @}
@@ -104,6 +106,7 @@ int8_t extract(int8x16 a)
 template<unsigned id>
 uint16_t extract(uint16x8 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     static_assert(id < 8, "index out of bounds");
 #if SIMDPP_USE_NULL
     return a.el(id);
@@ -121,6 +124,7 @@ uint16_t extract(uint16x8 a)
 template<unsigned id>
 int16_t extract(int16x8 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     return extract<id>(uint16x8(a));
 }
 /// @}
@@ -140,6 +144,7 @@ int16_t extract(int16x8 a)
 template<unsigned id>
 uint32_t extract(uint32x4 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     static_assert(id < 4, "index out of bounds");
 #if SIMDPP_USE_NULL
     return a.el(id);
@@ -160,6 +165,7 @@ uint32_t extract(uint32x4 a)
 template<unsigned id>
 int32_t extract(int32x4 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     return extract<id>(uint32x4(a));
 }
 /// @}
@@ -182,6 +188,7 @@ int32_t extract(int32x4 a)
 template<unsigned id>
 uint64_t extract(uint64x2 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     static_assert(id < 2, "index out of bounds");
 #if SIMDPP_USE_NULL
     return a.el(id);
@@ -221,6 +228,7 @@ uint64_t extract(uint64x2 a)
 template<unsigned id>
 int64_t extract(int64x2 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     return extract<id>(uint64x2(a));
 }
 /// @}
@@ -239,6 +247,7 @@ int64_t extract(int64x2 a)
 template<unsigned id>
 float extract(float32x4 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     static_assert(id < 4, "index out of bounds");
 #if SIMDPP_USE_NULL
     return a.el(id);
@@ -266,6 +275,7 @@ float extract(float32x4 a)
 template<unsigned id>
 double extract(float64x2 a)
 {
+    SIMDPP_PROFILE_OP(extract, a);
     static_assert(id < 2, "index out of bounds");
 #if SIMDPP_USE_NULL
     return a.el(id);
@@ -294,6 +304,7 @@ double extract(float64x2 a)
 */
 inline uint16_t extract_bits_any(uint8x16 a)
 {
+    SIMDPP_PROFILE_OP(extract_bits_any, a);
     // extract_bits_impl depends on the exact implementation of this function
 #if SIMDPP_USE_NULL
     uint16_t r = 0;
@@ -344,6 +355,7 @@ inline uint16_t extract_bits_any(uint8x16 a)
 template<unsigned id>
 uint16_t extract_bits(uint8x16 a)
 {
+    SIMDPP_PROFILE_OP(extract_bits, a);
     static_assert(id < 8, "index out of bounds");
 #if SIMDPP_USE_NULL
     uint16_t r = 0;
@@ -395,13 +407,30 @@ void v256_split(A a, R& r1, R& r2)
     @icost{AVX2, 1}
     @icost{SSE2-AVX, NEON, ALTIVEC, 0}
 */
-inline void split(uint8x32 a, uint8x16& r1, uint8x16& r2)  { detail::v256_split(a, r1, r2); }
-inline void split(uint16x16 a, uint16x8& r1, uint16x8& r2) { detail::v256_split(a, r1, r2); }
-inline void split(uint32x8 a, uint32x4& r1, uint32x4& r2)  { detail::v256_split(a, r1, r2); }
-inline void split(uint64x4 a, uint64x2& r1, uint64x2& r2)  { detail::v256_split(a, r1, r2); }
+inline void split(uint8x32 a, uint8x16& r1, uint8x16& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v256_split(a, r1, r2);
+}
+inline void split(uint16x16 a, uint16x8& r1, uint16x8& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v256_split(a, r1, r2);
+}
+inline void split(uint32x8 a, uint32x4& r1, uint32x4& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v256_split(a, r1, r2);
+}
+inline void split(uint64x4 a, uint64x2& r1, uint64x2& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v256_split(a, r1, r2);
+}
 
 inline void split(float32x8 a, float32x4& r1, float32x4& r2)
 {
+    SIMDPP_PROFILE_OP(split, a);
 #if SIMDPP_USE_AVX
     r1 = _mm256_extractf128_ps(a, 0);
     r2 = _mm256_extractf128_ps(a, 1);
@@ -413,6 +442,7 @@ inline void split(float32x8 a, float32x4& r1, float32x4& r2)
 
 inline void split(float64x4 a, float64x2& r1, float64x2& r2)
 {
+    SIMDPP_PROFILE_OP(split, a);
 #if SIMDPP_USE_AVX
     r1 = _mm256_extractf128_pd(a, 0);
     r2 = _mm256_extractf128_pd(a, 1);
@@ -422,6 +452,44 @@ inline void split(float64x4 a, float64x2& r1, float64x2& r2)
 #endif
 }
 
+#if SIMDPP_USE_AVX512F
+/** Splits a 512-bit vector into two 256-bit vectors.
+
+    @code
+    [ r1, r2 ] = a
+    @endcode
+
+    @icost{AVX512F, 1}
+*/
+inline void split(uint32<16> a, uint32x8& r1, uint32x8& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    r1 = _mm512_castsi512_si256(a);
+    r2 = _mm512_extracti64x4_epi64(a, 1);
+}
+
+inline void split(uint64<8> a, uint64x4& r1, uint64x4& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    r1 = _mm512_castsi512_si256(a);
+    r2 = _mm512_extracti64x4_epi64(a, 1);
+}
+
+inline void split(float32<16> a, float32x8& r1, float32x8& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    r1 = _mm512_castps512_ps256(a);
+    r2 = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a), 1));
+}
+
+inline void split(float64<8> a, float64x4& r1, float64x4& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    r1 = _mm512_castpd512_pd256(a);
+    r2 = _mm512_extractf64x4_pd(a, 1);
+}
+#endif
+
 namespace detail {
 
 template<class V, class H>
@@ -435,17 +503,41 @@ void v_split(V a, H& r1, H& r2)
 } // namespace detail
 
 template<unsigned N>
-void split(uint8<N> a, uint8<N/2>& r1, uint8<N/2>& r2) { detail::v_split(a, r1, r2); }
+void split(uint8<N> a, uint8<N/2>& r1, uint8<N/2>& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v_split(a, r1, r2);
+}
 template<unsigned N>
-void split(uint16<N> a, uint16<N/2>& r1, uint16<N/2>& r2) { detail::v_split(a, r1, r2); }
+void split(uint16<N> a, uint16<N/2>& r1, uint16<N/2>& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v_split(a, r1, r2);
+}
 template<unsigned N>
-void split(uint32<N> a, uint32<N/2>& r1, uint32<N/2>& r2) { detail::v_split(a, r1, r2); }
+void split(uint32<N> a, uint32<N/2>& r1, uint32<N/2>& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v_split(a, r1, r2);
+}
 template<unsigned N>
-void split(uint64<N> a, uint64<N/2>& r1, uint64<N/2>& r2) { detail::v_split(a, r1, r2); }
+void split(uint64<N> a, uint64<N/2>& r1, uint64<N/2>& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v_split(a, r1, r2);
+}
 template<unsigned N>
-void split(float32<N> a, float32<N/2>& r1, float32<N/2>& r2) { detail::v_split(a, r1, r2); }
+void split(float32<N> a, float32<N/2>& r1, float32<N/2>& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v_split(a, r1, r2);
+}
 template<unsigned N>
-void split(float64<N> a, float64<N/2>& r1, float64<N/2>& r2) { detail::v_split(a, r1, r2); }
+void split(float64<N> a, float64<N/2>& r1, float64<N/2>& r2)
+{
+    SIMDPP_PROFILE_OP(split, a);
+    detail::v_split(a, r1, r2);
+}
 
 /// @}
 
@@ -62,6 +62,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, expr_abs<float32<N,E>>> abs(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(abs, a);
     return { { a }, 0 };
 }
 
@@ -85,6 +86,7 @@ float32<N, expr_abs<float32<N,E>>> abs(float32<N,E> a)
 template<unsigned N, class E>
 float64<N, expr_abs<float64<N,E>>> abs(float64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(abs, a);
     return { { a }, 0 };
 }
 
@@ -56,6 +56,7 @@ template<unsigned N, class E1, class E2>
 float32<N, expr_add<float32<N,E1>,
                     float32<N,E2>>> add(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(add, a);
     return { { a, b }, 0 };
 }
 
@@ -78,6 +79,7 @@ template<unsigned N, class E1, class E2>
 float64<N, expr_add<float64<N,E1>,
                     float64<N,E2>>> add(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(add, a);
     return { { a, b }, 0 };
 }
 
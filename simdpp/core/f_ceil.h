@@ -61,6 +61,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> ceil(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(ceil, a);
     return detail::insn::i_ceil(a.eval());
 }
 
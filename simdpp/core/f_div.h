@@ -59,6 +59,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 float32<N, float32<N>> div(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(div, a);
     return detail::insn::i_div(a.eval(), b.eval());
 }
 
@@ -80,6 +81,7 @@ float32<N, float32<N>> div(float32<N,E1> a, float32<N,E2> b)
 template<unsigned N, class E1, class E2>
 float64<N, float64<N>> div(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(div, a);
     return detail::insn::i_div(a.eval(), b.eval());
 }
 
@@ -61,6 +61,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> floor(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(floor, a);
     return detail::insn::i_floor(a.eval());
 }
 
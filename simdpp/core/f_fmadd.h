@@ -60,6 +60,7 @@ float32<N, expr_fmadd<float32<N,E1>,
                                             float32<N,E2> b,
                                             float32<N,E3> c)
 {
+    SIMDPP_PROFILE_OP(fmadd, a);
     return { { a, b, c }, 0 };
 }
 
@@ -70,6 +71,7 @@ float64<N, expr_fmadd<float64<N,E1>,
                                             float64<N,E2> b,
                                             float64<N,E3> c)
 {
+    SIMDPP_PROFILE_OP(fmadd, a);
     return { { a, b, c }, 0 };
 }
 /// @}
@@ -54,6 +54,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 mask_float32<N, mask_float32<N>> isnan(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(isnan, a);
     return detail::insn::i_isnan(a.eval());
 }
 
@@ -75,6 +76,7 @@ mask_float32<N, mask_float32<N>> isnan(float32<N,E> a)
 template<unsigned N, class E>
 mask_float64<N, mask_float64<N>> isnan(float64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(isnan, a);
     return detail::insn::i_isnan(a.eval());
 }
 
@@ -58,6 +58,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 mask_float32<N, mask_float32<N>> isnan2(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(isnan2, a);
     return detail::insn::i_isnan2(a.eval(), b.eval());
 }
 
@@ -80,6 +81,7 @@ mask_float32<N, mask_float32<N>> isnan2(float32<N,E1> a, float32<N,E2> b)
 template<unsigned N, class E1, class E2>
 mask_float64<N, mask_float64<N>> isnan2(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(isnan2, a);
     return detail::insn::i_isnan2(a.eval(), b.eval());
 }
 
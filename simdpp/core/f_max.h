@@ -57,6 +57,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 float32<N, float32<N>> max(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(max, a);
     return detail::insn::i_max(a.eval(), b.eval());
 }
 
@@ -81,6 +82,7 @@ float32<N, float32<N>> max(float32<N,E1> a, float32<N,E2> b)
 template<unsigned N, class E1, class E2>
 float64<N, float64<N>> max(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(max, a);
     return detail::insn::i_max(a.eval(), b.eval());
 }
 
@@ -57,6 +57,7 @@ float32<N, expr_mul<float32<N,E1>,
                     float32<N,E2>>> mul(float32<N,E1> a,
                                         float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mul, a);
     return { { a, b }, 0 };
 }
 
@@ -80,6 +81,7 @@ float64<N, expr_mul<float64<N,E1>,
                     float64<N,E2>>> mul(float64<N,E1> a,
                                         float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mul, a);
     return { { a, b }, 0 };
 }
 
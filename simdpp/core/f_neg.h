@@ -58,6 +58,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, expr_neg<float32<N,E>>> neg(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(neg, a);
     return { { a }, 0 };
 }
 
@@ -81,6 +82,7 @@ float32<N, expr_neg<float32<N,E>>> neg(float32<N,E> a)
 template<unsigned N, class E>
 float64<N, expr_neg<float64<N,E>>> neg(float64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(neg, a);
     return { { a }, 0 };
 }
 
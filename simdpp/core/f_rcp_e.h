@@ -60,6 +60,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> rcp_e(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(rcp_e, a);
     return detail::insn::i_rcp_e(a.eval());
 }
 
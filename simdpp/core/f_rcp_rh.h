@@ -76,6 +76,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> rcp_rh(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(rcp_rh, a);
     return detail::insn::i_rcp_rh(a.eval());
 }
 
@@ -61,6 +61,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> rsqrt_e(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(rsqrt_e, a);
     return detail::insn::i_rsqrt_e(a.eval());
 }
 
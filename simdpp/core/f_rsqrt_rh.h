@@ -65,6 +65,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> rsqrt_rh(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(rsqrt_rh, a);
     return detail::insn::i_rcp_rh(a.eval());
 }
 
@@ -59,6 +59,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> sign(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(sign, a);
     return detail::insn::i_sign(a.eval());
 }
 
@@ -82,6 +83,7 @@ float32<N, float32<N>> sign(float32<N,E> a)
 template<unsigned N, class E>
 float64<N, float64<N>> sign(float64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(sign, a);
     return detail::insn::i_sign(a.eval());
 }
 
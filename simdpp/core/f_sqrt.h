@@ -61,6 +61,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 float32<N, float32<N>> sqrt(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(sqrt, a);
     return detail::insn::i_sqrt(a.eval(), b.eval());
 }
 
@@ -82,6 +83,7 @@ float32<N, float32<N>> sqrt(float32<N,E1> a, float32<N,E2> b)
 template<unsigned N, class E1, class E2>
 float64<N, float64<N>> sqrt(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(sqrt, a);
     return detail::insn::i_sqrt(a.eval(), b.eval());
 }
 
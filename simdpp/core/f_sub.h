@@ -55,6 +55,7 @@ template<unsigned N, class E1, class E2>
 float32<N, expr_sub<float32<N,E1>,
                     float32<N,E2>>> sub(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(sub, a);
     return { { a, b }, 0 };
 }
 
@@ -77,6 +78,7 @@ template<unsigned N, class E1, class E2>
 float64<N, expr_sub<float64<N,E1>,
                     float64<N,E2>>> sub(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(sub, a);
     return { { a, b }, 0 };
 }
 
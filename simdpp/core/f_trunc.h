@@ -60,6 +60,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 float32<N, float32<N>> trunc(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(trunc, a);
     return detail::insn::i_trunc(a.eval());
 }
 
@@ -60,6 +60,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 uint8<N, expr_abs<int8<N,E>>> abs(int8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(abs, a);
     return { { a }, 0 };
 }
 
@@ -83,6 +84,7 @@ uint8<N, expr_abs<int8<N,E>>> abs(int8<N,E> a)
 template<unsigned N, class E>
 uint16<N, expr_abs<int16<N,E>>> abs(int16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(abs, a);
     return { { a }, 0 };
 }
 
@@ -105,6 +107,7 @@ uint16<N, expr_abs<int16<N,E>>> abs(int16<N,E> a)
 template<unsigned N, class E>
 uint32<N, expr_abs<int32<N,E>>> abs(int32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(abs, a);
     return { { a }, 0 };
 }
 
@@ -129,6 +132,7 @@ uint32<N, expr_abs<int32<N,E>>> abs(int32<N,E> a)
 template<unsigned N, class E>
 uint64<N, expr_abs<int64<N,E>>> abs(int64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(abs, a);
     return { { a }, 0 };
 }
 
@@ -61,6 +61,7 @@ typename detail::get_expr2_nomask<V1, V2,
         add(const any_int8<N,V1>& a,
             const any_int8<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(add, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -83,6 +84,7 @@ typename detail::get_expr2_nomask<V1, V2,
         add(const any_int16<N,V1>& a,
             const any_int16<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(add, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -105,6 +107,7 @@ typename detail::get_expr2_nomask<V1, V2,
         add(const any_int32<N,V1>& a,
             const any_int32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(add, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -131,6 +134,7 @@ typename detail::get_expr2_nomask<V1, V2,
         add(const any_int64<N,V1>& a,
             const any_int64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(add, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
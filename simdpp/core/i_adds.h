@@ -57,6 +57,7 @@ int8<N, expr_adds<int8<N,E1>,
                   int8<N,E2>>> adds(int8<N,E1> a,
                                     int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(adds, a);
     return { { a, b }, 0 };
 }
 
@@ -76,6 +77,7 @@ int16<N, expr_adds<int16<N,E1>,
                    int16<N,E2>>> adds(int16<N,E1> a,
                                       int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(adds, a);
     return { { a, b }, 0 };
 }
 
@@ -95,6 +97,7 @@ uint8<N, expr_adds<uint8<N,E1>,
                    uint8<N,E2>>> adds(uint8<N,E1> a,
                                       uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(adds, a);
     return { { a, b }, 0 };
 }
 
@@ -114,6 +117,7 @@ uint16<N, expr_adds<uint16<N,E1>,
                     uint16<N,E2>>> adds(uint16<N,E1> a,
                                         uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(adds, a);
     return { { a, b }, 0 };
 }
 
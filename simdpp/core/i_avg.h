@@ -55,6 +55,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 uint8<N, uint8<N>> avg(uint8<N,E1> a, uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg, a);
     return detail::insn::i_avg(a.eval(), b.eval());
 }
 
@@ -77,6 +78,7 @@ uint8<N, uint8<N>> avg(uint8<N,E1> a, uint8<N,E2> b)
 template<unsigned N, class E1, class E2>
 int8<N, int8<N>> avg(int8<N,E1> a, int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg, a);
     return detail::insn::i_avg(a.eval(), b.eval());
 }
 
@@ -94,6 +96,7 @@ int8<N, int8<N>> avg(int8<N,E1> a, int8<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint16<N, uint16<N>> avg(uint16<N,E1> a, uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg, a);
     return detail::insn::i_avg(a.eval(), b.eval());
 }
 
@@ -116,6 +119,7 @@ uint16<N, uint16<N>> avg(uint16<N,E1> a, uint16<N,E2> b)
 template<unsigned N, class E1, class E2>
 int16<N, int16<N>> avg(int16<N,E1> a, int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg, a);
     return detail::insn::i_avg(a.eval(), b.eval());
 }
 
@@ -138,6 +142,7 @@ int16<N, int16<N>> avg(int16<N,E1> a, int16<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint32<N, uint32<N>> avg(uint32<N,E1> a, uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg, a);
     return detail::insn::i_avg(a.eval(), b.eval());
 }
 
@@ -161,6 +166,7 @@ uint32<N, uint32<N>> avg(uint32<N,E1> a, uint32<N,E2> b)
 template<unsigned N, class E1, class E2>
 int32<N, int32<N>> avg(int32<N,E1> a, int32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg, a);
     return detail::insn::i_avg(a.eval(), b.eval());
 }
 
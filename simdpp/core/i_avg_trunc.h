@@ -60,6 +60,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 uint8<N, uint8<N>> avg_trunc(uint8<N,E1> a, uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg_trunc, a);
     return detail::insn::i_avg_trunc(a.eval(), b.eval());
 }
 
@@ -82,6 +83,7 @@ uint8<N, uint8<N>> avg_trunc(uint8<N,E1> a, uint8<N,E2> b)
 template<unsigned N, class E1, class E2>
 int8<N, int8<N>> avg_trunc(int8<N,E1> a, int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg_trunc, a);
     return detail::insn::i_avg_trunc(a.eval(), b.eval());
 }
 
@@ -105,6 +107,7 @@ int8<N, int8<N>> avg_trunc(int8<N,E1> a, int8<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint16<N, uint16<N>> avg_trunc(uint16<N,E1> a, uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg_trunc, a);
     return detail::insn::i_avg_trunc(a.eval(), b.eval());
 }
 
@@ -128,6 +131,7 @@ uint16<N, uint16<N>> avg_trunc(uint16<N,E1> a, uint16<N,E2> b)
 template<unsigned N, class E1, class E2>
 int16<N, int16<N>> avg_trunc(int16<N,E1> a, int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg_trunc, a);
     return detail::insn::i_avg_trunc(a.eval(), b.eval());
 }
 
@@ -151,6 +155,7 @@ int16<N, int16<N>> avg_trunc(int16<N,E1> a, int16<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint32<N, uint32<N>> avg_trunc(uint32<N,E1> a, uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg_trunc, a);
     return detail::insn::i_avg_trunc(a.eval(), b.eval());
 }
 
@@ -175,6 +180,7 @@ uint32<N, uint32<N>> avg_trunc(uint32<N,E1> a, uint32<N,E2> b)
 template<unsigned N, class E1, class E2>
 int32<N, int32<N>> avg_trunc(int32<N,E1> a, int32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(avg_trunc, a);
     return detail::insn::i_avg_trunc(a.eval(), b.eval());
 }
 
@@ -66,6 +66,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned P>
 uint8x16 div_p(uint8x16 num, uint8x16 den)
 {
+    SIMDPP_PROFILE_OP(div_p, num);
 #if SIMDPP_USE_NULL
     return null::div_p<P>(num, den);
 #else
@@ -115,6 +116,7 @@ uint8x16 div_p(uint8x16 num, uint8x16 den)
 template<unsigned P>
 uint16x8 div_p(uint16x8 num, uint16x8 den)
 {
+    SIMDPP_PROFILE_OP(div_p, num);
 #if SIMDPP_USE_NULL
     return null::div_p<P>(num, den);
 #else
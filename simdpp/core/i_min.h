@@ -59,6 +59,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 int8<N, int8<N>> min(int8<N,E1> a, int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(min, a);
     return detail::insn::i_min(a.eval(), b.eval());
 }
 
@@ -76,6 +77,7 @@ int8<N, int8<N>> min(int8<N,E1> a, int8<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint8<N, uint8<N>> min(uint8<N,E1> a, uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(min, a);
     return detail::insn::i_min(a.eval(), b.eval());
 }
 
@@ -93,6 +95,7 @@ uint8<N, uint8<N>> min(uint8<N,E1> a, uint8<N,E2> b)
 template<unsigned N, class E1, class E2>
 int16<N, int16<N>> min(int16<N,E1> a, int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(min, a);
     return detail::insn::i_min(a.eval(), b.eval());
 }
 
@@ -114,6 +117,7 @@ int16<N, int16<N>> min(int16<N,E1> a, int16<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint16<N, uint16<N>> min(uint16<N,E1> a, uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(min, a);
     return detail::insn::i_min(a.eval(), b.eval());
 }
 
@@ -135,6 +139,7 @@ uint16<N, uint16<N>> min(uint16<N,E1> a, uint16<N,E2> b)
 template<unsigned N, class E1, class E2>
 int32<N, int32<N>> min(int32<N,E1> a, int32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(min, a);
     return detail::insn::i_min(a.eval(), b.eval());
 }
 
@@ -156,6 +161,7 @@ int32<N, int32<N>> min(int32<N,E1> a, int32<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint32<N, uint32<N>> min(uint32<N,E1> a, uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(min, a);
     return detail::insn::i_min(a.eval(), b.eval());
 }
 
@@ -60,6 +60,7 @@ typename detail::get_expr2_nomask<V1, V2,
         mul_lo(const any_int16<N,V1>& a,
                const any_int16<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(mul_lo, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -83,6 +84,7 @@ int16<N, expr_mul_hi<int16<N,E1>,
                      int16<N,E2>>> mul_hi(int16<N,E1> a,
                                           int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mul_hi, a);
     return { { a, b }, 0 };
 }
 
@@ -106,6 +108,7 @@ uint16<N, expr_mul_hi<uint16<N,E1>,
                       uint16<N,E2>>> mul_hi(uint16<N,E1> a,
                                             uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mul_hi, a);
     return { { a, b }, 0 };
 }
 
@@ -134,6 +137,7 @@ typename detail::get_expr2_nomask<V1, V2,
         mul_lo(const any_int32<N,V1>& a,
                const any_int32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(mul_lo, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
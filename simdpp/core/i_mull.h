@@ -93,6 +93,7 @@ template<unsigned N, class E1, class E2>
 int32<N, expr_mull<int16<N,E1>,
                    int16<N,E2>>> mull(int16<N,E1> a, int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mull, a);
     return { { a, b }, 0 };
 }
 
@@ -120,6 +121,7 @@ template<unsigned N, class E1, class E2>
 uint32<N, expr_mull<uint16<N,E1>,
                     uint16<N,E2>>> mull(uint16<N,E1> a, uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mull, a);
     return { { a, b }, 0 };
 }
 
@@ -147,6 +149,7 @@ template<unsigned N, class E1, class E2>
 int64<N, expr_mull<int32<N,E1>,
                    int32<N,E2>>> mull(int32<N,E1> a, int32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mull, a);
     return { { a, b }, 0 };
 }
 
@@ -174,6 +177,7 @@ template<unsigned N, class E1, class E2>
 uint64<N, expr_mull<uint32<N,E1>,
                     uint32<N,E2>>> mull(uint32<N,E1> a, uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(mull, a);
     return { { a, b }, 0 };
 }
 
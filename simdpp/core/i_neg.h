@@ -54,6 +54,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 int8<N, expr_neg<int8<N,E>>> neg(int8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(neg, a);
     return { { a }, 0 };
 }
 
@@ -71,6 +72,7 @@ int8<N, expr_neg<int8<N,E>>> neg(int8<N,E> a)
 template<unsigned N, class E>
 int16<N, expr_neg<int16<N,E>>> neg(int16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(neg, a);
     return { { a }, 0 };
 }
 
@@ -88,6 +90,7 @@ int16<N, expr_neg<int16<N,E>>> neg(int16<N,E> a)
 template<unsigned N, class E>
 int32<N, expr_neg<int32<N,E>>> neg(int32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(neg, a);
     return { { a }, 0 };
 }
 
@@ -109,6 +112,7 @@ int32<N, expr_neg<int32<N,E>>> neg(int32<N,E> a)
 template<unsigned N, class E>
 int64<N, expr_neg<int64<N,E>>> neg(int64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(neg, a);
     return { { a }, 0 };
 }
 
@@ -64,6 +64,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 int8<N, int8<N>> shift_l(int8<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     uint8<N> qa = a.eval();
     return detail::insn::i_shift_l(qa, count);
 }
@@ -71,6 +72,7 @@ int8<N, int8<N>> shift_l(int8<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint8<N, uint8<N>> shift_l(uint8<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     return detail::insn::i_shift_l(a.eval(), count);
 }
 /// @}
@@ -96,6 +98,7 @@ uint8<N, uint8<N>> shift_l(uint8<N,E> a, unsigned count)
 template<unsigned N, class E>
 int16<N, int16<N>> shift_l(int16<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     uint16<N> qa = a.eval();
     return detail::insn::i_shift_l(qa, count);
 }
@@ -103,6 +106,7 @@ int16<N, int16<N>> shift_l(int16<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint16<N, uint16<N>> shift_l(uint16<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     return detail::insn::i_shift_l(a.eval(), count);
 }
 /// @}
@@ -128,6 +132,7 @@ uint16<N, uint16<N>> shift_l(uint16<N,E> a, unsigned count)
 template<unsigned N, class E>
 int32<N, int32<N>> shift_l(int32<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     uint32<N> qa = a.eval();
     return detail::insn::i_shift_l(qa, count);
 }
@@ -135,6 +140,7 @@ int32<N, int32<N>> shift_l(int32<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint32<N, uint32<N>> shift_l(uint32<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     return detail::insn::i_shift_l(a.eval(), count);
 }
 /// @}
@@ -160,6 +166,7 @@ uint32<N, uint32<N>> shift_l(uint32<N,E> a, unsigned count)
 template<unsigned N, class E>
 int64<N, int64<N>> shift_l(int64<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     uint64<N> qa = a.eval();
     return detail::insn::i_shift_l(qa, count);
 }
@@ -167,6 +174,7 @@ int64<N, int64<N>> shift_l(int64<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint64<N, uint64<N>> shift_l(uint64<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     return detail::insn::i_shift_l(a.eval(), count);
 }
 /// @}
@@ -192,6 +200,7 @@ uint64<N, uint64<N>> shift_l(uint64<N,E> a, unsigned count)
 template<unsigned count, unsigned N, class E>
 int8<N, int8<N>> shift_l(int8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 8, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 8) return int8<N>::zero();
@@ -203,6 +212,7 @@ int8<N, int8<N>> shift_l(int8<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint8<N, uint8<N>> shift_l(uint8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 8, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 8) return uint8<N>::zero();
@@ -229,6 +239,7 @@ uint8<N, uint8<N>> shift_l(uint8<N,E> a)
 template<unsigned count, unsigned N, class E>
 int16<N, int16<N>> shift_l(int16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 16, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 16) return int16<N>::zero();
@@ -240,6 +251,7 @@ int16<N, int16<N>> shift_l(int16<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint16<N, uint16<N>> shift_l(uint16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 16, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 16) return uint16<N>::zero();
@@ -266,6 +278,7 @@ uint16<N, uint16<N>> shift_l(uint16<N,E> a)
 template<unsigned count, unsigned N, class E>
 int32<N, int32<N>> shift_l(int32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 32, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 32) return int32<N>::zero();
@@ -277,6 +290,7 @@ int32<N, int32<N>> shift_l(int32<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint32<N, uint32<N>> shift_l(uint32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 32, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 32) return uint32<N>::zero();
@@ -302,6 +316,7 @@ uint32<N, uint32<N>> shift_l(uint32<N,E> a)
 template<unsigned count, unsigned N, class E>
 int64<N, int64<N>> shift_l(int64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 64, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 64) return int64<N>::zero();
@@ -313,6 +328,7 @@ int64<N, int64<N>> shift_l(int64<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint64<N, uint64<N>> shift_l(uint64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_l, a);
     static_assert(count <= 64, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 64) return uint64<N>::zero();
@@ -63,6 +63,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E>
 int8<N, int8<N>> shift_r(int8<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -89,6 +90,7 @@ int8<N, int8<N>> shift_r(int8<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint8<N, uint8<N>> shift_r(uint8<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -114,6 +116,7 @@ uint8<N, uint8<N>> shift_r(uint8<N,E> a, unsigned count)
 template<unsigned N, class E>
 int16<N, int16<N>> shift_r(int16<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -138,6 +141,7 @@ int16<N, int16<N>> shift_r(int16<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint16<N, uint16<N>> shift_r(uint16<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -167,6 +171,7 @@ uint16<N, uint16<N>> shift_r(uint16<N,E> a, unsigned count)
 template<unsigned N, class E>
 int32<N, int32<N>> shift_r(int32<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -191,6 +196,7 @@ int32<N, int32<N>> shift_r(int32<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint32<N, uint32<N>> shift_r(uint32<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -217,6 +223,7 @@ uint32<N, uint32<N>> shift_r(uint32<N,E> a, unsigned count)
 template<unsigned N, class E>
 int64<N, int64<N>> shift_r(int64<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -241,6 +248,7 @@ int64<N, int64<N>> shift_r(int64<N,E> a, unsigned count)
 template<unsigned N, class E>
 uint64<N, uint64<N>> shift_r(uint64<N,E> a, unsigned count)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
@@ -267,6 +275,7 @@ uint64<N, uint64<N>> shift_r(uint64<N,E> a, unsigned count)
 template<unsigned count, unsigned N, class E>
 int8<N, int8<N>> shift_r(int8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 8, "Shift out of bounds");
     if (count == 0) return a;
     return detail::insn::i_shift_r<count>(a.eval());
@@ -294,6 +303,7 @@ int8<N, int8<N>> shift_r(int8<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint8<N, uint8<N>> shift_r(uint8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 8, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 8) return uint8<N>::zero();
@@ -319,6 +329,7 @@ uint8<N, uint8<N>> shift_r(uint8<N,E> a)
 template<unsigned count, unsigned N, class E>
 int16<N, int16<N>> shift_r(int16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 16, "Shift out of bounds");
     if (count == 0) return a;
     return detail::insn::i_shift_r<count>(a.eval());
@@ -343,6 +354,7 @@ int16<N, int16<N>> shift_r(int16<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint16<N, uint16<N>> shift_r(uint16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 16, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 16) return uint16<N>::zero();
@@ -368,6 +380,7 @@ uint16<N, uint16<N>> shift_r(uint16<N,E> a)
 template<unsigned count, unsigned N, class E>
 int32<N, int32<N>> shift_r(int32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 32, "Shift out of bounds");
     if (count == 0) return a;
     return detail::insn::i_shift_r<count>(a.eval());
@@ -392,6 +405,7 @@ int32<N, int32<N>> shift_r(int32<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint32<N, uint32<N>> shift_r(uint32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 32, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 32) return uint32<N>::zero();
@@ -422,6 +436,7 @@ uint32<N, uint32<N>> shift_r(uint32<N,E> a)
 template<unsigned count, unsigned N, class E>
 int64<N, int64<N>> shift_r(int64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 64, "Shift out of bounds");
     if (count == 0) return a;
     return detail::insn::i_shift_r<count>(a.eval());
@@ -445,6 +460,7 @@ int64<N, int64<N>> shift_r(int64<N,E> a)
 template<unsigned count, unsigned N, class E>
 uint64<N, uint64<N>> shift_r(uint64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(shift_r, a);
     static_assert(count <= 64, "Shift out of bounds");
     if (count == 0) return a;
     if (count == 64) return uint64<N>::zero();
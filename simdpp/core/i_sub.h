@@ -60,6 +60,7 @@ typename detail::get_expr2_nomask<V1, V2,
         sub(const any_int8<N,V1>& a,
             const any_int8<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(sub, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -82,6 +83,7 @@ typename detail::get_expr2_nomask<V1, V2,
         sub(const any_int16<N,V1>& a,
             const any_int16<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(sub, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -104,6 +106,7 @@ typename detail::get_expr2_nomask<V1, V2,
         sub(const any_int32<N,V1>& a,
             const any_int32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(sub, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
@@ -130,6 +133,7 @@ typename detail::get_expr2_nomask<V1, V2,
         sub(const any_int64<N,V1>& a,
             const any_int64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(sub, a);
     return { { a.vec(), b.vec() }, 0 };
 }
 
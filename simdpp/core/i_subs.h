@@ -56,6 +56,7 @@ int8<N, expr_subs<int8<N,E1>,
                   int8<N,E2>>> subs(int8<N,E1> a,
                                     int8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(subs, a);
     return { { a, b }, 0 };
 }
 
@@ -75,6 +76,7 @@ int16<N, expr_subs<int16<N,E1>,
                    int16<N,E2>>> subs(int16<N,E1> a,
                                       int16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(subs, a);
     return { { a, b }, 0 };
 }
 
@@ -94,6 +96,7 @@ uint8<N, expr_subs<uint8<N,E1>,
                    uint8<N,E2>>> subs(uint8<N,E1> a,
                                       uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(subs, a);
     return { { a, b }, 0 };
 }
 
@@ -114,6 +117,7 @@ uint16<N, expr_subs<uint16<N,E1>,
                     uint16<N,E2>>> subs(uint16<N,E1> a,
                                         uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(subs, a);
     return { { a, b }, 0 };
 }
 
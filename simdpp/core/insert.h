@@ -64,6 +64,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned id>
 uint8x16 insert(uint8x16 a, uint8_t x)
 {
+    SIMDPP_PROFILE_OP(insert, a);
     static_assert(id < 16, "Position out of range");
 #if SIMDPP_USE_NULL
     a.el(id) = x;
@@ -104,6 +105,7 @@ uint8x16 insert(uint8x16 a, uint8_t x)
 template<unsigned id>
 uint16x8 insert(uint16x8 a, uint16_t x)
 {
+    SIMDPP_PROFILE_OP(insert, a);
 #if SIMDPP_USE_NULL
     a.el(id) = x;
     return a;
@@ -136,6 +138,7 @@ uint16x8 insert(uint16x8 a, uint16_t x)
 template<unsigned id>
 uint32x4 insert(uint32x4 a, uint32_t x)
 {
+    SIMDPP_PROFILE_OP(insert, a);
 #if SIMDPP_USE_NULL
     a.el(id) = x;
     return a;
@@ -176,6 +179,7 @@ uint32x4 insert(uint32x4 a, uint32_t x)
 template<unsigned id>
 uint64x2 insert(uint64x2 a, uint64_t x)
 {
+    SIMDPP_PROFILE_OP(insert, a);
 #if SIMDPP_USE_NULL
     a.el(id) = x;
     return a;
@@ -235,6 +239,7 @@ uint64x2 insert(uint64x2 a, uint64_t x)
 template<unsigned id>
 float32x4 insert(float32x4 a, float x)
 {
+    SIMDPP_PROFILE_OP(insert, a);
 #if SIMDPP_USE_NULL || SIMDPP_USE_SSE2 || SIMDPP_USE_ALTIVEC
     return float32x4(insert<id>(int32x4(a), bit_cast<uint32_t>(x)));
 #elif SIMDPP_USE_NEON
@@ -258,6 +263,7 @@ float32x4 insert(float32x4 a, float x)
 template<unsigned id>
 float64x2 insert(float64x2 a, double x)
 {
+    SIMDPP_PROFILE_OP(insert, a);
     return float64x2(insert<id>(int64x2(a), bit_cast<int64_t>(x)));
 }
 
@@ -273,6 +279,7 @@ float64x2 insert(float64x2 a, double x)
 */
 inline uint8x32 combine(uint8x16 a, uint8x16 b)
 {
+    SIMDPP_PROFILE_OP(combine, a);
 #if SIMDPP_USE_AVX2
     uint8x32 r;
     r = _mm256_castsi128_si256(a);
@@ -288,19 +295,23 @@ inline uint8x32 combine(uint8x16 a, uint8x16 b)
 
 inline uint16x16 combine(uint16x8 a, uint16x8 b)
 {
+    SIMDPP_PROFILE_OP(combine, a);
     return uint16x16(combine(uint8x16(a), uint8x16(b)));
 }
 inline uint32x8 combine(uint32x4 a, uint32x4 b)
 {
+    SIMDPP_PROFILE_OP(combine, a);
     return uint32x8(combine(uint8x16(a), uint8x16(b)));
 }
 inline uint64x4 combine(uint64x2 a, uint64x2 b)
 {
+    SIMDPP_PROFILE_OP(combine, a);
     return uint64x4(combine(uint8x16(a), uint8x16(b)));
 }
 
 inline float32x8 combine(float32x4 a, float32x4 b)
 {
+    SIMDPP_PROFILE_OP(combine, a);
 #if SIMDPP_USE_AVX
     float32x8 r;
     r = _mm256_castps128_ps256(a);
@@ -316,6 +327,7 @@ inline float32x8 combine(float32x4 a, float32x4 b)
 
 inline float64x4 combine(float64x2 a, float64x2 b)
 {
+    SIMDPP_PROFILE_OP(combine, a);
 #if SIMDPP_USE_AVX
     float64x4 r;
     r = _mm256_castpd128_pd256(a);
@@ -329,6 +341,46 @@ inline float64x4 combine(float64x2 a, float64x2 b)
 #endif
 }
 
+#if SIMDPP_USE_AVX512F
+/** Combines two 256-bit vectors into a 512-bit vector
+
+    @code
+    r = [ a, b ]
+    @endcode
+
+    @icost{AVX512F, 1}
+*/
+inline uint32<16> combine(uint32x8 a, uint32x8 b)
+{
+    SIMDPP_PROFILE_OP(combine, a);
+    uint32<16> r;
+    r = _mm512_castsi256_si512(a);
+    r = _mm512_inserti64x4(r, b, 1);
+    return r;
+}
+
+inline uint64<8> combine(uint64x4 a, uint64x4 b)
+{
+    SIMDPP_PROFILE_OP(combine, a);
+    return uint64<8>(combine(uint32x8(a), uint32x8(b)));
+}
+
+inline float64<8> combine(float64x4 a, float64x4 b)
+{
+    SIMDPP_PROFILE_OP(combine, a);
+    float64<8> r;
+    r = _mm512_castpd256_pd512(a);
+    r = _mm512_insertf64x4(r, b, 1);
+    return r;
+}
+
+inline float32<16> combine(float32x8 a, float32x8 b)
+{
+    SIMDPP_PROFILE_OP(combine, a);
+    return float32<16>(combine(float64x4(a), float64x4(b)));
+}
+#endif
+
 namespace detail {
 
 template<class V, class H>
@@ -344,17 +396,41 @@ V v_combine(H a1, H a2)
 } // namespace detail
 
 template<unsigned N>
-uint8<N*2> combine(uint8<N>& a1, uint8<N>& a2) { return detail::v_combine<uint8<N*2>>(a1, a2); }
+uint8<N*2> combine(const uint8<N>& a1, const uint8<N>& a2)
+{
+    SIMDPP_PROFILE_OP(combine, a1);
+    return detail::v_combine<uint8<N*2>>(a1, a2);
+}
 template<unsigned N>
-uint16<N*2> combine(uint16<N>& a1, uint16<N>& a2) { return detail::v_combine<uint16<N*2>>(a1, a2); }
+uint16<N*2> combine(const uint16<N>& a1, const uint16<N>& a2)
+{
+    SIMDPP_PROFILE_OP(combine, a1);
+    return detail::v_combine<uint16<N*2>>(a1, a2);
+}
 template<unsigned N>
-uint32<N*2> combine(uint32<N>& a1, uint32<N>& a2) { return detail::v_combine<uint32<N*2>>(a1, a2); }
+uint32<N*2> combine(const uint32<N>& a1, const uint32<N>& a2)
+{
+    SIMDPP_PROFILE_OP(combine, a1);
+    return detail::v_combine<uint32<N*2>>(a1, a2);
+}
 template<unsigned N>
-uint64<N*2> combine(uint64<N>& a1, uint64<N>& a2) { return detail::v_combine<uint64<N*2>>(a1, a2); }
+uint64<N*2> combine(const uint64<N>& a1, const uint64<N>& a2)
+{
+    SIMDPP_PROFILE_OP(combine, a1);
+    return detail::v_combine<uint64<N*2>>(a1, a2);
+}
 template<unsigned N>
-float32<N*2> combine(float32<N>& a1, float32<N>& a2) { return detail::v_combine<float32<N*2>>(a1, a2); }
+float32<N*2> combine(const float32<N>& a1, const float32<N>& a2)
+{
+    SIMDPP_PROFILE_OP(combine, a1);
+    return detail::v_combine<float32<N*2>>(a1, a2);
+}
 template<unsigned N>
-float64<N*2> combine(float64<N>& a1, float64<N>& a2) { return detail::v_combine<float64<N*2>>(a1, a2); }
+float64<N*2> combine(const float64<N>& a1, const float64<N>& a2)
+{
+    SIMDPP_PROFILE_OP(combine, a1);
+    return detail::v_combine<float64<N*2>>(a1, a2);
+}
 
 /// @}
 
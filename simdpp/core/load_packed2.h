@@ -56,6 +56,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class V>
 void load_packed2(any_vec<N,V>& a, any_vec<N,V>& b, const void* p)
 {
+    SIMDPP_PROFILE_OP(load_packed2, a);
     static_assert(!is_mask<V>::value, "Mask types can not be loaded");
     typename detail::get_expr_nosign<V, void>::type ra, rb;
     detail::insn::i_load_packed2(ra, rb, reinterpret_cast<const char*>(p));
@@ -58,6 +58,7 @@ template<unsigned N, class V>
 void load_packed3(any_vec<N,V>& a, any_vec<N,V>& b, any_vec<N,V>& c,
                   const void* p)
 {
+    SIMDPP_PROFILE_OP(load_packed3, a);
     static_assert(!is_mask<V>::value, "Mask types can not be loaded");
     typename detail::get_expr_nosign<V,void>::type ra, rb, rc;
     detail::insn::i_load_packed3(ra, rb, rc, reinterpret_cast<const char*>(p));
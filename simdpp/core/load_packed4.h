@@ -60,6 +60,7 @@ void load_packed4(any_vec<N,V>& a, any_vec<N,V>& b,
                   any_vec<N,V>& c, any_vec<N,V>& d,
                   const void* p)
 {
+    SIMDPP_PROFILE_OP(load_packed4, a);
     static_assert(!is_mask<V>::value, "Mask types can not be loaded");
     typename detail::get_expr_nosign<V,void>::type ra, rb, rc, rd;
     detail::insn::i_load_packed4(ra, rb, rc, rd, reinterpret_cast<const char*>(p));
@@ -0,0 +1,81 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_partial.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Loads the first @a n elements of a vector from memory and sets the rest
+    of the elements to zero. @a n must be in range [0..M] where @a M is the
+    number of elements in the vector.
+
+    @code
+    a0 = *(p)
+    ...
+    a{n-1} = *(p+n-1)
+    a{n} = 0
+    ...
+    a{M-1} = 0
+    @endcode
+
+    No memory past the first @a n elements is accessed, thus the function
+    may be used to load the tail of an array. @a p must be aligned to the
+    element size.
+
+    On AVX and AVX2 the 32-bit and 64-bit elements are loaded with a masked
+    load, on AVX512F the 512-bit vectors too. Otherwise the data is loaded
+    in parts of 8, 4, 2 and 1 bytes.
+*/
+template<unsigned N, class V>
+void load_partial(any_vec<N,V>& a, const void* p, unsigned n)
+{
+    SIMDPP_PROFILE_OP(load_partial, a);
+    static_assert(!is_mask<V>::value, "Mask types can not be loaded");
+    typename detail::get_expr_nosign<V, void>::type r;
+    detail::insn::i_load_partial(r, reinterpret_cast<const char*>(p), n);
+    a.vec() = r;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
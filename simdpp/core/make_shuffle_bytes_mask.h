@@ -156,6 +156,7 @@ uint8x8 get_shuffle_bytex8_16()
 template<int s0, int s1, unsigned N>
 uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,2>();
     uint8_t b0 = detail::get_shuffle_bytex1_16<s0,2>();
     uint8_t b1 = detail::get_shuffle_bytex1_16<s1,2>();
@@ -204,6 +205,7 @@ uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 template<int s0, int s1, int s2, int s3, unsigned N>
 uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,s2,s3,4>();
     uint8_t b0 = detail::get_shuffle_bytex1_16<s0,4>();
     uint8_t b1 = detail::get_shuffle_bytex1_16<s1,4>();
@@ -251,6 +253,7 @@ uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 template<int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7, unsigned N>
 uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,s2,s3,8>();
     detail::assert_selector_range<s4,s5,s6,s7,8>();
     uint8_t b0 = detail::get_shuffle_bytex1_16<s0,8>();
@@ -298,6 +301,7 @@ template<int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7,
          int s8, int s9, int s10, int s11, int s12, int s13, int s14, int s15, unsigned N>
 uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,s2,s3,16>();
     detail::assert_selector_range<s4,s5,s6,s7,16>();
     detail::assert_selector_range<s8,s9,s10,s11,16>();
@@ -361,6 +365,7 @@ uint8<N> make_shuffle_bytes16_mask(uint8<N> &mask)
 template<int s0, int s1, unsigned N>
 uint16<N> make_shuffle_bytes16_mask(uint16<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,2>();
     detail::uint8x2 b0 = detail::get_shuffle_bytex2_16<s0,2>();
     detail::uint8x2 b1 = detail::get_shuffle_bytex2_16<s1,2>();
@@ -409,6 +414,7 @@ uint16<N> make_shuffle_bytes16_mask(uint16<N> &mask)
 template<int s0, int s1, int s2, int s3, unsigned N>
 uint16<N> make_shuffle_bytes16_mask(uint16<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,s2,s3,4>();
     detail::uint8x2 b0 = detail::get_shuffle_bytex2_16<s0,4>();
     detail::uint8x2 b1 = detail::get_shuffle_bytex2_16<s1,4>();
@@ -453,6 +459,7 @@ template<int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7,
          unsigned N>
 uint16<N> make_shuffle_bytes16_mask(uint16<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,s2,s3,8>();
     detail::assert_selector_range<s4,s5,s6,s7,8>();
 
@@ -504,6 +511,7 @@ uint16<N> make_shuffle_bytes16_mask(uint16<N> &mask)
 template<int s0, int s1, unsigned N>
 uint32<N> make_shuffle_bytes16_mask(uint32<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,2>();
     detail::uint8x4 b0 = detail::get_shuffle_bytex4_16<s0,2>();
     detail::uint8x4 b1 = detail::get_shuffle_bytex4_16<s1,2>();
@@ -543,6 +551,7 @@ uint32<N> make_shuffle_bytes16_mask(uint32<N> &mask)
 template<int s0, int s1, int s2, int s3, unsigned N>
 uint32<N> make_shuffle_bytes16_mask(uint32<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,s2,s3,4>();
     detail::uint8x4 b0 = detail::get_shuffle_bytex4_16<s0,4>();
     detail::uint8x4 b1 = detail::get_shuffle_bytex4_16<s1,4>();
@@ -582,6 +591,7 @@ uint32<N> make_shuffle_bytes16_mask(uint32<N> &mask)
 template<int s0, int s1, unsigned N>
 uint64<N> make_shuffle_bytes16_mask(uint64<N> &mask)
 {
+    SIMDPP_PROFILE_OP(make_shuffle_bytes16_mask, mask);
     detail::assert_selector_range<s0,s1,2>();
     detail::uint8x8 b0 = detail::get_shuffle_bytex8_16<s0,2>();
     detail::uint8x8 b1 = detail::get_shuffle_bytex8_16<s1,2>();
@@ -65,6 +65,7 @@ template<unsigned shift, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         move16_r(const any_vec8<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(move16_r, a);
     static_assert(shift <= 16, "Shift out of bounds");
     if (shift == 0) return a.vec().eval();
     if (shift == 16) return V::zero();
@@ -97,6 +98,7 @@ template<unsigned shift, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         move8_r(const any_vec16<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(move8_r, a);
     static_assert(shift <= 8, "Shift out of bounds");
     if (shift == 0) return a.vec().eval();
     if (shift == 8) return V::zero();
@@ -127,6 +129,7 @@ template<unsigned shift, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         move4_r(const any_vec32<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(move4_r, a);
     static_assert(shift <= 4, "Shift out of bounds");
     if (shift == 0) return a.vec().eval();
     if (shift == 4) return V::zero();
@@ -156,6 +159,7 @@ template<unsigned shift, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         move2_r(const any_vec64<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(move2_r, a);
     static_assert(shift <= 2, "Shift out of bounds");
     if (shift == 0) return a.vec().eval();
     if (shift == 2) return V::zero();
@@ -68,6 +68,7 @@ template<unsigned s0, unsigned s1, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         permute2(const any_vec16<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(permute2, a);
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
     typename detail::get_expr_nomask<V, void>::type ra;
     ra = a.vec().eval();
@@ -113,6 +114,7 @@ template<unsigned s0, unsigned s1, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         permute2(const any_vec32<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(permute2, a);
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
     typename detail::get_expr_nomask<V, void>::type ra;
     ra = a.vec().eval();
@@ -145,6 +147,7 @@ template<unsigned s0, unsigned s1, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         permute2(const any_vec64<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(permute2, a);
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
     typename detail::get_expr_nomask<V, void>::type ra;
     ra = a.vec().eval();
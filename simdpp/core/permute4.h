@@ -79,6 +79,7 @@ template<unsigned s0, unsigned s1, unsigned s2, unsigned s3,
 typename detail::get_expr_nomask<V, void>::empty
         permute4(const any_vec16<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(permute4, a);
     static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
     typename detail::get_expr_nomask<V, void>::type ra;
     ra = a.vec().eval();
@@ -124,6 +125,7 @@ template<unsigned s0, unsigned s1, unsigned s2, unsigned s3,
 typename detail::get_expr_nomask<V, void>::empty
         permute4(const any_vec32<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(permute4, a);
     static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
     typename detail::get_expr_nomask<V, void>::type ra;
     ra = a.vec().eval();
@@ -153,6 +155,7 @@ template<unsigned s0, unsigned s1, unsigned s2, unsigned s3,
 typename detail::get_expr_nomask<V, void>::empty
         permute4(const any_vec64<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(permute4, a);
     static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
     typename detail::get_expr_nomask<V, void>::type ra;
     ra = a.vec().eval();
@@ -62,6 +62,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline uint8x16 permute_bytes16(uint8x16 a, uint8x16 mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
 #if SIMDPP_USE_NULL
     uint8x16 ai = a;
     uint8x16 mi = mask;
@@ -90,6 +91,7 @@ inline uint8x16 permute_bytes16(uint8x16 a, uint8x16 mask)
 #if SIMDPP_USE_AVX2
 inline uint8x32 permute_bytes16(uint8x32 a, uint8x32 mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     return _mm256_shuffle_epi8(a, mask);
 }
 #endif
@@ -97,31 +99,37 @@ inline uint8x32 permute_bytes16(uint8x32 a, uint8x32 mask)
 template<unsigned N>
 uint8<N> permute_bytes16(uint8<N> a, uint8<N> mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     SIMDPP_VEC_ARRAY_IMPL2(uint8<N>, permute_bytes16, a, mask)
 }
 template<unsigned N>
 uint16<N> permute_bytes16(uint16<N> a, uint16<N> mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     return (uint16<N>) permute_bytes16(uint8<N*2>(a), uint8<N*2>(mask));
 }
 template<unsigned N>
 uint32<N> permute_bytes16(uint32<N> a, uint32<N> mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     return (uint32<N>) permute_bytes16(uint8<N*4>(a), uint8<N*4>(mask));
 }
 template<unsigned N>
 uint64<N> permute_bytes16(uint64<N> a, uint64<N> mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     return (uint64<N>) permute_bytes16(uint8<N*8>(a), uint8<N*8>(mask));
 }
 template<unsigned N>
 float32<N> permute_bytes16(float32<N> a, uint32<N> mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     return float32<N>(permute_bytes16(uint32<N>(a), mask));
 }
 template<unsigned N>
 float64<N> permute_bytes16(float64<N> a, uint64<N> mask)
 {
+    SIMDPP_PROFILE_OP(permute_bytes16, a);
     return float64<N>(permute_bytes16(uint64<N>(a), mask));
 }
 /// @}
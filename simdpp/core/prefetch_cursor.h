@@ -0,0 +1,147 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_PREFETCH_CURSOR_H
+#define LIBSIMDPP_SIMDPP_CORE_PREFETCH_CURSOR_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cache.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Loads vectors of type @a V from locations that are a fixed stride apart
+    and prefetches the data a given distance ahead of the current location.
+    Intended for streaming loops:
+
+    @code
+    prefetch_cursor<float32x8> src(ptr, 512);
+    for (std::size_t i = 0; i < n; i += 8) {
+        acc = add(acc, src.load());
+    }
+    @endcode
+
+    Each time the cursor advances, the cache lines that hold the vector
+    @a distance bytes ahead of the current location are prefetched. Every
+    cache line is prefetched at most once, thus when the stride is less than
+    the size of the cache line, there are fewer prefetches than loads. When
+    @a V is wider than the cache line, several prefetches are issued per
+    load. The prefetches are issued via prefetch_read() with the locality
+    hint @a H.
+
+    The best distance depends on the processor and on the amount of work done
+    per loaded vector. Too short distance does not hide the memory latency,
+    too long one evicts the prefetched data before it is used. The bandwidth
+    benchmark in the perf directory can sweep the distance on the target
+    machine.
+*/
+template<class V, prefetch_hint H = prefetch_hint::l1>
+class prefetch_cursor {
+public:
+    /** @param p the location of the first vector
+        @param distance how far ahead of the current location to prefetch,
+            in bytes
+        @param stride the distance between the consecutive vectors in bytes.
+            The size of @a V by default.
+    */
+    prefetch_cursor(const void* p, std::size_t distance,
+                    std::size_t stride = sizeof(V)) :
+        p_(reinterpret_cast<const char*>(p)),
+        next_(line_begin(p_ + distance)),
+        distance_(distance),
+        stride_(stride)
+    {
+    }
+
+    /// Loads the vector at the current location and advances the cursor. The
+    /// location must be aligned as required by load().
+    V load()
+    {
+        V r = ::simdpp::SIMDPP_ARCH_NAMESPACE::load<V>(p_);
+        advance();
+        return r;
+    }
+
+    /// Loads the vector at the current location and advances the cursor. The
+    /// location does not need to be aligned.
+    V load_u()
+    {
+        V r = ::simdpp::SIMDPP_ARCH_NAMESPACE::load_u<V>(p_);
+        advance();
+        return r;
+    }
+
+    /// Advances the cursor without loading the vector
+    void advance()
+    {
+        const char* ahead = p_ + distance_;
+        // the lines between the vectors are skipped when the stride is large
+        if (next_ < line_begin(ahead)) {
+            next_ = line_begin(ahead);
+        }
+        while (next_ < ahead + sizeof(V)) {
+            prefetch_read<H>(next_);
+            next_ += cache_line_size;
+        }
+        p_ += stride_;
+    }
+
+    /// Returns the current location
+    const char* get() const { return p_; }
+
+private:
+    // the cache line size on most of the supported processors
+    static const std::size_t cache_line_size = 64;
+
+    // Returns the beginning of the cache line that holds @a p
+    static const char* line_begin(const char* p)
+    {
+        return p - reinterpret_cast<std::uintptr_t>(p) % cache_line_size;
+    }
+
+    const char* p_;
+    const char* next_;
+    std::size_t distance_;
+    std::size_t stride_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,142 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/scatter.h>
+#include <simdpp/detail/get_expr.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Stores the elements of a vector to the locations given by a vector of
+    indices. The indices are in units of the element size and are relative
+    to @a p.
+
+    @code
+    *(p + index0) = a0
+    ...
+    *(p + indexN) = aN
+    @endcode
+
+    @a a must have 32-bit or 64-bit elements and the same number of elements
+    as @a index. 64-bit indices may be used only with 64-bit elements. The
+    indices are interpreted as signed integers, thus unsigned 32-bit indices
+    above 2^31-1 refer to the locations before @a p. If several indices are
+    equal, the element that comes last is stored. @a p must be aligned to
+    the element size.
+
+    On AVX512F the 512-bit vectors are stored with the scatter instructions.
+    Elsewhere the elements are stored one by one.
+
+    @novec{SSE2-AVX2, NEON, ALTIVEC}
+*/
+template<unsigned N, class I, unsigned B, class V>
+void scatter(void* p, const any_int32<N,I>& index, const any_vec<B,V>& a)
+{
+    SIMDPP_PROFILE_OP(scatter, index);
+    static_assert(V::length == N, "Vector and index lengths must be equal");
+    static_assert(!is_mask<V>::value, "Mask types can not be scattered");
+    typename detail::get_expr_nosign<V, void>::type r = a.vec().eval();
+    detail::insn::i_scatter(reinterpret_cast<char*>(p),
+                            int32<N>(index.vec().eval()), r);
+}
+
+template<unsigned N, class I, unsigned B, class V>
+void scatter(void* p, const any_int64<N,I>& index, const any_vec<B,V>& a)
+{
+    SIMDPP_PROFILE_OP(scatter, index);
+    static_assert(V::length == N, "Vector and index lengths must be equal");
+    static_assert(V::size_tag == SIMDPP_TAG_SIZE64,
+                  "64-bit indices require 64-bit elements");
+    static_assert(!is_mask<V>::value, "Mask types can not be scattered");
+    typename detail::get_expr_nosign<V, void>::type r = a.vec().eval();
+    detail::insn::i_scatter(reinterpret_cast<char*>(p),
+                            int64<N>(index.vec().eval()), r);
+}
+/// @}
+
+/// @{
+/** Stores the elements of a vector for which @a mask is set to the
+    locations given by a vector of indices. The memory of the rest of the
+    elements is not accessed.
+
+    @code
+    if (mask0) *(p + index0) = a0
+    ...
+    if (maskN) *(p + indexN) = aN
+    @endcode
+
+    @a mask must be of the mask type of @a a. Otherwise same as the unmasked
+    scatter.
+
+    @novec{SSE2-AVX2, NEON, ALTIVEC}
+*/
+template<unsigned N, class I, unsigned B, class V, unsigned BM, class M>
+void scatter(void* p, const any_int32<N,I>& index, const any_vec<B,V>& a,
+             const any_vec<BM,M>& mask)
+{
+    SIMDPP_PROFILE_OP(scatter, index);
+    static_assert(V::length == N, "Vector and index lengths must be equal");
+    static_assert(!is_mask<V>::value, "Mask types can not be scattered");
+    typename detail::get_expr_nosign<V, void>::type r = a.vec().eval();
+    typename V::mask_vector_type m = mask.vec().eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p),
+                                   int32<N>(index.vec().eval()), r, m);
+}
+
+template<unsigned N, class I, unsigned B, class V, unsigned BM, class M>
+void scatter(void* p, const any_int64<N,I>& index, const any_vec<B,V>& a,
+             const any_vec<BM,M>& mask)
+{
+    SIMDPP_PROFILE_OP(scatter, index);
+    static_assert(V::length == N, "Vector and index lengths must be equal");
+    static_assert(V::size_tag == SIMDPP_TAG_SIZE64,
+                  "64-bit indices require 64-bit elements");
+    static_assert(!is_mask<V>::value, "Mask types can not be scattered");
+    typename detail::get_expr_nosign<V, void>::type r = a.vec().eval();
+    typename V::mask_vector_type m = mask.vec().eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p),
+                                   int64<N>(index.vec().eval()), r, m);
+}
+/// @}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -74,6 +74,7 @@ template<unsigned s0, unsigned s1, unsigned N, class V1, class V2>
 typename detail::get_expr2_nomask<V1, V2, void>::empty
         shuffle1(const any_vec64<N,V1>& a, const any_vec64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(shuffle1, a);
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
     typename detail::get_expr2_nomask<V1, V2, void>::type ra = a.vec().eval(),
                                                                rb = b.vec().eval();
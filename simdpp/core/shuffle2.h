@@ -83,6 +83,7 @@ template<unsigned sa0, unsigned sa1, unsigned sb0, unsigned sb1, unsigned N,
 typename detail::get_expr2_nomask<V1, V2, void>::empty
     shuffle2(const any_vec32<N,V1>& a, const any_vec32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(shuffle2, a);
     static_assert(sa0 < 4 && sa1 < 4 && sb0 < 4 && sb1 < 4, "Selector out of range");
     typename detail::get_expr2_nomask<V1,V2,void>::type a0 = a.vec().eval(),
                                                         b0 = b.vec().eval();
@@ -131,6 +132,7 @@ template<unsigned s0, unsigned s1, unsigned N,
 typename detail::get_expr2_nomask<V1, V2, void>::empty
     shuffle2(const any_vec32<N,V1>& a, const any_vec32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(shuffle2, a);
     static_assert(s0 < 4 && s1 < 4, "Selector out of range");
     typename detail::get_expr2_nomask<V1,V2,void>::type a0 = a.vec().eval(),
                                                         b0 = b.vec().eval();
@@ -71,6 +71,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline uint8x16 shuffle_bytes16(uint8x16 a, uint8x16 b, uint8x16 mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
 #if SIMDPP_USE_NULL
     uint8x16 ai = a;
     uint8x16 bi = b;
@@ -121,6 +122,7 @@ inline uint8x16 shuffle_bytes16(uint8x16 a, uint8x16 b, uint8x16 mask)
 #if SIMDPP_USE_AVX2
 inline uint8x32 shuffle_bytes16(uint8x32 a, uint8x32 b, uint8x32 mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     int16x16 sel, ai, bi, r;
     sel = mask;
     sel = _mm256_slli_epi16(sel, 3); // the top 3 bits are already clear
@@ -128,42 +130,48 @@ inline uint8x32 shuffle_bytes16(uint8x32 a, uint8x32 b, uint8x32 mask)
     ai = _mm256_shuffle_epi8(a, mask);
     bi = _mm256_shuffle_epi8(b, mask);
     r = _mm256_blendv_epi8(ai, bi, sel);
-    return r;
+    return uint8x32(r);
 }
 #endif
 
 template<unsigned N>
 uint8<N> shuffle_bytes16(uint8<N> a, uint8<N> b, uint8<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     SIMDPP_VEC_ARRAY_IMPL3(uint8<N>, shuffle_bytes16, a, b, mask);
 }
 
 template<unsigned N>
 uint16<N> shuffle_bytes16(uint16<N> a, uint16<N> b, uint16<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     return (uint16<N>) shuffle_bytes16(uint8<N*2>(a), uint8<N*2>(b),
                                        uint8<N*2>(mask));
 }
 template<unsigned N>
 uint32<N> shuffle_bytes16(uint32<N> a, uint32<N> b, uint32<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     return (uint32<N>) shuffle_bytes16(uint8<N*4>(a), uint8<N*4>(b),
                                        uint8<N*4>(mask));
 }
 template<unsigned N>
 uint64<N> shuffle_bytes16(uint64<N> a, uint64<N> b, uint64<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     return (uint64<N>) shuffle_bytes16(uint8<N*8>(a), uint8<N*8>(b),
                                        uint8<N*8>(mask));
 }
 template<unsigned N>
 float32<N> shuffle_bytes16(float32<N> a, float32<N> b, uint32<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     return float32<N>(shuffle_bytes16(uint32<N>(a), uint32<N>(b), mask));
 }
 template<unsigned N>
 float64<N> shuffle_bytes16(float64<N> a, float64<N> b, uint64<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_bytes16, a);
     return float64<N>(shuffle_bytes16(uint64<N>(a), uint64<N>(b), mask));
 }
 /// @}
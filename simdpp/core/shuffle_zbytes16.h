@@ -77,6 +77,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline uint8x16 shuffle_zbytes16(uint8x16 a, uint8x16 b, uint8x16 mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
 #if SIMDPP_USE_NULL
     uint8x16 ai = a;
     uint8x16 bi = b;
@@ -132,6 +133,7 @@ inline uint8x16 shuffle_zbytes16(uint8x16 a, uint8x16 b, uint8x16 mask)
 #if SIMDPP_USE_AVX2
 inline uint8x32 shuffle_zbytes16(uint8x32 a, uint8x32 b, uint8x32 mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     int8x32 sel, set_zero, ai, bi, r;
     sel = mask;
     set_zero = cmp_lt(sel, int8x32::zero());
@@ -148,32 +150,38 @@ inline uint8x32 shuffle_zbytes16(uint8x32 a, uint8x32 b, uint8x32 mask)
 template<unsigned N>
 uint8<N> shuffle_zbytes16(uint8<N> a, uint8<N> b, uint8<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     SIMDPP_VEC_ARRAY_IMPL3(uint8<N>, shuffle_zbytes16, a, b, mask);
 }
 
 template<unsigned N>
 uint16<N> shuffle_zbytes16(uint16<N> a, uint16<N> b, uint16<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     return (uint16<N>) shuffle_zbytes16(uint8<N*2>(a), uint8<N*2>(b), uint8<N*2>(mask));
 }
 template<unsigned N>
 uint32<N> shuffle_zbytes16(uint32<N> a, uint32<N> b, uint32<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     return (uint32<N>) shuffle_zbytes16(uint8<N*4>(a), uint8<N*4>(b), uint8<N*4>(mask));
 }
 template<unsigned N>
 uint64<N> shuffle_zbytes16(uint64<N> a, uint64<N> b, uint64<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     return (uint64<N>) shuffle_zbytes16(uint8<N*8>(a), uint8<N*8>(b), uint8<N*8>(mask));
 }
 template<unsigned N>
 float32<N> shuffle_zbytes16(float32<N> a, float32<N> b, uint32<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     return float32<N>(shuffle_zbytes16(uint32<N>(a), uint32<N>(b), mask));
 }
 template<unsigned N>
 float64<N> shuffle_zbytes16(float64<N> a, float64<N> b, uint64<N> mask)
 {
+    SIMDPP_PROFILE_OP(shuffle_zbytes16, a);
     return float64<N>(shuffle_zbytes16(uint64<N>(a), uint64<N>(b), mask));
 }
 /// @}
@@ -103,6 +103,7 @@ template<unsigned s, unsigned N, class V>
 typename detail::get_expr_nomask<V, void>::empty
         splat(const any_vec<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(splat, a);
     static_assert(s < N, "Access out of bounds");
     typename detail::get_expr_nomask<V, void>::type ra = a.vec().eval();
     return detail::insn::i_splat<s>(ra);
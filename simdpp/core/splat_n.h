@@ -68,6 +68,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned s, unsigned N, class E>
 int8<N, expr_splat16<s,int8<N,E>>> splat16(int8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat16, a);
     static_assert(s < 16, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -75,6 +76,7 @@ int8<N, expr_splat16<s,int8<N,E>>> splat16(int8<N,E> a)
 template<unsigned s, unsigned N, class E>
 uint8<N, expr_splat16<s,uint8<N,E>>> splat16(uint8<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat16, a);
     static_assert(s < 16, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -103,6 +105,7 @@ uint8<N, expr_splat16<s,uint8<N,E>>> splat16(uint8<N,E> a)
 template<unsigned s, unsigned N, class E>
 int16<N, expr_splat8<s,int16<N,E>>> splat8(int16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat8, a);
     static_assert(s < 8, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -110,6 +113,7 @@ int16<N, expr_splat8<s,int16<N,E>>> splat8(int16<N,E> a)
 template<unsigned s, unsigned N, class E>
 uint16<N, expr_splat8<s,uint16<N,E>>> splat8(uint16<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat8, a);
     static_assert(s < 8, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -131,6 +135,7 @@ uint16<N, expr_splat8<s,uint16<N,E>>> splat8(uint16<N,E> a)
 template<unsigned s, unsigned N, class E>
 int32<N, expr_splat4<s,int32<N,E>>> splat4(int32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat4, a);
     static_assert(s < 4, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -138,6 +143,7 @@ int32<N, expr_splat4<s,int32<N,E>>> splat4(int32<N,E> a)
 template<unsigned s, unsigned N, class E>
 uint32<N, expr_splat4<s,uint32<N,E>>> splat4(uint32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat4, a);
     static_assert(s < 4, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -161,6 +167,7 @@ uint32<N, expr_splat4<s,uint32<N,E>>> splat4(uint32<N,E> a)
 template<unsigned s, unsigned N, class E>
 int64<N, expr_splat2<s,int64<N,E>>> splat2(int64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat2, a);
     static_assert(s < 2, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -168,6 +175,7 @@ int64<N, expr_splat2<s,int64<N,E>>> splat2(int64<N,E> a)
 template<unsigned s, unsigned N, class E>
 uint64<N, expr_splat2<s,uint64<N,E>>> splat2(uint64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat2, a);
     static_assert(s < 2, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -189,6 +197,7 @@ uint64<N, expr_splat2<s,uint64<N,E>>> splat2(uint64<N,E> a)
 template<unsigned s, unsigned N, class E>
 float32<N, expr_splat4<s,float32<N,E>>> splat4(float32<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat4, a);
     static_assert(s < 4, "Access out of bounds");
     return { { a }, 0 };
 }
@@ -212,6 +221,7 @@ float32<N, expr_splat4<s,float32<N,E>>> splat4(float32<N,E> a)
 template<unsigned s, unsigned N, class E>
 float64<N, expr_splat2<s,float64<N,E>>> splat2(float64<N,E> a)
 {
+    SIMDPP_PROFILE_OP(splat2, a);
     static_assert(s < 2, "Access out of bounds");
     return { { a }, 0 };
 }
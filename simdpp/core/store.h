@@ -61,6 +61,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class V>
 void store(void* p, const any_vec<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(store, a);
     static_assert(!is_mask<V>::value, "Masks can not be stored"); // FIXME: automatically convert
     detail::insn::i_store(reinterpret_cast<char*>(p), a.vec().eval());
 }
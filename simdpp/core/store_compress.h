@@ -0,0 +1,88 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/compress.h>
+#include <simdpp/detail/insn/store_partial.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Stores the elements for which @a mask is set to consecutive locations
+    in memory, preserving their order. Returns the number of the stored
+    elements.
+
+    @code
+    j = 0
+    for i in [0..N-1]:
+        if mask[i]:
+            *(p+j++) = a[i]
+    return j
+    @endcode
+
+    No memory past the stored elements is accessed, thus the function may
+    be used to filter an array in place or into a buffer of exact size.
+    @a p must be aligned to the element size. @a mask must be of the mask
+    type of @a a.
+
+    The elements are compressed as in compress() and are then stored as in
+    store_partial().
+
+    @novec{SSE2, NEON, ALTIVEC}
+*/
+template<unsigned N, class V, unsigned B, class M>
+unsigned store_compress(void* p, const any_vec<N,V>& a,
+                        const any_vec<B,M>& mask)
+{
+    SIMDPP_PROFILE_OP(store_compress, a);
+    static_assert(!is_mask<V>::value, "Mask types can not be stored");
+    using R = typename detail::get_expr_nosign<V, void>::type;
+    R ra = a.vec().eval();
+    typename R::mask_vector_type m = mask.vec().eval();
+    R r;
+    unsigned n = detail::insn::i_compress(r, ra, m);
+    detail::insn::i_store_partial(reinterpret_cast<char*>(p), r, n);
+    return n;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -65,6 +65,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class V>
 void store_first(void* p, const any_vec<N,V>& a, unsigned n)
 {
+    SIMDPP_PROFILE_OP(store_first, a);
     static_assert(!is_mask<V>::value, "Masks can not be stored"); // FIXME: automatically convert
     detail::insn::i_store_first(reinterpret_cast<char*>(p),
                                 a.vec().eval(), n);
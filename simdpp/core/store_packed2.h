@@ -57,6 +57,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class V1, class V2>
 void store_packed2(void* p, const any_vec<N,V1>& a, const any_vec<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(store_packed2, a);
     static_assert(!is_mask<V1>::value && !is_mask<V2>::value,
                   "Mask types can not be stored"); // FIXME
     static_assert(V1::size_tag == V2::size_tag,
@@ -59,6 +59,7 @@ template<unsigned N, class V1, class V2, class V3>
 void store_packed3(void* p, const any_vec<N,V1>& a, const any_vec<N,V2>& b,
                    const any_vec<N,V3>& c)
 {
+    SIMDPP_PROFILE_OP(store_packed3, a);
     static_assert(!is_mask<V1>::value && !is_mask<V2>::value && !is_mask<V3>::value,
                   "Mask types can not be stored"); // FIXME
     static_assert(V1::size_tag == V2::size_tag && V1::size_tag == V3::size_tag,
@@ -61,6 +61,7 @@ void store_packed4(void* p,
                    const any_vec<N,V1>& a, const any_vec<N,V2>& b,
                    const any_vec<N,V3>& c, const any_vec<N,V4>& d)
 {
+    SIMDPP_PROFILE_OP(store_packed4, a);
     static_assert(!is_mask<V1>::value && !is_mask<V2>::value &&
                   !is_mask<V3>::value && !is_mask<V4>::value,
                   "Mask types can not be stored"); // FIXME
@@ -63,6 +63,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class V>
 void stream(void* p, const any_vec<N,V>& a)
 {
+    SIMDPP_PROFILE_OP(stream, a);
     static_assert(!is_mask<V>::value, "Masks can not be stored"); // FIXME: convert automatically
     detail::insn::i_stream(reinterpret_cast<char*>(p), a.vec().eval());
 }
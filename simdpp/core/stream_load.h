@@ -0,0 +1,96 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STREAM_LOAD_H
+#define LIBSIMDPP_SIMDPP_CORE_STREAM_LOAD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/stream_load.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Loads a 128-bit, 256-bit or 512-bit integer, 32-bit or 64-bit float vector
+    from an aligned memory location, without polluting the caches, if
+    possible.
+
+    @par 128-bit version:
+
+    @code
+    a[0..127] = *(p)
+    @endcode
+    @a p must be aligned to 16 bytes.
+
+    @par 256-bit version:
+
+    @code
+    a[0..255] = *(p)
+    @endcode
+    @a p must be aligned to 32 bytes.
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, 2}
+    @icost{AVX, 2}
+
+    @par 512-bit version:
+
+    @code
+    a[0..511] = *(p)
+    @endcode
+    @a p must be aligned to 64 bytes.
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, 4}
+    @icost{AVX, 4}
+    @icost{AVX2, 2}
+    @icost{AVX512F, 1}
+
+    The non-temporal hint is honored by most processors only on
+    write-combining memory. Otherwise the function behaves as load().
+*/
+template<class V>
+V stream_load(const void* p)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    V a;
+    SIMDPP_PROFILE_OP(stream_load, a);
+    typename detail::remove_sign<V>::type r;
+    detail::insn::i_stream_load(r, reinterpret_cast<const char*>(p));
+    a = V(r);
+    return a;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
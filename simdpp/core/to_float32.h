@@ -33,6 +33,7 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/insert.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
@@ -67,6 +68,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline float32x4 to_float32(int32x4 a)
 {
+    SIMDPP_PROFILE_OP(to_float32, a);
 #if SIMDPP_USE_NULL
     return null::foreach<float32x4>(a, [](int32_t x) { return float(x); });
 #elif SIMDPP_USE_SSE2
@@ -89,13 +91,30 @@ inline float32x4 to_float32(int32x4 a)
 #if SIMDPP_USE_AVX
 inline float32x8 to_float32(int32x8 a)
 {
+    SIMDPP_PROFILE_OP(to_float32, a);
+#if SIMDPP_USE_AVX2
     return _mm256_cvtepi32_ps(a);
+#else
+    float32x4 r1, r2;
+    r1 = to_float32(a[0]);
+    r2 = to_float32(a[1]);
+    return combine(r1, r2);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline float32<16> to_float32(int32<16> a)
+{
+    SIMDPP_PROFILE_OP(to_float32, a);
+    return _mm512_cvtepi32_ps(a);
 }
 #endif
 
 template<unsigned N>
 float32<N> to_float32(int32<N> a)
 {
+    SIMDPP_PROFILE_OP(to_float32, a);
     SIMDPP_VEC_ARRAY_IMPL1(float32<N>, to_float32, a);
 }
 /// @}
@@ -137,6 +156,7 @@ float32<N> to_float32(int32<N> a)
 */
 inline float32x4 to_float32(float64x4 a)
 {
+    SIMDPP_PROFILE_OP(to_float32, a);
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
     detail::mem_block<float32x4> r;
     r[0] = float(a[0].el(0));
@@ -158,10 +178,15 @@ inline float32x4 to_float32(float64x4 a)
 #if SIMDPP_USE_AVX
 inline float32x8 to_float32(float64<8> a)
 {
+    SIMDPP_PROFILE_OP(to_float32, a);
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtpd_ps(a);
+#else
     float32x4 r1, r2;
     r1 = to_float32(a[0]);
     r2 = to_float32(a[1]);
     return combine(r1, r2);
+#endif
 }
 #endif
 
@@ -68,6 +68,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline float64x4 to_float64(int32x4 a)
 {
+    SIMDPP_PROFILE_OP(to_float64, a);
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
     detail::mem_block<int32x4> ax(a);
     float64x4 r;
@@ -87,14 +88,19 @@ inline float64x4 to_float64(int32x4 a)
 }
 
 #if SIMDPP_USE_AVX2
-inline float64<8> to_float64(float32x8 a)
+inline float64<8> to_float64(int32x8 a)
 {
+    SIMDPP_PROFILE_OP(to_float64, a);
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtepi32_pd(a);
+#else
     float64x4 r1, r2;
-    float32x4 a1, a2;
-    split(a, a1, a2);
+    uint32x4 a1, a2;
+    split(uint32x8(a), a1, a2);
     r1 = _mm256_cvtepi32_pd(a1);
     r2 = _mm256_cvtepi32_pd(a2);
     return combine(r1, r2);
+#endif
 }
 #endif
 /// @}
@@ -126,6 +132,7 @@ inline float64<8> to_float64(float32x8 a)
 */
 inline float64x4 to_float64(float32x4 a)
 {
+    SIMDPP_PROFILE_OP(to_float64, a);
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
     detail::mem_block<float32x4> ax(a);
     float64x4 r;
@@ -147,12 +154,17 @@ inline float64x4 to_float64(float32x4 a)
 #if SIMDPP_USE_AVX
 inline float64<8> to_float64(float32x8 a)
 {
-    float64x2 r1, r2;
+    SIMDPP_PROFILE_OP(to_float64, a);
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtps_pd(a);
+#else
+    float64x4 r1, r2;
     float32x4 a1, a2;
     split(a, a1, a2);
     r1 = _mm256_cvtps_pd(a1);
     r2 = _mm256_cvtps_pd(a2);
     return combine(r1, r2);
+#endif
 }
 #endif
 
@@ -58,6 +58,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline uint16x16 to_int16(int8x16 a)
 {
+    SIMDPP_PROFILE_OP(to_int16, a);
 #if SIMDPP_USE_NULL
     int16x16 r;
     for (unsigned i = 0; i < 16; i++) {
@@ -102,6 +103,7 @@ inline uint16x16 to_int16(int8x16 a)
 */
 inline uint16x16 to_int16(uint8x16 a)
 {
+    SIMDPP_PROFILE_OP(to_int16, a);
 #if SIMDPP_USE_NULL
     uint16x16 r;
     for (unsigned i = 0; i < 8; i++) {
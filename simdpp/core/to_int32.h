@@ -59,6 +59,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline int32x8 to_int32(int16x8 a)
 {
+    SIMDPP_PROFILE_OP(to_int32, a);
 #if SIMDPP_USE_NULL
     int32x8 r;
     for (unsigned i = 0; i < 8; i++) {
@@ -117,6 +118,7 @@ inline int32x8 to_int32(int16x8 a)
 */
 inline int32x4 to_int32(float32x4 a)
 {
+    SIMDPP_PROFILE_OP(to_int32, a);
 #if SIMDPP_USE_NULL
     return null::foreach<int32x4>(a, [](float x) { return int32_t(x); });
 #elif SIMDPP_USE_SSE2
@@ -139,6 +141,7 @@ inline int32x4 to_int32(float32x4 a)
 #if SIMDPP_USE_AVX2
 inline uint32x8 to_int32x8(float32x8 a)
 {
+    SIMDPP_PROFILE_OP(to_int32x8, a);
     return _mm256_cvttps_epi32(a);
 }
 #endif
@@ -146,6 +149,7 @@ inline uint32x8 to_int32x8(float32x8 a)
 template<unsigned N>
 uint32<N> to_int32x8(float32<N> a)
 {
+    SIMDPP_PROFILE_OP(to_int32x8, a);
     SIMDPP_VEC_ARRAY_IMPL1(uint32<N>, to_int32, a);
 }
 /// @}
@@ -178,6 +182,7 @@ uint32<N> to_int32x8(float32<N> a)
 */
 inline int32x4 to_int32(float64x4 a)
 {
+    SIMDPP_PROFILE_OP(to_int32, a);
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
     detail::mem_block<int32x4> r;
     r[0] = int32_t(a[0].el(0));
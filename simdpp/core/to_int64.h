@@ -58,6 +58,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 */
 inline uint64x4 to_int64(int32x4 a)
 {
+    SIMDPP_PROFILE_OP(to_int64, a);
 #if SIMDPP_USE_NULL
     int64x4 r;
     r[0].el(0) = int64_t(a.el(0));
@@ -100,6 +101,7 @@ inline uint64x4 to_int64(int32x4 a)
 */
 inline uint64x4 to_int64(uint32x4 a)
 {
+    SIMDPP_PROFILE_OP(to_int64, a);
 #if SIMDPP_USE_NULL
     uint64x4 r;
     r[0].el(0) = uint64_t(a.el(0));
@@ -63,6 +63,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 uint8<N, uint8<N>> unzip16_hi(uint8<N,E1> a, uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip16_hi, a);
     return detail::insn::i_unzip16_hi(a.eval(), b.eval());
 }
 
@@ -87,6 +88,7 @@ uint8<N, uint8<N>> unzip16_hi(uint8<N,E1> a, uint8<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint16<N, uint16<N>> unzip8_hi(uint16<N,E1> a, uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip8_hi, a);
     return detail::insn::i_unzip8_hi(a.eval(), b.eval());
 }
 
@@ -110,6 +112,7 @@ uint16<N, uint16<N>> unzip8_hi(uint16<N,E1> a, uint16<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint32<N, uint32<N>> unzip4_hi(uint32<N,E1> a, uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip4_hi, a);
     return detail::insn::i_unzip4_hi(a.eval(), b.eval());
 }
 
@@ -133,6 +136,7 @@ uint32<N, uint32<N>> unzip4_hi(uint32<N,E1> a, uint32<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint64<N, uint64<N>> unzip2_hi(uint64<N,E1> a, uint64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip2_hi, a);
     return detail::insn::i_unzip2_hi(a.eval(), b.eval());
 }
 
@@ -152,6 +156,7 @@ uint64<N, uint64<N>> unzip2_hi(uint64<N,E1> a, uint64<N,E2> b)
 template<unsigned N, class E1, class E2>
 float32<N, float32<N>> unzip4_hi(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip4_hi, a);
     return detail::insn::i_unzip4_hi(a.eval(), b.eval());
 }
 
@@ -175,6 +180,7 @@ float32<N, float32<N>> unzip4_hi(float32<N,E1> a, float32<N,E2> b)
 template<unsigned N, class E1, class E2>
 float64<N, float64<N>> unzip2_hi(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip2_hi, a);
     return detail::insn::i_unzip2_hi(a.eval(), b.eval());
 }
 
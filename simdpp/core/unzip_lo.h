@@ -64,6 +64,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
 template<unsigned N, class E1, class E2>
 uint8<N, uint8<N>> unzip16_lo(uint8<N,E1> a, uint8<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip16_lo, a);
     return detail::insn::i_unzip16_lo(a.eval(), b.eval());
 }
 
@@ -92,6 +93,7 @@ uint8<N, uint8<N>> unzip16_lo(uint8<N,E1> a, uint8<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint16<N, uint16<N>> unzip8_lo(uint16<N,E1> a, uint16<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip8_lo, a);
     return detail::insn::i_unzip8_lo(a.eval(), b.eval());
 }
 
@@ -115,6 +117,7 @@ uint16<N, uint16<N>> unzip8_lo(uint16<N,E1> a, uint16<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint32<N, uint32<N>> unzip4_lo(uint32<N,E1> a, uint32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip4_lo, a);
     return detail::insn::i_unzip4_lo(a.eval(), b.eval());
 }
 
@@ -134,6 +137,7 @@ uint32<N, uint32<N>> unzip4_lo(uint32<N,E1> a, uint32<N,E2> b)
 template<unsigned N, class E1, class E2>
 uint64<N, uint64<N>> unzip2_lo(uint64<N,E1> a, uint64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip2_lo, a);
     return detail::insn::i_unzip2_lo(a.eval(), b.eval());
 }
 
@@ -153,6 +157,7 @@ uint64<N, uint64<N>> unzip2_lo(uint64<N,E1> a, uint64<N,E2> b)
 template<unsigned N, class E1, class E2>
 float32<N, float32<N>> unzip4_lo(float32<N,E1> a, float32<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip4_lo, a);
     return detail::insn::i_unzip4_lo(a.eval(), b.eval());
 }
 
@@ -176,6 +181,7 @@ float32<N, float32<N>> unzip4_lo(float32<N,E1> a, float32<N,E2> b)
 template<unsigned N, class E1, class E2>
 float64<N, float64<N>> unzip2_lo(float64<N,E1> a, float64<N,E2> b)
 {
+    SIMDPP_PROFILE_OP(unzip2_lo, a);
     return detail::insn::i_unzip2_lo(a.eval(), b.eval());
 }
 
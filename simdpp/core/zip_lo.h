@@ -59,6 +59,7 @@ template<unsigned N, class V1, class V2>
 typename detail::get_expr2_nomask<V1, V2, void>::empty
         zip16_lo(const any_vec8<N,V1>& a, const any_vec8<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(zip16_lo, a);
     typename detail::get_expr2_nomask_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -69,6 +70,7 @@ template<unsigned N, class V1, class V2>
 typename detail::get_expr2_nomask<V1, V2, void>::empty
         zip8_lo(const any_vec16<N,V1>& a, const any_vec16<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(zip8_lo, a);
     typename detail::get_expr2_nomask_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -79,6 +81,7 @@ template<unsigned N, class V1, class V2>
 typename detail::get_expr2_nomask<V1, V2, void>::empty
         zip4_lo(const any_vec32<N,V1>& a, const any_vec32<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(zip4_lo, a);
     typename detail::get_expr2_nomask_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
@@ -89,6 +92,7 @@ template<unsigned N, class V1, class V2>
 typename detail::get_expr2_nomask<V1, V2, void>::empty
         zip2_lo(const any_vec64<N,V1>& a, const any_vec64<N,V2>& b)
 {
+    SIMDPP_PROFILE_OP(zip2_lo, a);
     typename detail::get_expr2_nomask_nosign<V1, V2, void>::type ra, rb;
     ra = a.vec().eval();
     rb = b.vec().eval();
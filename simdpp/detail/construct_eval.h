@@ -34,6 +34,7 @@
 
 #include <simdpp/setup_arch.h>
 #include <simdpp/expr.h>
+#include <simdpp/detail/profile.h>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -59,9 +60,21 @@ void construct_eval(V& v, const expr_vec_load_u& e);
 template<class V, class VE, unsigned N>
 void construct_eval(V& v, const expr_vec_make_const<VE, N>& e);
 
+#ifdef SIMDPP_PROFILE_OPS
+// the names under which the loads and the constants are profiled
+inline const char* construct_eval_name(const expr_vec_load_splat&) { return "load_splat"; }
+template<class VE>
+const char* construct_eval_name(const expr_vec_set_splat<VE>&) { return "splat"; }
+inline const char* construct_eval_name(const expr_vec_load&) { return "load"; }
+inline const char* construct_eval_name(const expr_vec_load_u&) { return "load_u"; }
+template<class VE, unsigned N>
+const char* construct_eval_name(const expr_vec_make_const<VE, N>&) { return "make_const"; }
+#endif
+
 template<class V, class E>
 void construct_eval_wrapper(V& v, const E& e)
 {
+    SIMDPP_PROFILE_OP_NAMED(construct_eval_name(e), v);
     construct_eval(v, e);
 }
 
@@ -69,6 +69,16 @@ float32<8> expr_eval(expr_abs<float32<8,E>> q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E>
+float32<16> expr_eval(expr_abs<float32<16,E>> q)
+{
+    float32<16> a = q.a.eval();
+    int32<16> mask = make_int(0x7fffffff);
+    return bit_and(a, mask);
+}
+#endif
+
 template<unsigned N, class E>
 float32<N> expr_eval(expr_abs<float32<N,E>> q)
 {
@@ -100,6 +110,16 @@ float64x4 expr_eval(expr_abs<float64<4,E>> q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E>
+float64x8 expr_eval(expr_abs<float64<8,E>> q)
+{
+    float64x8 a = q.a.eval();
+    int64<8> mask = make_int(0x7fffffffffffffff);
+    return bit_and(a, mask);
+}
+#endif
+
 template<unsigned N, class E>
 float64<N> expr_eval(expr_abs<float64<N,E>> q)
 {
@@ -69,6 +69,17 @@ float32<8> expr_eval(expr_add<float32<8,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2>
+float32<16> expr_eval(expr_add<float32<16,E1>,
+                               float32<16,E2>> q)
+{
+    float32<16> a = q.a.eval();
+    float32<16> b = q.b.eval();
+    return _mm512_add_ps(a, b);
+}
+#endif
+
 template<unsigned N, class E1, class E2>
 float32<N> expr_eval(expr_add<float32<N,E1>,
                               float32<N,E2>> q)
@@ -104,6 +115,17 @@ float64<4> expr_eval(expr_add<float64<4,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2>
+float64<8> expr_eval(expr_add<float64<8,E1>,
+                              float64<8,E2>> q)
+{
+    float64<8> a = q.a.eval();
+    float64<8> b = q.b.eval();
+    return _mm512_add_pd(a, b);
+}
+#endif
+
 template<unsigned N, class E1, class E2>
 float64<N> expr_eval(expr_add<float64<N,E1>,
                               float64<N,E2>> q)
@@ -80,6 +80,19 @@ float32<8> expr_eval(expr_fmsub<float32<8,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2, class E3>
+float32<16> expr_eval(expr_fmsub<float32<16,E1>,
+                                 float32<16,E2>,
+                                 float32<16,E3>> q)
+{
+    float32<16> a = q.a.eval();
+    float32<16> b = q.b.eval();
+    float32<16> c = q.c.eval();
+    return _mm512_fmsub_ps(a, b, c);
+}
+#endif
+
 template<unsigned N, class E1, class E2, class E3>
 float32<N> expr_eval(expr_fmsub<float32<N,E1>,
                                 float32<N,E2>,
@@ -131,6 +144,19 @@ float64<4> expr_eval(expr_fmsub<float64<4,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2, class E3>
+float64<8> expr_eval(expr_fmsub<float64<8,E1>,
+                                float64<8,E2>,
+                                float64<8,E3>> q)
+{
+    float64<8> a = q.a.eval();
+    float64<8> b = q.b.eval();
+    float64<8> c = q.c.eval();
+    return _mm512_fmsub_pd(a, b, c);
+}
+#endif
+
 template<unsigned N, class E1, class E2, class E3>
 float64<N> expr_eval(expr_fmsub<float64<N,E1>,
                                 float64<N,E2>,
@@ -67,6 +67,16 @@ float32<8> expr_eval(expr_neg<float32<8,E>> q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E>
+float32<16> expr_eval(expr_neg<float32<16,E>> q)
+{
+    float32<16> a = q.a.eval();
+    int32x16 zero = make_int(0x80000000);
+    return bit_xor(a, zero);
+}
+#endif
+
 template<unsigned N, class E>
 float32<N> expr_eval(expr_neg<float32<N,E>> q)
 {
@@ -98,6 +108,16 @@ float64x4 expr_eval(expr_neg<float64<4,E>> q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E>
+float64x8 expr_eval(expr_neg<float64<8,E>> q)
+{
+    float64x8 a = q.a.eval();
+    int64x8 zero = make_int(0x8000000000000000);
+    return bit_xor(a, zero);
+}
+#endif
+
 template<unsigned N, class E>
 float64<N> expr_eval(expr_neg<float64<N,E>> q)
 {
@@ -147,6 +147,17 @@ uint32<8> expr_eval(expr_add<uint32<8,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2>
+uint32<16> expr_eval(expr_add<uint32<16,E1>,
+                              uint32<16,E2>> q)
+{
+    uint32<16> a = q.a.eval();
+    uint32<16> b = q.b.eval();
+    return _mm512_add_epi32(a, b);
+}
+#endif
+
 template<unsigned N, class E1, class E2>
 uint32<N> expr_eval(expr_add<uint32<N,E1>,
                              uint32<N,E2>> q)
@@ -193,6 +204,17 @@ uint64<4> expr_eval(expr_add<uint64<4,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2>
+uint64<8> expr_eval(expr_add<uint64<8,E1>,
+                             uint64<8,E2>> q)
+{
+    uint64<8> a = q.a.eval();
+    uint64<8> b = q.b.eval();
+    return _mm512_add_epi64(a, b);
+}
+#endif
+
 template<unsigned N, class E1, class E2>
 uint64<N> expr_eval(expr_add<uint64<N,E1>,
                              uint64<N,E2>> q)
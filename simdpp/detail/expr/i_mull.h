@@ -36,6 +36,8 @@
 #include <simdpp/detail/mem_block.h>
 #include <simdpp/detail/not_implemented.h>
 #include <simdpp/core/detail/vec_insert.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/insert.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
 
@@ -108,9 +110,19 @@ int32<16> expr_eval(expr_mull<int16<16,E1>,
 {
     int16<16> a = q.a.eval();
     int16<16> b = q.b.eval();
+#if SIMDPP_USE_AVX512F
+    int32<16> a32 = _mm512_cvtepi16_epi32(a);
+    int32<16> b32 = _mm512_cvtepi16_epi32(b);
+    return _mm512_mullo_epi32(a32, b32);
+#else
     int16x16 lo = _mm256_mullo_epi16(a, b);
     int16x16 hi = _mm256_mulhi_epi16(a, b);
-    return (int32<16>) combine(zip8_lo(lo, hi), zip8_hi(lo, hi));
+    // the unpack instructions work within 128-bit lanes
+    uint16x16 rl = zip8_lo(lo, hi);
+    uint16x16 rh = zip8_hi(lo, hi);
+    return (int32<16>) combine(uint16x16(_mm256_permute2x128_si256(rl, rh, 0x20)),
+                               uint16x16(_mm256_permute2x128_si256(rl, rh, 0x31)));
+#endif
 }
 #endif
 
@@ -163,9 +175,19 @@ uint32<16> expr_eval(expr_mull<uint16<16,E1>,
 {
     uint16<16> a = q.a.eval();
     uint16<16> b = q.b.eval();
+#if SIMDPP_USE_AVX512F
+    uint32<16> a32 = _mm512_cvtepu16_epi32(a);
+    uint32<16> b32 = _mm512_cvtepu16_epi32(b);
+    return _mm512_mullo_epi32(a32, b32);
+#else
     int16x16 lo = _mm256_mullo_epi16(a, b);
-    int16x16 hi = _mm256_mulhi_epi16(a, b);
-    return (uint32<16>) combine(zip8_lo(lo, hi), zip8_hi(lo, hi));
+    int16x16 hi = _mm256_mulhi_epu16(a, b);
+    // the unpack instructions work within 128-bit lanes
+    uint16x16 rl = zip8_lo(lo, hi);
+    uint16x16 rh = zip8_hi(lo, hi);
+    return (uint32<16>) combine(uint16x16(_mm256_permute2x128_si256(rl, rh, 0x20)),
+                               uint16x16(_mm256_permute2x128_si256(rl, rh, 0x31)));
+#endif
 }
 #endif
 
@@ -223,6 +245,11 @@ int64<8> expr_eval(expr_mull<int32<8,E1>,
 {
     int32<8> a = q.a.eval();
     int32<8> b = q.b.eval();
+#if SIMDPP_USE_AVX512F
+    int64<8> a64 = _mm512_cvtepi32_epi64(a);
+    int64<8> b64 = _mm512_cvtepi32_epi64(b);
+    return _mm512_mul_epi32(a64, b64);
+#else
     int32x8 al, ah, bl, bh;
     int64x4 rl, rh;
     al = zip4_lo(a, a);
@@ -231,7 +258,26 @@ int64<8> expr_eval(expr_mull<int32<8,E1>,
     bh = zip4_hi(b, b);
     rl = _mm256_mul_epi32(al, bl);
     rh = _mm256_mul_epi32(ah, bh);
-    return combine(rl, rh);
+    return combine(uint64x4(_mm256_permute2x128_si256(rl, rh, 0x20)),
+                   uint64x4(_mm256_permute2x128_si256(rl, rh, 0x31)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2>
+int64<16> expr_eval(expr_mull<int32<16,E1>,
+                              int32<16,E2>> q)
+{
+    int32<16> a = q.a.eval();
+    int32<16> b = q.b.eval();
+    uint32<8> al, ah, bl, bh;
+    split(a, al, ah);
+    split(b, bl, bh);
+    int64<16> r;
+    r[0] = expr_eval(expr_mull<int32<8>, int32<8>>{int32<8>(al), int32<8>(bl)});
+    r[1] = expr_eval(expr_mull<int32<8>, int32<8>>{int32<8>(ah), int32<8>(bh)});
+    return r;
 }
 #endif
 
@@ -287,6 +333,11 @@ uint64<8> expr_eval(expr_mull<uint32<8,E1>,
 {
     uint32<8> a = q.a.eval();
     uint32<8> b = q.b.eval();
+#if SIMDPP_USE_AVX512F
+    uint64<8> a64 = _mm512_cvtepu32_epi64(a);
+    uint64<8> b64 = _mm512_cvtepu32_epi64(b);
+    return _mm512_mul_epu32(a64, b64);
+#else
     uint32x8 al, ah, bl, bh;
     uint64x4 rl, rh;
     al = zip4_lo(a, a);
@@ -295,7 +346,26 @@ uint64<8> expr_eval(expr_mull<uint32<8,E1>,
     bh = zip4_hi(b, b);
     rl = _mm256_mul_epu32(al, bl);
     rh = _mm256_mul_epu32(ah, bh);
-    return combine(rl, rh);
+    return combine(uint64x4(_mm256_permute2x128_si256(rl, rh, 0x20)),
+                   uint64x4(_mm256_permute2x128_si256(rl, rh, 0x31)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class E1, class E2>
+uint64<16> expr_eval(expr_mull<uint32<16,E1>,
+                               uint32<16,E2>> q)
+{
+    uint32<16> a = q.a.eval();
+    uint32<16> b = q.b.eval();
+    uint32<8> al, ah, bl, bh;
+    split(a, al, ah);
+    split(b, bl, bh);
+    uint64<16> r;
+    r[0] = expr_eval(expr_mull<uint32<8>, uint32<8>>{al, bl});
+    r[1] = expr_eval(expr_mull<uint32<8>, uint32<8>>{ah, bh});
+    return r;
 }
 #endif
 
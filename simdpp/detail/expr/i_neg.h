@@ -127,6 +127,15 @@ int32<8> expr_eval(expr_neg<int32<8,E>> q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E>
+int32<16> expr_eval(expr_neg<int32<16,E>> q)
+{
+    int32<16> a = q.a.eval();
+    return sub(int32x16::zero(), a);
+}
+#endif
+
 template<unsigned N, class E>
 int32<N> expr_eval(expr_neg<int32<N,E>> q)
 {
@@ -156,6 +165,15 @@ uint64<4> expr_eval(expr_neg<int64<4,E>> q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class E>
+uint64<8> expr_eval(expr_neg<int64<8,E>> q)
+{
+    int64<8> a = q.a.eval();
+    return sub(int64x8::zero(), a);
+}
+#endif
+
 template<unsigned N, class E>
 uint64<N> expr_eval(expr_neg<int64<N,E>> q)
 {
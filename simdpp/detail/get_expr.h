@@ -36,6 +36,7 @@
 #include <simdpp/types/fwd.h>
 #include <simdpp/types/any.h>
 #include <simdpp/types/tag.h>
+#include <type_traits>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -157,6 +158,28 @@ public:
     using empty = typename type_of_tag<type_tag + size_tag, V1::length_bytes, E>::empty;
 };
 
+/*  Selects the type of the second operand of a bitwise operation between a
+    vector and a mask. The mask is kept as-is when it has the same element
+    type and size as the vector, so that the operation can be applied through
+    the mask directly (e.g. as a zero-masking move on AVX-512). Otherwise the
+    operand is converted as in get_expr2_nosign.
+*/
+template<class V1, class V2>
+class get_expr_bitop_mask {
+    static const bool is_v1_mask = V1::type_tag == SIMDPP_TAG_MASK_FLOAT ||
+                                   V1::type_tag == SIMDPP_TAG_MASK_INT;
+    static const bool is_v1_float = V1::type_tag == SIMDPP_TAG_FLOAT;
+    static const unsigned mask_tag = is_v1_float ? SIMDPP_TAG_MASK_FLOAT : SIMDPP_TAG_MASK_INT;
+    static const bool keep_mask = !is_v1_mask && V2::type_tag == mask_tag &&
+                                  V1::size_tag == V2::size_tag;
+
+    using nosign = get_expr2_nosign<V1, V2, void>;
+public:
+    using type = typename std::conditional<keep_mask,
+                    typename type_of_tag<mask_tag + V2::size_tag, V1::length_bytes, void>::type,
+                    typename nosign::type>::type;
+};
+
 template<class V1, class V2, class V3, class E>
 class get_expr3 {
     static const unsigned type_tag_t1 = V1::type_tag > V2::type_tag ? V1::type_tag : V2::type_tag;
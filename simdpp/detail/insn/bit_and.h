@@ -63,6 +63,18 @@ inline uint8x32 i_bit_and(uint8x32 a, uint8x32 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_and(uint32x16 a, uint32x16 b)
+{
+    return _mm512_and_si512(a, b);
+}
+
+inline uint64x8 i_bit_and(uint64x8 a, uint64x8 b)
+{
+    return _mm512_and_si512(a, b);
+}
+#endif
+
 template<unsigned N>
 uint8<N> i_bit_and(uint8<N> a, uint8<N> b)
 {
@@ -142,9 +154,14 @@ inline uint64x2 i_bit_and(uint64x2 a, mask_int64x2 b)
 
 #if SIMDPP_USE_AVX2
 inline uint8x32  i_bit_and(uint8x32 a,  mask_int8x32 b)  { return i_bit_and(a, uint8x32(b)); }
-inline uint16x16 i_bit_and(uint16x16 a, mask_int16x16 b) { return i_bit_and(uint8x32(a), uint8x32(b)); }
-inline uint32x8  i_bit_and(uint32x8 a,  mask_int32x8 b)  { return i_bit_and(uint8x32(a), uint8x32(b)); }
-inline uint64x4  i_bit_and(uint64x4 a, mask_int64x4 b)   { return i_bit_and(uint8x32(a), uint8x32(b)); }
+inline uint16x16 i_bit_and(uint16x16 a, mask_int16x16 b) { return (uint16x16) i_bit_and(uint8x32(a), uint8x32(b)); }
+inline uint32x8  i_bit_and(uint32x8 a,  mask_int32x8 b)  { return (uint32x8) i_bit_and(uint8x32(a), uint8x32(b)); }
+inline uint64x4  i_bit_and(uint64x4 a, mask_int64x4 b)   { return (uint64x4) i_bit_and(uint8x32(a), uint8x32(b)); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_and(uint32x16 a, mask_int32x16 b) { return _mm512_maskz_mov_epi32(b, a); }
+inline uint64x8  i_bit_and(uint64x8 a,  mask_int64x8 b)  { return _mm512_maskz_mov_epi64(b, a); }
 #endif
 
 template<unsigned N>
@@ -211,9 +228,14 @@ inline mask_int64x2 i_bit_and(mask_int64x2 a, mask_int64x2 b)
 
 #if SIMDPP_USE_AVX2
 inline mask_int8x32  i_bit_and(mask_int8x32 a,  mask_int8x32 b)  { return i_bit_and(uint8x32(a), uint8x32(b)); }
-inline mask_int16x16 i_bit_and(mask_int16x16 a, mask_int16x16 b) { return i_bit_and(uint8x32(a), uint8x32(b)); }
-inline mask_int32x8  i_bit_and(mask_int32x8 a,  mask_int32x8 b)  { return i_bit_and(uint8x32(a), uint8x32(b)); }
-inline mask_int64x4  i_bit_and(mask_int64x4 a,  mask_int64x4 b)  { return i_bit_and(uint8x32(a), uint8x32(b)); }
+inline mask_int16x16 i_bit_and(mask_int16x16 a, mask_int16x16 b) { return (mask_int16x16) i_bit_and(uint16x16(a), uint16x16(b)); }
+inline mask_int32x8  i_bit_and(mask_int32x8 a,  mask_int32x8 b)  { return (mask_int32x8) i_bit_and(uint32x8(a), uint32x8(b)); }
+inline mask_int64x4  i_bit_and(mask_int64x4 a,  mask_int64x4 b)  { return (mask_int64x4) i_bit_and(uint64x4(a), uint64x4(b)); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_bit_and(mask_int32x16 a, mask_int32x16 b) { return _mm512_kand(a, b); }
+inline mask_int64x8  i_bit_and(mask_int64x8 a,  mask_int64x8 b)  { return __mmask8(a & b); }
 #endif
 
 template<unsigned N>
@@ -263,6 +285,13 @@ inline float32x8 i_bit_and(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_and(float32x16 a, float32x16 b)
+{
+    return float32x16(i_bit_and(uint32x16(a), uint32x16(b)));
+}
+#endif
+
 template<unsigned N>
 float32<N> i_bit_and(float32<N> a, float32<N> b)
 {
@@ -291,6 +320,13 @@ inline float32x8 i_bit_and(float32x8 a, mask_float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_and(float32x16 a, mask_float32x16 b)
+{
+    return _mm512_maskz_mov_ps(b, a);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_bit_and(float32<N> a, mask_float32<N> b)
 {
@@ -313,6 +349,13 @@ inline mask_float32x8 i_bit_and(mask_float32x8 a, mask_float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_bit_and(mask_float32x16 a, mask_float32x16 b)
+{
+    return _mm512_kand(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_bit_and(mask_float32<N> a, mask_float32<N> b)
 {
@@ -337,6 +380,13 @@ inline float64x4 i_bit_and(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_and(float64x8 a, float64x8 b)
+{
+    return float64x8(i_bit_and(uint64x8(a), uint64x8(b)));
+}
+#endif
+
 template<unsigned N>
 inline float64<N> i_bit_and(float64<N> a, float64<N> b)
 {
@@ -365,6 +415,13 @@ inline float64x4 i_bit_and(float64x4 a, mask_float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_and(float64x8 a, mask_float64x8 b)
+{
+    return _mm512_maskz_mov_pd(b, a);
+}
+#endif
+
 template<unsigned N>
 float64<N> i_bit_and(float64<N> a, mask_float64<N> b)
 {
@@ -387,6 +444,13 @@ inline mask_float64x4 i_bit_and(mask_float64x4 a, mask_float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_bit_and(mask_float64x8 a, mask_float64x8 b)
+{
+    return __mmask8(a & b);
+}
+#endif
+
 template<unsigned N>
 inline mask_float64<N> i_bit_and(mask_float64<N> a, mask_float64<N> b)
 {
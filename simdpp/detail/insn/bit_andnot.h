@@ -64,6 +64,18 @@ inline uint8x32 i_bit_andnot(uint8x32 a, uint8x32 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_andnot(uint32x16 a, uint32x16 b)
+{
+    return _mm512_andnot_si512(b, a);
+}
+
+inline uint64x8 i_bit_andnot(uint64x8 a, uint64x8 b)
+{
+    return _mm512_andnot_si512(b, a);
+}
+#endif
+
 template<unsigned N>
 inline uint8<N> i_bit_andnot(uint8<N> a, uint8<N> b)
 {
@@ -143,9 +155,14 @@ inline uint64x2 i_bit_andnot(uint64x2 a, mask_int64x2 b)
 
 #if SIMDPP_USE_AVX2
 inline uint8x32  i_bit_andnot(uint8x32 a,  mask_int8x32 b)  { return i_bit_andnot(a, uint8x32(b)); }
-inline uint16x16 i_bit_andnot(uint16x16 a, mask_int16x16 b) { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
-inline uint32x8  i_bit_andnot(uint32x8 a,  mask_int32x8 b)  { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
-inline uint64x4  i_bit_andnot(uint64x4 a, mask_int64x4 b)   { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
+inline uint16x16 i_bit_andnot(uint16x16 a, mask_int16x16 b) { return (uint16x16) i_bit_andnot(uint8x32(a), uint8x32(b)); }
+inline uint32x8  i_bit_andnot(uint32x8 a,  mask_int32x8 b)  { return (uint32x8) i_bit_andnot(uint8x32(a), uint8x32(b)); }
+inline uint64x4  i_bit_andnot(uint64x4 a, mask_int64x4 b)   { return (uint64x4) i_bit_andnot(uint8x32(a), uint8x32(b)); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_andnot(uint32x16 a, mask_int32x16 b) { return _mm512_maskz_mov_epi32(_mm512_knot(b), a); }
+inline uint64x8  i_bit_andnot(uint64x8 a,  mask_int64x8 b)  { return _mm512_maskz_mov_epi64(__mmask8(~b), a); }
 #endif
 
 template<unsigned N>
@@ -212,9 +229,14 @@ inline mask_int64x2 i_bit_andnot(mask_int64x2 a, mask_int64x2 b)
 
 #if SIMDPP_USE_AVX2
 inline mask_int8x32  i_bit_andnot(mask_int8x32 a,  mask_int8x32 b)  { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
-inline mask_int16x16 i_bit_andnot(mask_int16x16 a, mask_int16x16 b) { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
-inline mask_int32x8  i_bit_andnot(mask_int32x8 a,  mask_int32x8 b)  { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
-inline mask_int64x4  i_bit_andnot(mask_int64x4 a,  mask_int64x4 b)  { return i_bit_andnot(uint8x32(a), uint8x32(b)); }
+inline mask_int16x16 i_bit_andnot(mask_int16x16 a, mask_int16x16 b) { return (mask_int16x16) i_bit_andnot(uint16x16(a), uint16x16(b)); }
+inline mask_int32x8  i_bit_andnot(mask_int32x8 a,  mask_int32x8 b)  { return (mask_int32x8) i_bit_andnot(uint32x8(a), uint32x8(b)); }
+inline mask_int64x4  i_bit_andnot(mask_int64x4 a,  mask_int64x4 b)  { return (mask_int64x4) i_bit_andnot(uint64x4(a), uint64x4(b)); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_bit_andnot(mask_int32x16 a, mask_int32x16 b) { return _mm512_kandn(b, a); }
+inline mask_int64x8  i_bit_andnot(mask_int64x8 a,  mask_int64x8 b)  { return __mmask8(a & ~b); }
 #endif
 
 template<unsigned N>
@@ -262,6 +284,13 @@ inline float32x8 i_bit_andnot(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_andnot(float32x16 a, float32x16 b)
+{
+    return float32x16(i_bit_andnot(uint32x16(a), uint32x16(b)));
+}
+#endif
+
 template<unsigned N>
 float32<N> i_bit_andnot(float32<N> a, float32<N> b)
 {
@@ -290,6 +319,13 @@ inline float32x8 i_bit_andnot(float32x8 a, mask_float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_andnot(float32x16 a, mask_float32x16 b)
+{
+    return _mm512_maskz_mov_ps(_mm512_knot(b), a);
+}
+#endif
+
 template<unsigned N>
 inline float32<N> i_bit_andnot(float32<N> a, mask_float32<N> b)
 {
@@ -312,6 +348,13 @@ inline mask_float32x8 i_bit_andnot(mask_float32x8 a, mask_float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_bit_andnot(mask_float32x16 a, mask_float32x16 b)
+{
+    return _mm512_kandn(b, a);
+}
+#endif
+
 template<unsigned N>
 inline mask_float32<N> i_bit_andnot(mask_float32<N> a, mask_float32<N> b)
 {
@@ -336,6 +379,13 @@ inline float64x4 i_bit_andnot(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_andnot(float64x8 a, float64x8 b)
+{
+    return float64x8(i_bit_andnot(uint64x8(a), uint64x8(b)));
+}
+#endif
+
 template<unsigned N>
 inline float64<N> i_bit_andnot(float64<N> a, float64<N> b)
 {
@@ -364,6 +414,13 @@ inline float64x4 i_bit_andnot(float64x4 a, mask_float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_andnot(float64x8 a, mask_float64x8 b)
+{
+    return _mm512_maskz_mov_pd(__mmask8(~b), a);
+}
+#endif
+
 template<unsigned N>
 inline float64<N> i_bit_andnot(float64<N> a, mask_float64<N> b)
 {
@@ -386,6 +443,13 @@ inline mask_float64x4 i_bit_andnot(mask_float64x4 a, mask_float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_bit_andnot(mask_float64x8 a, mask_float64x8 b)
+{
+    return __mmask8(a & ~b);
+}
+#endif
+
 template<unsigned N>
 inline mask_float64<N> i_bit_andnot(mask_float64<N> a, mask_float64<N> b)
 {
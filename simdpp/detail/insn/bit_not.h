@@ -67,6 +67,18 @@ inline uint8x32 i_bit_not(uint8x32 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_not(uint32x16 a)
+{
+    return _mm512_ternarylogic_epi32(a, a, a, 0x55);
+}
+
+inline uint64x8 i_bit_not(uint64x8 a)
+{
+    return _mm512_ternarylogic_epi64(a, a, a, 0x55);
+}
+#endif
+
 template<unsigned N>
 inline uint8<N> i_bit_not(uint8<N> a)
 {
@@ -125,6 +137,11 @@ inline mask_int32x8  i_bit_not(mask_int32x8 a)  { return i_bit_not(uint32x8(a));
 inline mask_int64x4  i_bit_not(mask_int64x4 a)  { return i_bit_not(uint64x4(a)); }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_bit_not(mask_int32x16 a) { return _mm512_knot(a); }
+inline mask_int64x8  i_bit_not(mask_int64x8 a)  { return __mmask8(~a); }
+#endif
+
 template<unsigned N>
 inline mask_int8<N> i_bit_not(mask_int8<N> a)
 {
@@ -180,6 +197,13 @@ inline float32x8 i_bit_not(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_not(float32x16 a)
+{
+    return float32x16(i_bit_not(uint32x16(a)));
+}
+#endif
+
 template<unsigned N>
 float32<N> i_bit_not(float32<N> a)
 {
@@ -194,6 +218,13 @@ inline float64x4 i_bit_not(float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_not(float64x8 a)
+{
+    return float64x8(i_bit_not(uint64x8(a)));
+}
+#endif
+
 template<unsigned N>
 float64<N> i_bit_not(float64<N> a)
 {
@@ -227,6 +258,13 @@ inline mask_float32x8 i_bit_not(mask_float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_bit_not(mask_float32x16 a)
+{
+    return _mm512_knot(a);
+}
+#endif
+
 template<unsigned N>
 inline mask_float32<N> i_bit_not(mask_float32<N> a)
 {
@@ -240,6 +278,13 @@ inline mask_float64x4 i_bit_not(mask_float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_bit_not(mask_float64x8 a)
+{
+    return __mmask8(~a);
+}
+#endif
+
 template<unsigned N>
 inline mask_float64<N> i_bit_not(mask_float64<N> a)
 {
@@ -64,6 +64,18 @@ inline uint8x32 i_bit_or(uint8x32 a, uint8x32 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_or(uint32x16 a, uint32x16 b)
+{
+    return _mm512_or_si512(a, b);
+}
+
+inline uint64x8 i_bit_or(uint64x8 a, uint64x8 b)
+{
+    return _mm512_or_si512(a, b);
+}
+#endif
+
 template<unsigned N>
 inline uint8<N> i_bit_or(uint8<N> a, uint8<N> b)
 {
@@ -139,9 +151,14 @@ inline mask_int64x2 i_bit_or(mask_int64x2 a, mask_int64x2 b)
 
 #if SIMDPP_USE_AVX2
 inline mask_int8x32  i_bit_or(mask_int8x32 a,  mask_int8x32 b)  { return i_bit_or(uint8x32(a), uint8x32(b)); }
-inline mask_int16x16 i_bit_or(mask_int16x16 a, mask_int16x16 b) { return i_bit_or(uint8x32(a), uint8x32(b)); }
-inline mask_int32x8  i_bit_or(mask_int32x8 a,  mask_int32x8 b)  { return i_bit_or(uint8x32(a), uint8x32(b)); }
-inline mask_int64x4  i_bit_or(mask_int64x4 a,  mask_int64x4 b)  { return i_bit_or(uint8x32(a), uint8x32(b)); }
+inline mask_int16x16 i_bit_or(mask_int16x16 a, mask_int16x16 b) { return (mask_int16x16) i_bit_or(uint16x16(a), uint16x16(b)); }
+inline mask_int32x8  i_bit_or(mask_int32x8 a,  mask_int32x8 b)  { return (mask_int32x8) i_bit_or(uint32x8(a), uint32x8(b)); }
+inline mask_int64x4  i_bit_or(mask_int64x4 a,  mask_int64x4 b)  { return (mask_int64x4) i_bit_or(uint64x4(a), uint64x4(b)); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_bit_or(mask_int32x16 a, mask_int32x16 b) { return _mm512_kor(a, b); }
+inline mask_int64x8  i_bit_or(mask_int64x8 a,  mask_int64x8 b)  { return __mmask8(a | b); }
 #endif
 
 template<unsigned N>
@@ -190,6 +207,13 @@ inline float32x8 i_bit_or(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_or(float32x16 a, float32x16 b)
+{
+    return float32x16(i_bit_or(uint32x16(a), uint32x16(b)));
+}
+#endif
+
 template<unsigned N>
 float32<N> i_bit_or(float32<N> a, float32<N> b)
 {
@@ -220,6 +244,13 @@ inline float64x4 i_bit_or(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_or(float64x8 a, float64x8 b)
+{
+    return float64x8(i_bit_or(uint64x8(a), uint64x8(b)));
+}
+#endif
+
 template<unsigned N>
 float64<N> i_bit_or(float64<N> a, float64<N> b)
 {
@@ -259,6 +290,13 @@ inline mask_float32x8 i_bit_or(mask_float32x8 a, mask_float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_bit_or(mask_float32x16 a, mask_float32x16 b)
+{
+    return _mm512_kor(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_bit_or(mask_float32<N> a, mask_float32<N> b)
 {
@@ -272,6 +310,13 @@ inline mask_float64x4 i_bit_or(mask_float64x4 a, mask_float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_bit_or(mask_float64x8 a, mask_float64x8 b)
+{
+    return __mmask8(a | b);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_bit_or(mask_float64<N> a, mask_float64<N> b)
 {
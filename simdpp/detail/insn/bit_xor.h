@@ -64,6 +64,18 @@ inline uint8x32 i_bit_xor(uint8x32 a, uint8x32 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_bit_xor(uint32x16 a, uint32x16 b)
+{
+    return _mm512_xor_si512(a, b);
+}
+
+inline uint64x8 i_bit_xor(uint64x8 a, uint64x8 b)
+{
+    return _mm512_xor_si512(a, b);
+}
+#endif
+
 template<unsigned N>
 inline uint8<N> i_bit_xor(uint8<N> a, uint8<N> b)
 {
@@ -146,6 +158,11 @@ inline mask_int32x8  i_bit_xor(mask_int32x8 a,  mask_int32x8 b)  { return (mask_
 inline mask_int64x4  i_bit_xor(mask_int64x4 a,  mask_int64x4 b)  { return (mask_int64x4)  i_bit_xor(uint8x32(a), uint8x32(b)); }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_bit_xor(mask_int32x16 a, mask_int32x16 b) { return _mm512_kxor(a, b); }
+inline mask_int64x8  i_bit_xor(mask_int64x8 a,  mask_int64x8 b)  { return __mmask8(a ^ b); }
+#endif
+
 template<unsigned N>
 mask_int8<N> i_bit_xor(mask_int8<N> a, mask_int8<N> b)
 {
@@ -192,6 +209,13 @@ inline float32x8 i_bit_xor(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_bit_xor(float32x16 a, float32x16 b)
+{
+    return float32x16(i_bit_xor(uint32x16(a), uint32x16(b)));
+}
+#endif
+
 template<unsigned N>
 float32<N> i_bit_xor(float32<N> a, float32<N> b)
 {
@@ -222,6 +246,13 @@ inline float64x4 i_bit_xor(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_bit_xor(float64x8 a, float64x8 b)
+{
+    return float64x8(i_bit_xor(uint64x8(a), uint64x8(b)));
+}
+#endif
+
 template<unsigned N>
 float64<N> i_bit_xor(float64<N> a, float64<N> b)
 {
@@ -261,6 +292,13 @@ inline mask_float32x8 i_bit_xor(mask_float32x8 a, mask_float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_bit_xor(mask_float32x16 a, mask_float32x16 b)
+{
+    return _mm512_kxor(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_bit_xor(mask_float32<N> a, mask_float32<N> b)
 {
@@ -274,6 +312,13 @@ inline mask_float64x4 i_bit_xor(mask_float64x4 a, mask_float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_bit_xor(mask_float64x8 a, mask_float64x8 b)
+{
+    return __mmask8(a ^ b);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_bit_xor(mask_float64<N> a, mask_float64<N> b)
 {
@@ -122,6 +122,18 @@ inline uint16<N> i_blend(uint16<N> on, uint16<N> off, mask_int16<N> mask)
 
 // -----------------------------------------------------------------------------
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_blend(uint32x16 on, uint32x16 off, uint32x16 mask)
+{
+    return _mm512_ternarylogic_epi32(mask, on, off, 0xca);
+}
+
+inline uint32x16 i_blend(uint32x16 on, uint32x16 off, mask_int32x16 mask)
+{
+    return _mm512_mask_blend_epi32(mask, off, on);
+}
+#endif
+
 template<unsigned N>
 inline uint32<N> i_blend(uint32<N> on, uint32<N> off, uint32<N> mask)
 {
@@ -137,6 +149,18 @@ inline uint32<N> i_blend(uint32<N> on, uint32<N> off, mask_int32<N> mask)
 
 // -----------------------------------------------------------------------------
 
+#if SIMDPP_USE_AVX512F
+inline uint64x8 i_blend(uint64x8 on, uint64x8 off, uint64x8 mask)
+{
+    return _mm512_ternarylogic_epi64(mask, on, off, 0xca);
+}
+
+inline uint64x8 i_blend(uint64x8 on, uint64x8 off, mask_int64x8 mask)
+{
+    return _mm512_mask_blend_epi64(mask, off, on);
+}
+#endif
+
 template<unsigned N>
 inline uint64<N> i_blend(uint64<N> on, uint64<N> off, uint64<N> mask)
 {
@@ -156,8 +180,6 @@ inline float32x4 i_blend(float32x4 on, float32x4 off, float32x4 mask)
 {
 #if SIMDPP_USE_NULL
     return null::blend(on, off, mask);
-#elif SIMDPP_USE_AVX
-    return _mm_blendv_ps(off, on, mask);
 #elif SIMDPP_USE_SSE2
     float32x4 r;
      on = bit_and(on, mask);
@@ -175,7 +197,16 @@ inline float32x4 i_blend(float32x4 on, float32x4 off, float32x4 mask)
 #if SIMDPP_USE_AVX
 inline float32x8 i_blend(float32x8 on, float32x8 off, float32x8 mask)
 {
-    return _mm256_blendv_ps(off, on, mask);
+    // _mm256_blendv_ps only looks at the sign bits, the selection must be
+    // bitwise
+    return _mm256_or_ps(_mm256_and_ps(mask, on), _mm256_andnot_ps(mask, off));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_blend(float32x16 on, float32x16 off, float32x16 mask)
+{
+    return float32x16(i_blend(uint32x16(on), uint32x16(off), uint32x16(mask)));
 }
 #endif
 
@@ -195,6 +226,8 @@ inline float32x4 i_blend(float32x4 on, float32x4 off, mask_float32x4 mask)
 {
 #if SIMDPP_USE_NULL
     return null::blend_mask(on, off, mask);
+#elif SIMDPP_USE_AVX
+    return _mm_blendv_ps(off, on, mask.unmask());
 #else
     return i_blend(on, off, uint32x4(mask));
 #endif
@@ -203,7 +236,14 @@ inline float32x4 i_blend(float32x4 on, float32x4 off, mask_float32x4 mask)
 #if SIMDPP_USE_AVX
 inline float32x8 i_blend(float32x8 on, float32x8 off, mask_float32x8 mask)
 {
-    return i_blend(on, off, uint32x8(mask));
+    return _mm256_blendv_ps(off, on, mask.unmask());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_blend(float32x16 on, float32x16 off, mask_float32x16 mask)
+{
+    return _mm512_mask_blend_ps(mask, off, on);
 }
 #endif
 
@@ -219,8 +259,6 @@ inline float64x2 i_blend(float64x2 on, float64x2 off, float64x2 mask)
 {
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
     return null::blend(on, off, mask);
-#elif SIMDPP_USE_AVX
-    return _mm_blendv_pd(off, on, mask);
 #elif SIMDPP_USE_SSE2
     float64x2 r;
      on = bit_and(on, mask);
@@ -233,7 +271,14 @@ inline float64x2 i_blend(float64x2 on, float64x2 off, float64x2 mask)
 #if SIMDPP_USE_AVX
 inline float64x4 i_blend(float64x4 on, float64x4 off, float64x4 mask)
 {
-    return _mm256_blendv_pd(off, on, mask);
+    return _mm256_or_pd(_mm256_and_pd(mask, on), _mm256_andnot_pd(mask, off));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_blend(float64x8 on, float64x8 off, float64x8 mask)
+{
+    return float64x8(i_blend(uint64x8(on), uint64x8(off), uint64x8(mask)));
 }
 #endif
 
@@ -253,6 +298,8 @@ inline float64x2 i_blend(float64x2 on, float64x2 off, mask_float64x2 mask)
 {
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
     return null::blend_mask(on, off, mask);
+#elif SIMDPP_USE_AVX
+    return _mm_blendv_pd(off, on, mask.unmask());
 #else
     return i_blend(on, off, uint64x2(mask));
 #endif
@@ -261,7 +308,14 @@ inline float64x2 i_blend(float64x2 on, float64x2 off, mask_float64x2 mask)
 #if SIMDPP_USE_AVX
 inline float64x4 i_blend(float64x4 on, float64x4 off, mask_float64x4 mask)
 {
-    return i_blend(on, off, uint64x4(mask));
+    return _mm256_blendv_pd(off, on, mask.unmask());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_blend(float64x8 on, float64x8 off, mask_float64x8 mask)
+{
+    return _mm512_mask_blend_pd(mask, off, on);
 }
 #endif
 
@@ -119,13 +119,19 @@ inline mask_int32x4 i_cmp_eq(uint32x4 a, uint32x4 b)
 }
 
 #if SIMDPP_USE_AVX2
-template<unsigned N>
-mask_int32x8 i_cmp_eq(uint32x8 a, uint32x8 b)
+inline mask_int32x8 i_cmp_eq(uint32x8 a, uint32x8 b)
 {
     return _mm256_cmpeq_epi32(a, b);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_cmp_eq(uint32x16 a, uint32x16 b)
+{
+    return _mm512_cmpeq_epu32_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int32<N> i_cmp_eq(uint32<N> a, uint32<N> b)
 {
@@ -177,6 +183,13 @@ inline mask_int64x4 i_cmp_eq(uint64x4 a, uint64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int64x8 i_cmp_eq(uint64x8 a, uint64x8 b)
+{
+    return _mm512_cmpeq_epu64_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int64<N> i_cmp_eq(uint64<N> a, uint64<N> b)
 {
@@ -207,6 +220,13 @@ inline mask_float32x8 i_cmp_eq(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_cmp_eq(float32x16 a, float32x16 b)
+{
+    return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_cmp_eq(float32<N> a, float32<N> b)
 {
@@ -235,6 +255,13 @@ inline mask_float64x4 i_cmp_eq(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_cmp_eq(float64x8 a, float64x8 b)
+{
+    return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_cmp_eq(float64<N> a, float64<N> b)
 {
@@ -66,6 +66,13 @@ inline mask_float32x8 i_cmp_ge(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_cmp_ge(float32x16 a, float32x16 b)
+{
+    return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_cmp_ge(float32<N> a, float32<N> b)
 {
@@ -92,6 +99,13 @@ inline mask_float64x4 i_cmp_ge(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_cmp_ge(float64x8 a, float64x8 b)
+{
+    return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_cmp_ge(float64<N> a, float64<N> b)
 {
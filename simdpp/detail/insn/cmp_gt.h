@@ -195,6 +195,13 @@ inline mask_int32x8 i_cmp_gt(int32x8 a, int32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_cmp_gt(int32x16 a, int32x16 b)
+{
+    return _mm512_cmpgt_epi32_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int32<N> i_cmp_gt(int32<N> a, int32<N> b)
 {
@@ -231,6 +238,13 @@ inline mask_int32x8 i_cmp_gt(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_cmp_gt(uint32x16 a, uint32x16 b)
+{
+    return _mm512_cmpgt_epu32_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int32<N> i_cmp_gt(uint32<N> a, uint32<N> b)
 {
@@ -261,6 +275,13 @@ inline mask_float32x8 i_cmp_gt(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_cmp_gt(float32x16 a, float32x16 b)
+{
+    return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_cmp_gt(float32<N> a, float32<N> b)
 {
@@ -289,6 +310,13 @@ inline mask_float64x4 i_cmp_gt(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_cmp_gt(float64x8 a, float64x8 b)
+{
+    return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_cmp_gt(float64<N> a, float64<N> b)
 {
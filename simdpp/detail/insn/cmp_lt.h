@@ -193,6 +193,13 @@ inline mask_int32x8 i_cmp_lt(int32x8 a, int32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_cmp_lt(int32x16 a, int32x16 b)
+{
+    return _mm512_cmplt_epi32_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int32<N> i_cmp_lt(int32<N> a, int32<N> b)
 {
@@ -229,6 +236,13 @@ inline mask_int32x8 i_cmp_lt(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_cmp_lt(uint32x16 a, uint32x16 b)
+{
+    return _mm512_cmplt_epu32_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int32<N> i_cmp_lt(uint32<N> a, uint32<N> b)
 {
@@ -259,6 +273,13 @@ inline mask_float32x8 i_cmp_lt(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_cmp_lt(float32x16 a, float32x16 b)
+{
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_cmp_lt(float32<N> a, float32<N> b)
 {
@@ -285,6 +306,13 @@ inline mask_float64x4 i_cmp_lt(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_cmp_lt(float64x8 a, float64x8 b)
+{
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_cmp_lt(float64<N> a, float64<N> b)
 {
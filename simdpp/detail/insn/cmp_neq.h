@@ -116,6 +116,13 @@ inline mask_int32x8 i_cmp_neq(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int32x16 i_cmp_neq(uint32x16 a, uint32x16 b)
+{
+    return _mm512_cmpneq_epu32_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int32<N> i_cmp_neq(uint32<N> a, uint32<N> b)
 {
@@ -134,7 +141,7 @@ inline mask_int64x2 i_cmp_neq(uint64x2 a, uint64x2 b)
     return bit_not(cmp_eq(a, b));
 #elif SIMDPP_USE_SSE2
     uint64x2 r32, r32s;
-    r32 = (uint32x4)cmp_eq(uint32x4(a), uint32x4(b));
+    r32 = (uint32x4)i_cmp_neq(uint32x4(a), uint32x4(b));
     // swap the 32-bit halves
     r32s = bit_or(shift_l<32>(r32), shift_r<32>(r32));
     // combine the results. Each 32-bit half is ORed with the neighbouring pair
@@ -160,6 +167,13 @@ inline mask_int64x4 i_cmp_neq(uint64x4 a, uint64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_int64x8 i_cmp_neq(uint64x8 a, uint64x8 b)
+{
+    return _mm512_cmpneq_epu64_mask(a, b);
+}
+#endif
+
 template<unsigned N>
 mask_int64<N> i_cmp_neq(uint64<N> a, uint64<N> b)
 {
@@ -188,6 +202,13 @@ inline mask_float32x8 i_cmp_neq(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_cmp_neq(float32x16 a, float32x16 b)
+{
+    return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_cmp_neq(float32<N> a, float32<N> b)
 {
@@ -216,6 +237,13 @@ inline mask_float64x4 i_cmp_neq(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_cmp_neq(float64x8 a, float64x8 b)
+{
+    return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_cmp_neq(float64<N> a, float64<N> b)
 {
@@ -0,0 +1,565 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  The functions in this file move the elements of a for which the mask is
+    set to the beginning of r, preserving their order. The rest of the
+    elements of r are set to zero. The number of the selected elements is
+    returned.
+
+    On SSSE3 the elements are moved with PSHUFB. The shuffle masks are looked
+    up in tables indexed by the bits extracted from the mask with
+    PMOVMSKB/MOVMSKPS. 32-bit and 64-bit elements use a table of 16 masks
+    indexed by 4 bits, one bit per 32-bit lane. 8-bit and 16-bit elements
+    are processed one 8-byte half at a time, since a table indexed by all 16
+    bits would be too large. On AVX2 the 32-bit and 64-bit elements of
+    256-bit vectors are moved with VPERMD. Its indices are stored in a table
+    as 4-bit fields. AVX512F has dedicated instructions for 32-bit and 64-bit
+    elements of 512-bit vectors.
+*/
+
+template<class V, class M>
+unsigned v_compress(V& r, const V& a, const M& mask);
+
+template<class V, class M>
+unsigned v_emul_compress(V& r, const V& a, const M& mask)
+{
+    using U = typename V::uint_vector_type;
+    mem_block<V> ma(a);
+    mem_block<U> mm(bit_cast<U>(mask.unmask()));
+    mem_block<V> mr(V::zero());
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::length; i++) {
+        if (mm[i] != 0) {
+            mr[n++] = ma[i];
+        }
+    }
+    r = mr;
+    return n;
+}
+
+// Returns the number of set bits in a
+inline unsigned compress_popcnt(uint32_t a)
+{
+    a = a - ((a >> 1) & 0x55555555);
+    a = (a & 0x33333333) + ((a >> 2) & 0x33333333);
+    a = (a + (a >> 4)) & 0x0f0f0f0f;
+    return (a * 0x01010101) >> 24;
+}
+
+#if SIMDPP_USE_SSSE3
+/*  PSHUFB masks that move the bytes selected by an 8-bit mask to the
+    beginning of an 8-byte half. Each mask is stored as a 64-bit integer,
+    the unused bytes are set to 0x80.
+*/
+inline const uint64_t* compress_table_bytes8()
+{
+    static const uint64_t table[256] = {
+        0x8080808080808080ULL, 0x8080808080808000ULL, 0x8080808080808001ULL,
+        0x8080808080800100ULL, 0x8080808080808002ULL, 0x8080808080800200ULL,
+        0x8080808080800201ULL, 0x8080808080020100ULL, 0x8080808080808003ULL,
+        0x8080808080800300ULL, 0x8080808080800301ULL, 0x8080808080030100ULL,
+        0x8080808080800302ULL, 0x8080808080030200ULL, 0x8080808080030201ULL,
+        0x8080808003020100ULL, 0x8080808080808004ULL, 0x8080808080800400ULL,
+        0x8080808080800401ULL, 0x8080808080040100ULL, 0x8080808080800402ULL,
+        0x8080808080040200ULL, 0x8080808080040201ULL, 0x8080808004020100ULL,
+        0x8080808080800403ULL, 0x8080808080040300ULL, 0x8080808080040301ULL,
+        0x8080808004030100ULL, 0x8080808080040302ULL, 0x8080808004030200ULL,
+        0x8080808004030201ULL, 0x8080800403020100ULL, 0x8080808080808005ULL,
+        0x8080808080800500ULL, 0x8080808080800501ULL, 0x8080808080050100ULL,
+        0x8080808080800502ULL, 0x8080808080050200ULL, 0x8080808080050201ULL,
+        0x8080808005020100ULL, 0x8080808080800503ULL, 0x8080808080050300ULL,
+        0x8080808080050301ULL, 0x8080808005030100ULL, 0x8080808080050302ULL,
+        0x8080808005030200ULL, 0x8080808005030201ULL, 0x8080800503020100ULL,
+        0x8080808080800504ULL, 0x8080808080050400ULL, 0x8080808080050401ULL,
+        0x8080808005040100ULL, 0x8080808080050402ULL, 0x8080808005040200ULL,
+        0x8080808005040201ULL, 0x8080800504020100ULL, 0x8080808080050403ULL,
+        0x8080808005040300ULL, 0x8080808005040301ULL, 0x8080800504030100ULL,
+        0x8080808005040302ULL, 0x8080800504030200ULL, 0x8080800504030201ULL,
+        0x8080050403020100ULL, 0x8080808080808006ULL, 0x8080808080800600ULL,
+        0x8080808080800601ULL, 0x8080808080060100ULL, 0x8080808080800602ULL,
+        0x8080808080060200ULL, 0x8080808080060201ULL, 0x8080808006020100ULL,
+        0x8080808080800603ULL, 0x8080808080060300ULL, 0x8080808080060301ULL,
+        0x8080808006030100ULL, 0x8080808080060302ULL, 0x8080808006030200ULL,
+        0x8080808006030201ULL, 0x8080800603020100ULL, 0x8080808080800604ULL,
+        0x8080808080060400ULL, 0x8080808080060401ULL, 0x8080808006040100ULL,
+        0x8080808080060402ULL, 0x8080808006040200ULL, 0x8080808006040201ULL,
+        0x8080800604020100ULL, 0x8080808080060403ULL, 0x8080808006040300ULL,
+        0x8080808006040301ULL, 0x8080800604030100ULL, 0x8080808006040302ULL,
+        0x8080800604030200ULL, 0x8080800604030201ULL, 0x8080060403020100ULL,
+        0x8080808080800605ULL, 0x8080808080060500ULL, 0x8080808080060501ULL,
+        0x8080808006050100ULL, 0x8080808080060502ULL, 0x8080808006050200ULL,
+        0x8080808006050201ULL, 0x8080800605020100ULL, 0x8080808080060503ULL,
+        0x8080808006050300ULL, 0x8080808006050301ULL, 0x8080800605030100ULL,
+        0x8080808006050302ULL, 0x8080800605030200ULL, 0x8080800605030201ULL,
+        0x8080060503020100ULL, 0x8080808080060504ULL, 0x8080808006050400ULL,
+        0x8080808006050401ULL, 0x8080800605040100ULL, 0x8080808006050402ULL,
+        0x8080800605040200ULL, 0x8080800605040201ULL, 0x8080060504020100ULL,
+        0x8080808006050403ULL, 0x8080800605040300ULL, 0x8080800605040301ULL,
+        0x8080060504030100ULL, 0x8080800605040302ULL, 0x8080060504030200ULL,
+        0x8080060504030201ULL, 0x8006050403020100ULL, 0x8080808080808007ULL,
+        0x8080808080800700ULL, 0x8080808080800701ULL, 0x8080808080070100ULL,
+        0x8080808080800702ULL, 0x8080808080070200ULL, 0x8080808080070201ULL,
+        0x8080808007020100ULL, 0x8080808080800703ULL, 0x8080808080070300ULL,
+        0x8080808080070301ULL, 0x8080808007030100ULL, 0x8080808080070302ULL,
+        0x8080808007030200ULL, 0x8080808007030201ULL, 0x8080800703020100ULL,
+        0x8080808080800704ULL, 0x8080808080070400ULL, 0x8080808080070401ULL,
+        0x8080808007040100ULL, 0x8080808080070402ULL, 0x8080808007040200ULL,
+        0x8080808007040201ULL, 0x8080800704020100ULL, 0x8080808080070403ULL,
+        0x8080808007040300ULL, 0x8080808007040301ULL, 0x8080800704030100ULL,
+        0x8080808007040302ULL, 0x8080800704030200ULL, 0x8080800704030201ULL,
+        0x8080070403020100ULL, 0x8080808080800705ULL, 0x8080808080070500ULL,
+        0x8080808080070501ULL, 0x8080808007050100ULL, 0x8080808080070502ULL,
+        0x8080808007050200ULL, 0x8080808007050201ULL, 0x8080800705020100ULL,
+        0x8080808080070503ULL, 0x8080808007050300ULL, 0x8080808007050301ULL,
+        0x8080800705030100ULL, 0x8080808007050302ULL, 0x8080800705030200ULL,
+        0x8080800705030201ULL, 0x8080070503020100ULL, 0x8080808080070504ULL,
+        0x8080808007050400ULL, 0x8080808007050401ULL, 0x8080800705040100ULL,
+        0x8080808007050402ULL, 0x8080800705040200ULL, 0x8080800705040201ULL,
+        0x8080070504020100ULL, 0x8080808007050403ULL, 0x8080800705040300ULL,
+        0x8080800705040301ULL, 0x8080070504030100ULL, 0x8080800705040302ULL,
+        0x8080070504030200ULL, 0x8080070504030201ULL, 0x8007050403020100ULL,
+        0x8080808080800706ULL, 0x8080808080070600ULL, 0x8080808080070601ULL,
+        0x8080808007060100ULL, 0x8080808080070602ULL, 0x8080808007060200ULL,
+        0x8080808007060201ULL, 0x8080800706020100ULL, 0x8080808080070603ULL,
+        0x8080808007060300ULL, 0x8080808007060301ULL, 0x8080800706030100ULL,
+        0x8080808007060302ULL, 0x8080800706030200ULL, 0x8080800706030201ULL,
+        0x8080070603020100ULL, 0x8080808080070604ULL, 0x8080808007060400ULL,
+        0x8080808007060401ULL, 0x8080800706040100ULL, 0x8080808007060402ULL,
+        0x8080800706040200ULL, 0x8080800706040201ULL, 0x8080070604020100ULL,
+        0x8080808007060403ULL, 0x8080800706040300ULL, 0x8080800706040301ULL,
+        0x8080070604030100ULL, 0x8080800706040302ULL, 0x8080070604030200ULL,
+        0x8080070604030201ULL, 0x8007060403020100ULL, 0x8080808080070605ULL,
+        0x8080808007060500ULL, 0x8080808007060501ULL, 0x8080800706050100ULL,
+        0x8080808007060502ULL, 0x8080800706050200ULL, 0x8080800706050201ULL,
+        0x8080070605020100ULL, 0x8080808007060503ULL, 0x8080800706050300ULL,
+        0x8080800706050301ULL, 0x8080070605030100ULL, 0x8080800706050302ULL,
+        0x8080070605030200ULL, 0x8080070605030201ULL, 0x8007060503020100ULL,
+        0x8080808007060504ULL, 0x8080800706050400ULL, 0x8080800706050401ULL,
+        0x8080070605040100ULL, 0x8080800706050402ULL, 0x8080070605040200ULL,
+        0x8080070605040201ULL, 0x8007060504020100ULL, 0x8080800706050403ULL,
+        0x8080070605040300ULL, 0x8080070605040301ULL, 0x8007060504030100ULL,
+        0x8080070605040302ULL, 0x8007060504030200ULL, 0x8007060504030201ULL,
+        0x0706050403020100ULL
+    };
+    return table;
+}
+
+/*  PSHUFB masks that move the 32-bit lanes selected by a 4-bit mask to the
+    beginning of a 128-bit vector. The unused lanes are set to 0x80808080.
+*/
+inline const uint32_t* compress_table_dwords4()
+{
+    alignas(16) static const uint32_t table[16][4] = {
+        { 0x80808080, 0x80808080, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x80808080, 0x80808080, 0x80808080 },
+        { 0x07060504, 0x80808080, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x07060504, 0x80808080, 0x80808080 },
+        { 0x0b0a0908, 0x80808080, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x0b0a0908, 0x80808080, 0x80808080 },
+        { 0x07060504, 0x0b0a0908, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x07060504, 0x0b0a0908, 0x80808080 },
+        { 0x0f0e0d0c, 0x80808080, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x0f0e0d0c, 0x80808080, 0x80808080 },
+        { 0x07060504, 0x0f0e0d0c, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x07060504, 0x0f0e0d0c, 0x80808080 },
+        { 0x0b0a0908, 0x0f0e0d0c, 0x80808080, 0x80808080 },
+        { 0x03020100, 0x0b0a0908, 0x0f0e0d0c, 0x80808080 },
+        { 0x07060504, 0x0b0a0908, 0x0f0e0d0c, 0x80808080 },
+        { 0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c }
+    };
+    return &table[0][0];
+}
+
+// Compresses the bytes of a for which the corresponding bit of @a bits is set
+inline __m128i i_compress_bytes16(__m128i a, unsigned bits)
+{
+    const uint64_t* table = compress_table_bytes8();
+    unsigned lo = bits & 0xff;
+    unsigned hi = (bits >> 8) & 0xff;
+
+    __m128i idx_lo = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(table + lo));
+    __m128i idx_hi = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(table + hi));
+    // the indices of the upper half refer to the bytes 8-15. The unused
+    // bytes in the upper half of idx_hi are set to 0x80.
+    idx_hi = _mm_add_epi8(idx_hi, _mm_set_epi32(0x80808080, 0x80808080,
+                                                0x08080808, 0x08080808));
+
+    // the indices of the upper half are placed right after the selected
+    // indices of the lower half
+    union {
+        uint8_t idx[32];
+        __m128i align;
+    };
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(idx), idx_lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(idx + compress_popcnt(lo)), idx_hi);
+    return _mm_shuffle_epi8(a, _mm_load_si128(reinterpret_cast<const __m128i*>(idx)));
+}
+
+// Compresses the 32-bit lanes of a for which the corresponding bit of
+// @a bits is set
+inline __m128i i_compress_dwords4(__m128i a, unsigned bits)
+{
+    const uint32_t* table = compress_table_dwords4();
+    __m128i idx = _mm_load_si128(reinterpret_cast<const __m128i*>(table + bits * 4));
+    return _mm_shuffle_epi8(a, idx);
+}
+#endif
+
+#if SIMDPP_USE_AVX2
+/*  VPERMD indices that move the 32-bit lanes selected by an 8-bit mask to
+    the beginning of a 256-bit vector. The index of the destination lane i is
+    stored in the bits 4*i..4*i+3.
+*/
+inline const uint32_t* compress_table_dwords8()
+{
+    static const uint32_t table[256] = {
+        0x00000000, 0x00000000, 0x00000001, 0x00000010, 0x00000002, 0x00000020,
+        0x00000021, 0x00000210, 0x00000003, 0x00000030, 0x00000031, 0x00000310,
+        0x00000032, 0x00000320, 0x00000321, 0x00003210, 0x00000004, 0x00000040,
+        0x00000041, 0x00000410, 0x00000042, 0x00000420, 0x00000421, 0x00004210,
+        0x00000043, 0x00000430, 0x00000431, 0x00004310, 0x00000432, 0x00004320,
+        0x00004321, 0x00043210, 0x00000005, 0x00000050, 0x00000051, 0x00000510,
+        0x00000052, 0x00000520, 0x00000521, 0x00005210, 0x00000053, 0x00000530,
+        0x00000531, 0x00005310, 0x00000532, 0x00005320, 0x00005321, 0x00053210,
+        0x00000054, 0x00000540, 0x00000541, 0x00005410, 0x00000542, 0x00005420,
+        0x00005421, 0x00054210, 0x00000543, 0x00005430, 0x00005431, 0x00054310,
+        0x00005432, 0x00054320, 0x00054321, 0x00543210, 0x00000006, 0x00000060,
+        0x00000061, 0x00000610, 0x00000062, 0x00000620, 0x00000621, 0x00006210,
+        0x00000063, 0x00000630, 0x00000631, 0x00006310, 0x00000632, 0x00006320,
+        0x00006321, 0x00063210, 0x00000064, 0x00000640, 0x00000641, 0x00006410,
+        0x00000642, 0x00006420, 0x00006421, 0x00064210, 0x00000643, 0x00006430,
+        0x00006431, 0x00064310, 0x00006432, 0x00064320, 0x00064321, 0x00643210,
+        0x00000065, 0x00000650, 0x00000651, 0x00006510, 0x00000652, 0x00006520,
+        0x00006521, 0x00065210, 0x00000653, 0x00006530, 0x00006531, 0x00065310,
+        0x00006532, 0x00065320, 0x00065321, 0x00653210, 0x00000654, 0x00006540,
+        0x00006541, 0x00065410, 0x00006542, 0x00065420, 0x00065421, 0x00654210,
+        0x00006543, 0x00065430, 0x00065431, 0x00654310, 0x00065432, 0x00654320,
+        0x00654321, 0x06543210, 0x00000007, 0x00000070, 0x00000071, 0x00000710,
+        0x00000072, 0x00000720, 0x00000721, 0x00007210, 0x00000073, 0x00000730,
+        0x00000731, 0x00007310, 0x00000732, 0x00007320, 0x00007321, 0x00073210,
+        0x00000074, 0x00000740, 0x00000741, 0x00007410, 0x00000742, 0x00007420,
+        0x00007421, 0x00074210, 0x00000743, 0x00007430, 0x00007431, 0x00074310,
+        0x00007432, 0x00074320, 0x00074321, 0x00743210, 0x00000075, 0x00000750,
+        0x00000751, 0x00007510, 0x00000752, 0x00007520, 0x00007521, 0x00075210,
+        0x00000753, 0x00007530, 0x00007531, 0x00075310, 0x00007532, 0x00075320,
+        0x00075321, 0x00753210, 0x00000754, 0x00007540, 0x00007541, 0x00075410,
+        0x00007542, 0x00075420, 0x00075421, 0x00754210, 0x00007543, 0x00075430,
+        0x00075431, 0x00754310, 0x00075432, 0x00754320, 0x00754321, 0x07543210,
+        0x00000076, 0x00000760, 0x00000761, 0x00007610, 0x00000762, 0x00007620,
+        0x00007621, 0x00076210, 0x00000763, 0x00007630, 0x00007631, 0x00076310,
+        0x00007632, 0x00076320, 0x00076321, 0x00763210, 0x00000764, 0x00007640,
+        0x00007641, 0x00076410, 0x00007642, 0x00076420, 0x00076421, 0x00764210,
+        0x00007643, 0x00076430, 0x00076431, 0x00764310, 0x00076432, 0x00764320,
+        0x00764321, 0x07643210, 0x00000765, 0x00007650, 0x00007651, 0x00076510,
+        0x00007652, 0x00076520, 0x00076521, 0x00765210, 0x00007653, 0x00076530,
+        0x00076531, 0x00765310, 0x00076532, 0x00765320, 0x00765321, 0x07653210,
+        0x00007654, 0x00076540, 0x00076541, 0x00765410, 0x00076542, 0x00765420,
+        0x00765421, 0x07654210, 0x00076543, 0x00765430, 0x00765431, 0x07654310,
+        0x00765432, 0x07654320, 0x07654321, 0x76543210
+    };
+    return table;
+}
+#endif
+
+#if SIMDPP_USE_AVX
+// Concatenates the first @a n bytes of lo with hi. The rest of the bytes are
+// set to zero
+inline __m256i i_compress_concat(__m128i lo, __m128i hi, unsigned n)
+{
+    union {
+        uint8_t d[48];
+        __m256i align;
+    };
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + 16), _mm256_setzero_si256());
+    _mm_store_si128(reinterpret_cast<__m128i*>(d), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d + n), hi);
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(d));
+}
+
+// Compresses the bytes of a for which the corresponding bit of @a bits is set
+inline __m256i i_compress_bytes32(__m256i a, unsigned bits)
+{
+    __m128i lo = i_compress_bytes16(_mm256_castsi256_si128(a), bits & 0xffff);
+    __m128i hi = i_compress_bytes16(_mm256_extractf128_si256(a, 1), bits >> 16);
+    return i_compress_concat(lo, hi, compress_popcnt(bits & 0xffff));
+}
+
+// Compresses the 32-bit lanes of a for which the corresponding bit of
+// @a bits is set
+inline __m256i i_compress_dwords8(__m256i a, unsigned bits)
+{
+#if SIMDPP_USE_AVX2
+    __m256i idx = _mm256_set1_epi32(compress_table_dwords8()[bits]);
+    idx = _mm256_srlv_epi32(idx, _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+    __m256i r = _mm256_permutevar8x32_epi32(a, idx);
+
+    // zero the lanes past the selected ones
+    __m256i n = _mm256_set1_epi32(compress_popcnt(bits));
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    return _mm256_and_si256(r, _mm256_cmpgt_epi32(n, lanes));
+#else
+    __m128i lo = i_compress_dwords4(_mm256_castsi256_si128(a), bits & 0xf);
+    __m128i hi = i_compress_dwords4(_mm256_extractf128_si256(a, 1), bits >> 4);
+    return i_compress_concat(lo, hi, compress_popcnt(bits & 0xf) * 4);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+inline unsigned i_compress(uint8x16& r, const uint8x16& a, const mask_int8x16& mask)
+{
+#if SIMDPP_USE_SSSE3
+    unsigned bits = _mm_movemask_epi8(mask.unmask());
+    r = i_compress_bytes16(a, bits);
+    return compress_popcnt(bits);
+#else
+    return v_emul_compress(r, a, mask);
+#endif
+}
+
+inline unsigned i_compress(uint16x8& r, const uint16x8& a, const mask_int16x8& mask)
+{
+#if SIMDPP_USE_SSSE3
+    // each element is represented by two bits
+    unsigned bits = _mm_movemask_epi8(mask.unmask());
+    r = i_compress_bytes16(a, bits);
+    return compress_popcnt(bits) / 2;
+#else
+    return v_emul_compress(r, a, mask);
+#endif
+}
+
+inline unsigned i_compress(uint32x4& r, const uint32x4& a, const mask_int32x4& mask)
+{
+#if SIMDPP_USE_SSSE3
+    unsigned bits = _mm_movemask_ps(_mm_castsi128_ps(mask.unmask()));
+    r = i_compress_dwords4(a, bits);
+    return compress_popcnt(bits);
+#else
+    return v_emul_compress(r, a, mask);
+#endif
+}
+
+inline unsigned i_compress(uint64x2& r, const uint64x2& a, const mask_int64x2& mask)
+{
+#if SIMDPP_USE_SSSE3
+    // each element is represented by two bits
+    unsigned bits = _mm_movemask_ps(_mm_castsi128_ps(mask.unmask()));
+    r = i_compress_dwords4(a, bits);
+    return compress_popcnt(bits) / 2;
+#else
+    return v_emul_compress(r, a, mask);
+#endif
+}
+
+inline unsigned i_compress(float32x4& r, const float32x4& a, const mask_float32x4& mask)
+{
+#if SIMDPP_USE_SSSE3
+    unsigned bits = _mm_movemask_ps(mask.unmask());
+    r = _mm_castsi128_ps(i_compress_dwords4(_mm_castps_si128(a), bits));
+    return compress_popcnt(bits);
+#else
+    return v_emul_compress(r, a, mask);
+#endif
+}
+
+inline unsigned i_compress(float64x2& r, const float64x2& a, const mask_float64x2& mask)
+{
+#if SIMDPP_USE_SSSE3
+    // each element is represented by two bits
+    unsigned bits = _mm_movemask_ps(_mm_castpd_ps(mask.unmask()));
+    r = _mm_castsi128_pd(i_compress_dwords4(_mm_castpd_si128(a), bits));
+    return compress_popcnt(bits) / 2;
+#else
+    return v_emul_compress(r, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline unsigned i_compress(uint8x32& r, const uint8x32& a, const mask_int8x32& mask)
+{
+    unsigned bits = _mm256_movemask_epi8(mask.unmask());
+    r = i_compress_bytes32(a, bits);
+    return compress_popcnt(bits);
+}
+
+inline unsigned i_compress(uint16x16& r, const uint16x16& a, const mask_int16x16& mask)
+{
+    // each element is represented by two bits
+    unsigned bits = _mm256_movemask_epi8(mask.unmask());
+    r = i_compress_bytes32(a, bits);
+    return compress_popcnt(bits) / 2;
+}
+
+inline unsigned i_compress(uint32x8& r, const uint32x8& a, const mask_int32x8& mask)
+{
+    unsigned bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask.unmask()));
+    r = i_compress_dwords8(a, bits);
+    return compress_popcnt(bits);
+}
+
+inline unsigned i_compress(uint64x4& r, const uint64x4& a, const mask_int64x4& mask)
+{
+    // each element is represented by two bits
+    unsigned bits = _mm256_movemask_ps(_mm256_castsi256_ps(mask.unmask()));
+    r = i_compress_dwords8(a, bits);
+    return compress_popcnt(bits) / 2;
+}
+
+#endif
+
+#if SIMDPP_USE_AVX
+inline unsigned i_compress(float32x8& r, const float32x8& a, const mask_float32x8& mask)
+{
+    unsigned bits = _mm256_movemask_ps(mask.unmask());
+    r = _mm256_castsi256_ps(i_compress_dwords8(_mm256_castps_si256(a), bits));
+    return compress_popcnt(bits);
+}
+
+inline unsigned i_compress(float64x4& r, const float64x4& a, const mask_float64x4& mask)
+{
+    // each element is represented by two bits
+    unsigned bits = _mm256_movemask_ps(_mm256_castpd_ps(mask.unmask()));
+    r = _mm256_castsi256_pd(i_compress_dwords8(_mm256_castpd_si256(a), bits));
+    return compress_popcnt(bits) / 2;
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline unsigned i_compress(uint32<16>& r, const uint32<16>& a, const mask_int32<16>& mask)
+{
+    r = _mm512_maskz_compress_epi32(mask, a);
+    return compress_popcnt(mask);
+}
+
+inline unsigned i_compress(uint64<8>& r, const uint64<8>& a, const mask_int64<8>& mask)
+{
+    r = _mm512_maskz_compress_epi64(mask, a);
+    return compress_popcnt(mask);
+}
+
+inline unsigned i_compress(float32<16>& r, const float32<16>& a, const mask_float32<16>& mask)
+{
+    r = _mm512_maskz_compress_ps(mask, a);
+    return compress_popcnt(mask);
+}
+
+inline unsigned i_compress(float64<8>& r, const float64<8>& a, const mask_float64<8>& mask)
+{
+    r = _mm512_maskz_compress_pd(mask, a);
+    return compress_popcnt(mask);
+}
+#endif
+
+template<unsigned N>
+unsigned i_compress(uint8<N>& r, const uint8<N>& a, const mask_int8<N>& mask)
+{
+    return v_compress(r, a, mask);
+}
+
+template<unsigned N>
+unsigned i_compress(uint16<N>& r, const uint16<N>& a, const mask_int16<N>& mask)
+{
+    return v_compress(r, a, mask);
+}
+
+template<unsigned N>
+unsigned i_compress(uint32<N>& r, const uint32<N>& a, const mask_int32<N>& mask)
+{
+    return v_compress(r, a, mask);
+}
+
+template<unsigned N>
+unsigned i_compress(uint64<N>& r, const uint64<N>& a, const mask_int64<N>& mask)
+{
+    return v_compress(r, a, mask);
+}
+
+template<unsigned N>
+unsigned i_compress(float32<N>& r, const float32<N>& a, const mask_float32<N>& mask)
+{
+    return v_compress(r, a, mask);
+}
+
+template<unsigned N>
+unsigned i_compress(float64<N>& r, const float64<N>& a, const mask_float64<N>& mask)
+{
+    return v_compress(r, a, mask);
+}
+
+// The base vectors are compressed one by one and are concatenated in memory
+template<class V, class M>
+unsigned v_compress(V& r, const V& a, const M& mask)
+{
+    using E = typename V::element_type;
+    using B = typename V::base_vector_type;
+    union {
+        E d[V::length + B::length];
+        V align;
+    };
+    std::memset(d, 0, sizeof(d));
+
+    unsigned n = 0;
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        B t;
+        unsigned c = i_compress(t, a[j], mask[j]);
+        // the unselected elements of t are zero
+        std::memcpy(d + n, &t, sizeof(t));
+        n += c;
+    }
+    std::memcpy(&r, d, sizeof(r));
+    return n;
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -91,6 +91,13 @@ inline float32x8 i_ceil(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_ceil(float32x16 a)
+{
+    return _mm512_roundscale_ps(a, 2); // 2 = round towards positive infinity
+}
+#endif
+
 template<unsigned N>
 float32<N> i_ceil(float32<N> a)
 {
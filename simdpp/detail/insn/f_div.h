@@ -73,6 +73,13 @@ inline float32x8 i_div(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_div(float32x16 a, float32x16 b)
+{
+    return _mm512_div_ps(a, b);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_div(float32<N> a, float32<N> b)
 {
@@ -97,6 +104,13 @@ inline float64x4 i_div(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_div(float64x8 a, float64x8 b)
+{
+    return _mm512_div_pd(a, b);
+}
+#endif
+
 template<unsigned N>
 float64<N> i_div(float64<N> a, float64<N> b)
 {
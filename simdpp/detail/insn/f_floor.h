@@ -89,10 +89,17 @@ inline float32x8 i_floor(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_floor(float32x16 a)
+{
+    return _mm512_roundscale_ps(a, 1); // 1 = round towards negative infinity
+}
+#endif
+
 template<unsigned N>
-float32x8 i_floor(float32x8 a)
+float32<N> i_floor(float32<N> a)
 {
-    SIMDPP_VEC_ARRAY_IMPL1(float32x8, i_floor, a);
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_floor, a);
 }
 
 } // namespace insn
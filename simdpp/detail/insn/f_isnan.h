@@ -65,6 +65,13 @@ inline mask_float32x8 i_isnan(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_isnan(float32x16 a)
+{
+    return _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_isnan(float32<N> a)
 {
@@ -91,6 +98,13 @@ inline mask_float64x4 i_isnan(float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_isnan(float64x8 a)
+{
+    return _mm512_cmp_pd_mask(a, a, _CMP_UNORD_Q);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_isnan(float64<N> a)
 {
@@ -65,6 +65,13 @@ inline mask_float32x8 i_isnan2(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float32x16 i_isnan2(float32x16 a, float32x16 b)
+{
+    return _mm512_cmp_ps_mask(a, b, _CMP_UNORD_Q);
+}
+#endif
+
 template<unsigned N>
 mask_float32<N> i_isnan2(float32<N> a, float32<N> b)
 {
@@ -91,6 +98,13 @@ inline mask_float64x4 i_isnan2(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline mask_float64x8 i_isnan2(float64x8 a, float64x8 b)
+{
+    return _mm512_cmp_pd_mask(a, b, _CMP_UNORD_Q);
+}
+#endif
+
 template<unsigned N>
 mask_float64<N> i_isnan2(float64<N> a, float64<N> b)
 {
@@ -63,6 +63,13 @@ inline float32x8 i_max(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_max(float32x16 a, float32x16 b)
+{
+    return _mm512_max_ps(a, b);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_max(float32<N> a, float32<N> b)
 {
@@ -87,6 +94,13 @@ inline float64x4 i_max(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_max(float64x8 a, float64x8 b)
+{
+    return _mm512_max_pd(a, b);
+}
+#endif
+
 template<unsigned N>
 float64<N> i_max(float64<N> a, float64<N> b)
 {
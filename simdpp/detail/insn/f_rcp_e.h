@@ -67,6 +67,13 @@ inline float32x8 i_rcp_e(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_rcp_e(float32x16 a)
+{
+    return _mm512_rcp14_ps(a);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_rcp_e(float32<N> a)
 {
@@ -93,6 +93,20 @@ inline float32x8 i_rcp_rh(float32x8 x, float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_rcp_rh(float32x16 x, float32x16 a)
+{
+    float32x16 c2, r;
+    c2 = make_float(2.0f);
+
+    r = mul(a, x);
+    r = sub(c2, r);
+    x = mul(x, r);
+
+    return x;
+}
+#endif
+
 template<unsigned N>
 float32<N> i_rcp_rh(float32<N> x, float32<N> a)
 {
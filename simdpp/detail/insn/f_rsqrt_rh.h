@@ -107,6 +107,24 @@ inline float32x8 i_rsqrt_rh(float32x8 x, float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_rsqrt_rh(float32x16 x, float32x16 a)
+{
+    float32x16 x2, c3, c0p5, r;
+
+    c3 = make_float(3.0f);
+    c0p5 = make_float(0.5f);
+
+    x2 = mul(x, x);
+    r = mul(a, x2);
+    r = sub(c3, r);
+    x = mul(x, c0p5);
+    r = mul(x, r);
+
+    return r;
+}
+#endif
+
 template<unsigned N>
 float32<N> i_rsqrt_rh(float32<N> x, float32<N> a)
 {
@@ -68,6 +68,13 @@ inline float32x8 i_sqrt(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_sqrt(float32x16 a)
+{
+    return _mm512_sqrt_ps(a);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_sqrt(float32<N> a)
 {
@@ -92,6 +99,13 @@ inline float64x4 i_sqrt(float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_sqrt(float64x8 a)
+{
+    return _mm512_sqrt_pd(a);
+}
+#endif
+
 template<unsigned N>
 float64<N> i_sqrt(float64<N> a)
 {
@@ -75,6 +75,13 @@ inline float32x8 i_trunc(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_trunc(float32x16 a)
+{
+    return _mm512_roundscale_ps(a, 3); // 3 = i_truncate
+}
+#endif
+
 template<unsigned N>
 float32<N> i_trunc(float32<N> a)
 {
@@ -0,0 +1,468 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  The functions in this file load the elements p[idx[i]] into r. The
+    indices are signed and are scaled by the size of the element. The masked
+    variants zero the elements for which the mask is not set and do not
+    access their memory.
+
+    64-bit elements may be indexed by 32-bit indices. In that case the index
+    vector has half the width of the data vector, thus multi-vector gathers
+    slice the index vector into parts matching the base vectors of r.
+*/
+
+template<class V, class I>
+void v_emul_gather(V& r, const char* p, const I& idx)
+{
+    using E = typename V::element_type;
+    const E* pe = reinterpret_cast<const E*>(p);
+    mem_block<I> mi(idx);
+    mem_block<V> mr;
+    for (unsigned i = 0; i < V::length; i++) {
+        std::memcpy(&mr[i], pe + mi[i], sizeof(E));
+    }
+    r = mr;
+}
+
+template<class V, class I, class M>
+void v_emul_gather_masked(V& r, const char* p, const I& idx, const M& mask)
+{
+    using E = typename V::element_type;
+    const E* pe = reinterpret_cast<const E*>(p);
+    using U = typename V::uint_vector_type;
+    mem_block<I> mi(idx);
+    mem_block<U> mm(bit_cast<U>(mask.unmask()));
+    mem_block<V> mr;
+    for (unsigned i = 0; i < V::length; i++) {
+        if (mm[i] != 0) {
+            std::memcpy(&mr[i], pe + mi[i], sizeof(E));
+        } else {
+            mr[i] = 0;
+        }
+    }
+    r = mr;
+}
+
+// Returns the indices [j*M, j*M+M) of idx
+template<unsigned M, unsigned N>
+int32<M> v_gather_index_slice(const int32<N>& idx, unsigned j)
+{
+    mem_block<int32<N>> mi(idx);
+    mem_block<int32<M>> mr;
+    for (unsigned i = 0; i < M; i++) {
+        mr[i] = mi[j*M + i];
+    }
+    return mr;
+}
+
+// Multi-vector i_gather is mostly boilerplate
+template<class V, class I>
+void v_gather(V& r, const char* p, const I& idx);
+template<class V, class I, class M>
+void v_gather_masked(V& r, const char* p, const I& idx, const M& mask);
+template<class V, unsigned N>
+void v_gather_i32(V& r, const char* p, const int32<N>& idx);
+template<class V, unsigned N, class M>
+void v_gather_i32_masked(V& r, const char* p, const int32<N>& idx,
+                         const M& mask);
+
+// -----------------------------------------------------------------------------
+// 32-bit elements
+
+#if SIMDPP_USE_AVX2
+inline void i_gather(uint32x4& r, const char* p, const int32x4& idx)
+{
+    r = _mm_i32gather_epi32(reinterpret_cast<const int*>(p), idx, 4);
+}
+
+inline void i_gather(uint32x8& r, const char* p, const int32x8& idx)
+{
+    r = _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), idx, 4);
+}
+
+inline void i_gather(float32x4& r, const char* p, const int32x4& idx)
+{
+    r = _mm_i32gather_ps(reinterpret_cast<const float*>(p), idx, 4);
+}
+
+inline void i_gather(float32x8& r, const char* p, const int32x8& idx)
+{
+    r = _mm256_i32gather_ps(reinterpret_cast<const float*>(p), idx, 4);
+}
+
+inline void i_gather_masked(uint32x4& r, const char* p, const int32x4& idx,
+                            const mask_int32x4& mask)
+{
+    r = _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                 reinterpret_cast<const int*>(p),
+                                 idx, mask.unmask(), 4);
+}
+
+inline void i_gather_masked(uint32x8& r, const char* p, const int32x8& idx,
+                            const mask_int32x8& mask)
+{
+    r = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                    reinterpret_cast<const int*>(p),
+                                    idx, mask.unmask(), 4);
+}
+
+inline void i_gather_masked(float32x4& r, const char* p, const int32x4& idx,
+                            const mask_float32x4& mask)
+{
+    r = _mm_mask_i32gather_ps(_mm_setzero_ps(),
+                              reinterpret_cast<const float*>(p),
+                              idx, mask.unmask(), 4);
+}
+
+inline void i_gather_masked(float32x8& r, const char* p, const int32x8& idx,
+                            const mask_float32x8& mask)
+{
+    r = _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                 reinterpret_cast<const float*>(p),
+                                 idx, mask.unmask(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_gather(uint32<16>& r, const char* p, const int32<16>& idx)
+{
+    r = _mm512_i32gather_epi32(idx, p, 4);
+}
+
+inline void i_gather(float32<16>& r, const char* p, const int32<16>& idx)
+{
+    r = _mm512_i32gather_ps(idx, p, 4);
+}
+
+inline void i_gather_masked(uint32<16>& r, const char* p, const int32<16>& idx,
+                            const mask_int32<16>& mask)
+{
+    r = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, idx, p, 4);
+}
+
+inline void i_gather_masked(float32<16>& r, const char* p, const int32<16>& idx,
+                            const mask_float32<16>& mask)
+{
+    r = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, p, 4);
+}
+#endif
+
+template<unsigned N>
+void i_gather(uint32<N>& r, const char* p, const int32<N>& idx)
+{
+    v_gather(r, p, idx);
+}
+
+template<unsigned N>
+void i_gather(float32<N>& r, const char* p, const int32<N>& idx)
+{
+    v_gather(r, p, idx);
+}
+
+template<unsigned N>
+void i_gather_masked(uint32<N>& r, const char* p, const int32<N>& idx,
+                     const mask_int32<N>& mask)
+{
+    v_gather_masked(r, p, idx, mask);
+}
+
+template<unsigned N>
+void i_gather_masked(float32<N>& r, const char* p, const int32<N>& idx,
+                     const mask_float32<N>& mask)
+{
+    v_gather_masked(r, p, idx, mask);
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements, 64-bit indices
+
+#if SIMDPP_USE_AVX2
+inline void i_gather(uint64x2& r, const char* p, const int64x2& idx)
+{
+    r = _mm_i64gather_epi64(reinterpret_cast<const long long*>(p), idx, 8);
+}
+
+inline void i_gather(uint64x4& r, const char* p, const int64x4& idx)
+{
+    r = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(p), idx, 8);
+}
+
+inline void i_gather(float64x2& r, const char* p, const int64x2& idx)
+{
+    r = _mm_i64gather_pd(reinterpret_cast<const double*>(p), idx, 8);
+}
+
+inline void i_gather(float64x4& r, const char* p, const int64x4& idx)
+{
+    r = _mm256_i64gather_pd(reinterpret_cast<const double*>(p), idx, 8);
+}
+
+inline void i_gather_masked(uint64x2& r, const char* p, const int64x2& idx,
+                            const mask_int64x2& mask)
+{
+    r = _mm_mask_i64gather_epi64(_mm_setzero_si128(),
+                                 reinterpret_cast<const long long*>(p),
+                                 idx, mask.unmask(), 8);
+}
+
+inline void i_gather_masked(uint64x4& r, const char* p, const int64x4& idx,
+                            const mask_int64x4& mask)
+{
+    r = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const long long*>(p),
+                                    idx, mask.unmask(), 8);
+}
+
+inline void i_gather_masked(float64x2& r, const char* p, const int64x2& idx,
+                            const mask_float64x2& mask)
+{
+    r = _mm_mask_i64gather_pd(_mm_setzero_pd(),
+                              reinterpret_cast<const double*>(p),
+                              idx, mask.unmask(), 8);
+}
+
+inline void i_gather_masked(float64x4& r, const char* p, const int64x4& idx,
+                            const mask_float64x4& mask)
+{
+    r = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
+                                 reinterpret_cast<const double*>(p),
+                                 idx, mask.unmask(), 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_gather(uint64<8>& r, const char* p, const int64<8>& idx)
+{
+    r = _mm512_i64gather_epi64(idx, p, 8);
+}
+
+inline void i_gather(float64<8>& r, const char* p, const int64<8>& idx)
+{
+    r = _mm512_i64gather_pd(idx, p, 8);
+}
+
+inline void i_gather_masked(uint64<8>& r, const char* p, const int64<8>& idx,
+                            const mask_int64<8>& mask)
+{
+    r = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask, idx, p, 8);
+}
+
+inline void i_gather_masked(float64<8>& r, const char* p, const int64<8>& idx,
+                            const mask_float64<8>& mask)
+{
+    r = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, idx, p, 8);
+}
+#endif
+
+template<unsigned N>
+void i_gather(uint64<N>& r, const char* p, const int64<N>& idx)
+{
+    v_gather(r, p, idx);
+}
+
+template<unsigned N>
+void i_gather(float64<N>& r, const char* p, const int64<N>& idx)
+{
+    v_gather(r, p, idx);
+}
+
+template<unsigned N>
+void i_gather_masked(uint64<N>& r, const char* p, const int64<N>& idx,
+                     const mask_int64<N>& mask)
+{
+    v_gather_masked(r, p, idx, mask);
+}
+
+template<unsigned N>
+void i_gather_masked(float64<N>& r, const char* p, const int64<N>& idx,
+                     const mask_float64<N>& mask)
+{
+    v_gather_masked(r, p, idx, mask);
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements, 32-bit indices
+
+#if SIMDPP_USE_AVX2
+inline void i_gather(uint64x4& r, const char* p, const int32x4& idx)
+{
+    r = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(p), idx, 8);
+}
+
+inline void i_gather(float64x4& r, const char* p, const int32x4& idx)
+{
+    r = _mm256_i32gather_pd(reinterpret_cast<const double*>(p), idx, 8);
+}
+
+inline void i_gather_masked(uint64x4& r, const char* p, const int32x4& idx,
+                            const mask_int64x4& mask)
+{
+    r = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                    reinterpret_cast<const long long*>(p),
+                                    idx, mask.unmask(), 8);
+}
+
+inline void i_gather_masked(float64x4& r, const char* p, const int32x4& idx,
+                            const mask_float64x4& mask)
+{
+    r = _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                 reinterpret_cast<const double*>(p),
+                                 idx, mask.unmask(), 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_gather(uint64<8>& r, const char* p, const int32x8& idx)
+{
+    r = _mm512_i32gather_epi64(idx, p, 8);
+}
+
+inline void i_gather(float64<8>& r, const char* p, const int32x8& idx)
+{
+    r = _mm512_i32gather_pd(idx, p, 8);
+}
+
+inline void i_gather_masked(uint64<8>& r, const char* p, const int32x8& idx,
+                            const mask_int64<8>& mask)
+{
+    r = _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, idx, p, 8);
+}
+
+inline void i_gather_masked(float64<8>& r, const char* p, const int32x8& idx,
+                            const mask_float64<8>& mask)
+{
+    r = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, idx, p, 8);
+}
+#endif
+
+template<unsigned N>
+void i_gather(uint64<N>& r, const char* p, const int32<N>& idx)
+{
+    v_gather_i32(r, p, idx);
+}
+
+template<unsigned N>
+void i_gather(float64<N>& r, const char* p, const int32<N>& idx)
+{
+    v_gather_i32(r, p, idx);
+}
+
+template<unsigned N>
+void i_gather_masked(uint64<N>& r, const char* p, const int32<N>& idx,
+                     const mask_int64<N>& mask)
+{
+    v_gather_i32_masked(r, p, idx, mask);
+}
+
+template<unsigned N>
+void i_gather_masked(float64<N>& r, const char* p, const int32<N>& idx,
+                     const mask_float64<N>& mask)
+{
+    v_gather_i32_masked(r, p, idx, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V, class I>
+void v_gather(V& r, const char* p, const I& idx)
+{
+#if SIMDPP_USE_AVX2
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_gather(r[j], p, idx[j]);
+    }
+#else
+    v_emul_gather(r, p, idx);
+#endif
+}
+
+template<class V, class I, class M>
+void v_gather_masked(V& r, const char* p, const I& idx, const M& mask)
+{
+#if SIMDPP_USE_AVX2
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_gather_masked(r[j], p, idx[j], mask[j]);
+    }
+#else
+    v_emul_gather_masked(r, p, idx, mask);
+#endif
+}
+
+template<class V, unsigned N>
+void v_gather_i32(V& r, const char* p, const int32<N>& idx)
+{
+#if SIMDPP_USE_AVX2
+    using B = typename V::base_vector_type;
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_gather(r[j], p, v_gather_index_slice<B::length>(idx, j));
+    }
+#else
+    v_emul_gather(r, p, idx);
+#endif
+}
+
+template<class V, unsigned N, class M>
+void v_gather_i32_masked(V& r, const char* p, const int32<N>& idx,
+                         const M& mask)
+{
+#if SIMDPP_USE_AVX2
+    using B = typename V::base_vector_type;
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_gather_masked(r[j], p, v_gather_index_slice<B::length>(idx, j),
+                        mask[j]);
+    }
+#else
+    v_emul_gather_masked(r, p, idx, mask);
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -227,6 +227,20 @@ inline uint32x8 i_avg(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_avg(uint32x16 a, uint32x16 b)
+{
+    // (x & y) + ((x ^ y) >> 1) + (x ^ y) & 1
+    uint32x16 x1, x2, round;
+    x1 = bit_and(a, b);
+    x2 = bit_xor(a, b);
+    round = bit_and(x2, (uint32<16>) make_uint(1));
+    x1 = add(x1, shift_r<1>(x2));
+    x1 = add(x1, round);
+    return x1;
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_avg(uint32<N> a, uint32<N> b)
 {
@@ -267,6 +281,19 @@ inline int32x8 i_avg(int32x8 a, int32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline int32x16 i_avg(int32x16 a, int32x16 b)
+{
+    uint32x16 a2, b2, bias, r;
+    bias = make_uint(0x80000000);
+    a2 = bit_xor(a, bias); // add
+    b2 = bit_xor(b, bias); // add
+    r = i_avg(a2, b2); // unsigned
+    r = bit_xor(r, bias); // sub
+    return r;
+}
+#endif
+
 template<unsigned N>
 int32<N> i_avg(int32<N> a, int32<N> b)
 {
@@ -186,6 +186,13 @@ inline int32x8 i_max(int32x8 a, int32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline int32x16 i_max(int32x16 a, int32x16 b)
+{
+    return _mm512_max_epi32(a, b);
+}
+#endif
+
 template<unsigned N>
 int32<N> i_max(int32<N> a, int32<N> b)
 {
@@ -217,6 +224,13 @@ inline uint32x8 i_max(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_max(uint32x16 a, uint32x16 b)
+{
+    return _mm512_max_epu32(a, b);
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_max(uint32<N> a, uint32<N> b)
 {
@@ -186,6 +186,13 @@ inline int32x8 i_min(int32x8 a, int32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline int32x16 i_min(int32x16 a, int32x16 b)
+{
+    return _mm512_min_epi32(a, b);
+}
+#endif
+
 template<unsigned N>
 int32<N> i_min(int32<N> a, int32<N> b)
 {
@@ -217,6 +224,13 @@ inline uint32x8 i_min(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_min(uint32x16 a, uint32x16 b)
+{
+    return _mm512_min_epu32(a, b);
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_min(uint32<N> a, uint32<N> b)
 {
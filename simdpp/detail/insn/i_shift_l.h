@@ -77,12 +77,12 @@ inline uint8x32 i_shift_l(uint8x32 a, unsigned count)
     uint16x16 mask, a16;
     mask = uint16x16::ones();
     mask = shift_r(mask, 16-count);
-    mask = i_shift_l(mask, 8);
+    mask = shift_l(mask, 8);
 
     a16 = a;
-    a16 = i_shift_l(a16, count);
+    a16 = shift_l(a16, count);
     a16 = bit_andnot(a16, mask);
-    return a16;
+    return uint8x32(a16);
 }
 #endif
 
@@ -146,6 +146,13 @@ inline uint32x8 i_shift_l(uint32x8 a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_shift_l(uint32x16 a, unsigned count)
+{
+    return _mm512_sll_epi32(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_shift_l(uint32<N> a, unsigned count)
 {
@@ -175,6 +182,13 @@ inline uint64x4 i_shift_l(uint64x4 a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint64x8 i_shift_l(uint64x8 a, unsigned count)
+{
+    return _mm512_sll_epi64(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N>
 uint64<N> i_shift_l(uint64<N> a, unsigned count)
 {
@@ -288,6 +302,15 @@ inline uint32x8 i_shift_l(uint32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned count>
+inline uint32x16 i_shift_l(uint32x16 a)
+{
+    static_assert(count <= 32, "Shift out of bounds");
+    return i_shift_l(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N>
 uint32<N> i_shift_l(uint32<N> a)
 {
@@ -319,6 +342,15 @@ inline uint64x4 i_shift_l(uint64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned count>
+inline uint64x8 i_shift_l(uint64x8 a)
+{
+    static_assert(count <= 64, "Shift out of bounds");
+    return i_shift_l(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N>
 uint64<N> i_shift_l(uint64<N> a)
 {
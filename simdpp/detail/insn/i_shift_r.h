@@ -135,7 +135,7 @@ inline uint8x32 i_shift_r(uint8x32 a, unsigned count)
     a16 = a;
     a16 = shift_r(a16, count);
     a16 = bit_andnot(a16, mask);
-    return a16;
+    return uint8x32(a16);
 }
 #endif
 
@@ -229,6 +229,13 @@ inline int32x8 i_shift_r(int32x8 a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline int32x16 i_shift_r(int32x16 a, unsigned count)
+{
+    return _mm512_sra_epi32(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N>
 int32<N> i_shift_r(int32<N> a, unsigned count)
 {
@@ -259,6 +266,13 @@ inline uint32x8 i_shift_r(uint32x8 a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_shift_r(uint32x16 a, unsigned count)
+{
+    return _mm512_srl_epi32(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_shift_r(uint32<N> a, unsigned count)
 {
@@ -312,7 +326,7 @@ inline int64x4 i_shift_r(int64x4 a, unsigned count)
         v = shift_r(v, count - 32);
         v = shuffle2<1,3,1,3>(v, s);
         v = permute4<0,2,1,3>(v);
-        return v;
+        return int64x4(v);
     } else {
         uint64x4 v, mask;
         int32x8 sgn;
@@ -323,11 +337,18 @@ inline int64x4 i_shift_r(int64x4 a, unsigned count)
         mask = shift_l(mask, 64 - count);
         sgn = bit_and(sgn, mask);
         v = bit_or(v, sgn);
-        return v;
+        return int64x4(v);
     }
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline int64x8 i_shift_r(int64x8 a, unsigned count)
+{
+    return _mm512_sra_epi64(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N>
 int64<N> i_shift_r(int64<N> a, unsigned count)
 {
@@ -357,6 +378,13 @@ inline uint64x4 i_shift_r(uint64x4 a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint64x8 i_shift_r(uint64x8 a, unsigned count)
+{
+    return _mm512_srl_epi64(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N>
 uint64<N> i_shift_r(uint64<N> a, unsigned count)
 {
@@ -528,6 +556,15 @@ int32x8 i_shift_r(int32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned count>
+int32x16 i_shift_r(int32x16 a)
+{
+    static_assert(count <= 32, "Shift out of bounds");
+    return i_shift_r(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N>
 int32<N> i_shift_r(int32<N> a)
 {
@@ -560,6 +597,15 @@ uint32x8 i_shift_r(uint32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned count>
+uint32x16 i_shift_r(uint32x16 a)
+{
+    static_assert(count <= 32, "Shift out of bounds");
+    return i_shift_r(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N>
 uint32<N> i_shift_r(uint32<N> a)
 {
@@ -592,6 +638,15 @@ int64x4 i_shift_r(int64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned count>
+int64x8 i_shift_r(int64x8 a)
+{
+    static_assert(count <= 64, "Shift out of bounds");
+    return i_shift_r(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N>
 int64<N> i_shift_r(int64<N> a)
 {
@@ -623,6 +678,15 @@ uint64x4 i_shift_r(uint64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned count>
+uint64x8 i_shift_r(uint64x8 a)
+{
+    static_assert(count <= 64, "Shift out of bounds");
+    return i_shift_r(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N>
 uint64<N> i_shift_r(uint64<N> a)
 {
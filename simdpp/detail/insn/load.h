@@ -117,6 +117,9 @@ inline void i_load(uint64x4& a,  const char* p)
 {
     a = _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
 }
+#endif
+
+#if SIMDPP_USE_AVX
 inline void i_load(float32x8& a, const char* p)
 {
     a = _mm256_load_ps(reinterpret_cast<const float*>(p));
@@ -127,6 +130,25 @@ inline void i_load(float64x4& a, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load(uint32<16>& a, const char* p)
+{
+    a = _mm512_load_si512(reinterpret_cast<const __m512i*>(p));
+}
+inline void i_load(uint64<8>& a,  const char* p)
+{
+    a = _mm512_load_si512(reinterpret_cast<const __m512i*>(p));
+}
+inline void i_load(float32<16>& a, const char* p)
+{
+    a = _mm512_load_ps(reinterpret_cast<const float*>(p));
+}
+inline void i_load(float64<8>& a, const char* p)
+{
+    a = _mm512_load_pd(reinterpret_cast<const double*>(p));
+}
+#endif
+
 template<unsigned N>
 void i_load(uint8<N>& a,  const char* p) { v_load(a, p); }
 template<unsigned N>
@@ -35,6 +35,7 @@
 #include <simdpp/types.h>
 #include <simdpp/detail/align.h>
 #include <simdpp/detail/insn/mem_unpack.h>
+#include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
 #include <simdpp/null/memory.h>
 
@@ -48,6 +49,8 @@ namespace insn {
 // the 256-bit versions are mostly boilerplate. Collect that stuff here.
 template<class V>
 void v256_load_packed2(V& a, V& b, const char* p);
+template<class H, class V>
+void v512_load_packed2(V& a, V& b, const char* p);
 template<class V>
 void v_load_packed2(V& a, V& b, const char* p);
 
@@ -138,6 +141,13 @@ inline void i_load_packed2(uint32x8& a, uint32x8& b, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed2(uint32x16& a, uint32x16& b, const char* p)
+{
+    v512_load_packed2<uint32x8>(a, b, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed2(uint32<N>& a, uint32<N>& b, const char* p)
 {
@@ -161,6 +171,13 @@ inline void i_load_packed2(uint64x4& a, uint64x4& b, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed2(uint64x8& a, uint64x8& b, const char* p)
+{
+    v512_load_packed2<uint64x4>(a, b, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed2(uint64<N>& a, uint64<N>& b, const char* p)
 {
@@ -192,6 +209,13 @@ inline void i_load_packed2(float32x8& a, float32x8& b, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed2(float32x16& a, float32x16& b, const char* p)
+{
+    v512_load_packed2<float32x8>(a, b, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed2(float32<N>& a, float32<N>& b, const char* p)
 {
@@ -202,10 +226,9 @@ void i_load_packed2(float32<N>& a, float32<N>& b, const char* p)
 
 inline void i_load_packed2(float64x2& a, float64x2& b, const char* p)
 {
-    const double* q = reinterpret_cast<const double*>(p);
-    q = detail::assume_aligned(q, 16);
-    a = load(q);
-    b = load(q+16);
+    p = detail::assume_aligned(p, 16);
+    a = load(p);
+    b = load(p+16);
     transpose2(a, b);
 }
 
@@ -216,6 +239,13 @@ inline void i_load_packed2(float64x4& a, float64x4& b, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed2(float64x8& a, float64x8& b, const char* p)
+{
+    v512_load_packed2<float64x4>(a, b, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed2(float64<N>& a, float64<N>& b, const char* p)
 {
@@ -224,7 +254,7 @@ void i_load_packed2(float64<N>& a, float64<N>& b, const char* p)
 
 // -----------------------------------------------------------------------------
 
-template<class V, class P>
+template<class V>
 void v256_load_packed2(V& a, V& b, const char* p)
 {
     p = detail::assume_aligned(p, 32);
@@ -233,6 +263,17 @@ void v256_load_packed2(V& a, V& b, const char* p)
     mem_unpack2(a, b);
 }
 
+template<class H, class V>
+void v512_load_packed2(V& a, V& b, const char* p)
+{
+    p = detail::assume_aligned(p, 64);
+    H a0, b0, a1, b1;
+    i_load_packed2(a0, b0, p);
+    i_load_packed2(a1, b1, p + 64);
+    a = combine(a0, a1);
+    b = combine(b0, b1);
+}
+
 template<class V>
 void v_load_packed2(V& a, V& b, const char* p)
 {
@@ -35,6 +35,7 @@
 #include <simdpp/types.h>
 #include <simdpp/detail/align.h>
 #include <simdpp/detail/insn/mem_unpack.h>
+#include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
 #include <simdpp/adv/transpose.h>
 #include <simdpp/null/memory.h>
@@ -50,6 +51,8 @@ namespace insn {
 // the 256-bit versions are mostly boilerplate. Collect that stuff here.
 template<class V>
 void v256_load_packed3(V& a, V& b, V& c, const char* p);
+template<class H, class V>
+void v512_load_packed3(V& a, V& b, V& c, const char* p);
 template<class V>
 void v_load_packed3(V& a, V& b, V& c, const char* p);
 
@@ -148,6 +151,13 @@ inline void i_load_packed3(uint32x8& a, uint32x8& b, uint32x8& c, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed3(uint32x16& a, uint32x16& b, uint32x16& c, const char* p)
+{
+    v512_load_packed3<uint32x8>(a, b, c, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed3(uint32<N>& a, uint32<N>& b, uint32<N>& c, const char* p)
 {
@@ -192,6 +202,13 @@ inline void i_load_packed3(uint64x4& a, uint64x4& b, uint64x4& c, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed3(uint64x8& a, uint64x8& b, uint64x8& c, const char* p)
+{
+    v512_load_packed3<uint64x4>(a, b, c, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed3(uint64<N>& a, uint64<N>& b, uint64<N>& c, const char* p)
 {
@@ -225,6 +242,13 @@ inline void i_load_packed3(float32x8& a, float32x8& b, float32x8& c, const char*
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed3(float32x16& a, float32x16& b, float32x16& c, const char* p)
+{
+    v512_load_packed3<float32x8>(a, b, c, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed3(float32<N>& a, float32<N>& b, float32<N>& c, const char* p)
 {
@@ -254,6 +278,14 @@ inline void i_load_packed3(float64x4& a, float64x4& b, float64x4& c,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed3(float64x8& a, float64x8& b, float64x8& c,
+                           const char* p)
+{
+    v512_load_packed3<float64x4>(a, b, c, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed3(float64<N>& a, float64<N>& b, float64<N>& c, const char* p)
 {
@@ -272,6 +304,18 @@ void v256_load_packed3(V& a, V& b, V& c, const char* p)
     mem_unpack3(a, b, c);
 }
 
+template<class H, class V>
+void v512_load_packed3(V& a, V& b, V& c, const char* p)
+{
+    p = detail::assume_aligned(p, 64);
+    H a0, b0, c0, a1, b1, c1;
+    i_load_packed3(a0, b0, c0, p);
+    i_load_packed3(a1, b1, c1, p + 96);
+    a = combine(a0, a1);
+    b = combine(b0, b1);
+    c = combine(c0, c1);
+}
+
 template<class V>
 void v_load_packed3(V& a, V& b, V& c, const char* p)
 {
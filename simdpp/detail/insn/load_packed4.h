@@ -34,6 +34,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/insn/mem_unpack.h>
+#include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
 #include <simdpp/adv/transpose.h>
 #include <simdpp/null/memory.h>
@@ -49,6 +50,8 @@ namespace insn {
 // the 256-bit versions are mostly boilerplate. Collect that stuff here.
 template<class V>
 void v256_load_packed4(V& a, V& b, V& c, V& d, const char* p);
+template<class H, class V>
+void v512_load_packed4(V& a, V& b, V& c, V& d, const char* p);
 template<class V>
 void v_load_packed4(V& a, V& b, V& c, V& d, const char* p);
 
@@ -159,6 +162,14 @@ inline void i_load_packed4(uint32x8& a, uint32x8& b, uint32x8& c, uint32x8& d,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed4(uint32x16& a, uint32x16& b, uint32x16& c, uint32x16& d,
+                           const char* p)
+{
+    v512_load_packed4<uint32x8>(a, b, c, d, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed4(uint32<N>& a, uint32<N>& b, uint32<N>& c, uint32<N>& d,
                     const char* p)
@@ -188,6 +199,14 @@ inline void i_load_packed4(uint64x4& a, uint64x4& b, uint64x4& c, uint64x4& d,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed4(uint64x8& a, uint64x8& b, uint64x8& c, uint64x8& d,
+                           const char* p)
+{
+    v512_load_packed4<uint64x4>(a, b, c, d, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed4(uint64<N>& a, uint64<N>& b, uint64<N>& c, uint64<N>& d,
                   const char* p)
@@ -226,6 +245,14 @@ inline void i_load_packed4(float32x8& a, float32x8& b, float32x8& c, float32x8&
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed4(float32x16& a, float32x16& b, float32x16& c, float32x16& d,
+                           const char* p)
+{
+    v512_load_packed4<float32x8>(a, b, c, d, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed4(float32<N>& a, float32<N>& b, float32<N>& c, float32<N>& d,
                   const char* p)
@@ -258,6 +285,14 @@ inline void i_load_packed4(float64x4& a, float64x4& b, float64x4& c, float64x4&
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_packed4(float64x8& a, float64x8& b, float64x8& c, float64x8& d,
+                           const char* p)
+{
+    v512_load_packed4<float64x4>(a, b, c, d, p);
+}
+#endif
+
 template<unsigned N>
 void i_load_packed4(float64<N>& a, float64<N>& b, float64<N>& c, float64<N>& d,
                     const char* p)
@@ -278,6 +313,19 @@ void v256_load_packed4(V& a, V& b, V& c, V& d, const char* p)
     mem_unpack4(a, b, c, d);
 }
 
+template<class H, class V>
+void v512_load_packed4(V& a, V& b, V& c, V& d, const char* p)
+{
+    p = detail::assume_aligned(p, 64);
+    H a0, b0, c0, d0, a1, b1, c1, d1;
+    i_load_packed4(a0, b0, c0, d0, p);
+    i_load_packed4(a1, b1, c1, d1, p + 128);
+    a = combine(a0, a1);
+    b = combine(b0, b1);
+    c = combine(c0, c1);
+    d = combine(d0, d1);
+}
+
 template<class V>
 void v_load_packed4(V& a, V& b, V& c, V& d, const char* p)
 {
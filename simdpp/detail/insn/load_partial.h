@@ -0,0 +1,325 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Copies @a b bytes, b <= 16. Each power of two part of @a b is copied with
+    a single fixed size copy, thus no library call is made.
+*/
+inline void partial_copy16(char* dst, const char* src, unsigned b)
+{
+    if (b & 16) { std::memcpy(dst, src, 16); dst += 16; src += 16; }
+    if (b & 8) { std::memcpy(dst, src, 8); dst += 8; src += 8; }
+    if (b & 4) { std::memcpy(dst, src, 4); dst += 4; src += 4; }
+    if (b & 2) { std::memcpy(dst, src, 2); dst += 2; src += 2; }
+    if (b & 1) { *dst = *src; }
+}
+
+#if SIMDPP_USE_AVX
+/*  Returns a mask with the first @a n 32-bit elements set, n <= 8. The mask
+    of the first @a n 64-bit elements is partial_mask32(n*2).
+*/
+inline __m256i partial_mask32(unsigned n)
+{
+    static const int32_t mask_d[16] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                         0,  0,  0,  0,  0,  0,  0,  0 };
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask_d + 8 - n));
+}
+#endif
+
+/*  Loads the first @a b bytes, b <= 16, and sets the rest to zero. No memory
+    past the first @a b bytes is accessed.
+*/
+inline uint8x16 i_load_partial_bytes16(const char* p, unsigned b)
+{
+#if SIMDPP_USE_SSE2
+    if (b >= 16) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    // The parts of 1, 2, 4 and 8 bytes are loaded starting from the end of
+    // the data. Each is shifted in from the bottom of the vector.
+    const char* q = p + b;
+    uint32_t t = 0;
+    if (b & 1) {
+        q -= 1;
+        t = uint8_t(*q);
+    }
+    if (b & 2) {
+        q -= 2;
+        uint16_t w;
+        std::memcpy(&w, q, 2);
+        t = (t << 16) | w;
+    }
+    __m128i r = _mm_cvtsi32_si128(t);
+    if (b & 4) {
+        q -= 4;
+        uint32_t w;
+        std::memcpy(&w, q, 4);
+        r = _mm_or_si128(_mm_slli_si128(r, 4), _mm_cvtsi32_si128(w));
+    }
+    if (b & 8) {
+        q -= 8;
+        r = _mm_or_si128(_mm_slli_si128(r, 8),
+                         _mm_loadl_epi64(reinterpret_cast<const __m128i*>(q)));
+    }
+    return r;
+#else
+    mem_block<uint8x16> r(uint8x16::zero());
+    partial_copy16(reinterpret_cast<char*>(&r[0]), p, b);
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline uint8x32 i_load_partial_bytes32(const char* p, unsigned b)
+{
+    if (b >= 32) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    if (b <= 16) {
+        return _mm256_inserti128_si256(_mm256_setzero_si256(),
+                                       i_load_partial_bytes16(p, b), 0);
+    }
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i hi = i_load_partial_bytes16(p + 16, b - 16);
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+#endif
+
+// Multi-vector i_load_partial is mostly boilerplate
+template<class V>
+void v_load_partial(V& a, const char* p, unsigned n);
+
+// 8 bits
+
+inline void i_load_partial(uint8x16& a, const char* p, unsigned n)
+{
+    a = i_load_partial_bytes16(p, n);
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_load_partial(uint8x32& a, const char* p, unsigned n)
+{
+    a = i_load_partial_bytes32(p, n);
+}
+#endif
+
+template<unsigned N>
+void i_load_partial(uint8<N>& a, const char* p, unsigned n)
+{
+    v_load_partial(a, p, n);
+}
+
+// 16 bits
+
+inline void i_load_partial(uint16x8& a, const char* p, unsigned n)
+{
+    a = (uint16x8) i_load_partial_bytes16(p, n*2);
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_load_partial(uint16x16& a, const char* p, unsigned n)
+{
+    a = (uint16x16) i_load_partial_bytes32(p, n*2);
+}
+#endif
+
+template<unsigned N>
+void i_load_partial(uint16<N>& a, const char* p, unsigned n)
+{
+    v_load_partial(a, p, n);
+}
+
+// 32 bits
+
+inline void i_load_partial(uint32x4& a, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n));
+    a = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p), mask));
+#else
+    a = (uint32x4) i_load_partial_bytes16(p, n*4);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_load_partial(uint32x8& a, const char* p, unsigned n)
+{
+    a = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), partial_mask32(n));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_load_partial(uint32<16>& a, const char* p, unsigned n)
+{
+    a = _mm512_maskz_loadu_epi32((1u << n) - 1, p);
+}
+#endif
+
+template<unsigned N>
+void i_load_partial(uint32<N>& a, const char* p, unsigned n)
+{
+    v_load_partial(a, p, n);
+}
+
+// 64 bits
+
+inline void i_load_partial(uint64x2& a, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n*2));
+    a = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p), mask));
+#else
+    a = (uint64x2) i_load_partial_bytes16(p, n*8);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_load_partial(uint64x4& a, const char* p, unsigned n)
+{
+    a = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p),
+                              partial_mask32(n*2));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_load_partial(uint64<8>& a, const char* p, unsigned n)
+{
+    a = _mm512_maskz_loadu_epi64((1u << n) - 1, p);
+}
+#endif
+
+template<unsigned N>
+void i_load_partial(uint64<N>& a, const char* p, unsigned n)
+{
+    v_load_partial(a, p, n);
+}
+
+// 32 bits float
+
+inline void i_load_partial(float32x4& a, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n));
+    a = _mm_maskload_ps(reinterpret_cast<const float*>(p), mask);
+#else
+    a = bit_cast<float32x4>(i_load_partial_bytes16(p, n*4));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+inline void i_load_partial(float32x8& a, const char* p, unsigned n)
+{
+    a = _mm256_maskload_ps(reinterpret_cast<const float*>(p), partial_mask32(n));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_load_partial(float32<16>& a, const char* p, unsigned n)
+{
+    a = _mm512_maskz_loadu_ps((1u << n) - 1, p);
+}
+#endif
+
+template<unsigned N>
+void i_load_partial(float32<N>& a, const char* p, unsigned n)
+{
+    v_load_partial(a, p, n);
+}
+
+// 64 bits float
+
+inline void i_load_partial(float64x2& a, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n*2));
+    a = _mm_maskload_pd(reinterpret_cast<const double*>(p), mask);
+#else
+    a = bit_cast<float64x2>(i_load_partial_bytes16(p, n*8));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+inline void i_load_partial(float64x4& a, const char* p, unsigned n)
+{
+    a = _mm256_maskload_pd(reinterpret_cast<const double*>(p),
+                           partial_mask32(n*2));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_load_partial(float64<8>& a, const char* p, unsigned n)
+{
+    a = _mm512_maskz_loadu_pd((1u << n) - 1, p);
+}
+#endif
+
+template<unsigned N>
+void i_load_partial(float64<N>& a, const char* p, unsigned n)
+{
+    v_load_partial(a, p, n);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V>
+void v_load_partial(V& a, const char* p, unsigned n)
+{
+    using B = typename V::base_vector_type;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        unsigned count = n < B::length ? n : B::length;
+        i_load_partial(a[i], p, count);
+        n -= count;
+        p += sizeof(B);
+    }
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
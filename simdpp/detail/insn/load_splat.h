@@ -141,6 +141,13 @@ inline void i_load_splat(uint32x8& v, const void* p0)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_splat(uint32<16>& v, const void* p0)
+{
+    i_set_splat(v, *reinterpret_cast<const uint32_t*>(p0));
+}
+#endif
+
 template<unsigned N>
 void i_load_splat(uint32<N>& v, const void* p0)
 {
@@ -180,11 +187,18 @@ inline void i_load_splat(uint64x2& v, const void* p0)
 inline void i_load_splat(uint64x4& v, const void* p0)
 {
     const uint64_t* v0 = reinterpret_cast<const uint64_t*>(p0);
-    uint64x2 a = _mm_cvtsi64_si128(v0);
+    uint64x2 a = _mm_cvtsi64_si128(*v0);
     v = _mm256_broadcastq_epi64(a);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_splat(uint64<8>& v, const void* p0)
+{
+    i_set_splat(v, *reinterpret_cast<const uint64_t*>(p0));
+}
+#endif
+
 template<unsigned N>
 void i_load_splat(uint64<N>& v, const void* p0)
 {
@@ -223,6 +237,13 @@ inline void i_load_splat(float32x8& v, const void* p0)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_splat(float32<16>& v, const void* p0)
+{
+    i_set_splat(v, *reinterpret_cast<const float*>(p0));
+}
+#endif
+
 template<unsigned N>
 void i_load_splat(float32<N>& v, const void* p0)
 {
@@ -257,6 +278,13 @@ inline void i_load_splat(float64x4& v, const void* p0)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_load_splat(float64<8>& v, const void* p0)
+{
+    i_set_splat(v, *reinterpret_cast<const double*>(p0));
+}
+#endif
+
 template<unsigned N>
 void i_load_splat(float64<N>& v, const void* p0)
 {
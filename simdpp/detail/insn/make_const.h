@@ -105,6 +105,17 @@ void i_make_const(float32<8>& v, const expr_vec_make_const<VE,N>& e)
 
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class VE, unsigned N>
+void i_make_const(float32<16>& v, const expr_vec_make_const<VE,N>& e)
+{
+    v = _mm512_set_ps(e.val(15), e.val(14), e.val(13), e.val(12),
+                      e.val(11), e.val(10), e.val(9),  e.val(8),
+                      e.val(7),  e.val(6),  e.val(5),  e.val(4),
+                      e.val(3),  e.val(2),  e.val(1),  e.val(0));
+}
+#endif
+
 
 template<unsigned N, class VE, unsigned NE>
 void i_make_const(float32<N>& v, const expr_vec_make_const<VE,NE>& e)
@@ -136,6 +147,15 @@ void i_make_const(float64<4>& v, const expr_vec_make_const<VE,N>& e)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class VE, unsigned N>
+void i_make_const(float64<8>& v, const expr_vec_make_const<VE,N>& e)
+{
+    v = _mm512_set_pd(e.val(7), e.val(6), e.val(5), e.val(4),
+                      e.val(3), e.val(2), e.val(1), e.val(0));
+}
+#endif
+
 template<unsigned N, class VE, unsigned NE>
 void i_make_const(float64<N>& v, const expr_vec_make_const<VE,NE>& e)
 {
@@ -389,6 +409,17 @@ void i_make_const(uint32<8>& v, const expr_vec_make_const<VE,N>& e)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class VE, unsigned N>
+void i_make_const(uint32<16>& v, const expr_vec_make_const<VE,N>& e)
+{
+    v = _mm512_set_epi32(e.val(15), e.val(14), e.val(13), e.val(12),
+                         e.val(11), e.val(10), e.val(9),  e.val(8),
+                         e.val(7),  e.val(6),  e.val(5),  e.val(4),
+                         e.val(3),  e.val(2),  e.val(1),  e.val(0));
+}
+#endif
+
 template<unsigned N, class VE, unsigned NE>
 void i_make_const(uint32<N>& v, const expr_vec_make_const<VE,NE>& e)
 {
@@ -445,6 +476,15 @@ void i_make_const(uint64<4>& v, const expr_vec_make_const<VE,N>& e)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<class VE, unsigned N>
+void i_make_const(uint64<8>& v, const expr_vec_make_const<VE,N>& e)
+{
+    v = _mm512_set_epi64(e.val(7), e.val(6), e.val(5), e.val(4),
+                         e.val(3), e.val(2), e.val(1), e.val(0));
+}
+#endif
+
 template<unsigned N, class VE, unsigned NE>
 void i_make_const(uint64<N>& v, const expr_vec_make_const<VE,NE>& e)
 {
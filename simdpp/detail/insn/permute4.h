@@ -121,6 +121,15 @@ uint32x8 i_permute4(uint32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3>
+uint32x16 i_permute4(uint32x16 a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    return _mm512_shuffle_epi32(a, _MM_PERM_ENUM(_MM_SHUFFLE(s3, s2, s1, s0)));
+}
+#endif
+
 template<unsigned s0, unsigned s1, unsigned s2, unsigned s3, unsigned N>
 uint32<N> i_permute4(uint32<N> a)
 {
@@ -156,6 +165,15 @@ float32x8 i_permute4(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3>
+float32x16 i_permute4(float32x16 a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    return _mm512_shuffle_ps(a, a, _MM_SHUFFLE(s3, s2, s1, s0));
+}
+#endif
+
 template<unsigned s0, unsigned s1, unsigned s2, unsigned s3, unsigned N>
 float32<N> i_permute4(float32<N> a)
 {
@@ -183,6 +201,15 @@ uint64x4 i_permute4(uint64x4 a)
 #endif
 }
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3>
+uint64x8 i_permute4(uint64x8 a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    return _mm512_permutex_epi64(a, _MM_SHUFFLE(s3, s2, s1, s0));
+}
+#endif
+
 template<unsigned s0, unsigned s1, unsigned s2, unsigned s3, unsigned N>
 uint64<N> i_permute4(uint64<N> a)
 {
@@ -210,6 +237,15 @@ float64x4 i_permute4(float64x4 a)
 #endif
 }
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3>
+float64x8 i_permute4(float64x8 a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    return _mm512_permutex_pd(a, _MM_SHUFFLE(s3, s2, s1, s0));
+}
+#endif
+
 template<unsigned s0, unsigned s1, unsigned s2, unsigned s3, unsigned N>
 float64<N> i_permute4(float64<N> a)
 {
@@ -0,0 +1,363 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/gather.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+#include <type_traits>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  The functions in this file store the elements of a to p[idx[i]] in the
+    order of the elements. Only AVX512F has scatter instructions, elsewhere
+    the elements are stored one by one.
+*/
+
+template<class V, class I>
+void v_emul_scatter(char* p, const I& idx, const V& a)
+{
+    using E = typename V::element_type;
+    E* pe = reinterpret_cast<E*>(p);
+    mem_block<I> mi(idx);
+    mem_block<V> ma(a);
+    for (unsigned i = 0; i < V::length; i++) {
+        std::memcpy(pe + mi[i], &ma[i], sizeof(E));
+    }
+}
+
+template<class V, class I, class M>
+void v_emul_scatter_masked(char* p, const I& idx, const V& a, const M& mask)
+{
+    using E = typename V::element_type;
+    E* pe = reinterpret_cast<E*>(p);
+    using U = typename V::uint_vector_type;
+    mem_block<I> mi(idx);
+    mem_block<V> ma(a);
+    mem_block<U> mm(bit_cast<U>(mask.unmask()));
+    for (unsigned i = 0; i < V::length; i++) {
+        if (mm[i] != 0) {
+            std::memcpy(pe + mi[i], &ma[i], sizeof(E));
+        }
+    }
+}
+
+// Multi-vector i_scatter is mostly boilerplate
+template<class V, class I>
+void v_scatter(char* p, const I& idx, const V& a);
+template<class V, class I, class M>
+void v_scatter_masked(char* p, const I& idx, const V& a, const M& mask);
+template<class V, unsigned N>
+void v_scatter_i32(char* p, const int32<N>& idx, const V& a);
+template<class V, unsigned N, class M>
+void v_scatter_i32_masked(char* p, const int32<N>& idx, const V& a,
+                          const M& mask);
+
+// -----------------------------------------------------------------------------
+// 32-bit elements
+
+#if SIMDPP_USE_AVX512F
+inline void i_scatter(char* p, const int32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(p, idx, a, 4);
+}
+
+inline void i_scatter(char* p, const int32<16>& idx, const float32<16>& a)
+{
+    _mm512_i32scatter_ps(p, idx, a, 4);
+}
+
+inline void i_scatter_masked(char* p, const int32<16>& idx,
+                             const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(p, mask, idx, a, 4);
+}
+
+inline void i_scatter_masked(char* p, const int32<16>& idx,
+                             const float32<16>& a, const mask_float32<16>& mask)
+{
+    _mm512_mask_i32scatter_ps(p, mask, idx, a, 4);
+}
+#endif
+
+template<unsigned N>
+void i_scatter(char* p, const int32<N>& idx, const uint32<N>& a)
+{
+    v_scatter(p, idx, a);
+}
+
+template<unsigned N>
+void i_scatter(char* p, const int32<N>& idx, const float32<N>& a)
+{
+    v_scatter(p, idx, a);
+}
+
+template<unsigned N>
+void i_scatter_masked(char* p, const int32<N>& idx, const uint32<N>& a,
+                      const mask_int32<N>& mask)
+{
+    v_scatter_masked(p, idx, a, mask);
+}
+
+template<unsigned N>
+void i_scatter_masked(char* p, const int32<N>& idx, const float32<N>& a,
+                      const mask_float32<N>& mask)
+{
+    v_scatter_masked(p, idx, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements, 64-bit indices
+
+#if SIMDPP_USE_AVX512F
+inline void i_scatter(char* p, const int64<8>& idx, const uint64<8>& a)
+{
+    _mm512_i64scatter_epi64(p, idx, a, 8);
+}
+
+inline void i_scatter(char* p, const int64<8>& idx, const float64<8>& a)
+{
+    _mm512_i64scatter_pd(p, idx, a, 8);
+}
+
+inline void i_scatter_masked(char* p, const int64<8>& idx,
+                             const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_i64scatter_epi64(p, mask, idx, a, 8);
+}
+
+inline void i_scatter_masked(char* p, const int64<8>& idx,
+                             const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_i64scatter_pd(p, mask, idx, a, 8);
+}
+#endif
+
+template<unsigned N>
+void i_scatter(char* p, const int64<N>& idx, const uint64<N>& a)
+{
+    v_scatter(p, idx, a);
+}
+
+template<unsigned N>
+void i_scatter(char* p, const int64<N>& idx, const float64<N>& a)
+{
+    v_scatter(p, idx, a);
+}
+
+template<unsigned N>
+void i_scatter_masked(char* p, const int64<N>& idx, const uint64<N>& a,
+                      const mask_int64<N>& mask)
+{
+    v_scatter_masked(p, idx, a, mask);
+}
+
+template<unsigned N>
+void i_scatter_masked(char* p, const int64<N>& idx, const float64<N>& a,
+                      const mask_float64<N>& mask)
+{
+    v_scatter_masked(p, idx, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements, 32-bit indices
+
+#if SIMDPP_USE_AVX512F
+inline void i_scatter(char* p, const int32x8& idx, const uint64<8>& a)
+{
+    _mm512_i32scatter_epi64(p, idx, a, 8);
+}
+
+inline void i_scatter(char* p, const int32x8& idx, const float64<8>& a)
+{
+    _mm512_i32scatter_pd(p, idx, a, 8);
+}
+
+inline void i_scatter_masked(char* p, const int32x8& idx,
+                             const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_i32scatter_epi64(p, mask, idx, a, 8);
+}
+
+inline void i_scatter_masked(char* p, const int32x8& idx,
+                             const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_i32scatter_pd(p, mask, idx, a, 8);
+}
+#endif
+
+template<unsigned N>
+void i_scatter(char* p, const int32<N>& idx, const uint64<N>& a)
+{
+    v_scatter_i32(p, idx, a);
+}
+
+template<unsigned N>
+void i_scatter(char* p, const int32<N>& idx, const float64<N>& a)
+{
+    v_scatter_i32(p, idx, a);
+}
+
+template<unsigned N>
+void i_scatter_masked(char* p, const int32<N>& idx, const uint64<N>& a,
+                      const mask_int64<N>& mask)
+{
+    v_scatter_i32_masked(p, idx, a, mask);
+}
+
+template<unsigned N>
+void i_scatter_masked(char* p, const int32<N>& idx, const float64<N>& a,
+                      const mask_float64<N>& mask)
+{
+    v_scatter_i32_masked(p, idx, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+// Only the 512-bit base vectors have scatter instructions. The base vectors
+// are stored in order, thus the last of the elements with equal indices is
+// stored last in all cases.
+template<class V>
+struct scatter_is_native : std::integral_constant<bool,
+#if SIMDPP_USE_AVX512F
+        V::base_vector_type::length_bytes == 64
+#else
+        false
+#endif
+    > {};
+
+template<class V, class I>
+void v_scatter_tag(char* p, const I& idx, const V& a, std::true_type)
+{
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_scatter(p, idx[j], a[j]);
+    }
+}
+
+template<class V, class I>
+void v_scatter_tag(char* p, const I& idx, const V& a, std::false_type)
+{
+    v_emul_scatter(p, idx, a);
+}
+
+template<class V, class I, class M>
+void v_scatter_masked_tag(char* p, const I& idx, const V& a, const M& mask,
+                          std::true_type)
+{
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_scatter_masked(p, idx[j], a[j], mask[j]);
+    }
+}
+
+template<class V, class I, class M>
+void v_scatter_masked_tag(char* p, const I& idx, const V& a, const M& mask,
+                          std::false_type)
+{
+    v_emul_scatter_masked(p, idx, a, mask);
+}
+
+template<class V, unsigned N>
+void v_scatter_i32_tag(char* p, const int32<N>& idx, const V& a,
+                       std::true_type)
+{
+    using B = typename V::base_vector_type;
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_scatter(p, v_gather_index_slice<B::length>(idx, j), a[j]);
+    }
+}
+
+template<class V, unsigned N>
+void v_scatter_i32_tag(char* p, const int32<N>& idx, const V& a,
+                       std::false_type)
+{
+    v_emul_scatter(p, idx, a);
+}
+
+template<class V, unsigned N, class M>
+void v_scatter_i32_masked_tag(char* p, const int32<N>& idx, const V& a,
+                              const M& mask, std::true_type)
+{
+    using B = typename V::base_vector_type;
+    for (unsigned j = 0; j < V::vec_length; ++j) {
+        i_scatter_masked(p, v_gather_index_slice<B::length>(idx, j), a[j],
+                         mask[j]);
+    }
+}
+
+template<class V, unsigned N, class M>
+void v_scatter_i32_masked_tag(char* p, const int32<N>& idx, const V& a,
+                              const M& mask, std::false_type)
+{
+    v_emul_scatter_masked(p, idx, a, mask);
+}
+
+template<class V, class I>
+void v_scatter(char* p, const I& idx, const V& a)
+{
+    v_scatter_tag(p, idx, a, scatter_is_native<V>());
+}
+
+template<class V, class I, class M>
+void v_scatter_masked(char* p, const I& idx, const V& a, const M& mask)
+{
+    v_scatter_masked_tag(p, idx, a, mask, scatter_is_native<V>());
+}
+
+template<class V, unsigned N>
+void v_scatter_i32(char* p, const int32<N>& idx, const V& a)
+{
+    v_scatter_i32_tag(p, idx, a, scatter_is_native<V>());
+}
+
+template<class V, unsigned N, class M>
+void v_scatter_i32_masked(char* p, const int32<N>& idx, const V& a,
+                          const M& mask)
+{
+    v_scatter_i32_masked_tag(p, idx, a, mask, scatter_is_native<V>());
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
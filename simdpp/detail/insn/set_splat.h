@@ -163,6 +163,13 @@ inline void i_set_splat(uint32x8& v, uint32_t v0)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_set_splat(uint32<16>& v, uint32_t v0)
+{
+    v = _mm512_set1_epi32(v0);
+}
+#endif
+
 template<unsigned N>
 void i_set_splat(uint32<N>& v, uint32_t v0)
 {
@@ -210,6 +217,13 @@ inline void i_set_splat(uint64x4& v, uint64_t v0)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_set_splat(uint64<8>& v, uint64_t v0)
+{
+    v = _mm512_set1_epi64(v0);
+}
+#endif
+
 template<unsigned N>
 void i_set_splat(uint64<N>& v, uint64_t v0)
 {
@@ -242,13 +256,20 @@ inline void i_set_splat(float32x4& v, float v0)
 #endif
 }
 
-#if SIMDPP_USE_AVX2
+#if SIMDPP_USE_AVX
 inline void i_set_splat(float32x8& v, float v0)
 {
     v = _mm256_broadcast_ss(&v0);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_set_splat(float32<16>& v, float v0)
+{
+    v = _mm512_set1_ps(v0);
+}
+#endif
+
 template<unsigned N>
 void i_set_splat(float32<N>& v, float v0)
 {
@@ -270,13 +291,20 @@ inline void i_set_splat(float64x2& v, double v0)
 #endif
 }
 
-#if SIMDPP_USE_AVX2
+#if SIMDPP_USE_AVX
 inline void i_set_splat(float64x4& v, double v0)
 {
     v = _mm256_broadcast_sd(&v0);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_set_splat(float64<8>& v, double v0)
+{
+    v = _mm512_set1_pd(v0);
+}
+#endif
+
 template<unsigned N>
 void i_set_splat(float64<N>& v, double v0)
 {
@@ -82,6 +82,15 @@ float64x4 i_shuffle1(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s0, unsigned s1>
+float64x8 i_shuffle1(float64x8 a, float64x8 b)
+{
+    return _mm512_shuffle_pd(a, b, s0 | s1<<1 | s0<<2 | s1<<3 |
+                            s0<<4 | s1<<5 | s0<<6 | s1<<7);
+}
+#endif
+
 template<unsigned s0, unsigned s1, unsigned N>
 float64<N> i_shuffle1(float64<N> a, float64<N> b)
 {
@@ -113,7 +122,17 @@ uint64x4 i_shuffle1(uint64x4 a, uint64x4 b)
 {
     static_assert(s0 < 2 && s1 < 2, "Selector out of range");
     // We can't do this in the integer execution domain. Beware of additional latency
-    return int64x4(shuffle1<s0,s1>(float64x4(a), float64x4(b)));
+    return uint64x4(i_shuffle1<s0,s1>(float64x4(a), float64x4(b)));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<unsigned s0, unsigned s1>
+uint64x8 i_shuffle1(uint64x8 a, uint64x8 b)
+{
+    static_assert(s0 < 2 && s1 < 2, "Selector out of range");
+    // We can't do this in the integer execution domain. Beware of additional latency
+    return uint64x8(i_shuffle1<s0,s1>(float64x8(a), float64x8(b)));
 }
 #endif
 
@@ -35,6 +35,7 @@
 #include <simdpp/types.h>
 #include <simdpp/core/splat_n.h>
 #include <simdpp/detail/insn/shuffle128.h>
+#include <simdpp/sse/extract_half.h>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -134,11 +135,20 @@ uint32x8 i_splat(uint32x8 a)
 {
     static_assert(s < 8, "Access out of bounds");
     a = permute4<s%4,s%4,s%4,s%4>(a);
-    a = detail::shuffle128<s/4, s/4>(a, a);
+    a = shuffle128<s/4, s/4>(a, a);
     return a;
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+uint32<16> i_splat(uint32<16> a)
+{
+    static_assert(s < 16, "Access out of bounds");
+    return _mm512_permutexvar_epi32(_mm512_set1_epi32(s), a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 uint32<N> i_splat(uint32<N> a)
 {
@@ -163,6 +173,15 @@ uint64x4 i_splat(uint64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+uint64<8> i_splat(uint64<8> a)
+{
+    static_assert(s < 8, "Access out of bounds");
+    return _mm512_permutexvar_epi64(_mm512_set1_epi64(s), a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 uint64<N> i_splat(uint64<N> a)
 {
@@ -183,11 +202,20 @@ template<unsigned s>
 float32x8 i_splat(float32x8 a)
 {
     static_assert(s < 8, "Access out of bounds");
-    a = detail::shuffle128<s/4,s/4>(a, a);
+    a = shuffle128<s/4,s/4>(a, a);
     return permute4<s%4,s%4,s%4,s%4>(a);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+float32<16> i_splat(float32<16> a)
+{
+    static_assert(s < 16, "Access out of bounds");
+    return _mm512_permutexvar_ps(_mm512_set1_epi32(s), a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 float32<N> i_splat(float32<N> a)
 {
@@ -211,13 +239,22 @@ float64x4 i_splat(float64x4 a)
 #if SIMDPP_USE_AVX2
     return permute4<s,s,s,s>(a);
 #else // SIMDPP_USE_AVX
-    a = detail::shuffle128<s/2,s/2>(a, a);
+    a = shuffle128<s/2,s/2>(a, a);
     a = permute2<s%2,s%2>(a);
     return a;
 #endif
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+float64<8> i_splat(float64<8> a)
+{
+    static_assert(s < 8, "Access out of bounds");
+    return _mm512_permutexvar_pd(_mm512_set1_epi64(s), a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 float64<N> i_splat(float64<N> a)
 {
@@ -50,6 +50,10 @@ namespace insn {
 // forward declarations
 template<unsigned s>
 uint16x8 i_splat8(uint16x8 a);
+#if SIMDPP_USE_AVX2
+template<unsigned s>
+uint16x16 i_splat8(uint16x16 a);
+#endif
 
 // -----------------------------------------------------------------------------
 
@@ -96,8 +100,8 @@ template<unsigned s>
 uint8x32 i_splat16(uint8x32 a)
 {
     static_assert(s < 16, "Access out of bounds");
-    uint16x16 b = s < 8 ? zip16_lo(a, a) : zip16_hi(a, a);
-    return i_splat8<s%8>(b);
+    uint8x32 b = s < 8 ? zip16_lo(a, a) : zip16_hi(a, a);
+    return uint8x32(i_splat8<s%8>(uint16x16(b)));
 }
 #endif
 
@@ -156,12 +160,12 @@ uint16x16 i_splat8(uint16x16 a)
         constexpr unsigned q = (s < 4) ? s : 0;
         uint64x4 h = _mm256_shufflelo_epi16(a, q << 6 | q << 4 | q << 2 | q);
         h = permute2<0,0>(h);
-        return h;
+        return uint16x16(h);
     } else {
         constexpr unsigned q = (s < 4) ? 0 : s - 4;
         uint64x4 h = _mm256_shufflehi_epi16(a, q << 6 | q << 4 | q << 2 | q);
         h = permute2<1,1>(h);
-        return h;
+        return uint16x16(h);
     }
 }
 #endif
@@ -207,11 +211,20 @@ uint32x8 i_splat4(uint32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+uint32x16 i_splat4(uint32x16 a)
+{
+    static_assert(s < 4, "Access out of bounds");
+    return permute4<s,s,s,s>(a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 uint32<N> i_splat4(uint32<N> a)
 {
     static_assert(s < 4, "Access out of bounds");
-    SIMDPP_VEC_ARRAY_IMPL1(uint32x8, i_splat4<s>, a);
+    SIMDPP_VEC_ARRAY_IMPL1(uint32<N>, i_splat4<s>, a);
 }
 
 // -----------------------------------------------------------------------------
@@ -251,6 +264,15 @@ uint64x4 i_splat2(uint64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+uint64x8 i_splat2(uint64x8 a)
+{
+    static_assert(s < 2, "Access out of bounds");
+    return permute2<s,s>(a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 uint64<N> i_splat2(uint64<N> a)
 {
@@ -292,6 +314,15 @@ float32x8 i_splat4(float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+float32x16 i_splat4(float32x16 a)
+{
+    static_assert(s < 4, "Access out of bounds");
+    return permute4<s,s,s,s>(a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 float32<N> i_splat4(float32<N> a)
 {
@@ -327,6 +358,15 @@ float64x4 i_splat2(float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+template<unsigned s>
+float64x8 i_splat2(float64x8 a)
+{
+    static_assert(s < 2, "Access out of bounds");
+    return permute2<s,s>(a);
+}
+#endif
+
 template<unsigned s, unsigned N>
 float64<N> i_splat2(float64<N> a)
 {
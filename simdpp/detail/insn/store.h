@@ -75,6 +75,20 @@ void i_store(char* p, uint8<N> a)
     v_store(p, a);
 }
 
+#if SIMDPP_USE_AVX512F
+inline void i_store(char* p, uint32<16> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_store_si512(reinterpret_cast<__m512i*>(p), a);
+}
+
+inline void i_store(char* p, uint64<8> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_store_si512(reinterpret_cast<__m512i*>(p), a);
+}
+#endif
+
 template<unsigned N>
 void i_store(char* p, uint16<N> a) { i_store(p, uint8<N*2>(a)); }
 template<unsigned N>
@@ -106,6 +120,15 @@ inline void i_store(char* p, float32x8 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store(char* p, float32<16> a)
+{
+    float* q = reinterpret_cast<float*>(p);
+    q = detail::assume_aligned(q, 64);
+    _mm512_store_ps(q, a);
+}
+#endif
+
 template<unsigned N>
 void i_store(char* p, float32<N> a)
 {
@@ -130,6 +153,14 @@ inline void i_store(char* p, float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store(char* p, float64<8> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_store_pd(reinterpret_cast<double*>(p), a);
+}
+#endif
+
 template<unsigned N>
 void i_store(char* p, float64<N> a)
 {
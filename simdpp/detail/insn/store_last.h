@@ -84,8 +84,8 @@ inline void i_store_last(char* p, uint8x32 a, unsigned n)
                                        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
                                        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
                                        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff};
-    uint8x32 mask = load_u(mask, mask_d + n);
-    uint8x32 old = load(old, p);
+    uint8x32 mask = load_u(mask_d + n);
+    uint8x32 old = load(p);
     a = blend(a, old, mask);
     store(p, a);
 }
@@ -143,6 +143,13 @@ inline void i_store_last(char* p, uint32x8 a, unsigned n)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_last(char* p, uint32x16 a, unsigned n)
+{
+    _mm512_mask_store_epi32(p, 0xffffu << (16-n), a);
+}
+#endif
+
 template<unsigned N>
 void i_store_last(char* p, uint32<N> a, unsigned n)
 {
@@ -176,7 +183,14 @@ inline void i_store_last(char* p, uint64x2 a, unsigned n)
 #if SIMDPP_USE_AVX2
 inline void i_store_last(char* p, uint64x4 a, unsigned n)
 {
-    i_store_last(p, uint8x32(a), n*2);
+    i_store_last(p, uint8x32(a), n*8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_store_last(char* p, uint64x8 a, unsigned n)
+{
+    _mm512_mask_store_epi64(p, 0xffu << (8-n), a);
 }
 #endif
 
@@ -227,13 +241,20 @@ inline void i_store_last(char* p, float32x8 a, unsigned n)
                                         0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
 
     const float* mask_dp = reinterpret_cast<const float*>(mask_d);
-    float32x8 mask = load_u(mask, mask_dp + n);
-    float32x8 old = load(old, v);
+    float32x8 mask = load_u(mask_dp + n);
+    float32x8 old = load(v);
     a = blend(a, old, mask);
     store(v, a);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_last(char* p, float32x16 a, unsigned n)
+{
+    _mm512_mask_store_ps(p, 0xffffu << (16-n), a);
+}
+#endif
+
 template<unsigned N>
 void i_store_last(char* p, float32<N> a, unsigned n)
 {
@@ -265,13 +286,20 @@ inline void i_store_last(char* p, float64x4 a, unsigned n)
                                         0xffffffffffffffff, 0xffffffffffffffff};
 
     const double* mask_dp = reinterpret_cast<const double*>(mask_d);
-    float64x4 mask = load_u(mask, mask_dp + n);
-    float64x4 old = load(old, q);
+    float64x4 mask = load_u(mask_dp + n);
+    float64x4 old = load(q);
     a = blend(a, old, mask);
     store(q, a);
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_last(char* p, float64x8 a, unsigned n)
+{
+    _mm512_mask_store_pd(p, 0xffu << (8-n), a);
+}
+#endif
+
 template<unsigned N>
 void i_store_last(char* p, float64<N> a, unsigned n)
 {
@@ -35,6 +35,7 @@
 #include <simdpp/types.h>
 #include <simdpp/detail/align.h>
 #include <simdpp/detail/insn/mem_pack.h>
+#include <simdpp/core/extract.h>
 #include <simdpp/core/store.h>
 #include <simdpp/null/memory.h>
 
@@ -48,6 +49,8 @@ namespace insn {
 // the 256-bit versions are mostly boilerplate. Collect that stuff here.
 template<class V>
 void v256_store_pack2(char* p, V a, V b);
+template<class H, class V>
+void v512_store_pack2(char* p, V a, V b);
 template<class V>
 void v_store_pack2(char* p, V a, V b);
 
@@ -141,6 +144,13 @@ inline void i_store_packed2(char* p, uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed2(char* p, uint32x16 a, uint32x16 b)
+{
+    v512_store_pack2<uint32x8>(p, a, b);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed2(char* p, uint32<N> a, uint32<N> b)
 {
@@ -164,6 +174,13 @@ inline void i_store_packed2(char* p, uint64x4 a, uint64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed2(char* p, uint64x8 a, uint64x8 b)
+{
+    v512_store_pack2<uint64x4>(p, a, b);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed2(char* p, uint64<N> a, uint64<N> b)
 {
@@ -196,6 +213,13 @@ inline void i_store_packed2(char* p, float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed2(char* p, float32x16 a, float32x16 b)
+{
+    v512_store_pack2<float32x8>(p, a, b);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed2(char* p, float32<N> a, float32<N> b)
 {
@@ -219,6 +243,13 @@ inline void i_store_packed2(char* p, float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed2(char* p, float64x8 a, float64x8 b)
+{
+    v512_store_pack2<float64x4>(p, a, b);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed2(char* p, float64<N> a, float64<N> b)
 {
@@ -236,6 +267,17 @@ void v256_store_pack2(char* p, V a, V b)
     i_store(p + 32, b);
 }
 
+template<class H, class V>
+void v512_store_pack2(char* p, V a, V b)
+{
+    p = detail::assume_aligned(p, 64);
+    H a0, b0, a1, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    i_store_packed2(p, a0, b0);
+    i_store_packed2(p + 64, a1, b1);
+}
+
 template<class V>
 void v_store_pack2(char* p, V a, V b)
 {
@@ -35,6 +35,7 @@
 #include <simdpp/types.h>
 #include <simdpp/detail/align.h>
 #include <simdpp/detail/insn/mem_pack.h>
+#include <simdpp/core/extract.h>
 #include <simdpp/core/store.h>
 #include <simdpp/null/memory.h>
 
@@ -48,6 +49,8 @@ namespace insn {
 // the 256-bit versions are mostly boilerplate. Collect that stuff here.
 template<class V>
 void v256_store_pack3(char* p, V a, V b, V c);
+template<class H, class V>
+void v512_store_pack3(char* p, V a, V b, V c);
 template<class V>
 void v_store_pack3(char* p, V a, V b, V c);
 
@@ -155,6 +158,14 @@ inline void i_store_packed3(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed3(char* p,
+                            uint32x16 a, uint32x16 b, uint32x16 c)
+{
+    v512_store_pack3<uint32x8>(p, a, b, c);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed3(char* p,
                      uint32<N> a, uint32<N> b, uint32<N> c)
@@ -196,6 +207,14 @@ inline void i_store_packed3(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed3(char* p,
+                            uint64x8 a, uint64x8 b, uint64x8 c)
+{
+    v512_store_pack3<uint64x4>(p, a, b, c);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed3(char* p,
                      uint64<N> a, uint64<N> b, uint64<N> c)
@@ -232,6 +251,14 @@ inline void i_store_packed3(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed3(char* p,
+                            float32x16 a, float32x16 b, float32x16 c)
+{
+    v512_store_pack3<float32x8>(p, a, b, c);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed3(char* p,
                      float32<N> a, float32<N> b, float32<N> c)
@@ -262,6 +289,14 @@ inline void i_store_packed3(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed3(char* p,
+                            float64x8 a, float64x8 b, float64x8 c)
+{
+    v512_store_pack3<float64x4>(p, a, b, c);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed3(char* p,
                      float64<N> a, float64<N> b, float64<N> c)
@@ -281,6 +316,18 @@ void v256_store_pack3(char* p, V a, V b, V c)
     i_store(p + 64, c);
 }
 
+template<class H, class V>
+void v512_store_pack3(char* p, V a, V b, V c)
+{
+    p = detail::assume_aligned(p, 64);
+    H a0, b0, c0, a1, b1, c1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    split(c, c0, c1);
+    i_store_packed3(p, a0, b0, c0);
+    i_store_packed3(p + 96, a1, b1, c1);
+}
+
 template<class V>
 void v_store_pack3(char* p, V a, V b, V c)
 {
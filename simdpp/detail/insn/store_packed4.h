@@ -35,6 +35,7 @@
 #include <simdpp/types.h>
 #include <simdpp/detail/align.h>
 #include <simdpp/detail/insn/mem_pack.h>
+#include <simdpp/core/extract.h>
 #include <simdpp/core/store.h>
 #include <simdpp/null/memory.h>
 
@@ -49,6 +50,8 @@ namespace insn {
 // the 256-bit versions are mostly boilerplate. Collect that stuff here.
 template<class V>
 void v256_store_pack4(char* p, V a, V b, V c, V d);
+template<class H, class V>
+void v512_store_pack4(char* p, V a, V b, V c, V d);
 template<class V>
 void v_store_pack4(char* p, V a, V b, V c, V d);
 
@@ -162,6 +165,14 @@ inline void i_store_packed4(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed4(char* p,
+                            uint32x16 a, uint32x16 b, uint32x16 c, uint32x16 d)
+{
+    v512_store_pack4<uint32x8>(p, a, b, c, d);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed4(char* p,
                      uint32<N> a, uint32<N> b, uint32<N> c, uint32<N> d)
@@ -191,6 +202,14 @@ inline void i_store_packed4(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed4(char* p,
+                            uint64x8 a, uint64x8 b, uint64x8 c, uint64x8 d)
+{
+    v512_store_pack4<uint64x4>(p, a, b, c, d);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed4(char* p,
                      uint64<N> a, uint64<N> b, uint64<N> c, uint64<N> d)
@@ -230,6 +249,14 @@ inline void i_store_packed4(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed4(char* p,
+                            float32x16 a, float32x16 b, float32x16 c, float32x16 d)
+{
+    v512_store_pack4<float32x8>(p, a, b, c, d);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed4(char* p,
                      float32<N> a, float32<N> b, float32<N> c, float32<N> d)
@@ -262,6 +289,14 @@ inline void i_store_packed4(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_store_packed4(char* p,
+                            float64x8 a, float64x8 b, float64x8 c, float64x8 d)
+{
+    v512_store_pack4<float64x4>(p, a, b, c, d);
+}
+#endif
+
 template<unsigned N>
 void i_store_packed4(char* p,
                      float64<N> a, float64<N> b, float64<N> c, float64<N> d)
@@ -282,6 +317,19 @@ void v256_store_pack4(char* p, V a, V b, V c, V d)
     i_store(p + 96, d);
 }
 
+template<class H, class V>
+void v512_store_pack4(char* p, V a, V b, V c, V d)
+{
+    p = detail::assume_aligned(p, 64);
+    H a0, b0, c0, d0, a1, b1, c1, d1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+    split(c, c0, c1);
+    split(d, d0, d1);
+    i_store_packed4(p, a0, b0, c0, d0);
+    i_store_packed4(p + 128, a1, b1, c1, d1);
+}
+
 template<class V>
 void v_store_pack4(char* p, V a, V b, V c, V d)
 {
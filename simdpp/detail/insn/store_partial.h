@@ -0,0 +1,299 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_partial.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Stores the first @a b bytes of @a a, b <= 16. No memory past the first
+    @a b bytes is accessed.
+*/
+inline void i_store_partial_bytes16(char* p, uint8x16 a, unsigned b)
+{
+#if SIMDPP_USE_SSE2
+    __m128i r = a;
+    if (b >= 16) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), r);
+        return;
+    }
+    // The parts of 8, 4, 2 and 1 bytes are stored starting from the
+    // beginning of the data. Each is shifted out from the bottom of the
+    // vector.
+    if (b & 8) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), r);
+        r = _mm_srli_si128(r, 8);
+        p += 8;
+    }
+    if (b & 4) {
+        uint32_t w = _mm_cvtsi128_si32(r);
+        std::memcpy(p, &w, 4);
+        r = _mm_srli_si128(r, 4);
+        p += 4;
+    }
+    uint32_t t = _mm_cvtsi128_si32(r);
+    if (b & 2) {
+        uint16_t w = t;
+        std::memcpy(p, &w, 2);
+        t >>= 16;
+        p += 2;
+    }
+    if (b & 1) {
+        *p = char(t);
+    }
+#else
+    mem_block<uint8x16> r(a);
+    partial_copy16(p, reinterpret_cast<const char*>(&r[0]), b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_store_partial_bytes32(char* p, uint8x32 a, unsigned b)
+{
+    if (b >= 32) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+        return;
+    }
+    __m128i lo = _mm256_castsi256_si128(a);
+    if (b <= 16) {
+        i_store_partial_bytes16(p, lo, b);
+        return;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), lo);
+    i_store_partial_bytes16(p + 16, _mm256_extracti128_si256(a, 1), b - 16);
+}
+#endif
+
+// Multi-vector i_store_partial is mostly boilerplate
+template<class V>
+void v_store_partial(char* p, const V& a, unsigned n);
+
+// 8 bits
+
+inline void i_store_partial(char* p, const uint8x16& a, unsigned n)
+{
+    i_store_partial_bytes16(p, a, n);
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_store_partial(char* p, const uint8x32& a, unsigned n)
+{
+    i_store_partial_bytes32(p, a, n);
+}
+#endif
+
+template<unsigned N>
+void i_store_partial(char* p, const uint8<N>& a, unsigned n)
+{
+    v_store_partial(p, a, n);
+}
+
+// 16 bits
+
+inline void i_store_partial(char* p, const uint16x8& a, unsigned n)
+{
+    i_store_partial_bytes16(p, (uint8x16) a, n*2);
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_store_partial(char* p, const uint16x16& a, unsigned n)
+{
+    i_store_partial_bytes32(p, (uint8x32) a, n*2);
+}
+#endif
+
+template<unsigned N>
+void i_store_partial(char* p, const uint16<N>& a, unsigned n)
+{
+    v_store_partial(p, a, n);
+}
+
+// 32 bits
+
+inline void i_store_partial(char* p, const uint32x4& a, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n));
+    _mm_maskstore_ps(reinterpret_cast<float*>(p), mask, _mm_castsi128_ps(a));
+#else
+    i_store_partial_bytes16(p, (uint8x16) a, n*4);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_store_partial(char* p, const uint32x8& a, unsigned n)
+{
+    _mm256_maskstore_epi32(reinterpret_cast<int*>(p), partial_mask32(n), a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_store_partial(char* p, const uint32<16>& a, unsigned n)
+{
+    _mm512_mask_storeu_epi32(p, (1u << n) - 1, a);
+}
+#endif
+
+template<unsigned N>
+void i_store_partial(char* p, const uint32<N>& a, unsigned n)
+{
+    v_store_partial(p, a, n);
+}
+
+// 64 bits
+
+inline void i_store_partial(char* p, const uint64x2& a, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n*2));
+    _mm_maskstore_pd(reinterpret_cast<double*>(p), mask, _mm_castsi128_pd(a));
+#else
+    i_store_partial_bytes16(p, (uint8x16) a, n*8);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline void i_store_partial(char* p, const uint64x4& a, unsigned n)
+{
+    _mm256_maskstore_epi64(reinterpret_cast<long long*>(p),
+                           partial_mask32(n*2), a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_store_partial(char* p, const uint64<8>& a, unsigned n)
+{
+    _mm512_mask_storeu_epi64(p, (1u << n) - 1, a);
+}
+#endif
+
+template<unsigned N>
+void i_store_partial(char* p, const uint64<N>& a, unsigned n)
+{
+    v_store_partial(p, a, n);
+}
+
+// 32 bits float
+
+inline void i_store_partial(char* p, const float32x4& a, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n));
+    _mm_maskstore_ps(reinterpret_cast<float*>(p), mask, a);
+#else
+    i_store_partial_bytes16(p, bit_cast<uint8x16>(a), n*4);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+inline void i_store_partial(char* p, const float32x8& a, unsigned n)
+{
+    _mm256_maskstore_ps(reinterpret_cast<float*>(p), partial_mask32(n), a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_store_partial(char* p, const float32<16>& a, unsigned n)
+{
+    _mm512_mask_storeu_ps(p, (1u << n) - 1, a);
+}
+#endif
+
+template<unsigned N>
+void i_store_partial(char* p, const float32<N>& a, unsigned n)
+{
+    v_store_partial(p, a, n);
+}
+
+// 64 bits float
+
+inline void i_store_partial(char* p, const float64x2& a, unsigned n)
+{
+#if SIMDPP_USE_AVX
+    __m128i mask = _mm256_castsi256_si128(partial_mask32(n*2));
+    _mm_maskstore_pd(reinterpret_cast<double*>(p), mask, a);
+#else
+    i_store_partial_bytes16(p, bit_cast<uint8x16>(a), n*8);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+inline void i_store_partial(char* p, const float64x4& a, unsigned n)
+{
+    _mm256_maskstore_pd(reinterpret_cast<double*>(p), partial_mask32(n*2), a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_store_partial(char* p, const float64<8>& a, unsigned n)
+{
+    _mm512_mask_storeu_pd(p, (1u << n) - 1, a);
+}
+#endif
+
+template<unsigned N>
+void i_store_partial(char* p, const float64<N>& a, unsigned n)
+{
+    v_store_partial(p, a, n);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V>
+void v_store_partial(char* p, const V& a, unsigned n)
+{
+    using B = typename V::base_vector_type;
+    for (unsigned i = 0; i < V::vec_length && n > 0; ++i) {
+        unsigned count = n < B::length ? n : B::length;
+        i_store_partial(p, a[i], count);
+        n -= count;
+        p += sizeof(B);
+    }
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
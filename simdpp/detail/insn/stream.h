@@ -76,6 +76,20 @@ void i_stream(char* p, uint8<N> a)
     v_stream(p, a);
 }
 
+#if SIMDPP_USE_AVX512F
+inline void i_stream(char* p, uint32<16> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(p), a);
+}
+
+inline void i_stream(char* p, uint64<8> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(p), a);
+}
+#endif
+
 template<unsigned N>
 void i_stream(char* p, uint16<N> a) { i_stream(p, uint8<N*2>(a)); }
 template<unsigned N>
@@ -104,7 +118,15 @@ inline void i_stream(char* p, float32x4 a)
 inline void i_stream(char* p, float32x8 a)
 {
     p = detail::assume_aligned(p, 32);
-    _mm256_stream_ps(reinterpret_cast<double*>(p), a);
+    _mm256_stream_ps(reinterpret_cast<float*>(p), a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline void i_stream(char* p, float32<16> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_stream_ps(reinterpret_cast<float*>(p), a);
 }
 #endif
 
@@ -134,6 +156,14 @@ inline void i_stream(char* p, float64x4 a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline void i_stream(char* p, float64<8> a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_stream_pd(reinterpret_cast<double*>(p), a);
+}
+#endif
+
 template<unsigned N>
 void i_stream(char* p, float64<N> a)
 {
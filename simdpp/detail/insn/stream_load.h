@@ -0,0 +1,198 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STREAM_LOAD_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STREAM_LOAD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/align.h>
+#include <simdpp/null/memory.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+template<class V>
+void v_stream_load(V& a, const char* p);
+
+#if SIMDPP_USE_SSE4_1
+// _mm_stream_load_si128 takes a non-const pointer on some compilers
+inline __m128i stream_load_si128(const char* p)
+{
+    __m128i* q = reinterpret_cast<__m128i*>(const_cast<char*>(p));
+    return _mm_stream_load_si128(q);
+}
+#endif
+
+inline void i_stream_load(uint8x16& a, const char* p)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    null::load(a, p);
+#elif SIMDPP_USE_SSE4_1
+    a = stream_load_si128(p);
+#elif SIMDPP_USE_SSE2
+    a = _mm_load_si128(reinterpret_cast<const __m128i*>(p));
+#elif SIMDPP_USE_NEON
+    a = vreinterpretq_u32_u64(vld1q_u64(reinterpret_cast<const uint64_t*>(p)));
+#elif SIMDPP_USE_ALTIVEC
+    a = vec_ldl(0, reinterpret_cast<const uint8_t*>(p));
+#endif
+}
+
+inline void i_stream_load(uint16x8& a, const char* p) { uint8x16 r; i_stream_load(r, p); a = r; }
+inline void i_stream_load(uint32x4& a, const char* p) { uint8x16 r; i_stream_load(r, p); a = r; }
+inline void i_stream_load(uint64x2& a, const char* p) { uint8x16 r; i_stream_load(r, p); a = r; }
+
+inline void i_stream_load(float32x4& a, const char* p)
+{
+    const float* q = reinterpret_cast<const float*>(p);
+    q = detail::assume_aligned(q, 16);
+#if SIMDPP_USE_NULL
+    null::load(a, q);
+#elif SIMDPP_USE_SSE4_1
+    a = _mm_castsi128_ps(stream_load_si128(p));
+#elif SIMDPP_USE_SSE2
+    a = _mm_load_ps(q);
+#elif SIMDPP_USE_NEON
+    a = vld1q_f32(q);
+#elif SIMDPP_USE_ALTIVEC
+    a = vec_ldl(0, q);
+#endif
+}
+
+inline void i_stream_load(float64x2& a, const char* p)
+{
+    const double* q = reinterpret_cast<const double*>(p);
+    q = detail::assume_aligned(q, 16);
+#if SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC || SIMDPP_USE_NEON
+    null::load(a, q);
+#elif SIMDPP_USE_SSE4_1
+    a = _mm_castsi128_pd(stream_load_si128(p));
+#elif SIMDPP_USE_SSE2
+    a = _mm_load_pd(q);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+inline __m256i stream_load_si256(const char* p)
+{
+    p = detail::assume_aligned(p, 32);
+    return _mm256_stream_load_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+inline void i_stream_load(uint8x32& a,  const char* p) { a = stream_load_si256(p); }
+inline void i_stream_load(uint16x16& a, const char* p) { a = stream_load_si256(p); }
+inline void i_stream_load(uint32x8& a,  const char* p) { a = stream_load_si256(p); }
+inline void i_stream_load(uint64x4& a,  const char* p) { a = stream_load_si256(p); }
+#endif
+
+#if SIMDPP_USE_AVX
+// AVX has no 256-bit streaming load, two 128-bit loads are used instead
+inline __m256i stream_load_float256(const char* p)
+{
+#if SIMDPP_USE_AVX2
+    return stream_load_si256(p);
+#else
+    p = detail::assume_aligned(p, 32);
+    __m256i r = _mm256_castsi128_si256(stream_load_si128(p));
+    return _mm256_insertf128_si256(r, stream_load_si128(p + 16), 1);
+#endif
+}
+
+inline void i_stream_load(float32x8& a, const char* p)
+{
+    a = _mm256_castsi256_ps(stream_load_float256(p));
+}
+
+inline void i_stream_load(float64x4& a, const char* p)
+{
+    a = _mm256_castsi256_pd(stream_load_float256(p));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+inline __m512i stream_load_si512(const char* p)
+{
+    p = detail::assume_aligned(p, 64);
+    return _mm512_stream_load_si512(const_cast<char*>(p));
+}
+
+inline void i_stream_load(uint32<16>& a, const char* p) { a = stream_load_si512(p); }
+inline void i_stream_load(uint64<8>& a,  const char* p) { a = stream_load_si512(p); }
+
+inline void i_stream_load(float32<16>& a, const char* p)
+{
+    a = _mm512_castsi512_ps(stream_load_si512(p));
+}
+
+inline void i_stream_load(float64<8>& a, const char* p)
+{
+    a = _mm512_castsi512_pd(stream_load_si512(p));
+}
+#endif
+
+template<unsigned N>
+void i_stream_load(uint8<N>& a,  const char* p) { v_stream_load(a, p); }
+template<unsigned N>
+void i_stream_load(uint16<N>& a, const char* p) { v_stream_load(a, p); }
+template<unsigned N>
+void i_stream_load(uint32<N>& a, const char* p) { v_stream_load(a, p); }
+template<unsigned N>
+void i_stream_load(uint64<N>& a, const char* p) { v_stream_load(a, p); }
+template<unsigned N>
+void i_stream_load(float32<N>& a, const char* p){ v_stream_load(a, p); }
+template<unsigned N>
+void i_stream_load(float64<N>& a, const char* p){ v_stream_load(a, p); }
+
+template<class V>
+void v_stream_load(V& a, const char* p)
+{
+    unsigned veclen = sizeof(typename V::base_vector_type);
+
+    p = detail::assume_aligned(p, veclen);
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_stream_load(a[i], p);
+        p += veclen;
+    }
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
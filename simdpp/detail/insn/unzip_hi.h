@@ -130,6 +130,13 @@ inline uint32x8 i_unzip4_hi(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_unzip4_hi(uint32x16 a, uint32x16 b)
+{
+    return shuffle2<1,3,1,3>(a, b);
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_unzip4_hi(uint32<N> a, uint32<N> b)
 {
@@ -166,6 +173,13 @@ inline float32x8 i_unzip4_hi(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_unzip4_hi(float32x16 a, float32x16 b)
+{
+    return shuffle2<1,3,1,3>(a, b);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_unzip4_hi(float32<N> a, float32<N> b)
 {
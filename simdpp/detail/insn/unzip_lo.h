@@ -76,7 +76,7 @@ inline uint8x32 i_unzip16_lo(uint8x32 a, uint8x32 b)
     a = bit_and(a, mask);
     b = bit_and(b, mask);
     r = _mm256_packus_epi16(a, b);
-    return r;
+    return uint8x32(r);
 }
 #endif
 
@@ -125,7 +125,7 @@ inline uint16x16 i_unzip8_lo(uint16x16 a, uint16x16 b)
     a = bit_and(a, mask);
     b = bit_and(b, mask);
     r = _mm256_packus_epi32(a, b);
-    return r;
+    return uint16x16(r);
 }
 #endif
 
@@ -158,6 +158,13 @@ inline uint32x8 i_unzip4_lo(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_unzip4_lo(uint32x16 a, uint32x16 b)
+{
+    return shuffle2<0,2,0,2>(a,b);
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_unzip4_lo(uint32<N> a, uint32<N> b)
 {
@@ -195,6 +202,13 @@ inline float32x8 i_unzip4_lo(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_unzip4_lo(float32x16 a, float32x16 b)
+{
+    return shuffle2<0,2,0,2>(a,b);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_unzip4_lo(float32<N> a, float32<N> b)
 {
@@ -122,6 +122,13 @@ inline uint32x8 i_zip4_hi(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_zip4_hi(uint32x16 a, uint32x16 b)
+{
+    return _mm512_unpackhi_epi32(a, b);
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_zip4_hi(uint32<N> a, uint32<N> b)
 {
@@ -151,6 +158,13 @@ inline uint64x4 i_zip2_hi(uint64x4 a, uint64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint64x8 i_zip2_hi(uint64x8 a, uint64x8 b)
+{
+    return _mm512_unpackhi_epi64(a, b);
+}
+#endif
+
 template<unsigned N>
 uint64<N> i_zip2_hi(uint64<N> a, uint64<N> b)
 {
@@ -179,6 +193,13 @@ inline float32x8 i_zip4_hi(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_zip4_hi(float32x16 a, float32x16 b)
+{
+    return _mm512_unpackhi_ps(a, b);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_zip4_hi(float32<N> a, float32<N> b)
 {
@@ -206,6 +227,13 @@ inline float64x4 i_zip2_hi(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_zip2_hi(float64x8 a, float64x8 b)
+{
+    return _mm512_unpackhi_pd(a, b);
+}
+#endif
+
 template<unsigned N>
 float64<N> i_zip2_hi(float64<N> a, float64<N> b)
 {
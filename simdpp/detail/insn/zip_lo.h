@@ -121,6 +121,13 @@ inline uint32x8 i_zip4_lo(uint32x8 a, uint32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint32x16 i_zip4_lo(uint32x16 a, uint32x16 b)
+{
+    return _mm512_unpacklo_epi32(a, b);
+}
+#endif
+
 template<unsigned N>
 uint32<N> i_zip4_lo(uint32<N> a, uint32<N> b)
 {
@@ -150,6 +157,13 @@ inline uint64x4 i_zip2_lo(uint64x4 a, uint64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline uint64x8 i_zip2_lo(uint64x8 a, uint64x8 b)
+{
+    return _mm512_unpacklo_epi64(a, b);
+}
+#endif
+
 template<unsigned N>
 uint64<N> i_zip2_lo(uint64<N> a, uint64<N> b)
 {
@@ -178,6 +192,13 @@ inline float32x8 i_zip4_lo(float32x8 a, float32x8 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float32x16 i_zip4_lo(float32x16 a, float32x16 b)
+{
+    return _mm512_unpacklo_ps(a, b);
+}
+#endif
+
 template<unsigned N>
 float32<N> i_zip4_lo(float32<N> a, float32<N> b)
 {
@@ -205,6 +226,13 @@ inline float64x4 i_zip2_lo(float64x4 a, float64x4 b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512F
+inline float64x8 i_zip2_lo(float64x8 a, float64x8 b)
+{
+    return _mm512_unpacklo_pd(a, b);
+}
+#endif
+
 template<unsigned N>
 float64<N> i_zip2_lo(float64<N> a, float64<N> b)
 {
@@ -0,0 +1,429 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_PROFILE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_PROFILE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+
+/** @def SIMDPP_PROFILE_OPS
+    Enables the operation profiling mode. If the macro is defined, each call
+    of a public operation increments a per-thread counter keyed by the name
+    of the operation, the type of its first vector argument and the
+    instruction set of the calling code. The counters are weighted by the
+    number of instructions documented with @c @@icost, see
+    simdpp::get_op_profile and simdpp::dump_op_profile.
+
+    The mode is intended to find the operations that dominate a kernel and
+    the ones that are emulated on the target instruction set. It is not zero
+    overhead, thus the macro must not be defined in production builds. All
+    translation units of the program must be compiled with the same setting.
+
+    Only the outermost public operation is counted. The operations that a
+    public operation or an expression evaluation uses internally are
+    attributed to it. Loads and the construction of constants are counted as
+    load, load_u, load_splat, splat and make_const when the expression is
+    evaluated.
+*/
+
+#ifdef SIMDPP_PROFILE_OPS
+
+#include <simdpp/detail/profile_costs.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace simdpp {
+
+/// The number of calls of an operation on a single vector type
+struct OpProfileEntry {
+    /// The name of the operation, e.g. add
+    std::string op;
+    /// The type of the first vector argument, e.g. uint32x8
+    std::string type;
+    /// The instruction set of the calling code, see @c SIMDPP_ARCH_NAME
+    std::string arch;
+    std::uint64_t calls;
+    /// The number of instructions per call
+    unsigned cost;
+    /** Whether the cost is documented. Otherwise it's estimated as the
+        number of native vectors the type occupies
+    */
+    bool documented;
+    /** Whether the operation is executed element by element. The cost is
+        then the number of elements
+    */
+    bool emulated;
+
+    /// Returns the number of calls weighted by the cost
+    std::uint64_t weighted() const { return calls * cost; }
+};
+
+namespace detail {
+
+struct ProfileSite {
+    std::string op;
+    std::string type;
+    std::string arch;
+    unsigned cost;
+    bool documented;
+    bool emulated;
+    unsigned id;
+};
+
+struct ProfileRegistry {
+    std::mutex mutex;
+    // deque keeps the addresses of the sites stable
+    std::deque<ProfileSite> sites;
+    std::map<std::string, ProfileSite*> index;
+    // the counters of the threads that have exited
+    std::vector<std::uint64_t> retired;
+};
+
+inline ProfileRegistry& get_profile_registry()
+{
+    static ProfileRegistry registry;
+    return registry;
+}
+
+inline void profile_merge(std::vector<std::uint64_t>& dst,
+                          const std::vector<std::uint64_t>& src)
+{
+    if (dst.size() < src.size()) {
+        dst.resize(src.size());
+    }
+    for (unsigned i = 0; i < src.size(); ++i) {
+        dst[i] += src[i];
+    }
+}
+
+/* The counters of a single thread, indexed by ProfileSite::id. The counters
+   are merged to the registry when the thread exits.
+*/
+struct ProfileThread {
+    unsigned depth = 0;
+    std::vector<std::uint64_t> calls;
+
+    ~ProfileThread()
+    {
+        ProfileRegistry& r = get_profile_registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        profile_merge(r.retired, calls);
+    }
+};
+
+inline ProfileThread& get_profile_thread()
+{
+    static thread_local ProfileThread thread;
+    return thread;
+}
+
+/** Returns the site of the operation @a op on @a type, creating it if
+    needed. Calls of the same operation from different call sites share
+    the site.
+*/
+inline const ProfileSite* profile_register(const char* op,
+                                           const std::string& type,
+                                           const char* arch, unsigned cost,
+                                           bool documented, bool emulated)
+{
+    ProfileRegistry& r = get_profile_registry();
+    std::string key = std::string(op) + ' ' + type + ' ' + arch;
+    std::lock_guard<std::mutex> lock(r.mutex);
+    auto it = r.index.find(key);
+    if (it != r.index.end()) {
+        return it->second;
+    }
+    ProfileSite site = { op, type, arch, cost, documented, emulated,
+                         (unsigned) r.sites.size() };
+    r.sites.push_back(site);
+    r.index[key] = &r.sites.back();
+    return &r.sites.back();
+}
+
+/** Counts a call of a public operation. Only the outermost scope of a
+    thread counts; the nested ones only track the depth.
+*/
+class ProfileScope {
+public:
+    ProfileScope(const ProfileSite* site) : thread_(get_profile_thread())
+    {
+        if (thread_.depth++ == 0 && site != nullptr) {
+            if (site->id >= thread_.calls.size()) {
+                thread_.calls.resize(site->id + 1);
+            }
+            thread_.calls[site->id]++;
+        }
+    }
+
+    ~ProfileScope()
+    {
+        thread_.depth--;
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileThread& thread_;
+};
+
+/** Returns the documented cost of @a op on @a type on the instruction set
+    @a arch, named as in the documentation, or nullptr if there's none
+*/
+inline const ProfileCost* find_profile_cost(const char* op, const char* type,
+                                            const char* arch)
+{
+    unsigned size;
+    const ProfileCost* costs = get_profile_costs(size);
+    auto less = [](const ProfileCost& a, const ProfileCost& b)
+    {
+        int r = std::strcmp(a.op, b.op);
+        if (r == 0) r = std::strcmp(a.type, b.type);
+        if (r == 0) r = std::strcmp(a.arch, b.arch);
+        return r < 0;
+    };
+    ProfileCost key = { op, type, arch, 0, false };
+    const ProfileCost* it = std::lower_bound(costs, costs + size, key, less);
+    if (it == costs + size || less(key, *it)) {
+        return nullptr;
+    }
+    return it;
+}
+
+} // namespace detail
+
+/** Returns the operation counters of the SIMDPP_PROFILE_OPS mode, sorted by
+    the weighted cost in descending order. The counters of the calling thread
+    and of the threads that have exited are included.
+*/
+inline std::vector<OpProfileEntry> get_op_profile()
+{
+    detail::ProfileRegistry& r = detail::get_profile_registry();
+    std::vector<OpProfileEntry> res;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        std::vector<std::uint64_t> calls = r.retired;
+        detail::profile_merge(calls, detail::get_profile_thread().calls);
+        for (unsigned i = 0; i < calls.size(); ++i) {
+            if (calls[i] == 0) {
+                continue;
+            }
+            const detail::ProfileSite& s = r.sites[i];
+            OpProfileEntry e = { s.op, s.type, s.arch, calls[i], s.cost,
+                                 s.documented, s.emulated };
+            res.push_back(e);
+        }
+    }
+    std::stable_sort(res.begin(), res.end(),
+                     [](const OpProfileEntry& a, const OpProfileEntry& b)
+    {
+        return a.weighted() > b.weighted();
+    });
+    return res;
+}
+
+/** Clears the counters of the calling thread and of the threads that have
+    exited. The counters of the other running threads are not affected.
+*/
+inline void reset_op_profile()
+{
+    detail::ProfileRegistry& r = detail::get_profile_registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired.clear();
+    detail::get_profile_thread().calls.clear();
+}
+
+/** Prints the result of get_op_profile as a table. The estimated costs are
+    marked with ~, the emulated operations with *. If @a limit is nonzero,
+    at most @a limit rows are printed.
+*/
+inline void dump_op_profile(std::ostream& os, unsigned limit = 0)
+{
+    std::vector<OpProfileEntry> entries = get_op_profile();
+    std::uint64_t total = 0;
+    for (const OpProfileEntry& e : entries) {
+        total += e.weighted();
+    }
+    os << std::setw(14) << "weighted" << std::setw(7) << "%"
+       << std::setw(14) << "calls" << std::setw(7) << "cost"
+       << "  op/type (arch)\n";
+    unsigned n = 0;
+    for (const OpProfileEntry& e : entries) {
+        if (limit != 0 && n++ == limit) {
+            break;
+        }
+        double percent = total ? 100.0 * e.weighted() / total : 0;
+        os << std::setw(14) << e.weighted()
+           << std::setw(7) << std::fixed << std::setprecision(1) << percent
+           << std::setw(14) << e.calls
+           << std::setw(6) << e.cost
+           << (e.emulated ? '*' : (e.documented ? ' ' : '~'))
+           << "  " << e.op << '/' << e.type << " (" << e.arch << ")\n";
+    }
+    os << std::setw(14) << total << "  total\n";
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+
+// Returns the name of the instruction set as used in the documentation, or
+// nullptr for NONE_NULL
+inline const char* profile_doc_arch()
+{
+#if SIMDPP_USE_AVX512F
+    return "AVX512F";
+#elif SIMDPP_USE_AVX2
+    return "AVX2";
+#elif SIMDPP_USE_AVX
+    return "AVX";
+#elif SIMDPP_USE_SSE4_1
+    return "SSE4.1";
+#elif SIMDPP_USE_SSSE3
+    return "SSSE3";
+#elif SIMDPP_USE_SSE3
+    return "SSE3";
+#elif SIMDPP_USE_SSE2
+    return "SSE2";
+#elif SIMDPP_USE_NEON
+    return "NEON";
+#elif SIMDPP_USE_ALTIVEC
+    return "ALTIVEC";
+#else
+    return nullptr;
+#endif
+}
+
+/* Returns the name of the vector type, e.g. mask_int32x4. If @a unmask is
+   true, the masks are named as the unsigned integer or floating-point
+   vectors, which the documented costs refer to.
+*/
+template<class V>
+std::string profile_type_name(bool unmask)
+{
+    std::string r;
+    switch (V::type_tag) {
+    case SIMDPP_TAG_MASK_INT:   r = unmask ? "uint" : "mask_int"; break;
+    case SIMDPP_TAG_MASK_FLOAT: r = unmask ? "float" : "mask_float"; break;
+    case SIMDPP_TAG_INT:        r = "int"; break;
+    case SIMDPP_TAG_UINT:       r = "uint"; break;
+    default:                    r = "float"; break;
+    }
+    return r + std::to_string(V::length_bytes * 8 / V::length) + 'x' +
+        std::to_string(V::length);
+}
+
+// Returns the number of elements of the native vector of the element type
+template<class V>
+unsigned profile_native_length()
+{
+    bool is_float = V::type_tag == SIMDPP_TAG_FLOAT ||
+                    V::type_tag == SIMDPP_TAG_MASK_FLOAT;
+    switch (V::length_bytes / V::length) {
+    case 1:  return SIMDPP_FAST_INT8_SIZE;
+    case 2:  return SIMDPP_FAST_INT16_SIZE;
+    case 4:  return is_float ? SIMDPP_FAST_FLOAT32_SIZE : SIMDPP_FAST_INT32_SIZE;
+    default: return is_float ? SIMDPP_FAST_FLOAT64_SIZE : SIMDPP_FAST_INT64_SIZE;
+    }
+}
+
+/* Returns the profiling site of @a op called with @a V as the first vector
+   argument. The documented cost is used if there's one, otherwise one
+   instruction per native vector is assumed.
+*/
+template<class V>
+const ::simdpp::detail::ProfileSite* profile_site(const char* op, const V&)
+{
+    const char* doc_arch = profile_doc_arch();
+    unsigned native = profile_native_length<V>();
+    unsigned cost = (V::length + native - 1) / native;
+    bool documented = false;
+    bool emulated = false;
+    if (doc_arch == nullptr) {
+        cost = V::length;
+        emulated = true;
+    } else {
+        std::string type = profile_type_name<V>(true);
+        const ::simdpp::detail::ProfileCost* c =
+            ::simdpp::detail::find_profile_cost(op, type.c_str(), doc_arch);
+        if (c != nullptr) {
+            documented = true;
+            emulated = c->novec;
+            cost = emulated ? V::length : c->cost;
+        }
+    }
+    return ::simdpp::detail::profile_register(op, profile_type_name<V>(false),
+                                              SIMDPP_ARCH_NAME, cost,
+                                              documented, emulated);
+}
+
+} // namespace detail
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+/*  Counts a call of the public operation @a NAME at the beginning of its
+    body. @a A is the first vector argument.
+*/
+#define SIMDPP_PROFILE_OP(NAME, A) SIMDPP_PROFILE_OP_NAMED(#NAME, A)
+
+#define SIMDPP_PROFILE_OP_NAMED(NAME, A)                                    \
+    static const ::simdpp::detail::ProfileSite* simdpp_profile_site =      \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::detail::profile_site(NAME,        \
+                                                              (A).vec());  \
+    ::simdpp::detail::ProfileScope simdpp_profile_scope(simdpp_profile_site)
+
+/*  Marks the evaluation of an expression. The public operations used by the
+    evaluation are not counted.
+*/
+#define SIMDPP_PROFILE_NESTED()                                             \
+    ::simdpp::detail::ProfileScope simdpp_profile_scope(nullptr)
+
+#else // SIMDPP_PROFILE_OPS
+
+#define SIMDPP_PROFILE_OP(NAME, A)
+#define SIMDPP_PROFILE_OP_NAMED(NAME, A)
+#define SIMDPP_PROFILE_NESTED()
+
+#endif // SIMDPP_PROFILE_OPS
+
+#endif
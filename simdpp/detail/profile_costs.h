@@ -0,0 +1,3323 @@
+/*  libsimdpp
+    Copyright (C) 2011-2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Generated by tools/gen_profile_costs.py. Do not edit.
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_PROFILE_COSTS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_PROFILE_COSTS_H
+
+namespace simdpp {
+namespace detail {
+
+/** The documented number of instructions of an operation. If @a novec is
+    set, the operation is executed element by element.
+*/
+struct ProfileCost {
+    const char* op;
+    const char* type;
+    const char* arch;
+    unsigned cost;
+    bool novec;
+};
+
+/** Returns the table of the documented costs and stores the number of the
+    rows to @a size. The rows are sorted by the operation, the type and the
+    instruction set.
+*/
+inline const ProfileCost* get_profile_costs(unsigned& size)
+{
+    static const ProfileCost costs[] = {
+        { "abs", "float32x4", "ALTIVEC", 2, false },
+        { "abs", "float32x4", "AVX", 2, false },
+        { "abs", "float32x4", "AVX2", 2, false },
+        { "abs", "float32x4", "SSE2", 2, false },
+        { "abs", "float32x4", "SSE3", 2, false },
+        { "abs", "float32x4", "SSE4.1", 2, false },
+        { "abs", "float32x4", "SSSE3", 2, false },
+        { "abs", "float32x8", "ALTIVEC", 3, false },
+        { "abs", "float32x8", "AVX", 2, false },
+        { "abs", "float32x8", "AVX2", 2, false },
+        { "abs", "float32x8", "NEON", 2, false },
+        { "abs", "float32x8", "SSE2", 3, false },
+        { "abs", "float32x8", "SSE3", 3, false },
+        { "abs", "float32x8", "SSE4.1", 3, false },
+        { "abs", "float32x8", "SSSE3", 3, false },
+        { "abs", "float64x2", "ALTIVEC", 0, true },
+        { "abs", "float64x2", "AVX", 2, false },
+        { "abs", "float64x2", "AVX2", 2, false },
+        { "abs", "float64x2", "NEON", 0, true },
+        { "abs", "float64x2", "SSE2", 2, false },
+        { "abs", "float64x2", "SSE3", 2, false },
+        { "abs", "float64x2", "SSE4.1", 2, false },
+        { "abs", "float64x2", "SSSE3", 2, false },
+        { "abs", "float64x4", "ALTIVEC", 0, true },
+        { "abs", "float64x4", "AVX", 2, false },
+        { "abs", "float64x4", "AVX2", 2, false },
+        { "abs", "float64x4", "NEON", 0, true },
+        { "abs", "float64x4", "SSE2", 3, false },
+        { "abs", "float64x4", "SSE3", 3, false },
+        { "abs", "float64x4", "SSE4.1", 3, false },
+        { "abs", "float64x4", "SSSE3", 3, false },
+        { "abs", "int16x16", "ALTIVEC", 5, false },
+        { "abs", "int16x16", "AVX", 2, false },
+        { "abs", "int16x16", "NEON", 2, false },
+        { "abs", "int16x16", "SSE2", 6, false },
+        { "abs", "int16x16", "SSE3", 6, false },
+        { "abs", "int16x16", "SSE4.1", 2, false },
+        { "abs", "int16x16", "SSSE3", 2, false },
+        { "abs", "int16x8", "ALTIVEC", 3, false },
+        { "abs", "int16x8", "SSE2", 3, false },
+        { "abs", "int16x8", "SSE3", 3, false },
+        { "abs", "int32x4", "ALTIVEC", 3, false },
+        { "abs", "int32x4", "SSE2", 3, false },
+        { "abs", "int32x4", "SSE3", 3, false },
+        { "abs", "int32x8", "ALTIVEC", 4, false },
+        { "abs", "int32x8", "AVX", 2, false },
+        { "abs", "int32x8", "NEON", 2, false },
+        { "abs", "int32x8", "SSE2", 6, false },
+        { "abs", "int32x8", "SSE3", 6, false },
+        { "abs", "int32x8", "SSE4.1", 2, false },
+        { "abs", "int32x8", "SSSE3", 2, false },
+        { "abs", "int64x2", "ALTIVEC", 0, true },
+        { "abs", "int64x2", "AVX", 5, false },
+        { "abs", "int64x2", "NEON", 6, false },
+        { "abs", "int64x2", "SSE2", 5, false },
+        { "abs", "int64x2", "SSE3", 5, false },
+        { "abs", "int64x2", "SSE4.1", 5, false },
+        { "abs", "int64x2", "SSSE3", 5, false },
+        { "abs", "int64x4", "ALTIVEC", 0, true },
+        { "abs", "int64x4", "AVX", 10, false },
+        { "abs", "int64x4", "AVX2", 4, false },
+        { "abs", "int64x4", "NEON", 12, false },
+        { "abs", "int64x4", "SSE2", 10, false },
+        { "abs", "int64x4", "SSE3", 10, false },
+        { "abs", "int64x4", "SSE4.1", 10, false },
+        { "abs", "int64x4", "SSSE3", 10, false },
+        { "abs", "int8x16", "ALTIVEC", 3, false },
+        { "abs", "int8x16", "SSE2", 3, false },
+        { "abs", "int8x16", "SSE3", 3, false },
+        { "abs", "int8x32", "ALTIVEC", 4, false },
+        { "abs", "int8x32", "AVX", 2, false },
+        { "abs", "int8x32", "NEON", 2, false },
+        { "abs", "int8x32", "SSE2", 6, false },
+        { "abs", "int8x32", "SSE3", 6, false },
+        { "abs", "int8x32", "SSE4.1", 2, false },
+        { "abs", "int8x32", "SSSE3", 2, false },
+        { "add", "float32x8", "ALTIVEC", 2, false },
+        { "add", "float32x8", "NEON", 2, false },
+        { "add", "float32x8", "SSE2", 2, false },
+        { "add", "float32x8", "SSE3", 2, false },
+        { "add", "float32x8", "SSE4.1", 2, false },
+        { "add", "float32x8", "SSSE3", 2, false },
+        { "add", "float64x2", "ALTIVEC", 0, true },
+        { "add", "float64x2", "NEON", 0, true },
+        { "add", "float64x4", "ALTIVEC", 0, true },
+        { "add", "float64x4", "NEON", 0, true },
+        { "add", "float64x4", "SSE2", 2, false },
+        { "add", "float64x4", "SSE3", 2, false },
+        { "add", "float64x4", "SSE4.1", 2, false },
+        { "add", "float64x4", "SSSE3", 2, false },
+        { "add", "int16x16", "ALTIVEC", 2, false },
+        { "add", "int16x16", "AVX", 2, false },
+        { "add", "int16x16", "NEON", 2, false },
+        { "add", "int16x16", "SSE2", 2, false },
+        { "add", "int16x16", "SSE3", 2, false },
+        { "add", "int16x16", "SSE4.1", 2, false },
+        { "add", "int16x16", "SSSE3", 2, false },
+        { "add", "int32x8", "ALTIVEC", 2, false },
+        { "add", "int32x8", "AVX", 2, false },
+        { "add", "int32x8", "NEON", 2, false },
+        { "add", "int32x8", "SSE2", 2, false },
+        { "add", "int32x8", "SSE3", 2, false },
+        { "add", "int32x8", "SSE4.1", 2, false },
+        { "add", "int32x8", "SSSE3", 2, false },
+        { "add", "int64x2", "ALTIVEC", 6, false },
+        { "add", "int64x4", "ALTIVEC", 11, false },
+        { "add", "int64x4", "AVX", 2, false },
+        { "add", "int64x4", "NEON", 2, false },
+        { "add", "int64x4", "SSE2", 2, false },
+        { "add", "int64x4", "SSE3", 2, false },
+        { "add", "int64x4", "SSE4.1", 2, false },
+        { "add", "int64x4", "SSSE3", 2, false },
+        { "add", "int8x32", "ALTIVEC", 2, false },
+        { "add", "int8x32", "AVX", 2, false },
+        { "add", "int8x32", "NEON", 2, false },
+        { "add", "int8x32", "SSE2", 2, false },
+        { "add", "int8x32", "SSE3", 2, false },
+        { "add", "int8x32", "SSE4.1", 2, false },
+        { "add", "int8x32", "SSSE3", 2, false },
+        { "add", "uint16x16", "ALTIVEC", 2, false },
+        { "add", "uint16x16", "AVX", 2, false },
+        { "add", "uint16x16", "NEON", 2, false },
+        { "add", "uint16x16", "SSE2", 2, false },
+        { "add", "uint16x16", "SSE3", 2, false },
+        { "add", "uint16x16", "SSE4.1", 2, false },
+        { "add", "uint16x16", "SSSE3", 2, false },
+        { "add", "uint32x8", "ALTIVEC", 2, false },
+        { "add", "uint32x8", "AVX", 2, false },
+        { "add", "uint32x8", "NEON", 2, false },
+        { "add", "uint32x8", "SSE2", 2, false },
+        { "add", "uint32x8", "SSE3", 2, false },
+        { "add", "uint32x8", "SSE4.1", 2, false },
+        { "add", "uint32x8", "SSSE3", 2, false },
+        { "add", "uint64x2", "ALTIVEC", 6, false },
+        { "add", "uint64x4", "ALTIVEC", 11, false },
+        { "add", "uint64x4", "AVX", 2, false },
+        { "add", "uint64x4", "NEON", 2, false },
+        { "add", "uint64x4", "SSE2", 2, false },
+        { "add", "uint64x4", "SSE3", 2, false },
+        { "add", "uint64x4", "SSE4.1", 2, false },
+        { "add", "uint64x4", "SSSE3", 2, false },
+        { "add", "uint8x32", "ALTIVEC", 2, false },
+        { "add", "uint8x32", "AVX", 2, false },
+        { "add", "uint8x32", "NEON", 2, false },
+        { "add", "uint8x32", "SSE2", 2, false },
+        { "add", "uint8x32", "SSE3", 2, false },
+        { "add", "uint8x32", "SSE4.1", 2, false },
+        { "add", "uint8x32", "SSSE3", 2, false },
+        { "adds", "int16x16", "ALTIVEC", 2, false },
+        { "adds", "int16x16", "AVX", 2, false },
+        { "adds", "int16x16", "NEON", 2, false },
+        { "adds", "int16x16", "SSE2", 2, false },
+        { "adds", "int16x16", "SSE3", 2, false },
+        { "adds", "int16x16", "SSE4.1", 2, false },
+        { "adds", "int16x16", "SSSE3", 2, false },
+        { "adds", "int8x32", "ALTIVEC", 2, false },
+        { "adds", "int8x32", "AVX", 2, false },
+        { "adds", "int8x32", "NEON", 2, false },
+        { "adds", "int8x32", "SSE2", 2, false },
+        { "adds", "int8x32", "SSE3", 2, false },
+        { "adds", "int8x32", "SSE4.1", 2, false },
+        { "adds", "int8x32", "SSSE3", 2, false },
+        { "adds", "uint16x16", "ALTIVEC", 2, false },
+        { "adds", "uint16x16", "AVX", 2, false },
+        { "adds", "uint16x16", "NEON", 2, false },
+        { "adds", "uint16x16", "SSE2", 2, false },
+        { "adds", "uint16x16", "SSE3", 2, false },
+        { "adds", "uint16x16", "SSE4.1", 2, false },
+        { "adds", "uint16x16", "SSSE3", 2, false },
+        { "adds", "uint8x32", "ALTIVEC", 2, false },
+        { "adds", "uint8x32", "AVX", 2, false },
+        { "adds", "uint8x32", "NEON", 2, false },
+        { "adds", "uint8x32", "SSE2", 2, false },
+        { "adds", "uint8x32", "SSE3", 2, false },
+        { "adds", "uint8x32", "SSE4.1", 2, false },
+        { "adds", "uint8x32", "SSSE3", 2, false },
+        { "align16", "int8x16", "SSE2", 3, false },
+        { "align16", "int8x16", "SSE3", 3, false },
+        { "align16", "int8x32", "ALTIVEC", 2, false },
+        { "align16", "int8x32", "AVX", 2, false },
+        { "align16", "int8x32", "NEON", 2, false },
+        { "align16", "int8x32", "SSE2", 6, false },
+        { "align16", "int8x32", "SSE3", 6, false },
+        { "align16", "int8x32", "SSE4.1", 2, false },
+        { "align16", "int8x32", "SSSE3", 2, false },
+        { "align16", "uint8x16", "SSE2", 3, false },
+        { "align16", "uint8x16", "SSE3", 3, false },
+        { "align16", "uint8x32", "ALTIVEC", 2, false },
+        { "align16", "uint8x32", "AVX", 2, false },
+        { "align16", "uint8x32", "NEON", 2, false },
+        { "align16", "uint8x32", "SSE2", 6, false },
+        { "align16", "uint8x32", "SSE3", 6, false },
+        { "align16", "uint8x32", "SSE4.1", 2, false },
+        { "align16", "uint8x32", "SSSE3", 2, false },
+        { "align2", "float64x2", "SSE2", 3, false },
+        { "align2", "float64x2", "SSE3", 3, false },
+        { "align2", "float64x4", "ALTIVEC", 2, false },
+        { "align2", "float64x4", "AVX", 2, false },
+        { "align2", "float64x4", "NEON", 2, false },
+        { "align2", "float64x4", "SSE2", 6, false },
+        { "align2", "float64x4", "SSE3", 6, false },
+        { "align2", "float64x4", "SSE4.1", 2, false },
+        { "align2", "float64x4", "SSSE3", 2, false },
+        { "align2", "int64x2", "SSE2", 3, false },
+        { "align2", "int64x2", "SSE3", 3, false },
+        { "align2", "int64x4", "ALTIVEC", 2, false },
+        { "align2", "int64x4", "AVX", 2, false },
+        { "align2", "int64x4", "NEON", 2, false },
+        { "align2", "int64x4", "SSE2", 6, false },
+        { "align2", "int64x4", "SSE3", 6, false },
+        { "align2", "int64x4", "SSE4.1", 2, false },
+        { "align2", "int64x4", "SSSE3", 2, false },
+        { "align2", "uint64x2", "SSE2", 3, false },
+        { "align2", "uint64x2", "SSE3", 3, false },
+        { "align2", "uint64x4", "ALTIVEC", 2, false },
+        { "align2", "uint64x4", "AVX", 2, false },
+        { "align2", "uint64x4", "NEON", 2, false },
+        { "align2", "uint64x4", "SSE2", 6, false },
+        { "align2", "uint64x4", "SSE3", 6, false },
+        { "align2", "uint64x4", "SSE4.1", 2, false },
+        { "align2", "uint64x4", "SSSE3", 2, false },
+        { "align4", "float32x4", "SSE2", 3, false },
+        { "align4", "float32x4", "SSE3", 3, false },
+        { "align4", "float32x8", "ALTIVEC", 2, false },
+        { "align4", "float32x8", "AVX", 2, false },
+        { "align4", "float32x8", "NEON", 2, false },
+        { "align4", "float32x8", "SSE2", 6, false },
+        { "align4", "float32x8", "SSE3", 6, false },
+        { "align4", "float32x8", "SSE4.1", 2, false },
+        { "align4", "float32x8", "SSSE3", 2, false },
+        { "align4", "int32x4", "SSE2", 3, false },
+        { "align4", "int32x4", "SSE3", 3, false },
+        { "align4", "int32x8", "ALTIVEC", 2, false },
+        { "align4", "int32x8", "AVX", 2, false },
+        { "align4", "int32x8", "NEON", 2, false },
+        { "align4", "int32x8", "SSE2", 6, false },
+        { "align4", "int32x8", "SSE3", 6, false },
+        { "align4", "int32x8", "SSE4.1", 2, false },
+        { "align4", "int32x8", "SSSE3", 2, false },
+        { "align4", "uint32x4", "SSE2", 3, false },
+        { "align4", "uint32x4", "SSE3", 3, false },
+        { "align4", "uint32x8", "ALTIVEC", 2, false },
+        { "align4", "uint32x8", "AVX", 2, false },
+        { "align4", "uint32x8", "NEON", 2, false },
+        { "align4", "uint32x8", "SSE2", 6, false },
+        { "align4", "uint32x8", "SSE3", 6, false },
+        { "align4", "uint32x8", "SSE4.1", 2, false },
+        { "align4", "uint32x8", "SSSE3", 2, false },
+        { "align8", "int16x16", "ALTIVEC", 2, false },
+        { "align8", "int16x16", "AVX", 2, false },
+        { "align8", "int16x16", "NEON", 2, false },
+        { "align8", "int16x16", "SSE2", 6, false },
+        { "align8", "int16x16", "SSE3", 6, false },
+        { "align8", "int16x16", "SSE4.1", 2, false },
+        { "align8", "int16x16", "SSSE3", 2, false },
+        { "align8", "int16x8", "SSE2", 3, false },
+        { "align8", "int16x8", "SSE3", 3, false },
+        { "align8", "uint16x16", "ALTIVEC", 2, false },
+        { "align8", "uint16x16", "AVX", 2, false },
+        { "align8", "uint16x16", "NEON", 2, false },
+        { "align8", "uint16x16", "SSE2", 6, false },
+        { "align8", "uint16x16", "SSE3", 6, false },
+        { "align8", "uint16x16", "SSE4.1", 2, false },
+        { "align8", "uint16x16", "SSSE3", 2, false },
+        { "align8", "uint16x8", "SSE2", 3, false },
+        { "align8", "uint16x8", "SSE3", 3, false },
+        { "avg", "int16x16", "ALTIVEC", 2, false },
+        { "avg", "int16x16", "AVX", 9, false },
+        { "avg", "int16x16", "AVX2", 5, false },
+        { "avg", "int16x16", "NEON", 2, false },
+        { "avg", "int16x16", "SSE2", 9, false },
+        { "avg", "int16x16", "SSE3", 9, false },
+        { "avg", "int16x16", "SSE4.1", 9, false },
+        { "avg", "int16x16", "SSSE3", 9, false },
+        { "avg", "int16x8", "AVX", 5, false },
+        { "avg", "int16x8", "AVX2", 5, false },
+        { "avg", "int16x8", "SSE2", 5, false },
+        { "avg", "int16x8", "SSE3", 5, false },
+        { "avg", "int16x8", "SSE4.1", 5, false },
+        { "avg", "int16x8", "SSSE3", 5, false },
+        { "avg", "int32x4", "AVX", 10, false },
+        { "avg", "int32x4", "AVX2", 10, false },
+        { "avg", "int32x4", "NEON", 1, false },
+        { "avg", "int32x4", "SSE2", 10, false },
+        { "avg", "int32x4", "SSE3", 10, false },
+        { "avg", "int32x4", "SSE4.1", 10, false },
+        { "avg", "int32x4", "SSSE3", 10, false },
+        { "avg", "int32x8", "ALTIVEC", 2, false },
+        { "avg", "int32x8", "AVX", 19, false },
+        { "avg", "int32x8", "AVX2", 10, false },
+        { "avg", "int32x8", "NEON", 2, false },
+        { "avg", "int32x8", "SSE2", 19, false },
+        { "avg", "int32x8", "SSE3", 19, false },
+        { "avg", "int32x8", "SSE4.1", 19, false },
+        { "avg", "int32x8", "SSSE3", 19, false },
+        { "avg", "int8x16", "AVX", 5, false },
+        { "avg", "int8x16", "AVX2", 5, false },
+        { "avg", "int8x16", "SSE2", 5, false },
+        { "avg", "int8x16", "SSE3", 5, false },
+        { "avg", "int8x16", "SSE4.1", 5, false },
+        { "avg", "int8x16", "SSSE3", 5, false },
+        { "avg", "int8x32", "ALTIVEC", 2, false },
+        { "avg", "int8x32", "AVX", 9, false },
+        { "avg", "int8x32", "AVX2", 5, false },
+        { "avg", "int8x32", "NEON", 2, false },
+        { "avg", "int8x32", "SSE2", 9, false },
+        { "avg", "int8x32", "SSE3", 9, false },
+        { "avg", "int8x32", "SSE4.1", 9, false },
+        { "avg", "int8x32", "SSSE3", 9, false },
+        { "avg", "uint16x16", "ALTIVEC", 2, false },
+        { "avg", "uint16x16", "AVX", 2, false },
+        { "avg", "uint16x16", "NEON", 2, false },
+        { "avg", "uint16x16", "SSE2", 2, false },
+        { "avg", "uint16x16", "SSE3", 2, false },
+        { "avg", "uint16x16", "SSE4.1", 2, false },
+        { "avg", "uint16x16", "SSSE3", 2, false },
+        { "avg", "uint32x4", "AVX", 7, false },
+        { "avg", "uint32x4", "AVX2", 7, false },
+        { "avg", "uint32x4", "SSE2", 7, false },
+        { "avg", "uint32x4", "SSE3", 7, false },
+        { "avg", "uint32x4", "SSE4.1", 7, false },
+        { "avg", "uint32x4", "SSSE3", 7, false },
+        { "avg", "uint32x8", "ALTIVEC", 2, false },
+        { "avg", "uint32x8", "AVX", 13, false },
+        { "avg", "uint32x8", "AVX2", 7, false },
+        { "avg", "uint32x8", "NEON", 2, false },
+        { "avg", "uint32x8", "SSE2", 13, false },
+        { "avg", "uint32x8", "SSE3", 13, false },
+        { "avg", "uint32x8", "SSE4.1", 13, false },
+        { "avg", "uint32x8", "SSSE3", 13, false },
+        { "avg", "uint8x32", "ALTIVEC", 2, false },
+        { "avg", "uint8x32", "AVX", 2, false },
+        { "avg", "uint8x32", "NEON", 2, false },
+        { "avg", "uint8x32", "SSE2", 2, false },
+        { "avg", "uint8x32", "SSE3", 2, false },
+        { "avg", "uint8x32", "SSE4.1", 2, false },
+        { "avg", "uint8x32", "SSSE3", 2, false },
+        { "avg_trunc", "int16x16", "ALTIVEC", 2, false },
+        { "avg_trunc", "int16x16", "AVX", 15, false },
+        { "avg_trunc", "int16x16", "AVX2", 8, false },
+        { "avg_trunc", "int16x16", "NEON", 2, false },
+        { "avg_trunc", "int16x16", "SSE2", 15, false },
+        { "avg_trunc", "int16x16", "SSE3", 15, false },
+        { "avg_trunc", "int16x16", "SSE4.1", 15, false },
+        { "avg_trunc", "int16x16", "SSSE3", 15, false },
+        { "avg_trunc", "int16x8", "AVX", 8, false },
+        { "avg_trunc", "int16x8", "AVX2", 8, false },
+        { "avg_trunc", "int16x8", "NEON", 1, false },
+        { "avg_trunc", "int16x8", "SSE2", 8, false },
+        { "avg_trunc", "int16x8", "SSE3", 8, false },
+        { "avg_trunc", "int16x8", "SSE4.1", 8, false },
+        { "avg_trunc", "int16x8", "SSSE3", 8, false },
+        { "avg_trunc", "int32x4", "ALTIVEC", 4, false },
+        { "avg_trunc", "int32x4", "AVX", 8, false },
+        { "avg_trunc", "int32x4", "AVX2", 8, false },
+        { "avg_trunc", "int32x4", "SSE2", 8, false },
+        { "avg_trunc", "int32x4", "SSE3", 8, false },
+        { "avg_trunc", "int32x4", "SSE4.1", 8, false },
+        { "avg_trunc", "int32x4", "SSSE3", 8, false },
+        { "avg_trunc", "int32x8", "ALTIVEC", 8, false },
+        { "avg_trunc", "int32x8", "AVX", 15, false },
+        { "avg_trunc", "int32x8", "AVX2", 8, false },
+        { "avg_trunc", "int32x8", "NEON", 2, false },
+        { "avg_trunc", "int32x8", "SSE2", 15, false },
+        { "avg_trunc", "int32x8", "SSE3", 15, false },
+        { "avg_trunc", "int32x8", "SSE4.1", 15, false },
+        { "avg_trunc", "int32x8", "SSSE3", 15, false },
+        { "avg_trunc", "int8x16", "AVX", 8, false },
+        { "avg_trunc", "int8x16", "AVX2", 8, false },
+        { "avg_trunc", "int8x16", "SSE2", 8, false },
+        { "avg_trunc", "int8x16", "SSE3", 8, false },
+        { "avg_trunc", "int8x16", "SSE4.1", 8, false },
+        { "avg_trunc", "int8x16", "SSSE3", 8, false },
+        { "avg_trunc", "int8x32", "ALTIVEC", 2, false },
+        { "avg_trunc", "int8x32", "AVX", 15, false },
+        { "avg_trunc", "int8x32", "AVX2", 8, false },
+        { "avg_trunc", "int8x32", "NEON", 2, false },
+        { "avg_trunc", "int8x32", "SSE2", 15, false },
+        { "avg_trunc", "int8x32", "SSE3", 15, false },
+        { "avg_trunc", "int8x32", "SSE4.1", 15, false },
+        { "avg_trunc", "int8x32", "SSSE3", 15, false },
+        { "avg_trunc", "uint16x16", "ALTIVEC", 2, false },
+        { "avg_trunc", "uint16x16", "AVX", 8, false },
+        { "avg_trunc", "uint16x16", "AVX2", 4, false },
+        { "avg_trunc", "uint16x16", "NEON", 2, false },
+        { "avg_trunc", "uint16x16", "SSE2", 8, false },
+        { "avg_trunc", "uint16x16", "SSE3", 8, false },
+        { "avg_trunc", "uint16x16", "SSE4.1", 8, false },
+        { "avg_trunc", "uint16x16", "SSSE3", 8, false },
+        { "avg_trunc", "uint16x8", "AVX", 4, false },
+        { "avg_trunc", "uint16x8", "AVX2", 4, false },
+        { "avg_trunc", "uint16x8", "NEON", 1, false },
+        { "avg_trunc", "uint16x8", "SSE2", 4, false },
+        { "avg_trunc", "uint16x8", "SSE3", 4, false },
+        { "avg_trunc", "uint16x8", "SSE4.1", 4, false },
+        { "avg_trunc", "uint16x8", "SSSE3", 4, false },
+        { "avg_trunc", "uint32x4", "AVX", 4, false },
+        { "avg_trunc", "uint32x4", "AVX2", 4, false },
+        { "avg_trunc", "uint32x4", "NEON", 1, false },
+        { "avg_trunc", "uint32x4", "SSE2", 4, false },
+        { "avg_trunc", "uint32x4", "SSE3", 4, false },
+        { "avg_trunc", "uint32x4", "SSE4.1", 4, false },
+        { "avg_trunc", "uint32x4", "SSSE3", 4, false },
+        { "avg_trunc", "uint32x8", "ALTIVEC", 2, false },
+        { "avg_trunc", "uint32x8", "AVX", 8, false },
+        { "avg_trunc", "uint32x8", "AVX2", 4, false },
+        { "avg_trunc", "uint32x8", "NEON", 2, false },
+        { "avg_trunc", "uint32x8", "SSE2", 8, false },
+        { "avg_trunc", "uint32x8", "SSE3", 8, false },
+        { "avg_trunc", "uint32x8", "SSE4.1", 8, false },
+        { "avg_trunc", "uint32x8", "SSSE3", 8, false },
+        { "avg_trunc", "uint8x16", "AVX", 4, false },
+        { "avg_trunc", "uint8x16", "AVX2", 4, false },
+        { "avg_trunc", "uint8x16", "NEON", 1, false },
+        { "avg_trunc", "uint8x16", "SSE2", 4, false },
+        { "avg_trunc", "uint8x16", "SSE3", 4, false },
+        { "avg_trunc", "uint8x16", "SSE4.1", 4, false },
+        { "avg_trunc", "uint8x16", "SSSE3", 4, false },
+        { "avg_trunc", "uint8x32", "ALTIVEC", 2, false },
+        { "avg_trunc", "uint8x32", "AVX", 8, false },
+        { "avg_trunc", "uint8x32", "AVX2", 4, false },
+        { "avg_trunc", "uint8x32", "NEON", 2, false },
+        { "avg_trunc", "uint8x32", "SSE2", 8, false },
+        { "avg_trunc", "uint8x32", "SSE3", 8, false },
+        { "avg_trunc", "uint8x32", "SSE4.1", 8, false },
+        { "avg_trunc", "uint8x32", "SSSE3", 8, false },
+        { "bit_xor", "float32x8", "ALTIVEC", 2, false },
+        { "bit_xor", "float32x8", "AVX", 2, false },
+        { "bit_xor", "float32x8", "NEON", 2, false },
+        { "bit_xor", "float32x8", "SSE2", 2, false },
+        { "bit_xor", "float32x8", "SSE3", 2, false },
+        { "bit_xor", "float32x8", "SSE4.1", 2, false },
+        { "bit_xor", "float32x8", "SSSE3", 2, false },
+        { "bit_xor", "float64x4", "ALTIVEC", 2, false },
+        { "bit_xor", "float64x4", "AVX", 2, false },
+        { "bit_xor", "float64x4", "NEON", 2, false },
+        { "bit_xor", "float64x4", "SSE2", 2, false },
+        { "bit_xor", "float64x4", "SSE3", 2, false },
+        { "bit_xor", "float64x4", "SSE4.1", 2, false },
+        { "bit_xor", "float64x4", "SSSE3", 2, false },
+        { "bit_xor", "int16x16", "ALTIVEC", 2, false },
+        { "bit_xor", "int16x16", "AVX", 2, false },
+        { "bit_xor", "int16x16", "NEON", 2, false },
+        { "bit_xor", "int16x16", "SSE2", 2, false },
+        { "bit_xor", "int16x16", "SSE3", 2, false },
+        { "bit_xor", "int16x16", "SSE4.1", 2, false },
+        { "bit_xor", "int16x16", "SSSE3", 2, false },
+        { "bit_xor", "int32x8", "ALTIVEC", 2, false },
+        { "bit_xor", "int32x8", "AVX", 2, false },
+        { "bit_xor", "int32x8", "NEON", 2, false },
+        { "bit_xor", "int32x8", "SSE2", 2, false },
+        { "bit_xor", "int32x8", "SSE3", 2, false },
+        { "bit_xor", "int32x8", "SSE4.1", 2, false },
+        { "bit_xor", "int32x8", "SSSE3", 2, false },
+        { "bit_xor", "int64x4", "ALTIVEC", 2, false },
+        { "bit_xor", "int64x4", "AVX", 2, false },
+        { "bit_xor", "int64x4", "NEON", 2, false },
+        { "bit_xor", "int64x4", "SSE2", 2, false },
+        { "bit_xor", "int64x4", "SSE3", 2, false },
+        { "bit_xor", "int64x4", "SSE4.1", 2, false },
+        { "bit_xor", "int64x4", "SSSE3", 2, false },
+        { "bit_xor", "int8x32", "ALTIVEC", 2, false },
+        { "bit_xor", "int8x32", "AVX", 2, false },
+        { "bit_xor", "int8x32", "NEON", 2, false },
+        { "bit_xor", "int8x32", "SSE2", 2, false },
+        { "bit_xor", "int8x32", "SSE3", 2, false },
+        { "bit_xor", "int8x32", "SSE4.1", 2, false },
+        { "bit_xor", "int8x32", "SSSE3", 2, false },
+        { "bit_xor", "uint16x16", "ALTIVEC", 2, false },
+        { "bit_xor", "uint16x16", "AVX", 2, false },
+        { "bit_xor", "uint16x16", "NEON", 2, false },
+        { "bit_xor", "uint16x16", "SSE2", 2, false },
+        { "bit_xor", "uint16x16", "SSE3", 2, false },
+        { "bit_xor", "uint16x16", "SSE4.1", 2, false },
+        { "bit_xor", "uint16x16", "SSSE3", 2, false },
+        { "bit_xor", "uint32x8", "ALTIVEC", 2, false },
+        { "bit_xor", "uint32x8", "AVX", 2, false },
+        { "bit_xor", "uint32x8", "NEON", 2, false },
+        { "bit_xor", "uint32x8", "SSE2", 2, false },
+        { "bit_xor", "uint32x8", "SSE3", 2, false },
+        { "bit_xor", "uint32x8", "SSE4.1", 2, false },
+        { "bit_xor", "uint32x8", "SSSE3", 2, false },
+        { "bit_xor", "uint64x4", "ALTIVEC", 2, false },
+        { "bit_xor", "uint64x4", "AVX", 2, false },
+        { "bit_xor", "uint64x4", "NEON", 2, false },
+        { "bit_xor", "uint64x4", "SSE2", 2, false },
+        { "bit_xor", "uint64x4", "SSE3", 2, false },
+        { "bit_xor", "uint64x4", "SSE4.1", 2, false },
+        { "bit_xor", "uint64x4", "SSSE3", 2, false },
+        { "bit_xor", "uint8x32", "ALTIVEC", 2, false },
+        { "bit_xor", "uint8x32", "AVX", 2, false },
+        { "bit_xor", "uint8x32", "NEON", 2, false },
+        { "bit_xor", "uint8x32", "SSE2", 2, false },
+        { "bit_xor", "uint8x32", "SSE3", 2, false },
+        { "bit_xor", "uint8x32", "SSE4.1", 2, false },
+        { "bit_xor", "uint8x32", "SSSE3", 2, false },
+        { "blend", "float32x4", "ALTIVEC", 0, true },
+        { "blend", "float32x4", "AVX", 3, false },
+        { "blend", "float32x4", "NEON", 0, true },
+        { "blend", "float32x4", "SSE2", 3, false },
+        { "blend", "float32x4", "SSE3", 3, false },
+        { "blend", "float32x4", "SSE4.1", 3, false },
+        { "blend", "float32x4", "SSSE3", 3, false },
+        { "blend", "float32x8", "ALTIVEC", 0, true },
+        { "blend", "float32x8", "AVX", 6, false },
+        { "blend", "float32x8", "NEON", 0, true },
+        { "blend", "float32x8", "SSE2", 6, false },
+        { "blend", "float32x8", "SSE3", 6, false },
+        { "blend", "float32x8", "SSE4.1", 6, false },
+        { "blend", "float32x8", "SSSE3", 6, false },
+        { "blend", "float64x2", "ALTIVEC", 0, true },
+        { "blend", "float64x2", "AVX", 3, false },
+        { "blend", "float64x2", "NEON", 0, true },
+        { "blend", "float64x2", "SSE2", 3, false },
+        { "blend", "float64x2", "SSE3", 3, false },
+        { "blend", "float64x2", "SSE4.1", 3, false },
+        { "blend", "float64x2", "SSSE3", 3, false },
+        { "blend", "float64x4", "ALTIVEC", 0, true },
+        { "blend", "float64x4", "AVX", 6, false },
+        { "blend", "float64x4", "NEON", 0, true },
+        { "blend", "float64x4", "SSE2", 6, false },
+        { "blend", "float64x4", "SSE3", 6, false },
+        { "blend", "float64x4", "SSE4.1", 6, false },
+        { "blend", "float64x4", "SSSE3", 6, false },
+        { "blend", "int16x16", "ALTIVEC", 0, true },
+        { "blend", "int16x16", "AVX", 6, false },
+        { "blend", "int16x16", "NEON", 0, true },
+        { "blend", "int16x16", "SSE2", 6, false },
+        { "blend", "int16x16", "SSE3", 6, false },
+        { "blend", "int16x16", "SSE4.1", 6, false },
+        { "blend", "int16x16", "SSSE3", 6, false },
+        { "blend", "int16x8", "ALTIVEC", 0, true },
+        { "blend", "int16x8", "AVX", 3, false },
+        { "blend", "int16x8", "NEON", 0, true },
+        { "blend", "int16x8", "SSE2", 3, false },
+        { "blend", "int16x8", "SSE3", 3, false },
+        { "blend", "int16x8", "SSE4.1", 3, false },
+        { "blend", "int16x8", "SSSE3", 3, false },
+        { "blend", "int32x4", "ALTIVEC", 0, true },
+        { "blend", "int32x4", "AVX", 3, false },
+        { "blend", "int32x4", "NEON", 0, true },
+        { "blend", "int32x4", "SSE2", 3, false },
+        { "blend", "int32x4", "SSE3", 3, false },
+        { "blend", "int32x4", "SSE4.1", 3, false },
+        { "blend", "int32x4", "SSSE3", 3, false },
+        { "blend", "int32x8", "ALTIVEC", 0, true },
+        { "blend", "int32x8", "AVX", 6, false },
+        { "blend", "int32x8", "NEON", 0, true },
+        { "blend", "int32x8", "SSE2", 6, false },
+        { "blend", "int32x8", "SSE3", 6, false },
+        { "blend", "int32x8", "SSE4.1", 6, false },
+        { "blend", "int32x8", "SSSE3", 6, false },
+        { "blend", "int64x2", "ALTIVEC", 0, true },
+        { "blend", "int64x2", "AVX", 3, false },
+        { "blend", "int64x2", "NEON", 0, true },
+        { "blend", "int64x2", "SSE2", 3, false },
+        { "blend", "int64x2", "SSE3", 3, false },
+        { "blend", "int64x2", "SSE4.1", 3, false },
+        { "blend", "int64x2", "SSSE3", 3, false },
+        { "blend", "int64x4", "ALTIVEC", 0, true },
+        { "blend", "int64x4", "AVX", 6, false },
+        { "blend", "int64x4", "NEON", 0, true },
+        { "blend", "int64x4", "SSE2", 6, false },
+        { "blend", "int64x4", "SSE3", 6, false },
+        { "blend", "int64x4", "SSE4.1", 6, false },
+        { "blend", "int64x4", "SSSE3", 6, false },
+        { "blend", "int8x16", "ALTIVEC", 0, true },
+        { "blend", "int8x16", "AVX", 3, false },
+        { "blend", "int8x16", "NEON", 0, true },
+        { "blend", "int8x16", "SSE2", 3, false },
+        { "blend", "int8x16", "SSE3", 3, false },
+        { "blend", "int8x16", "SSE4.1", 3, false },
+        { "blend", "int8x16", "SSSE3", 3, false },
+        { "blend", "int8x32", "ALTIVEC", 0, true },
+        { "blend", "int8x32", "AVX", 6, false },
+        { "blend", "int8x32", "NEON", 0, true },
+        { "blend", "int8x32", "SSE2", 6, false },
+        { "blend", "int8x32", "SSE3", 6, false },
+        { "blend", "int8x32", "SSE4.1", 6, false },
+        { "blend", "int8x32", "SSSE3", 6, false },
+        { "blend", "uint16x16", "ALTIVEC", 0, true },
+        { "blend", "uint16x16", "AVX", 6, false },
+        { "blend", "uint16x16", "NEON", 0, true },
+        { "blend", "uint16x16", "SSE2", 6, false },
+        { "blend", "uint16x16", "SSE3", 6, false },
+        { "blend", "uint16x16", "SSE4.1", 6, false },
+        { "blend", "uint16x16", "SSSE3", 6, false },
+        { "blend", "uint16x8", "ALTIVEC", 0, true },
+        { "blend", "uint16x8", "AVX", 3, false },
+        { "blend", "uint16x8", "NEON", 0, true },
+        { "blend", "uint16x8", "SSE2", 3, false },
+        { "blend", "uint16x8", "SSE3", 3, false },
+        { "blend", "uint16x8", "SSE4.1", 3, false },
+        { "blend", "uint16x8", "SSSE3", 3, false },
+        { "blend", "uint32x4", "ALTIVEC", 0, true },
+        { "blend", "uint32x4", "AVX", 3, false },
+        { "blend", "uint32x4", "NEON", 0, true },
+        { "blend", "uint32x4", "SSE2", 3, false },
+        { "blend", "uint32x4", "SSE3", 3, false },
+        { "blend", "uint32x4", "SSE4.1", 3, false },
+        { "blend", "uint32x4", "SSSE3", 3, false },
+        { "blend", "uint32x8", "ALTIVEC", 0, true },
+        { "blend", "uint32x8", "AVX", 6, false },
+        { "blend", "uint32x8", "NEON", 0, true },
+        { "blend", "uint32x8", "SSE2", 6, false },
+        { "blend", "uint32x8", "SSE3", 6, false },
+        { "blend", "uint32x8", "SSE4.1", 6, false },
+        { "blend", "uint32x8", "SSSE3", 6, false },
+        { "blend", "uint64x2", "ALTIVEC", 0, true },
+        { "blend", "uint64x2", "AVX", 3, false },
+        { "blend", "uint64x2", "NEON", 0, true },
+        { "blend", "uint64x2", "SSE2", 3, false },
+        { "blend", "uint64x2", "SSE3", 3, false },
+        { "blend", "uint64x2", "SSE4.1", 3, false },
+        { "blend", "uint64x2", "SSSE3", 3, false },
+        { "blend", "uint64x4", "ALTIVEC", 0, true },
+        { "blend", "uint64x4", "AVX", 6, false },
+        { "blend", "uint64x4", "NEON", 0, true },
+        { "blend", "uint64x4", "SSE2", 6, false },
+        { "blend", "uint64x4", "SSE3", 6, false },
+        { "blend", "uint64x4", "SSE4.1", 6, false },
+        { "blend", "uint64x4", "SSSE3", 6, false },
+        { "blend", "uint8x16", "ALTIVEC", 0, true },
+        { "blend", "uint8x16", "AVX", 3, false },
+        { "blend", "uint8x16", "NEON", 0, true },
+        { "blend", "uint8x16", "SSE2", 3, false },
+        { "blend", "uint8x16", "SSE3", 3, false },
+        { "blend", "uint8x16", "SSE4.1", 3, false },
+        { "blend", "uint8x16", "SSSE3", 3, false },
+        { "blend", "uint8x32", "ALTIVEC", 0, true },
+        { "blend", "uint8x32", "AVX", 6, false },
+        { "blend", "uint8x32", "NEON", 0, true },
+        { "blend", "uint8x32", "SSE2", 6, false },
+        { "blend", "uint8x32", "SSE3", 6, false },
+        { "blend", "uint8x32", "SSE4.1", 6, false },
+        { "blend", "uint8x32", "SSSE3", 6, false },
+        { "ceil", "float32x4", "NEON", 13, false },
+        { "ceil", "float32x4", "SSE2", 15, false },
+        { "ceil", "float32x4", "SSE3", 15, false },
+        { "ceil", "float32x4", "SSSE3", 15, false },
+        { "ceil", "float32x8", "ALTIVEC", 2, false },
+        { "ceil", "float32x8", "NEON", 24, false },
+        { "ceil", "float32x8", "SSE2", 28, false },
+        { "ceil", "float32x8", "SSE3", 28, false },
+        { "ceil", "float32x8", "SSSE3", 28, false },
+        { "cmp_eq", "float32x8", "ALTIVEC", 2, false },
+        { "cmp_eq", "float32x8", "NEON", 2, false },
+        { "cmp_eq", "float32x8", "SSE2", 2, false },
+        { "cmp_eq", "float32x8", "SSE3", 2, false },
+        { "cmp_eq", "float32x8", "SSE4.1", 2, false },
+        { "cmp_eq", "float32x8", "SSSE3", 2, false },
+        { "cmp_eq", "float64x2", "ALTIVEC", 0, true },
+        { "cmp_eq", "float64x2", "NEON", 0, true },
+        { "cmp_eq", "float64x4", "ALTIVEC", 0, true },
+        { "cmp_eq", "float64x4", "NEON", 0, true },
+        { "cmp_eq", "float64x4", "SSE2", 2, false },
+        { "cmp_eq", "float64x4", "SSE3", 2, false },
+        { "cmp_eq", "float64x4", "SSE4.1", 2, false },
+        { "cmp_eq", "float64x4", "SSSE3", 2, false },
+        { "cmp_eq", "int16x16", "ALTIVEC", 2, false },
+        { "cmp_eq", "int16x16", "AVX", 2, false },
+        { "cmp_eq", "int16x16", "NEON", 2, false },
+        { "cmp_eq", "int16x16", "SSE2", 2, false },
+        { "cmp_eq", "int16x16", "SSE3", 2, false },
+        { "cmp_eq", "int16x16", "SSE4.1", 2, false },
+        { "cmp_eq", "int16x16", "SSSE3", 2, false },
+        { "cmp_eq", "int32x8", "ALTIVEC", 2, false },
+        { "cmp_eq", "int32x8", "AVX", 2, false },
+        { "cmp_eq", "int32x8", "NEON", 2, false },
+        { "cmp_eq", "int32x8", "SSE2", 2, false },
+        { "cmp_eq", "int32x8", "SSE3", 2, false },
+        { "cmp_eq", "int32x8", "SSE4.1", 2, false },
+        { "cmp_eq", "int32x8", "SSSE3", 2, false },
+        { "cmp_eq", "int64x2", "ALTIVEC", 4, false },
+        { "cmp_eq", "int64x2", "NEON", 3, false },
+        { "cmp_eq", "int64x2", "SSE2", 5, false },
+        { "cmp_eq", "int64x2", "SSE3", 5, false },
+        { "cmp_eq", "int64x2", "SSSE3", 5, false },
+        { "cmp_eq", "int64x4", "ALTIVEC", 7, false },
+        { "cmp_eq", "int64x4", "AVX", 10, false },
+        { "cmp_eq", "int64x4", "NEON", 6, false },
+        { "cmp_eq", "int64x4", "SSE2", 10, false },
+        { "cmp_eq", "int64x4", "SSE3", 10, false },
+        { "cmp_eq", "int64x4", "SSE4.1", 2, false },
+        { "cmp_eq", "int64x4", "SSSE3", 10, false },
+        { "cmp_eq", "int8x32", "ALTIVEC", 2, false },
+        { "cmp_eq", "int8x32", "AVX", 2, false },
+        { "cmp_eq", "int8x32", "NEON", 2, false },
+        { "cmp_eq", "int8x32", "SSE2", 2, false },
+        { "cmp_eq", "int8x32", "SSE3", 2, false },
+        { "cmp_eq", "int8x32", "SSE4.1", 2, false },
+        { "cmp_eq", "int8x32", "SSSE3", 2, false },
+        { "cmp_eq", "uint16x16", "ALTIVEC", 2, false },
+        { "cmp_eq", "uint16x16", "AVX", 2, false },
+        { "cmp_eq", "uint16x16", "NEON", 2, false },
+        { "cmp_eq", "uint16x16", "SSE2", 2, false },
+        { "cmp_eq", "uint16x16", "SSE3", 2, false },
+        { "cmp_eq", "uint16x16", "SSE4.1", 2, false },
+        { "cmp_eq", "uint16x16", "SSSE3", 2, false },
+        { "cmp_eq", "uint32x8", "ALTIVEC", 2, false },
+        { "cmp_eq", "uint32x8", "AVX", 2, false },
+        { "cmp_eq", "uint32x8", "NEON", 2, false },
+        { "cmp_eq", "uint32x8", "SSE2", 2, false },
+        { "cmp_eq", "uint32x8", "SSE3", 2, false },
+        { "cmp_eq", "uint32x8", "SSE4.1", 2, false },
+        { "cmp_eq", "uint32x8", "SSSE3", 2, false },
+        { "cmp_eq", "uint64x2", "ALTIVEC", 4, false },
+        { "cmp_eq", "uint64x2", "NEON", 3, false },
+        { "cmp_eq", "uint64x2", "SSE2", 5, false },
+        { "cmp_eq", "uint64x2", "SSE3", 5, false },
+        { "cmp_eq", "uint64x2", "SSSE3", 5, false },
+        { "cmp_eq", "uint64x4", "ALTIVEC", 7, false },
+        { "cmp_eq", "uint64x4", "AVX", 10, false },
+        { "cmp_eq", "uint64x4", "NEON", 6, false },
+        { "cmp_eq", "uint64x4", "SSE2", 10, false },
+        { "cmp_eq", "uint64x4", "SSE3", 10, false },
+        { "cmp_eq", "uint64x4", "SSE4.1", 2, false },
+        { "cmp_eq", "uint64x4", "SSSE3", 10, false },
+        { "cmp_eq", "uint8x32", "ALTIVEC", 2, false },
+        { "cmp_eq", "uint8x32", "AVX", 2, false },
+        { "cmp_eq", "uint8x32", "NEON", 2, false },
+        { "cmp_eq", "uint8x32", "SSE2", 2, false },
+        { "cmp_eq", "uint8x32", "SSE3", 2, false },
+        { "cmp_eq", "uint8x32", "SSE4.1", 2, false },
+        { "cmp_eq", "uint8x32", "SSSE3", 2, false },
+        { "cmp_ge", "float32x8", "ALTIVEC", 2, false },
+        { "cmp_ge", "float32x8", "NEON", 2, false },
+        { "cmp_ge", "float32x8", "SSE2", 2, false },
+        { "cmp_ge", "float32x8", "SSE3", 2, false },
+        { "cmp_ge", "float32x8", "SSE4.1", 2, false },
+        { "cmp_ge", "float32x8", "SSSE3", 2, false },
+        { "cmp_ge", "float64x2", "ALTIVEC", 0, true },
+        { "cmp_ge", "float64x2", "NEON", 0, true },
+        { "cmp_ge", "float64x4", "ALTIVEC", 0, true },
+        { "cmp_ge", "float64x4", "NEON", 0, true },
+        { "cmp_ge", "float64x4", "SSE2", 2, false },
+        { "cmp_ge", "float64x4", "SSE3", 2, false },
+        { "cmp_ge", "float64x4", "SSE4.1", 2, false },
+        { "cmp_ge", "float64x4", "SSSE3", 2, false },
+        { "cmp_gt", "float32x8", "ALTIVEC", 2, false },
+        { "cmp_gt", "float32x8", "NEON", 2, false },
+        { "cmp_gt", "float32x8", "SSE2", 2, false },
+        { "cmp_gt", "float32x8", "SSE3", 2, false },
+        { "cmp_gt", "float32x8", "SSE4.1", 2, false },
+        { "cmp_gt", "float32x8", "SSSE3", 2, false },
+        { "cmp_gt", "float64x2", "ALTIVEC", 0, true },
+        { "cmp_gt", "float64x2", "NEON", 0, true },
+        { "cmp_gt", "float64x4", "ALTIVEC", 0, true },
+        { "cmp_gt", "float64x4", "NEON", 0, true },
+        { "cmp_gt", "float64x4", "SSE2", 2, false },
+        { "cmp_gt", "float64x4", "SSE3", 2, false },
+        { "cmp_gt", "float64x4", "SSE4.1", 2, false },
+        { "cmp_gt", "float64x4", "SSSE3", 2, false },
+        { "cmp_gt", "int16x16", "ALTIVEC", 2, false },
+        { "cmp_gt", "int16x16", "AVX", 2, false },
+        { "cmp_gt", "int16x16", "NEON", 2, false },
+        { "cmp_gt", "int16x16", "SSE2", 2, false },
+        { "cmp_gt", "int16x16", "SSE3", 2, false },
+        { "cmp_gt", "int16x16", "SSE4.1", 2, false },
+        { "cmp_gt", "int16x16", "SSSE3", 2, false },
+        { "cmp_gt", "int32x8", "ALTIVEC", 2, false },
+        { "cmp_gt", "int32x8", "AVX", 2, false },
+        { "cmp_gt", "int32x8", "NEON", 2, false },
+        { "cmp_gt", "int32x8", "SSE2", 2, false },
+        { "cmp_gt", "int32x8", "SSE3", 2, false },
+        { "cmp_gt", "int32x8", "SSE4.1", 2, false },
+        { "cmp_gt", "int32x8", "SSSE3", 2, false },
+        { "cmp_gt", "int8x32", "ALTIVEC", 2, false },
+        { "cmp_gt", "int8x32", "AVX", 2, false },
+        { "cmp_gt", "int8x32", "NEON", 2, false },
+        { "cmp_gt", "int8x32", "SSE2", 2, false },
+        { "cmp_gt", "int8x32", "SSE3", 2, false },
+        { "cmp_gt", "int8x32", "SSE4.1", 2, false },
+        { "cmp_gt", "int8x32", "SSSE3", 2, false },
+        { "cmp_gt", "uint16x16", "ALTIVEC", 2, false },
+        { "cmp_gt", "uint16x16", "AVX", 7, false },
+        { "cmp_gt", "uint16x16", "AVX2", 4, false },
+        { "cmp_gt", "uint16x16", "NEON", 2, false },
+        { "cmp_gt", "uint16x16", "SSE2", 7, false },
+        { "cmp_gt", "uint16x16", "SSE3", 7, false },
+        { "cmp_gt", "uint16x16", "SSE4.1", 7, false },
+        { "cmp_gt", "uint16x16", "SSSE3", 7, false },
+        { "cmp_gt", "uint16x8", "AVX", 4, false },
+        { "cmp_gt", "uint16x8", "AVX2", 4, false },
+        { "cmp_gt", "uint16x8", "SSE2", 4, false },
+        { "cmp_gt", "uint16x8", "SSE3", 4, false },
+        { "cmp_gt", "uint16x8", "SSE4.1", 4, false },
+        { "cmp_gt", "uint16x8", "SSSE3", 4, false },
+        { "cmp_gt", "uint32x4", "AVX", 4, false },
+        { "cmp_gt", "uint32x4", "AVX2", 4, false },
+        { "cmp_gt", "uint32x4", "SSE2", 4, false },
+        { "cmp_gt", "uint32x4", "SSE3", 4, false },
+        { "cmp_gt", "uint32x4", "SSE4.1", 4, false },
+        { "cmp_gt", "uint32x4", "SSSE3", 4, false },
+        { "cmp_gt", "uint32x8", "ALTIVEC", 2, false },
+        { "cmp_gt", "uint32x8", "AVX", 7, false },
+        { "cmp_gt", "uint32x8", "AVX2", 4, false },
+        { "cmp_gt", "uint32x8", "NEON", 2, false },
+        { "cmp_gt", "uint32x8", "SSE2", 7, false },
+        { "cmp_gt", "uint32x8", "SSE3", 7, false },
+        { "cmp_gt", "uint32x8", "SSE4.1", 7, false },
+        { "cmp_gt", "uint32x8", "SSSE3", 7, false },
+        { "cmp_gt", "uint8x16", "AVX", 4, false },
+        { "cmp_gt", "uint8x16", "AVX2", 4, false },
+        { "cmp_gt", "uint8x16", "SSE2", 4, false },
+        { "cmp_gt", "uint8x16", "SSE3", 4, false },
+        { "cmp_gt", "uint8x16", "SSE4.1", 4, false },
+        { "cmp_gt", "uint8x16", "SSSE3", 4, false },
+        { "cmp_gt", "uint8x32", "ALTIVEC", 2, false },
+        { "cmp_gt", "uint8x32", "AVX", 7, false },
+        { "cmp_gt", "uint8x32", "AVX2", 4, false },
+        { "cmp_gt", "uint8x32", "NEON", 2, false },
+        { "cmp_gt", "uint8x32", "SSE2", 7, false },
+        { "cmp_gt", "uint8x32", "SSE3", 7, false },
+        { "cmp_gt", "uint8x32", "SSE4.1", 7, false },
+        { "cmp_gt", "uint8x32", "SSSE3", 7, false },
+        { "cmp_le", "float32x8", "ALTIVEC", 2, false },
+        { "cmp_le", "float32x8", "AVX", 2, false },
+        { "cmp_le", "float32x8", "NEON", 2, false },
+        { "cmp_le", "float32x8", "SSE2", 2, false },
+        { "cmp_le", "float32x8", "SSE3", 2, false },
+        { "cmp_le", "float32x8", "SSE4.1", 2, false },
+        { "cmp_le", "float32x8", "SSSE3", 2, false },
+        { "cmp_le", "float64x2", "ALTIVEC", 0, true },
+        { "cmp_le", "float64x2", "NEON", 0, true },
+        { "cmp_le", "float64x4", "ALTIVEC", 0, true },
+        { "cmp_le", "float64x4", "NEON", 0, true },
+        { "cmp_le", "float64x4", "SSE2", 2, false },
+        { "cmp_le", "float64x4", "SSE3", 2, false },
+        { "cmp_le", "float64x4", "SSE4.1", 2, false },
+        { "cmp_le", "float64x4", "SSSE3", 2, false },
+        { "cmp_lt", "float32x8", "ALTIVEC", 2, false },
+        { "cmp_lt", "float32x8", "AVX", 2, false },
+        { "cmp_lt", "float32x8", "NEON", 2, false },
+        { "cmp_lt", "float32x8", "SSE2", 2, false },
+        { "cmp_lt", "float32x8", "SSE3", 2, false },
+        { "cmp_lt", "float32x8", "SSE4.1", 2, false },
+        { "cmp_lt", "float32x8", "SSSE3", 2, false },
+        { "cmp_lt", "float64x2", "ALTIVEC", 0, true },
+        { "cmp_lt", "float64x2", "NEON", 0, true },
+        { "cmp_lt", "float64x4", "ALTIVEC", 0, true },
+        { "cmp_lt", "float64x4", "NEON", 0, true },
+        { "cmp_lt", "float64x4", "SSE2", 2, false },
+        { "cmp_lt", "float64x4", "SSE3", 2, false },
+        { "cmp_lt", "float64x4", "SSE4.1", 2, false },
+        { "cmp_lt", "float64x4", "SSSE3", 2, false },
+        { "cmp_lt", "int16x16", "ALTIVEC", 2, false },
+        { "cmp_lt", "int16x16", "AVX", 2, false },
+        { "cmp_lt", "int16x16", "NEON", 2, false },
+        { "cmp_lt", "int16x16", "SSE2", 2, false },
+        { "cmp_lt", "int16x16", "SSE3", 2, false },
+        { "cmp_lt", "int16x16", "SSE4.1", 2, false },
+        { "cmp_lt", "int16x16", "SSSE3", 2, false },
+        { "cmp_lt", "int32x8", "ALTIVEC", 2, false },
+        { "cmp_lt", "int32x8", "AVX", 2, false },
+        { "cmp_lt", "int32x8", "NEON", 2, false },
+        { "cmp_lt", "int32x8", "SSE2", 2, false },
+        { "cmp_lt", "int32x8", "SSE3", 2, false },
+        { "cmp_lt", "int32x8", "SSE4.1", 2, false },
+        { "cmp_lt", "int32x8", "SSSE3", 2, false },
+        { "cmp_lt", "int8x32", "ALTIVEC", 2, false },
+        { "cmp_lt", "int8x32", "AVX", 2, false },
+        { "cmp_lt", "int8x32", "NEON", 2, false },
+        { "cmp_lt", "int8x32", "SSE2", 2, false },
+        { "cmp_lt", "int8x32", "SSE3", 2, false },
+        { "cmp_lt", "int8x32", "SSE4.1", 2, false },
+        { "cmp_lt", "int8x32", "SSSE3", 2, false },
+        { "cmp_lt", "uint16x16", "ALTIVEC", 2, false },
+        { "cmp_lt", "uint16x16", "AVX", 7, false },
+        { "cmp_lt", "uint16x16", "AVX2", 4, false },
+        { "cmp_lt", "uint16x16", "NEON", 2, false },
+        { "cmp_lt", "uint16x16", "SSE2", 7, false },
+        { "cmp_lt", "uint16x16", "SSE3", 7, false },
+        { "cmp_lt", "uint16x16", "SSE4.1", 7, false },
+        { "cmp_lt", "uint16x16", "SSSE3", 7, false },
+        { "cmp_lt", "uint16x8", "AVX", 4, false },
+        { "cmp_lt", "uint16x8", "AVX2", 4, false },
+        { "cmp_lt", "uint16x8", "SSE2", 4, false },
+        { "cmp_lt", "uint16x8", "SSE3", 4, false },
+        { "cmp_lt", "uint16x8", "SSE4.1", 4, false },
+        { "cmp_lt", "uint16x8", "SSSE3", 4, false },
+        { "cmp_lt", "uint32x4", "AVX", 4, false },
+        { "cmp_lt", "uint32x4", "AVX2", 4, false },
+        { "cmp_lt", "uint32x4", "SSE2", 4, false },
+        { "cmp_lt", "uint32x4", "SSE3", 4, false },
+        { "cmp_lt", "uint32x4", "SSE4.1", 4, false },
+        { "cmp_lt", "uint32x4", "SSSE3", 4, false },
+        { "cmp_lt", "uint32x8", "ALTIVEC", 2, false },
+        { "cmp_lt", "uint32x8", "AVX", 7, false },
+        { "cmp_lt", "uint32x8", "AVX2", 4, false },
+        { "cmp_lt", "uint32x8", "NEON", 2, false },
+        { "cmp_lt", "uint32x8", "SSE2", 7, false },
+        { "cmp_lt", "uint32x8", "SSE3", 7, false },
+        { "cmp_lt", "uint32x8", "SSE4.1", 7, false },
+        { "cmp_lt", "uint32x8", "SSSE3", 7, false },
+        { "cmp_lt", "uint8x16", "AVX", 4, false },
+        { "cmp_lt", "uint8x16", "AVX2", 4, false },
+        { "cmp_lt", "uint8x16", "SSE2", 4, false },
+        { "cmp_lt", "uint8x16", "SSE3", 4, false },
+        { "cmp_lt", "uint8x16", "SSE4.1", 4, false },
+        { "cmp_lt", "uint8x16", "SSSE3", 4, false },
+        { "cmp_lt", "uint8x32", "ALTIVEC", 2, false },
+        { "cmp_lt", "uint8x32", "AVX", 7, false },
+        { "cmp_lt", "uint8x32", "AVX2", 4, false },
+        { "cmp_lt", "uint8x32", "NEON", 2, false },
+        { "cmp_lt", "uint8x32", "SSE2", 7, false },
+        { "cmp_lt", "uint8x32", "SSE3", 7, false },
+        { "cmp_lt", "uint8x32", "SSE4.1", 7, false },
+        { "cmp_lt", "uint8x32", "SSSE3", 7, false },
+        { "cmp_neq", "float32x4", "ALTIVEC", 2, false },
+        { "cmp_neq", "float32x4", "NEON", 2, false },
+        { "cmp_neq", "float32x8", "ALTIVEC", 4, false },
+        { "cmp_neq", "float32x8", "NEON", 4, false },
+        { "cmp_neq", "float32x8", "SSE2", 2, false },
+        { "cmp_neq", "float32x8", "SSE3", 2, false },
+        { "cmp_neq", "float32x8", "SSE4.1", 2, false },
+        { "cmp_neq", "float32x8", "SSSE3", 2, false },
+        { "cmp_neq", "float64x2", "ALTIVEC", 0, true },
+        { "cmp_neq", "float64x2", "NEON", 0, true },
+        { "cmp_neq", "float64x4", "ALTIVEC", 0, true },
+        { "cmp_neq", "float64x4", "NEON", 0, true },
+        { "cmp_neq", "float64x4", "SSE2", 2, false },
+        { "cmp_neq", "float64x4", "SSE3", 2, false },
+        { "cmp_neq", "float64x4", "SSE4.1", 2, false },
+        { "cmp_neq", "float64x4", "SSSE3", 2, false },
+        { "cmp_neq", "int16x16", "ALTIVEC", 4, false },
+        { "cmp_neq", "int16x16", "AVX", 4, false },
+        { "cmp_neq", "int16x16", "AVX2", 2, false },
+        { "cmp_neq", "int16x16", "NEON", 4, false },
+        { "cmp_neq", "int16x16", "SSE2", 4, false },
+        { "cmp_neq", "int16x16", "SSE3", 4, false },
+        { "cmp_neq", "int16x16", "SSE4.1", 4, false },
+        { "cmp_neq", "int16x16", "SSSE3", 4, false },
+        { "cmp_neq", "int16x8", "ALTIVEC", 2, false },
+        { "cmp_neq", "int16x8", "AVX", 2, false },
+        { "cmp_neq", "int16x8", "NEON", 2, false },
+        { "cmp_neq", "int16x8", "SSE2", 2, false },
+        { "cmp_neq", "int16x8", "SSE3", 2, false },
+        { "cmp_neq", "int16x8", "SSE4.1", 2, false },
+        { "cmp_neq", "int16x8", "SSSE3", 2, false },
+        { "cmp_neq", "int32x4", "ALTIVEC", 2, false },
+        { "cmp_neq", "int32x4", "AVX", 2, false },
+        { "cmp_neq", "int32x4", "NEON", 2, false },
+        { "cmp_neq", "int32x4", "SSE2", 2, false },
+        { "cmp_neq", "int32x4", "SSE3", 2, false },
+        { "cmp_neq", "int32x4", "SSE4.1", 2, false },
+        { "cmp_neq", "int32x4", "SSSE3", 2, false },
+        { "cmp_neq", "int32x8", "ALTIVEC", 4, false },
+        { "cmp_neq", "int32x8", "AVX", 4, false },
+        { "cmp_neq", "int32x8", "AVX2", 2, false },
+        { "cmp_neq", "int32x8", "NEON", 4, false },
+        { "cmp_neq", "int32x8", "SSE2", 4, false },
+        { "cmp_neq", "int32x8", "SSE3", 4, false },
+        { "cmp_neq", "int32x8", "SSE4.1", 4, false },
+        { "cmp_neq", "int32x8", "SSSE3", 4, false },
+        { "cmp_neq", "int64x2", "ALTIVEC", 5, false },
+        { "cmp_neq", "int64x2", "AVX", 2, false },
+        { "cmp_neq", "int64x2", "NEON", 4, false },
+        { "cmp_neq", "int64x2", "SSE2", 5, false },
+        { "cmp_neq", "int64x2", "SSE3", 5, false },
+        { "cmp_neq", "int64x2", "SSE4.1", 2, false },
+        { "cmp_neq", "int64x2", "SSSE3", 5, false },
+        { "cmp_neq", "int64x4", "ALTIVEC", 8, false },
+        { "cmp_neq", "int64x4", "AVX", 10, false },
+        { "cmp_neq", "int64x4", "AVX2", 2, false },
+        { "cmp_neq", "int64x4", "NEON", 8, false },
+        { "cmp_neq", "int64x4", "SSE2", 10, false },
+        { "cmp_neq", "int64x4", "SSE3", 10, false },
+        { "cmp_neq", "int64x4", "SSE4.1", 4, false },
+        { "cmp_neq", "int64x4", "SSSE3", 10, false },
+        { "cmp_neq", "int8x16", "ALTIVEC", 2, false },
+        { "cmp_neq", "int8x16", "AVX", 2, false },
+        { "cmp_neq", "int8x16", "NEON", 2, false },
+        { "cmp_neq", "int8x16", "SSE2", 2, false },
+        { "cmp_neq", "int8x16", "SSE3", 2, false },
+        { "cmp_neq", "int8x16", "SSE4.1", 2, false },
+        { "cmp_neq", "int8x16", "SSSE3", 2, false },
+        { "cmp_neq", "int8x32", "ALTIVEC", 4, false },
+        { "cmp_neq", "int8x32", "AVX", 4, false },
+        { "cmp_neq", "int8x32", "AVX2", 2, false },
+        { "cmp_neq", "int8x32", "NEON", 4, false },
+        { "cmp_neq", "int8x32", "SSE2", 4, false },
+        { "cmp_neq", "int8x32", "SSE3", 4, false },
+        { "cmp_neq", "int8x32", "SSE4.1", 4, false },
+        { "cmp_neq", "int8x32", "SSSE3", 4, false },
+        { "cmp_neq", "uint16x16", "ALTIVEC", 4, false },
+        { "cmp_neq", "uint16x16", "AVX", 4, false },
+        { "cmp_neq", "uint16x16", "AVX2", 2, false },
+        { "cmp_neq", "uint16x16", "NEON", 4, false },
+        { "cmp_neq", "uint16x16", "SSE2", 4, false },
+        { "cmp_neq", "uint16x16", "SSE3", 4, false },
+        { "cmp_neq", "uint16x16", "SSE4.1", 4, false },
+        { "cmp_neq", "uint16x16", "SSSE3", 4, false },
+        { "cmp_neq", "uint16x8", "ALTIVEC", 2, false },
+        { "cmp_neq", "uint16x8", "AVX", 2, false },
+        { "cmp_neq", "uint16x8", "NEON", 2, false },
+        { "cmp_neq", "uint16x8", "SSE2", 2, false },
+        { "cmp_neq", "uint16x8", "SSE3", 2, false },
+        { "cmp_neq", "uint16x8", "SSE4.1", 2, false },
+        { "cmp_neq", "uint16x8", "SSSE3", 2, false },
+        { "cmp_neq", "uint32x4", "ALTIVEC", 2, false },
+        { "cmp_neq", "uint32x4", "AVX", 2, false },
+        { "cmp_neq", "uint32x4", "NEON", 2, false },
+        { "cmp_neq", "uint32x4", "SSE2", 2, false },
+        { "cmp_neq", "uint32x4", "SSE3", 2, false },
+        { "cmp_neq", "uint32x4", "SSE4.1", 2, false },
+        { "cmp_neq", "uint32x4", "SSSE3", 2, false },
+        { "cmp_neq", "uint32x8", "ALTIVEC", 4, false },
+        { "cmp_neq", "uint32x8", "AVX", 4, false },
+        { "cmp_neq", "uint32x8", "AVX2", 2, false },
+        { "cmp_neq", "uint32x8", "NEON", 4, false },
+        { "cmp_neq", "uint32x8", "SSE2", 4, false },
+        { "cmp_neq", "uint32x8", "SSE3", 4, false },
+        { "cmp_neq", "uint32x8", "SSE4.1", 4, false },
+        { "cmp_neq", "uint32x8", "SSSE3", 4, false },
+        { "cmp_neq", "uint64x2", "ALTIVEC", 5, false },
+        { "cmp_neq", "uint64x2", "AVX", 2, false },
+        { "cmp_neq", "uint64x2", "NEON", 4, false },
+        { "cmp_neq", "uint64x2", "SSE2", 5, false },
+        { "cmp_neq", "uint64x2", "SSE3", 5, false },
+        { "cmp_neq", "uint64x2", "SSE4.1", 2, false },
+        { "cmp_neq", "uint64x2", "SSSE3", 5, false },
+        { "cmp_neq", "uint64x4", "ALTIVEC", 8, false },
+        { "cmp_neq", "uint64x4", "AVX", 10, false },
+        { "cmp_neq", "uint64x4", "AVX2", 2, false },
+        { "cmp_neq", "uint64x4", "NEON", 8, false },
+        { "cmp_neq", "uint64x4", "SSE2", 10, false },
+        { "cmp_neq", "uint64x4", "SSE3", 10, false },
+        { "cmp_neq", "uint64x4", "SSE4.1", 4, false },
+        { "cmp_neq", "uint64x4", "SSSE3", 10, false },
+        { "cmp_neq", "uint8x16", "ALTIVEC", 2, false },
+        { "cmp_neq", "uint8x16", "AVX", 2, false },
+        { "cmp_neq", "uint8x16", "NEON", 2, false },
+        { "cmp_neq", "uint8x16", "SSE2", 2, false },
+        { "cmp_neq", "uint8x16", "SSE3", 2, false },
+        { "cmp_neq", "uint8x16", "SSE4.1", 2, false },
+        { "cmp_neq", "uint8x16", "SSSE3", 2, false },
+        { "cmp_neq", "uint8x32", "ALTIVEC", 4, false },
+        { "cmp_neq", "uint8x32", "AVX", 4, false },
+        { "cmp_neq", "uint8x32", "AVX2", 2, false },
+        { "cmp_neq", "uint8x32", "NEON", 4, false },
+        { "cmp_neq", "uint8x32", "SSE2", 4, false },
+        { "cmp_neq", "uint8x32", "SSE3", 4, false },
+        { "cmp_neq", "uint8x32", "SSE4.1", 4, false },
+        { "cmp_neq", "uint8x32", "SSSE3", 4, false },
+        { "combine", "float32x4", "ALTIVEC", 0, false },
+        { "combine", "float32x4", "AVX", 0, false },
+        { "combine", "float32x4", "AVX2", 1, false },
+        { "combine", "float32x4", "NEON", 0, false },
+        { "combine", "float32x4", "SSE2", 0, false },
+        { "combine", "float32x4", "SSE3", 0, false },
+        { "combine", "float32x4", "SSE4.1", 0, false },
+        { "combine", "float32x4", "SSSE3", 0, false },
+        { "combine", "float64x2", "ALTIVEC", 0, false },
+        { "combine", "float64x2", "AVX", 0, false },
+        { "combine", "float64x2", "AVX2", 1, false },
+        { "combine", "float64x2", "NEON", 0, false },
+        { "combine", "float64x2", "SSE2", 0, false },
+        { "combine", "float64x2", "SSE3", 0, false },
+        { "combine", "float64x2", "SSE4.1", 0, false },
+        { "combine", "float64x2", "SSSE3", 0, false },
+        { "combine", "uint16x8", "ALTIVEC", 0, false },
+        { "combine", "uint16x8", "AVX", 0, false },
+        { "combine", "uint16x8", "AVX2", 1, false },
+        { "combine", "uint16x8", "NEON", 0, false },
+        { "combine", "uint16x8", "SSE2", 0, false },
+        { "combine", "uint16x8", "SSE3", 0, false },
+        { "combine", "uint16x8", "SSE4.1", 0, false },
+        { "combine", "uint16x8", "SSSE3", 0, false },
+        { "combine", "uint32x4", "ALTIVEC", 0, false },
+        { "combine", "uint32x4", "AVX", 0, false },
+        { "combine", "uint32x4", "AVX2", 1, false },
+        { "combine", "uint32x4", "NEON", 0, false },
+        { "combine", "uint32x4", "SSE2", 0, false },
+        { "combine", "uint32x4", "SSE3", 0, false },
+        { "combine", "uint32x4", "SSE4.1", 0, false },
+        { "combine", "uint32x4", "SSSE3", 0, false },
+        { "combine", "uint64x2", "ALTIVEC", 0, false },
+        { "combine", "uint64x2", "AVX", 0, false },
+        { "combine", "uint64x2", "AVX2", 1, false },
+        { "combine", "uint64x2", "NEON", 0, false },
+        { "combine", "uint64x2", "SSE2", 0, false },
+        { "combine", "uint64x2", "SSE3", 0, false },
+        { "combine", "uint64x2", "SSE4.1", 0, false },
+        { "combine", "uint64x2", "SSSE3", 0, false },
+        { "combine", "uint8x16", "ALTIVEC", 0, false },
+        { "combine", "uint8x16", "AVX", 0, false },
+        { "combine", "uint8x16", "AVX2", 1, false },
+        { "combine", "uint8x16", "NEON", 0, false },
+        { "combine", "uint8x16", "SSE2", 0, false },
+        { "combine", "uint8x16", "SSE3", 0, false },
+        { "combine", "uint8x16", "SSE4.1", 0, false },
+        { "combine", "uint8x16", "SSSE3", 0, false },
+        { "compress", "float32x4", "ALTIVEC", 0, true },
+        { "compress", "float32x4", "NEON", 0, true },
+        { "compress", "float32x4", "SSE2", 0, true },
+        { "compress", "float64x2", "ALTIVEC", 0, true },
+        { "compress", "float64x2", "NEON", 0, true },
+        { "compress", "float64x2", "SSE2", 0, true },
+        { "compress", "int16x8", "ALTIVEC", 0, true },
+        { "compress", "int16x8", "NEON", 0, true },
+        { "compress", "int16x8", "SSE2", 0, true },
+        { "compress", "int32x4", "ALTIVEC", 0, true },
+        { "compress", "int32x4", "NEON", 0, true },
+        { "compress", "int32x4", "SSE2", 0, true },
+        { "compress", "int64x2", "ALTIVEC", 0, true },
+        { "compress", "int64x2", "NEON", 0, true },
+        { "compress", "int64x2", "SSE2", 0, true },
+        { "compress", "int8x16", "ALTIVEC", 0, true },
+        { "compress", "int8x16", "NEON", 0, true },
+        { "compress", "int8x16", "SSE2", 0, true },
+        { "compress", "uint16x8", "ALTIVEC", 0, true },
+        { "compress", "uint16x8", "NEON", 0, true },
+        { "compress", "uint16x8", "SSE2", 0, true },
+        { "compress", "uint32x4", "ALTIVEC", 0, true },
+        { "compress", "uint32x4", "NEON", 0, true },
+        { "compress", "uint32x4", "SSE2", 0, true },
+        { "compress", "uint64x2", "ALTIVEC", 0, true },
+        { "compress", "uint64x2", "NEON", 0, true },
+        { "compress", "uint64x2", "SSE2", 0, true },
+        { "compress", "uint8x16", "ALTIVEC", 0, true },
+        { "compress", "uint8x16", "NEON", 0, true },
+        { "compress", "uint8x16", "SSE2", 0, true },
+        { "div", "float32x4", "ALTIVEC", 10, false },
+        { "div", "float32x4", "NEON", 6, false },
+        { "div", "float32x8", "ALTIVEC", 19, false },
+        { "div", "float32x8", "NEON", 12, false },
+        { "div", "float32x8", "SSE2", 2, false },
+        { "div", "float32x8", "SSE3", 2, false },
+        { "div", "float32x8", "SSE4.1", 2, false },
+        { "div", "float32x8", "SSSE3", 2, false },
+        { "div", "float64x2", "ALTIVEC", 0, true },
+        { "div", "float64x2", "NEON", 0, true },
+        { "div", "float64x4", "ALTIVEC", 0, true },
+        { "div", "float64x4", "NEON", 0, true },
+        { "div", "float64x4", "SSE2", 2, false },
+        { "div", "float64x4", "SSE3", 2, false },
+        { "div", "float64x4", "SSE4.1", 2, false },
+        { "div", "float64x4", "SSSE3", 2, false },
+        { "extract", "float32x4", "ALTIVEC", 2, false },
+        { "extract", "float32x4", "SSE2", 2, false },
+        { "extract", "float32x4", "SSE3", 2, false },
+        { "extract", "float32x4", "SSSE3", 2, false },
+        { "extract", "float64x2", "ALTIVEC", 2, false },
+        { "extract", "float64x2", "NEON", 2, false },
+        { "extract", "int16x8", "ALTIVEC", 2, false },
+        { "extract", "int32x4", "ALTIVEC", 2, false },
+        { "extract", "int32x4", "SSE2", 2, false },
+        { "extract", "int32x4", "SSE3", 2, false },
+        { "extract", "int32x4", "SSSE3", 2, false },
+        { "extract", "int64x2", "ALTIVEC", 2, false },
+        { "extract", "int64x2", "SSE2", 2, false },
+        { "extract", "int64x2", "SSE3", 2, false },
+        { "extract", "int64x2", "SSE4.1", 1, false },
+        { "extract", "int64x2", "SSSE3", 2, false },
+        { "extract", "int8x16", "ALTIVEC", 2, false },
+        { "extract", "int8x16", "AVX", 1, false },
+        { "extract", "int8x16", "SSE2", 2, false },
+        { "extract", "int8x16", "SSE3", 2, false },
+        { "extract", "int8x16", "SSE4.1", 1, false },
+        { "extract", "int8x16", "SSSE3", 2, false },
+        { "extract", "uint16x8", "ALTIVEC", 2, false },
+        { "extract", "uint32x4", "ALTIVEC", 2, false },
+        { "extract", "uint32x4", "SSE2", 2, false },
+        { "extract", "uint32x4", "SSE3", 2, false },
+        { "extract", "uint32x4", "SSSE3", 2, false },
+        { "extract", "uint64x2", "ALTIVEC", 2, false },
+        { "extract", "uint64x2", "SSE2", 2, false },
+        { "extract", "uint64x2", "SSE3", 2, false },
+        { "extract", "uint64x2", "SSE4.1", 1, false },
+        { "extract", "uint64x2", "SSSE3", 2, false },
+        { "extract", "uint8x16", "ALTIVEC", 2, false },
+        { "extract", "uint8x16", "AVX", 1, false },
+        { "extract", "uint8x16", "SSE2", 2, false },
+        { "extract", "uint8x16", "SSE3", 2, false },
+        { "extract", "uint8x16", "SSE4.1", 1, false },
+        { "extract", "uint8x16", "SSSE3", 2, false },
+        { "extract_bits", "uint8x16", "ALTIVEC", 11, false },
+        { "extract_bits", "uint8x16", "AVX", 2, false },
+        { "extract_bits", "uint8x16", "AVX2", 2, false },
+        { "extract_bits", "uint8x16", "NEON", 9, false },
+        { "extract_bits", "uint8x16", "SSE2", 2, false },
+        { "extract_bits", "uint8x16", "SSE3", 2, false },
+        { "extract_bits", "uint8x16", "SSE4.1", 2, false },
+        { "extract_bits", "uint8x16", "SSSE3", 2, false },
+        { "extract_bits_any", "uint8x16", "ALTIVEC", 9, false },
+        { "extract_bits_any", "uint8x16", "NEON", 7, false },
+        { "floor", "float32x4", "NEON", 11, false },
+        { "floor", "float32x4", "SSE2", 14, false },
+        { "floor", "float32x4", "SSE3", 14, false },
+        { "floor", "float32x4", "SSSE3", 14, false },
+        { "floor", "float32x8", "ALTIVEC", 2, false },
+        { "floor", "float32x8", "NEON", 21, false },
+        { "floor", "float32x8", "SSE2", 26, false },
+        { "floor", "float32x8", "SSE3", 26, false },
+        { "floor", "float32x8", "SSSE3", 26, false },
+        { "gather", "int32x4", "ALTIVEC", 0, true },
+        { "gather", "int32x4", "AVX", 0, true },
+        { "gather", "int32x4", "NEON", 0, true },
+        { "gather", "int32x4", "SSE2", 0, true },
+        { "gather", "int32x4", "SSE3", 0, true },
+        { "gather", "int32x4", "SSE4.1", 0, true },
+        { "gather", "int32x4", "SSSE3", 0, true },
+        { "gather", "int64x2", "ALTIVEC", 0, true },
+        { "gather", "int64x2", "AVX", 0, true },
+        { "gather", "int64x2", "NEON", 0, true },
+        { "gather", "int64x2", "SSE2", 0, true },
+        { "gather", "int64x2", "SSE3", 0, true },
+        { "gather", "int64x2", "SSE4.1", 0, true },
+        { "gather", "int64x2", "SSSE3", 0, true },
+        { "gather", "uint32x4", "ALTIVEC", 0, true },
+        { "gather", "uint32x4", "AVX", 0, true },
+        { "gather", "uint32x4", "NEON", 0, true },
+        { "gather", "uint32x4", "SSE2", 0, true },
+        { "gather", "uint32x4", "SSE3", 0, true },
+        { "gather", "uint32x4", "SSE4.1", 0, true },
+        { "gather", "uint32x4", "SSSE3", 0, true },
+        { "gather", "uint64x2", "ALTIVEC", 0, true },
+        { "gather", "uint64x2", "AVX", 0, true },
+        { "gather", "uint64x2", "NEON", 0, true },
+        { "gather", "uint64x2", "SSE2", 0, true },
+        { "gather", "uint64x2", "SSE3", 0, true },
+        { "gather", "uint64x2", "SSE4.1", 0, true },
+        { "gather", "uint64x2", "SSSE3", 0, true },
+        { "insert", "float32x4", "ALTIVEC", 3, false },
+        { "insert", "float32x4", "SSE2", 4, false },
+        { "insert", "float32x4", "SSE3", 4, false },
+        { "insert", "float32x4", "SSSE3", 4, false },
+        { "insert", "float64x2", "ALTIVEC", 3, false },
+        { "insert", "float64x2", "SSE2", 2, false },
+        { "insert", "float64x2", "SSE3", 2, false },
+        { "insert", "float64x2", "SSSE3", 2, false },
+        { "insert", "uint16x8", "ALTIVEC", 3, false },
+        { "insert", "uint32x4", "ALTIVEC", 3, false },
+        { "insert", "uint32x4", "SSE2", 4, false },
+        { "insert", "uint32x4", "SSE3", 4, false },
+        { "insert", "uint32x4", "SSSE3", 4, false },
+        { "insert", "uint64x2", "ALTIVEC", 3, false },
+        { "insert", "uint64x2", "SSE2", 2, false },
+        { "insert", "uint64x2", "SSE3", 2, false },
+        { "insert", "uint64x2", "SSE4.1", 1, false },
+        { "insert", "uint64x2", "SSSE3", 2, false },
+        { "insert", "uint8x16", "ALTIVEC", 3, false },
+        { "insert", "uint8x16", "SSE2", 5, false },
+        { "insert", "uint8x16", "SSE3", 5, false },
+        { "insert", "uint8x16", "SSSE3", 5, false },
+        { "isnan", "float32x8", "ALTIVEC", 2, false },
+        { "isnan", "float32x8", "NEON", 2, false },
+        { "isnan", "float32x8", "SSE2", 2, false },
+        { "isnan", "float32x8", "SSE3", 2, false },
+        { "isnan", "float32x8", "SSE4.1", 2, false },
+        { "isnan", "float32x8", "SSSE3", 2, false },
+        { "isnan", "float64x2", "ALTIVEC", 0, true },
+        { "isnan", "float64x2", "NEON", 0, true },
+        { "isnan", "float64x4", "ALTIVEC", 0, true },
+        { "isnan", "float64x4", "NEON", 0, true },
+        { "isnan", "float64x4", "SSE2", 2, false },
+        { "isnan", "float64x4", "SSE3", 2, false },
+        { "isnan", "float64x4", "SSE4.1", 2, false },
+        { "isnan", "float64x4", "SSSE3", 2, false },
+        { "isnan2", "float32x4", "ALTIVEC", 3, false },
+        { "isnan2", "float32x4", "NEON", 3, false },
+        { "isnan2", "float32x8", "ALTIVEC", 6, false },
+        { "isnan2", "float32x8", "NEON", 6, false },
+        { "isnan2", "float32x8", "SSE2", 2, false },
+        { "isnan2", "float32x8", "SSE3", 2, false },
+        { "isnan2", "float32x8", "SSE4.1", 2, false },
+        { "isnan2", "float32x8", "SSSE3", 2, false },
+        { "isnan2", "float64x2", "ALTIVEC", 0, true },
+        { "isnan2", "float64x2", "NEON", 0, true },
+        { "isnan2", "float64x4", "ALTIVEC", 0, true },
+        { "isnan2", "float64x4", "NEON", 0, true },
+        { "isnan2", "float64x4", "SSE2", 2, false },
+        { "isnan2", "float64x4", "SSE3", 2, false },
+        { "isnan2", "float64x4", "SSE4.1", 2, false },
+        { "isnan2", "float64x4", "SSSE3", 2, false },
+        { "max", "float32x8", "ALTIVEC", 2, false },
+        { "max", "float32x8", "NEON", 2, false },
+        { "max", "float32x8", "SSE2", 2, false },
+        { "max", "float32x8", "SSE3", 2, false },
+        { "max", "float32x8", "SSE4.1", 2, false },
+        { "max", "float32x8", "SSSE3", 2, false },
+        { "max", "float64x2", "ALTIVEC", 0, true },
+        { "max", "float64x2", "NEON", 0, true },
+        { "max", "float64x4", "ALTIVEC", 0, true },
+        { "max", "float64x4", "NEON", 0, true },
+        { "max", "float64x4", "SSE2", 2, false },
+        { "max", "float64x4", "SSE3", 2, false },
+        { "max", "float64x4", "SSE4.1", 2, false },
+        { "max", "float64x4", "SSSE3", 2, false },
+        { "max", "int16x16", "ALTIVEC", 2, false },
+        { "max", "int16x16", "AVX", 2, false },
+        { "max", "int16x16", "NEON", 2, false },
+        { "max", "int16x16", "SSE2", 2, false },
+        { "max", "int16x16", "SSE3", 2, false },
+        { "max", "int16x16", "SSE4.1", 2, false },
+        { "max", "int16x16", "SSSE3", 2, false },
+        { "max", "int32x4", "SSE2", 4, false },
+        { "max", "int32x4", "SSE3", 4, false },
+        { "max", "int32x4", "SSSE3", 4, false },
+        { "max", "int32x8", "ALTIVEC", 2, false },
+        { "max", "int32x8", "AVX", 2, false },
+        { "max", "int32x8", "NEON", 2, false },
+        { "max", "int32x8", "SSE2", 8, false },
+        { "max", "int32x8", "SSE3", 8, false },
+        { "max", "int32x8", "SSE4.1", 2, false },
+        { "max", "int32x8", "SSSE3", 8, false },
+        { "max", "int8x16", "SSE2", 4, false },
+        { "max", "int8x16", "SSE3", 4, false },
+        { "max", "int8x16", "SSSE3", 4, false },
+        { "max", "int8x32", "ALTIVEC", 2, false },
+        { "max", "int8x32", "AVX", 2, false },
+        { "max", "int8x32", "NEON", 2, false },
+        { "max", "int8x32", "SSE2", 8, false },
+        { "max", "int8x32", "SSE3", 8, false },
+        { "max", "int8x32", "SSE4.1", 2, false },
+        { "max", "int8x32", "SSSE3", 8, false },
+        { "max", "uint16x16", "ALTIVEC", 2, false },
+        { "max", "uint16x16", "AVX", 2, false },
+        { "max", "uint16x16", "NEON", 2, false },
+        { "max", "uint16x16", "SSE2", 13, false },
+        { "max", "uint16x16", "SSE3", 13, false },
+        { "max", "uint16x16", "SSE4.1", 2, false },
+        { "max", "uint16x16", "SSSE3", 13, false },
+        { "max", "uint16x8", "SSE2", 7, false },
+        { "max", "uint16x8", "SSE3", 7, false },
+        { "max", "uint16x8", "SSSE3", 7, false },
+        { "max", "uint32x4", "SSE2", 7, false },
+        { "max", "uint32x4", "SSE3", 7, false },
+        { "max", "uint32x4", "SSSE3", 7, false },
+        { "max", "uint32x8", "ALTIVEC", 2, false },
+        { "max", "uint32x8", "AVX", 2, false },
+        { "max", "uint32x8", "NEON", 2, false },
+        { "max", "uint32x8", "SSE2", 13, false },
+        { "max", "uint32x8", "SSE3", 13, false },
+        { "max", "uint32x8", "SSE4.1", 2, false },
+        { "max", "uint32x8", "SSSE3", 13, false },
+        { "max", "uint8x32", "ALTIVEC", 2, false },
+        { "max", "uint8x32", "AVX", 2, false },
+        { "max", "uint8x32", "NEON", 2, false },
+        { "max", "uint8x32", "SSE2", 2, false },
+        { "max", "uint8x32", "SSE3", 2, false },
+        { "max", "uint8x32", "SSE4.1", 2, false },
+        { "max", "uint8x32", "SSSE3", 2, false },
+        { "min", "float32x8", "ALTIVEC", 2, false },
+        { "min", "float32x8", "NEON", 2, false },
+        { "min", "float32x8", "SSE2", 2, false },
+        { "min", "float32x8", "SSE3", 2, false },
+        { "min", "float32x8", "SSE4.1", 2, false },
+        { "min", "float32x8", "SSSE3", 2, false },
+        { "min", "float64x2", "ALTIVEC", 0, true },
+        { "min", "float64x2", "NEON", 0, true },
+        { "min", "float64x4", "ALTIVEC", 0, true },
+        { "min", "float64x4", "NEON", 0, true },
+        { "min", "float64x4", "SSE2", 2, false },
+        { "min", "float64x4", "SSE3", 2, false },
+        { "min", "float64x4", "SSE4.1", 2, false },
+        { "min", "float64x4", "SSSE3", 2, false },
+        { "min", "int16x16", "ALTIVEC", 2, false },
+        { "min", "int16x16", "AVX", 2, false },
+        { "min", "int16x16", "NEON", 2, false },
+        { "min", "int16x16", "SSE2", 2, false },
+        { "min", "int16x16", "SSE3", 2, false },
+        { "min", "int16x16", "SSE4.1", 2, false },
+        { "min", "int16x16", "SSSE3", 2, false },
+        { "min", "int32x4", "SSE2", 4, false },
+        { "min", "int32x4", "SSE3", 4, false },
+        { "min", "int32x4", "SSSE3", 4, false },
+        { "min", "int32x8", "ALTIVEC", 2, false },
+        { "min", "int32x8", "AVX", 2, false },
+        { "min", "int32x8", "NEON", 2, false },
+        { "min", "int32x8", "SSE2", 8, false },
+        { "min", "int32x8", "SSE3", 8, false },
+        { "min", "int32x8", "SSE4.1", 2, false },
+        { "min", "int32x8", "SSSE3", 8, false },
+        { "min", "int8x16", "SSE2", 4, false },
+        { "min", "int8x16", "SSE3", 4, false },
+        { "min", "int8x16", "SSSE3", 4, false },
+        { "min", "int8x32", "ALTIVEC", 2, false },
+        { "min", "int8x32", "AVX", 2, false },
+        { "min", "int8x32", "NEON", 2, false },
+        { "min", "int8x32", "SSE2", 8, false },
+        { "min", "int8x32", "SSE3", 8, false },
+        { "min", "int8x32", "SSE4.1", 2, false },
+        { "min", "int8x32", "SSSE3", 8, false },
+        { "min", "uint16x16", "ALTIVEC", 2, false },
+        { "min", "uint16x16", "AVX", 2, false },
+        { "min", "uint16x16", "NEON", 2, false },
+        { "min", "uint16x16", "SSE2", 13, false },
+        { "min", "uint16x16", "SSE3", 13, false },
+        { "min", "uint16x16", "SSE4.1", 2, false },
+        { "min", "uint16x16", "SSSE3", 13, false },
+        { "min", "uint16x8", "SSE2", 7, false },
+        { "min", "uint16x8", "SSE3", 7, false },
+        { "min", "uint16x8", "SSSE3", 7, false },
+        { "min", "uint32x4", "SSE2", 7, false },
+        { "min", "uint32x4", "SSE3", 7, false },
+        { "min", "uint32x4", "SSSE3", 7, false },
+        { "min", "uint32x8", "ALTIVEC", 2, false },
+        { "min", "uint32x8", "AVX", 2, false },
+        { "min", "uint32x8", "NEON", 2, false },
+        { "min", "uint32x8", "SSE2", 13, false },
+        { "min", "uint32x8", "SSE3", 13, false },
+        { "min", "uint32x8", "SSE4.1", 2, false },
+        { "min", "uint32x8", "SSSE3", 13, false },
+        { "min", "uint8x32", "ALTIVEC", 2, false },
+        { "min", "uint8x32", "AVX", 2, false },
+        { "min", "uint8x32", "NEON", 2, false },
+        { "min", "uint8x32", "SSE2", 2, false },
+        { "min", "uint8x32", "SSE3", 2, false },
+        { "min", "uint8x32", "SSE4.1", 2, false },
+        { "min", "uint8x32", "SSSE3", 2, false },
+        { "move16_l", "int8x32", "ALTIVEC", 2, false },
+        { "move16_l", "int8x32", "AVX", 2, false },
+        { "move16_l", "int8x32", "NEON", 2, false },
+        { "move16_l", "int8x32", "SSE2", 2, false },
+        { "move16_l", "int8x32", "SSE3", 2, false },
+        { "move16_l", "int8x32", "SSE4.1", 2, false },
+        { "move16_l", "int8x32", "SSSE3", 2, false },
+        { "move16_l", "uint8x32", "ALTIVEC", 2, false },
+        { "move16_l", "uint8x32", "AVX", 2, false },
+        { "move16_l", "uint8x32", "NEON", 2, false },
+        { "move16_l", "uint8x32", "SSE2", 2, false },
+        { "move16_l", "uint8x32", "SSE3", 2, false },
+        { "move16_l", "uint8x32", "SSE4.1", 2, false },
+        { "move16_l", "uint8x32", "SSSE3", 2, false },
+        { "move16_r", "int8x32", "ALTIVEC", 2, false },
+        { "move16_r", "int8x32", "AVX", 2, false },
+        { "move16_r", "int8x32", "NEON", 2, false },
+        { "move16_r", "int8x32", "SSE2", 2, false },
+        { "move16_r", "int8x32", "SSE3", 2, false },
+        { "move16_r", "int8x32", "SSE4.1", 2, false },
+        { "move16_r", "int8x32", "SSSE3", 2, false },
+        { "move16_r", "uint8x32", "ALTIVEC", 2, false },
+        { "move16_r", "uint8x32", "AVX", 2, false },
+        { "move16_r", "uint8x32", "NEON", 2, false },
+        { "move16_r", "uint8x32", "SSE2", 2, false },
+        { "move16_r", "uint8x32", "SSE3", 2, false },
+        { "move16_r", "uint8x32", "SSE4.1", 2, false },
+        { "move16_r", "uint8x32", "SSSE3", 2, false },
+        { "move2_l", "float64x4", "ALTIVEC", 2, false },
+        { "move2_l", "float64x4", "AVX", 2, false },
+        { "move2_l", "float64x4", "NEON", 2, false },
+        { "move2_l", "float64x4", "SSE2", 2, false },
+        { "move2_l", "float64x4", "SSE3", 2, false },
+        { "move2_l", "float64x4", "SSE4.1", 2, false },
+        { "move2_l", "float64x4", "SSSE3", 2, false },
+        { "move2_l", "int64x4", "ALTIVEC", 2, false },
+        { "move2_l", "int64x4", "AVX", 2, false },
+        { "move2_l", "int64x4", "NEON", 2, false },
+        { "move2_l", "int64x4", "SSE2", 2, false },
+        { "move2_l", "int64x4", "SSE3", 2, false },
+        { "move2_l", "int64x4", "SSE4.1", 2, false },
+        { "move2_l", "int64x4", "SSSE3", 2, false },
+        { "move2_l", "uint64x4", "ALTIVEC", 2, false },
+        { "move2_l", "uint64x4", "AVX", 2, false },
+        { "move2_l", "uint64x4", "NEON", 2, false },
+        { "move2_l", "uint64x4", "SSE2", 2, false },
+        { "move2_l", "uint64x4", "SSE3", 2, false },
+        { "move2_l", "uint64x4", "SSE4.1", 2, false },
+        { "move2_l", "uint64x4", "SSSE3", 2, false },
+        { "move2_r", "float64x4", "ALTIVEC", 2, false },
+        { "move2_r", "float64x4", "AVX", 2, false },
+        { "move2_r", "float64x4", "NEON", 2, false },
+        { "move2_r", "float64x4", "SSE2", 2, false },
+        { "move2_r", "float64x4", "SSE3", 2, false },
+        { "move2_r", "float64x4", "SSE4.1", 2, false },
+        { "move2_r", "float64x4", "SSSE3", 2, false },
+        { "move2_r", "int64x4", "ALTIVEC", 2, false },
+        { "move2_r", "int64x4", "AVX", 2, false },
+        { "move2_r", "int64x4", "NEON", 2, false },
+        { "move2_r", "int64x4", "SSE2", 2, false },
+        { "move2_r", "int64x4", "SSE3", 2, false },
+        { "move2_r", "int64x4", "SSE4.1", 2, false },
+        { "move2_r", "int64x4", "SSSE3", 2, false },
+        { "move2_r", "uint64x4", "ALTIVEC", 2, false },
+        { "move2_r", "uint64x4", "AVX", 2, false },
+        { "move2_r", "uint64x4", "NEON", 2, false },
+        { "move2_r", "uint64x4", "SSE2", 2, false },
+        { "move2_r", "uint64x4", "SSE3", 2, false },
+        { "move2_r", "uint64x4", "SSE4.1", 2, false },
+        { "move2_r", "uint64x4", "SSSE3", 2, false },
+        { "move4_l", "float32x8", "ALTIVEC", 2, false },
+        { "move4_l", "float32x8", "AVX", 2, false },
+        { "move4_l", "float32x8", "NEON", 2, false },
+        { "move4_l", "float32x8", "SSE2", 2, false },
+        { "move4_l", "float32x8", "SSE3", 2, false },
+        { "move4_l", "float32x8", "SSE4.1", 2, false },
+        { "move4_l", "float32x8", "SSSE3", 2, false },
+        { "move4_l", "int32x8", "ALTIVEC", 2, false },
+        { "move4_l", "int32x8", "AVX", 2, false },
+        { "move4_l", "int32x8", "NEON", 2, false },
+        { "move4_l", "int32x8", "SSE2", 2, false },
+        { "move4_l", "int32x8", "SSE3", 2, false },
+        { "move4_l", "int32x8", "SSE4.1", 2, false },
+        { "move4_l", "int32x8", "SSSE3", 2, false },
+        { "move4_l", "uint32x8", "ALTIVEC", 2, false },
+        { "move4_l", "uint32x8", "AVX", 2, false },
+        { "move4_l", "uint32x8", "NEON", 2, false },
+        { "move4_l", "uint32x8", "SSE2", 2, false },
+        { "move4_l", "uint32x8", "SSE3", 2, false },
+        { "move4_l", "uint32x8", "SSE4.1", 2, false },
+        { "move4_l", "uint32x8", "SSSE3", 2, false },
+        { "move4_r", "float32x8", "ALTIVEC", 2, false },
+        { "move4_r", "float32x8", "AVX", 2, false },
+        { "move4_r", "float32x8", "NEON", 2, false },
+        { "move4_r", "float32x8", "SSE2", 2, false },
+        { "move4_r", "float32x8", "SSE3", 2, false },
+        { "move4_r", "float32x8", "SSE4.1", 2, false },
+        { "move4_r", "float32x8", "SSSE3", 2, false },
+        { "move4_r", "int32x8", "ALTIVEC", 2, false },
+        { "move4_r", "int32x8", "AVX", 2, false },
+        { "move4_r", "int32x8", "NEON", 2, false },
+        { "move4_r", "int32x8", "SSE2", 2, false },
+        { "move4_r", "int32x8", "SSE3", 2, false },
+        { "move4_r", "int32x8", "SSE4.1", 2, false },
+        { "move4_r", "int32x8", "SSSE3", 2, false },
+        { "move4_r", "uint32x8", "ALTIVEC", 2, false },
+        { "move4_r", "uint32x8", "AVX", 2, false },
+        { "move4_r", "uint32x8", "NEON", 2, false },
+        { "move4_r", "uint32x8", "SSE2", 2, false },
+        { "move4_r", "uint32x8", "SSE3", 2, false },
+        { "move4_r", "uint32x8", "SSE4.1", 2, false },
+        { "move4_r", "uint32x8", "SSSE3", 2, false },
+        { "move8_l", "int16x16", "ALTIVEC", 2, false },
+        { "move8_l", "int16x16", "AVX", 2, false },
+        { "move8_l", "int16x16", "NEON", 2, false },
+        { "move8_l", "int16x16", "SSE2", 2, false },
+        { "move8_l", "int16x16", "SSE3", 2, false },
+        { "move8_l", "int16x16", "SSE4.1", 2, false },
+        { "move8_l", "int16x16", "SSSE3", 2, false },
+        { "move8_l", "uint16x16", "ALTIVEC", 2, false },
+        { "move8_l", "uint16x16", "AVX", 2, false },
+        { "move8_l", "uint16x16", "NEON", 2, false },
+        { "move8_l", "uint16x16", "SSE2", 2, false },
+        { "move8_l", "uint16x16", "SSE3", 2, false },
+        { "move8_l", "uint16x16", "SSE4.1", 2, false },
+        { "move8_l", "uint16x16", "SSSE3", 2, false },
+        { "move8_r", "int16x16", "ALTIVEC", 2, false },
+        { "move8_r", "int16x16", "AVX", 2, false },
+        { "move8_r", "int16x16", "NEON", 2, false },
+        { "move8_r", "int16x16", "SSE2", 2, false },
+        { "move8_r", "int16x16", "SSE3", 2, false },
+        { "move8_r", "int16x16", "SSE4.1", 2, false },
+        { "move8_r", "int16x16", "SSSE3", 2, false },
+        { "move8_r", "uint16x16", "ALTIVEC", 2, false },
+        { "move8_r", "uint16x16", "AVX", 2, false },
+        { "move8_r", "uint16x16", "NEON", 2, false },
+        { "move8_r", "uint16x16", "SSE2", 2, false },
+        { "move8_r", "uint16x16", "SSE3", 2, false },
+        { "move8_r", "uint16x16", "SSE4.1", 2, false },
+        { "move8_r", "uint16x16", "SSSE3", 2, false },
+        { "mul", "float32x8", "ALTIVEC", 2, false },
+        { "mul", "float32x8", "NEON", 2, false },
+        { "mul", "float32x8", "SSE2", 2, false },
+        { "mul", "float32x8", "SSE3", 2, false },
+        { "mul", "float32x8", "SSE4.1", 2, false },
+        { "mul", "float32x8", "SSSE3", 2, false },
+        { "mul", "float64x2", "ALTIVEC", 0, true },
+        { "mul", "float64x2", "NEON", 0, true },
+        { "mul", "float64x4", "ALTIVEC", 0, true },
+        { "mul", "float64x4", "NEON", 0, true },
+        { "mul", "float64x4", "SSE2", 2, false },
+        { "mul", "float64x4", "SSE3", 2, false },
+        { "mul", "float64x4", "SSE4.1", 2, false },
+        { "mul", "float64x4", "SSSE3", 2, false },
+        { "mul_hi", "int16x16", "ALTIVEC", 6, false },
+        { "mul_hi", "int16x16", "AVX", 2, false },
+        { "mul_hi", "int16x16", "NEON", 6, false },
+        { "mul_hi", "int16x16", "SSE2", 2, false },
+        { "mul_hi", "int16x16", "SSE3", 2, false },
+        { "mul_hi", "int16x16", "SSE4.1", 2, false },
+        { "mul_hi", "int16x16", "SSSE3", 2, false },
+        { "mul_hi", "int16x8", "ALTIVEC", 3, false },
+        { "mul_hi", "int16x8", "NEON", 3, false },
+        { "mul_hi", "uint16x16", "ALTIVEC", 6, false },
+        { "mul_hi", "uint16x16", "AVX", 2, false },
+        { "mul_hi", "uint16x16", "NEON", 6, false },
+        { "mul_hi", "uint16x16", "SSE2", 2, false },
+        { "mul_hi", "uint16x16", "SSE3", 2, false },
+        { "mul_hi", "uint16x16", "SSE4.1", 2, false },
+        { "mul_hi", "uint16x16", "SSSE3", 2, false },
+        { "mul_hi", "uint16x8", "ALTIVEC", 3, false },
+        { "mul_hi", "uint16x8", "NEON", 3, false },
+        { "mul_lo", "int16x16", "ALTIVEC", 2, false },
+        { "mul_lo", "int16x16", "AVX", 2, false },
+        { "mul_lo", "int16x16", "NEON", 2, false },
+        { "mul_lo", "int16x16", "SSE2", 2, false },
+        { "mul_lo", "int16x16", "SSE3", 2, false },
+        { "mul_lo", "int16x16", "SSE4.1", 2, false },
+        { "mul_lo", "int16x16", "SSSE3", 2, false },
+        { "mul_lo", "int32x4", "ALTIVEC", 8, false },
+        { "mul_lo", "int32x4", "SSE2", 6, false },
+        { "mul_lo", "int32x4", "SSE3", 6, false },
+        { "mul_lo", "int32x4", "SSSE3", 6, false },
+        { "mul_lo", "int32x8", "ALTIVEC", 16, false },
+        { "mul_lo", "int32x8", "AVX", 2, false },
+        { "mul_lo", "int32x8", "NEON", 2, false },
+        { "mul_lo", "int32x8", "SSE2", 12, false },
+        { "mul_lo", "int32x8", "SSE3", 12, false },
+        { "mul_lo", "int32x8", "SSE4.1", 2, false },
+        { "mul_lo", "int32x8", "SSSE3", 12, false },
+        { "mul_lo", "uint16x16", "ALTIVEC", 2, false },
+        { "mul_lo", "uint16x16", "AVX", 2, false },
+        { "mul_lo", "uint16x16", "NEON", 2, false },
+        { "mul_lo", "uint16x16", "SSE2", 2, false },
+        { "mul_lo", "uint16x16", "SSE3", 2, false },
+        { "mul_lo", "uint16x16", "SSE4.1", 2, false },
+        { "mul_lo", "uint16x16", "SSSE3", 2, false },
+        { "mul_lo", "uint32x4", "ALTIVEC", 8, false },
+        { "mul_lo", "uint32x4", "SSE2", 6, false },
+        { "mul_lo", "uint32x4", "SSE3", 6, false },
+        { "mul_lo", "uint32x4", "SSSE3", 6, false },
+        { "mul_lo", "uint32x8", "ALTIVEC", 16, false },
+        { "mul_lo", "uint32x8", "AVX", 2, false },
+        { "mul_lo", "uint32x8", "NEON", 2, false },
+        { "mul_lo", "uint32x8", "SSE2", 12, false },
+        { "mul_lo", "uint32x8", "SSE3", 12, false },
+        { "mul_lo", "uint32x8", "SSE4.1", 2, false },
+        { "mul_lo", "uint32x8", "SSSE3", 12, false },
+        { "mull", "int16x16", "ALTIVEC", 6, false },
+        { "mull", "int16x16", "AVX", 6, false },
+        { "mull", "int16x16", "AVX2", 3, false },
+        { "mull", "int16x16", "NEON", 3, false },
+        { "mull", "int16x16", "SSE2", 6, false },
+        { "mull", "int16x16", "SSE3", 6, false },
+        { "mull", "int16x16", "SSE4.1", 6, false },
+        { "mull", "int16x16", "SSSE3", 6, false },
+        { "mull", "int16x8", "ALTIVEC", 3, false },
+        { "mull", "int16x8", "AVX", 3, false },
+        { "mull", "int16x8", "SSE2", 3, false },
+        { "mull", "int16x8", "SSE3", 3, false },
+        { "mull", "int16x8", "SSE4.1", 3, false },
+        { "mull", "int16x8", "SSSE3", 3, false },
+        { "mull", "int32x4", "AVX", 3, false },
+        { "mull", "int32x4", "SSE4.1", 3, false },
+        { "mull", "int32x8", "AVX", 6, false },
+        { "mull", "int32x8", "AVX2", 3, false },
+        { "mull", "int32x8", "NEON", 2, false },
+        { "mull", "int32x8", "SSE4.1", 6, false },
+        { "mull", "uint16x16", "ALTIVEC", 6, false },
+        { "mull", "uint16x16", "AVX", 6, false },
+        { "mull", "uint16x16", "AVX2", 3, false },
+        { "mull", "uint16x16", "NEON", 2, false },
+        { "mull", "uint16x16", "SSE2", 6, false },
+        { "mull", "uint16x16", "SSE3", 6, false },
+        { "mull", "uint16x16", "SSE4.1", 6, false },
+        { "mull", "uint16x16", "SSSE3", 6, false },
+        { "mull", "uint16x8", "ALTIVEC", 3, false },
+        { "mull", "uint16x8", "AVX", 3, false },
+        { "mull", "uint16x8", "AVX2", 3, false },
+        { "mull", "uint16x8", "SSE2", 3, false },
+        { "mull", "uint16x8", "SSE3", 3, false },
+        { "mull", "uint16x8", "SSE4.1", 3, false },
+        { "mull", "uint16x8", "SSSE3", 3, false },
+        { "mull", "uint32x4", "AVX", 3, false },
+        { "mull", "uint32x4", "SSE2", 3, false },
+        { "mull", "uint32x4", "SSE3", 3, false },
+        { "mull", "uint32x4", "SSE4.1", 3, false },
+        { "mull", "uint32x4", "SSSE3", 3, false },
+        { "mull", "uint32x8", "AVX", 6, false },
+        { "mull", "uint32x8", "AVX2", 3, false },
+        { "mull", "uint32x8", "NEON", 2, false },
+        { "mull", "uint32x8", "SSE2", 6, false },
+        { "mull", "uint32x8", "SSE3", 6, false },
+        { "mull", "uint32x8", "SSE4.1", 6, false },
+        { "mull", "uint32x8", "SSSE3", 6, false },
+        { "neg", "float32x4", "ALTIVEC", 2, false },
+        { "neg", "float32x4", "AVX", 2, false },
+        { "neg", "float32x4", "AVX2", 2, false },
+        { "neg", "float32x4", "SSE2", 2, false },
+        { "neg", "float32x4", "SSE3", 2, false },
+        { "neg", "float32x4", "SSE4.1", 2, false },
+        { "neg", "float32x4", "SSSE3", 2, false },
+        { "neg", "float32x8", "ALTIVEC", 3, false },
+        { "neg", "float32x8", "AVX", 2, false },
+        { "neg", "float32x8", "AVX2", 2, false },
+        { "neg", "float32x8", "NEON", 2, false },
+        { "neg", "float32x8", "SSE2", 3, false },
+        { "neg", "float32x8", "SSE3", 3, false },
+        { "neg", "float32x8", "SSE4.1", 3, false },
+        { "neg", "float32x8", "SSSE3", 3, false },
+        { "neg", "float64x2", "ALTIVEC", 0, true },
+        { "neg", "float64x2", "AVX", 2, false },
+        { "neg", "float64x2", "AVX2", 2, false },
+        { "neg", "float64x2", "NEON", 0, true },
+        { "neg", "float64x2", "SSE2", 2, false },
+        { "neg", "float64x2", "SSE3", 2, false },
+        { "neg", "float64x2", "SSE4.1", 2, false },
+        { "neg", "float64x2", "SSSE3", 2, false },
+        { "neg", "float64x4", "ALTIVEC", 0, true },
+        { "neg", "float64x4", "AVX", 2, false },
+        { "neg", "float64x4", "AVX2", 2, false },
+        { "neg", "float64x4", "NEON", 0, true },
+        { "neg", "float64x4", "SSE2", 3, false },
+        { "neg", "float64x4", "SSE3", 3, false },
+        { "neg", "float64x4", "SSE4.1", 3, false },
+        { "neg", "float64x4", "SSSE3", 3, false },
+        { "neg", "int16x16", "ALTIVEC", 2, false },
+        { "neg", "int16x16", "AVX", 2, false },
+        { "neg", "int16x16", "NEON", 2, false },
+        { "neg", "int16x16", "SSE2", 2, false },
+        { "neg", "int16x16", "SSE3", 2, false },
+        { "neg", "int16x16", "SSE4.1", 2, false },
+        { "neg", "int16x16", "SSSE3", 2, false },
+        { "neg", "int32x8", "ALTIVEC", 2, false },
+        { "neg", "int32x8", "AVX", 2, false },
+        { "neg", "int32x8", "NEON", 2, false },
+        { "neg", "int32x8", "SSE2", 2, false },
+        { "neg", "int32x8", "SSE3", 2, false },
+        { "neg", "int32x8", "SSE4.1", 2, false },
+        { "neg", "int32x8", "SSSE3", 2, false },
+        { "neg", "int64x2", "ALTIVEC", 5, false },
+        { "neg", "int64x4", "ALTIVEC", 9, false },
+        { "neg", "int64x4", "AVX", 2, false },
+        { "neg", "int64x4", "NEON", 2, false },
+        { "neg", "int64x4", "SSE2", 2, false },
+        { "neg", "int64x4", "SSE3", 2, false },
+        { "neg", "int64x4", "SSE4.1", 2, false },
+        { "neg", "int64x4", "SSSE3", 2, false },
+        { "neg", "int8x32", "ALTIVEC", 2, false },
+        { "neg", "int8x32", "AVX", 2, false },
+        { "neg", "int8x32", "NEON", 2, false },
+        { "neg", "int8x32", "SSE2", 2, false },
+        { "neg", "int8x32", "SSE3", 2, false },
+        { "neg", "int8x32", "SSE4.1", 2, false },
+        { "neg", "int8x32", "SSSE3", 2, false },
+        { "permute2", "float32x4", "ALTIVEC", 2, false },
+        { "permute2", "float32x4", "NEON", 4, false },
+        { "permute2", "float32x8", "ALTIVEC", 3, false },
+        { "permute2", "float32x8", "AVX", 2, false },
+        { "permute2", "float32x8", "NEON", 8, false },
+        { "permute2", "float32x8", "SSE2", 2, false },
+        { "permute2", "float32x8", "SSE3", 2, false },
+        { "permute2", "float32x8", "SSE4.1", 2, false },
+        { "permute2", "float32x8", "SSSE3", 2, false },
+        { "permute2", "float64x2", "ALTIVEC", 2, false },
+        { "permute2", "float64x2", "NEON", 2, false },
+        { "permute2", "float64x4", "ALTIVEC", 4, false },
+        { "permute2", "float64x4", "AVX", 2, false },
+        { "permute2", "float64x4", "NEON", 4, false },
+        { "permute2", "float64x4", "SSE2", 2, false },
+        { "permute2", "float64x4", "SSE3", 2, false },
+        { "permute2", "float64x4", "SSE4.1", 2, false },
+        { "permute2", "float64x4", "SSSE3", 2, false },
+        { "permute2", "int16x8", "ALTIVEC", 3, false },
+        { "permute2", "int16x8", "AVX", 4, false },
+        { "permute2", "int16x8", "AVX2", 2, false },
+        { "permute2", "int16x8", "NEON", 4, false },
+        { "permute2", "int16x8", "SSE2", 4, false },
+        { "permute2", "int16x8", "SSE3", 4, false },
+        { "permute2", "int16x8", "SSE4.1", 4, false },
+        { "permute2", "int16x8", "SSSE3", 4, false },
+        { "permute2", "int32x4", "ALTIVEC", 2, false },
+        { "permute2", "int32x4", "NEON", 4, false },
+        { "permute2", "int32x8", "ALTIVEC", 3, false },
+        { "permute2", "int32x8", "AVX", 2, false },
+        { "permute2", "int32x8", "NEON", 8, false },
+        { "permute2", "int32x8", "SSE2", 2, false },
+        { "permute2", "int32x8", "SSE3", 2, false },
+        { "permute2", "int32x8", "SSE4.1", 2, false },
+        { "permute2", "int32x8", "SSSE3", 2, false },
+        { "permute2", "int64x2", "ALTIVEC", 2, false },
+        { "permute2", "int64x2", "NEON", 2, false },
+        { "permute2", "int64x4", "ALTIVEC", 4, false },
+        { "permute2", "int64x4", "AVX", 2, false },
+        { "permute2", "int64x4", "NEON", 4, false },
+        { "permute2", "int64x4", "SSE2", 2, false },
+        { "permute2", "int64x4", "SSE3", 2, false },
+        { "permute2", "int64x4", "SSE4.1", 2, false },
+        { "permute2", "int64x4", "SSSE3", 2, false },
+        { "permute2", "uint16x8", "ALTIVEC", 3, false },
+        { "permute2", "uint16x8", "AVX", 4, false },
+        { "permute2", "uint16x8", "AVX2", 2, false },
+        { "permute2", "uint16x8", "NEON", 4, false },
+        { "permute2", "uint16x8", "SSE2", 4, false },
+        { "permute2", "uint16x8", "SSE3", 4, false },
+        { "permute2", "uint16x8", "SSE4.1", 4, false },
+        { "permute2", "uint16x8", "SSSE3", 4, false },
+        { "permute2", "uint32x4", "ALTIVEC", 2, false },
+        { "permute2", "uint32x4", "NEON", 4, false },
+        { "permute2", "uint32x8", "ALTIVEC", 3, false },
+        { "permute2", "uint32x8", "AVX", 2, false },
+        { "permute2", "uint32x8", "NEON", 8, false },
+        { "permute2", "uint32x8", "SSE2", 2, false },
+        { "permute2", "uint32x8", "SSE3", 2, false },
+        { "permute2", "uint32x8", "SSE4.1", 2, false },
+        { "permute2", "uint32x8", "SSSE3", 2, false },
+        { "permute2", "uint64x2", "ALTIVEC", 2, false },
+        { "permute2", "uint64x2", "NEON", 2, false },
+        { "permute2", "uint64x4", "ALTIVEC", 4, false },
+        { "permute2", "uint64x4", "AVX", 2, false },
+        { "permute2", "uint64x4", "NEON", 4, false },
+        { "permute2", "uint64x4", "SSE2", 2, false },
+        { "permute2", "uint64x4", "SSE3", 2, false },
+        { "permute2", "uint64x4", "SSE4.1", 2, false },
+        { "permute2", "uint64x4", "SSSE3", 2, false },
+        { "permute4", "float32x4", "ALTIVEC", 2, false },
+        { "permute4", "float32x4", "NEON", 4, false },
+        { "permute4", "float32x8", "ALTIVEC", 3, false },
+        { "permute4", "float32x8", "AVX", 2, false },
+        { "permute4", "float32x8", "NEON", 8, false },
+        { "permute4", "float32x8", "SSE2", 2, false },
+        { "permute4", "float32x8", "SSE3", 2, false },
+        { "permute4", "float32x8", "SSE4.1", 2, false },
+        { "permute4", "float32x8", "SSSE3", 2, false },
+        { "permute4", "float64x2", "ALTIVEC", 4, false },
+        { "permute4", "float64x2", "AVX", 2, false },
+        { "permute4", "float64x2", "NEON", 4, false },
+        { "permute4", "float64x2", "SSE2", 2, false },
+        { "permute4", "float64x2", "SSE3", 2, false },
+        { "permute4", "float64x2", "SSE4.1", 2, false },
+        { "permute4", "float64x2", "SSSE3", 2, false },
+        { "permute4", "float64x4", "ALTIVEC", 4, false },
+        { "permute4", "float64x4", "AVX", 2, false },
+        { "permute4", "float64x4", "NEON", 4, false },
+        { "permute4", "float64x4", "SSE2", 2, false },
+        { "permute4", "float64x4", "SSE3", 2, false },
+        { "permute4", "float64x4", "SSE4.1", 2, false },
+        { "permute4", "float64x4", "SSSE3", 2, false },
+        { "permute4", "float64x8", "ALTIVEC", 4, false },
+        { "permute4", "float64x8", "AVX", 2, false },
+        { "permute4", "float64x8", "NEON", 4, false },
+        { "permute4", "float64x8", "SSE2", 2, false },
+        { "permute4", "float64x8", "SSE3", 2, false },
+        { "permute4", "float64x8", "SSE4.1", 2, false },
+        { "permute4", "float64x8", "SSSE3", 2, false },
+        { "permute4", "int16x8", "ALTIVEC", 3, false },
+        { "permute4", "int16x8", "AVX", 4, false },
+        { "permute4", "int16x8", "AVX2", 2, false },
+        { "permute4", "int16x8", "NEON", 10, false },
+        { "permute4", "int16x8", "SSE2", 4, false },
+        { "permute4", "int16x8", "SSE3", 4, false },
+        { "permute4", "int16x8", "SSE4.1", 4, false },
+        { "permute4", "int16x8", "SSSE3", 4, false },
+        { "permute4", "int32x4", "ALTIVEC", 2, false },
+        { "permute4", "int32x4", "NEON", 4, false },
+        { "permute4", "int32x8", "ALTIVEC", 3, false },
+        { "permute4", "int32x8", "AVX", 2, false },
+        { "permute4", "int32x8", "NEON", 8, false },
+        { "permute4", "int32x8", "SSE2", 2, false },
+        { "permute4", "int32x8", "SSE3", 2, false },
+        { "permute4", "int32x8", "SSE4.1", 2, false },
+        { "permute4", "int32x8", "SSSE3", 2, false },
+        { "permute4", "int64x2", "AVX", 2, false },
+        { "permute4", "int64x2", "SSE2", 2, false },
+        { "permute4", "int64x2", "SSE3", 2, false },
+        { "permute4", "int64x2", "SSE4.1", 2, false },
+        { "permute4", "int64x2", "SSSE3", 2, false },
+        { "permute4", "int64x4", "AVX", 2, false },
+        { "permute4", "int64x4", "SSE2", 2, false },
+        { "permute4", "int64x4", "SSE3", 2, false },
+        { "permute4", "int64x4", "SSE4.1", 2, false },
+        { "permute4", "int64x4", "SSSE3", 2, false },
+        { "permute4", "int64x8", "AVX", 2, false },
+        { "permute4", "int64x8", "SSE2", 2, false },
+        { "permute4", "int64x8", "SSE3", 2, false },
+        { "permute4", "int64x8", "SSE4.1", 2, false },
+        { "permute4", "int64x8", "SSSE3", 2, false },
+        { "permute4", "uint16x8", "ALTIVEC", 3, false },
+        { "permute4", "uint16x8", "AVX", 4, false },
+        { "permute4", "uint16x8", "AVX2", 2, false },
+        { "permute4", "uint16x8", "NEON", 10, false },
+        { "permute4", "uint16x8", "SSE2", 4, false },
+        { "permute4", "uint16x8", "SSE3", 4, false },
+        { "permute4", "uint16x8", "SSE4.1", 4, false },
+        { "permute4", "uint16x8", "SSSE3", 4, false },
+        { "permute4", "uint32x4", "ALTIVEC", 2, false },
+        { "permute4", "uint32x4", "NEON", 4, false },
+        { "permute4", "uint32x8", "ALTIVEC", 3, false },
+        { "permute4", "uint32x8", "AVX", 2, false },
+        { "permute4", "uint32x8", "NEON", 8, false },
+        { "permute4", "uint32x8", "SSE2", 2, false },
+        { "permute4", "uint32x8", "SSE3", 2, false },
+        { "permute4", "uint32x8", "SSE4.1", 2, false },
+        { "permute4", "uint32x8", "SSSE3", 2, false },
+        { "permute4", "uint64x2", "AVX", 2, false },
+        { "permute4", "uint64x2", "SSE2", 2, false },
+        { "permute4", "uint64x2", "SSE3", 2, false },
+        { "permute4", "uint64x2", "SSE4.1", 2, false },
+        { "permute4", "uint64x2", "SSSE3", 2, false },
+        { "permute4", "uint64x4", "AVX", 2, false },
+        { "permute4", "uint64x4", "SSE2", 2, false },
+        { "permute4", "uint64x4", "SSE3", 2, false },
+        { "permute4", "uint64x4", "SSE4.1", 2, false },
+        { "permute4", "uint64x4", "SSSE3", 2, false },
+        { "permute4", "uint64x8", "AVX", 2, false },
+        { "permute4", "uint64x8", "SSE2", 2, false },
+        { "permute4", "uint64x8", "SSE3", 2, false },
+        { "permute4", "uint64x8", "SSE4.1", 2, false },
+        { "permute4", "uint64x8", "SSSE3", 2, false },
+        { "permute_bytes16", "uint8x16", "NEON", 2, false },
+        { "permute_bytes16", "uint8x32", "ALTIVEC", 2, false },
+        { "permute_bytes16", "uint8x32", "AVX", 2, false },
+        { "permute_bytes16", "uint8x32", "NEON", 4, false },
+        { "permute_bytes16", "uint8x32", "SSE4.1", 2, false },
+        { "permute_bytes16", "uint8x32", "SSSE3", 2, false },
+        { "permute_zbytes16", "uint8x16", "ALTIVEC", 2, false },
+        { "permute_zbytes16", "uint8x16", "NEON", 2, false },
+        { "permute_zbytes16", "uint8x32", "ALTIVEC", 3, false },
+        { "permute_zbytes16", "uint8x32", "AVX", 2, false },
+        { "permute_zbytes16", "uint8x32", "AVX2", 1, false },
+        { "permute_zbytes16", "uint8x32", "NEON", 4, false },
+        { "permute_zbytes16", "uint8x32", "SSE4.1", 2, false },
+        { "permute_zbytes16", "uint8x32", "SSSE3", 2, false },
+        { "rcp_e", "float32x8", "ALTIVEC", 2, false },
+        { "rcp_e", "float32x8", "NEON", 2, false },
+        { "rcp_e", "float32x8", "SSE2", 2, false },
+        { "rcp_e", "float32x8", "SSE3", 2, false },
+        { "rcp_e", "float32x8", "SSE4.1", 2, false },
+        { "rcp_e", "float32x8", "SSSE3", 2, false },
+        { "rcp_rh", "float32x4", "ALTIVEC", 3, false },
+        { "rcp_rh", "float32x4", "AVX", 4, false },
+        { "rcp_rh", "float32x4", "AVX2", 4, false },
+        { "rcp_rh", "float32x4", "NEON", 2, false },
+        { "rcp_rh", "float32x4", "SSE2", 4, false },
+        { "rcp_rh", "float32x4", "SSE3", 4, false },
+        { "rcp_rh", "float32x4", "SSE4.1", 4, false },
+        { "rcp_rh", "float32x4", "SSSE3", 4, false },
+        { "rcp_rh", "float32x8", "ALTIVEC", 5, false },
+        { "rcp_rh", "float32x8", "AVX", 4, false },
+        { "rcp_rh", "float32x8", "AVX2", 4, false },
+        { "rcp_rh", "float32x8", "NEON", 4, false },
+        { "rcp_rh", "float32x8", "SSE2", 7, false },
+        { "rcp_rh", "float32x8", "SSE3", 7, false },
+        { "rcp_rh", "float32x8", "SSE4.1", 7, false },
+        { "rcp_rh", "float32x8", "SSSE3", 7, false },
+        { "rsqrt_e", "float32x4", "ALTIVEC", 2, false },
+        { "rsqrt_e", "float32x4", "NEON", 2, false },
+        { "rsqrt_e", "float32x4", "SSE2", 2, false },
+        { "rsqrt_e", "float32x4", "SSE3", 2, false },
+        { "rsqrt_e", "float32x4", "SSE4.1", 2, false },
+        { "rsqrt_e", "float32x4", "SSSE3", 2, false },
+        { "rsqrt_rh", "float32x4", "ALTIVEC", 6, false },
+        { "rsqrt_rh", "float32x4", "NEON", 3, false },
+        { "rsqrt_rh", "float32x4", "SSE2", 7, false },
+        { "rsqrt_rh", "float32x4", "SSE3", 7, false },
+        { "rsqrt_rh", "float32x4", "SSE4.1", 7, false },
+        { "rsqrt_rh", "float32x4", "SSSE3", 7, false },
+        { "rsqrt_rh", "float32x8", "ALTIVEC", 10, false },
+        { "rsqrt_rh", "float32x8", "AVX", 7, false },
+        { "rsqrt_rh", "float32x8", "AVX2", 7, false },
+        { "rsqrt_rh", "float32x8", "NEON", 6, false },
+        { "rsqrt_rh", "float32x8", "SSE2", 12, false },
+        { "rsqrt_rh", "float32x8", "SSE3", 12, false },
+        { "rsqrt_rh", "float32x8", "SSE4.1", 12, false },
+        { "rsqrt_rh", "float32x8", "SSSE3", 12, false },
+        { "scatter", "int32x4", "ALTIVEC", 0, true },
+        { "scatter", "int32x4", "AVX", 0, true },
+        { "scatter", "int32x4", "AVX2", 0, true },
+        { "scatter", "int32x4", "NEON", 0, true },
+        { "scatter", "int32x4", "SSE2", 0, true },
+        { "scatter", "int32x4", "SSE3", 0, true },
+        { "scatter", "int32x4", "SSE4.1", 0, true },
+        { "scatter", "int32x4", "SSSE3", 0, true },
+        { "scatter", "int64x2", "ALTIVEC", 0, true },
+        { "scatter", "int64x2", "AVX", 0, true },
+        { "scatter", "int64x2", "AVX2", 0, true },
+        { "scatter", "int64x2", "NEON", 0, true },
+        { "scatter", "int64x2", "SSE2", 0, true },
+        { "scatter", "int64x2", "SSE3", 0, true },
+        { "scatter", "int64x2", "SSE4.1", 0, true },
+        { "scatter", "int64x2", "SSSE3", 0, true },
+        { "scatter", "uint32x4", "ALTIVEC", 0, true },
+        { "scatter", "uint32x4", "AVX", 0, true },
+        { "scatter", "uint32x4", "AVX2", 0, true },
+        { "scatter", "uint32x4", "NEON", 0, true },
+        { "scatter", "uint32x4", "SSE2", 0, true },
+        { "scatter", "uint32x4", "SSE3", 0, true },
+        { "scatter", "uint32x4", "SSE4.1", 0, true },
+        { "scatter", "uint32x4", "SSSE3", 0, true },
+        { "scatter", "uint64x2", "ALTIVEC", 0, true },
+        { "scatter", "uint64x2", "AVX", 0, true },
+        { "scatter", "uint64x2", "AVX2", 0, true },
+        { "scatter", "uint64x2", "NEON", 0, true },
+        { "scatter", "uint64x2", "SSE2", 0, true },
+        { "scatter", "uint64x2", "SSE3", 0, true },
+        { "scatter", "uint64x2", "SSE4.1", 0, true },
+        { "scatter", "uint64x2", "SSSE3", 0, true },
+        { "shift_l", "int16x16", "ALTIVEC", 5, false },
+        { "shift_l", "int16x16", "AVX", 2, false },
+        { "shift_l", "int16x16", "NEON", 3, false },
+        { "shift_l", "int16x16", "SSE2", 2, false },
+        { "shift_l", "int16x16", "SSE3", 2, false },
+        { "shift_l", "int16x16", "SSE4.1", 2, false },
+        { "shift_l", "int16x16", "SSSE3", 2, false },
+        { "shift_l", "int16x8", "ALTIVEC", 4, false },
+        { "shift_l", "int16x8", "NEON", 2, false },
+        { "shift_l", "int32x4", "ALTIVEC", 4, false },
+        { "shift_l", "int32x4", "NEON", 2, false },
+        { "shift_l", "int32x8", "ALTIVEC", 5, false },
+        { "shift_l", "int32x8", "AVX", 2, false },
+        { "shift_l", "int32x8", "NEON", 3, false },
+        { "shift_l", "int32x8", "SSE2", 2, false },
+        { "shift_l", "int32x8", "SSE3", 2, false },
+        { "shift_l", "int32x8", "SSE4.1", 2, false },
+        { "shift_l", "int32x8", "SSSE3", 2, false },
+        { "shift_l", "int64x2", "NEON", 2, false },
+        { "shift_l", "int64x4", "AVX", 2, false },
+        { "shift_l", "int64x4", "NEON", 3, false },
+        { "shift_l", "int64x4", "SSE2", 2, false },
+        { "shift_l", "int64x4", "SSE3", 2, false },
+        { "shift_l", "int64x4", "SSE4.1", 2, false },
+        { "shift_l", "int64x4", "SSSE3", 2, false },
+        { "shift_l", "int8x16", "ALTIVEC", 4, false },
+        { "shift_l", "int8x16", "AVX", 5, false },
+        { "shift_l", "int8x16", "AVX2", 3, false },
+        { "shift_l", "int8x16", "NEON", 2, false },
+        { "shift_l", "int8x16", "SSE2", 5, false },
+        { "shift_l", "int8x16", "SSE3", 5, false },
+        { "shift_l", "int8x16", "SSE4.1", 5, false },
+        { "shift_l", "int8x16", "SSSE3", 5, false },
+        { "shift_l", "int8x32", "ALTIVEC", 5, false },
+        { "shift_l", "int8x32", "AVX", 9, false },
+        { "shift_l", "int8x32", "AVX2", 5, false },
+        { "shift_l", "int8x32", "NEON", 3, false },
+        { "shift_l", "int8x32", "SSE2", 9, false },
+        { "shift_l", "int8x32", "SSE3", 9, false },
+        { "shift_l", "int8x32", "SSE4.1", 9, false },
+        { "shift_l", "int8x32", "SSSE3", 9, false },
+        { "shift_l", "uint16x16", "ALTIVEC", 5, false },
+        { "shift_l", "uint16x16", "AVX", 2, false },
+        { "shift_l", "uint16x16", "NEON", 3, false },
+        { "shift_l", "uint16x16", "SSE2", 2, false },
+        { "shift_l", "uint16x16", "SSE3", 2, false },
+        { "shift_l", "uint16x16", "SSE4.1", 2, false },
+        { "shift_l", "uint16x16", "SSSE3", 2, false },
+        { "shift_l", "uint16x8", "ALTIVEC", 4, false },
+        { "shift_l", "uint16x8", "NEON", 2, false },
+        { "shift_l", "uint32x4", "ALTIVEC", 4, false },
+        { "shift_l", "uint32x4", "NEON", 2, false },
+        { "shift_l", "uint32x8", "ALTIVEC", 5, false },
+        { "shift_l", "uint32x8", "AVX", 2, false },
+        { "shift_l", "uint32x8", "NEON", 3, false },
+        { "shift_l", "uint32x8", "SSE2", 2, false },
+        { "shift_l", "uint32x8", "SSE3", 2, false },
+        { "shift_l", "uint32x8", "SSE4.1", 2, false },
+        { "shift_l", "uint32x8", "SSSE3", 2, false },
+        { "shift_l", "uint64x2", "NEON", 2, false },
+        { "shift_l", "uint64x4", "AVX", 2, false },
+        { "shift_l", "uint64x4", "NEON", 3, false },
+        { "shift_l", "uint64x4", "SSE2", 2, false },
+        { "shift_l", "uint64x4", "SSE3", 2, false },
+        { "shift_l", "uint64x4", "SSE4.1", 2, false },
+        { "shift_l", "uint64x4", "SSSE3", 2, false },
+        { "shift_l", "uint8x16", "ALTIVEC", 4, false },
+        { "shift_l", "uint8x16", "AVX", 5, false },
+        { "shift_l", "uint8x16", "AVX2", 3, false },
+        { "shift_l", "uint8x16", "NEON", 2, false },
+        { "shift_l", "uint8x16", "SSE2", 5, false },
+        { "shift_l", "uint8x16", "SSE3", 5, false },
+        { "shift_l", "uint8x16", "SSE4.1", 5, false },
+        { "shift_l", "uint8x16", "SSSE3", 5, false },
+        { "shift_l", "uint8x32", "ALTIVEC", 5, false },
+        { "shift_l", "uint8x32", "AVX", 9, false },
+        { "shift_l", "uint8x32", "AVX2", 5, false },
+        { "shift_l", "uint8x32", "NEON", 3, false },
+        { "shift_l", "uint8x32", "SSE2", 9, false },
+        { "shift_l", "uint8x32", "SSE3", 9, false },
+        { "shift_l", "uint8x32", "SSE4.1", 9, false },
+        { "shift_l", "uint8x32", "SSSE3", 9, false },
+        { "shift_r", "int16x16", "ALTIVEC", 5, false },
+        { "shift_r", "int16x16", "AVX", 2, false },
+        { "shift_r", "int16x16", "NEON", 3, false },
+        { "shift_r", "int16x16", "SSE2", 2, false },
+        { "shift_r", "int16x16", "SSE3", 2, false },
+        { "shift_r", "int16x16", "SSE4.1", 2, false },
+        { "shift_r", "int16x16", "SSSE3", 2, false },
+        { "shift_r", "int16x8", "ALTIVEC", 4, false },
+        { "shift_r", "int16x8", "NEON", 2, false },
+        { "shift_r", "int32x4", "ALTIVEC", 4, false },
+        { "shift_r", "int32x4", "NEON", 2, false },
+        { "shift_r", "int32x8", "ALTIVEC", 5, false },
+        { "shift_r", "int32x8", "AVX", 2, false },
+        { "shift_r", "int32x8", "NEON", 3, false },
+        { "shift_r", "int32x8", "SSE2", 2, false },
+        { "shift_r", "int32x8", "SSE3", 2, false },
+        { "shift_r", "int32x8", "SSE4.1", 2, false },
+        { "shift_r", "int32x8", "SSSE3", 2, false },
+        { "shift_r", "int64x2", "AVX", 6, false },
+        { "shift_r", "int64x2", "AVX2", 6, false },
+        { "shift_r", "int64x2", "NEON", 2, false },
+        { "shift_r", "int64x2", "SSE2", 6, false },
+        { "shift_r", "int64x2", "SSE3", 6, false },
+        { "shift_r", "int64x2", "SSE4.1", 6, false },
+        { "shift_r", "int64x2", "SSSE3", 6, false },
+        { "shift_r", "int64x4", "AVX", 10, false },
+        { "shift_r", "int64x4", "AVX2", 6, false },
+        { "shift_r", "int64x4", "NEON", 3, false },
+        { "shift_r", "int64x4", "SSE2", 10, false },
+        { "shift_r", "int64x4", "SSE3", 10, false },
+        { "shift_r", "int64x4", "SSE4.1", 10, false },
+        { "shift_r", "int64x4", "SSSE3", 10, false },
+        { "shift_r", "int8x16", "ALTIVEC", 4, false },
+        { "shift_r", "int8x16", "AVX", 6, false },
+        { "shift_r", "int8x16", "AVX2", 6, false },
+        { "shift_r", "int8x16", "NEON", 2, false },
+        { "shift_r", "int8x16", "SSE2", 6, false },
+        { "shift_r", "int8x16", "SSE3", 6, false },
+        { "shift_r", "int8x16", "SSE4.1", 6, false },
+        { "shift_r", "int8x16", "SSSE3", 6, false },
+        { "shift_r", "int8x32", "ALTIVEC", 5, false },
+        { "shift_r", "int8x32", "AVX", 12, false },
+        { "shift_r", "int8x32", "AVX2", 6, false },
+        { "shift_r", "int8x32", "NEON", 3, false },
+        { "shift_r", "int8x32", "SSE2", 12, false },
+        { "shift_r", "int8x32", "SSE3", 12, false },
+        { "shift_r", "int8x32", "SSE4.1", 12, false },
+        { "shift_r", "int8x32", "SSSE3", 12, false },
+        { "shift_r", "uint16x16", "ALTIVEC", 5, false },
+        { "shift_r", "uint16x16", "AVX", 2, false },
+        { "shift_r", "uint16x16", "NEON", 3, false },
+        { "shift_r", "uint16x16", "SSE2", 2, false },
+        { "shift_r", "uint16x16", "SSE3", 2, false },
+        { "shift_r", "uint16x16", "SSE4.1", 2, false },
+        { "shift_r", "uint16x16", "SSSE3", 2, false },
+        { "shift_r", "uint16x8", "ALTIVEC", 4, false },
+        { "shift_r", "uint16x8", "NEON", 2, false },
+        { "shift_r", "uint32x4", "ALTIVEC", 4, false },
+        { "shift_r", "uint32x4", "NEON", 2, false },
+        { "shift_r", "uint32x8", "ALTIVEC", 5, false },
+        { "shift_r", "uint32x8", "AVX", 2, false },
+        { "shift_r", "uint32x8", "NEON", 3, false },
+        { "shift_r", "uint32x8", "SSE2", 2, false },
+        { "shift_r", "uint32x8", "SSE3", 2, false },
+        { "shift_r", "uint32x8", "SSE4.1", 2, false },
+        { "shift_r", "uint32x8", "SSSE3", 2, false },
+        { "shift_r", "uint64x2", "NEON", 2, false },
+        { "shift_r", "uint64x4", "AVX", 2, false },
+        { "shift_r", "uint64x4", "NEON", 3, false },
+        { "shift_r", "uint64x4", "SSE2", 2, false },
+        { "shift_r", "uint64x4", "SSE3", 2, false },
+        { "shift_r", "uint64x4", "SSE4.1", 2, false },
+        { "shift_r", "uint64x4", "SSSE3", 2, false },
+        { "shift_r", "uint8x16", "ALTIVEC", 4, false },
+        { "shift_r", "uint8x16", "AVX", 5, false },
+        { "shift_r", "uint8x16", "AVX2", 5, false },
+        { "shift_r", "uint8x16", "NEON", 2, false },
+        { "shift_r", "uint8x16", "SSE2", 5, false },
+        { "shift_r", "uint8x16", "SSE3", 5, false },
+        { "shift_r", "uint8x16", "SSE4.1", 5, false },
+        { "shift_r", "uint8x16", "SSSE3", 5, false },
+        { "shift_r", "uint8x32", "ALTIVEC", 5, false },
+        { "shift_r", "uint8x32", "AVX", 9, false },
+        { "shift_r", "uint8x32", "AVX2", 5, false },
+        { "shift_r", "uint8x32", "NEON", 3, false },
+        { "shift_r", "uint8x32", "SSE2", 9, false },
+        { "shift_r", "uint8x32", "SSE3", 9, false },
+        { "shift_r", "uint8x32", "SSE4.1", 9, false },
+        { "shift_r", "uint8x32", "SSSE3", 9, false },
+        { "shuffle1", "float64x2", "ALTIVEC", 0, true },
+        { "shuffle1", "float64x2", "NEON", 0, true },
+        { "shuffle1", "float64x4", "ALTIVEC", 0, true },
+        { "shuffle1", "float64x4", "AVX", 2, false },
+        { "shuffle1", "float64x4", "NEON", 0, true },
+        { "shuffle1", "float64x4", "SSE2", 2, false },
+        { "shuffle1", "float64x4", "SSE3", 2, false },
+        { "shuffle1", "float64x4", "SSE4.1", 2, false },
+        { "shuffle1", "float64x4", "SSSE3", 2, false },
+        { "shuffle1", "int64x2", "ALTIVEC", 0, true },
+        { "shuffle1", "int64x2", "NEON", 0, true },
+        { "shuffle1", "int64x4", "ALTIVEC", 0, true },
+        { "shuffle1", "int64x4", "AVX", 2, false },
+        { "shuffle1", "int64x4", "NEON", 0, true },
+        { "shuffle1", "int64x4", "SSE2", 2, false },
+        { "shuffle1", "int64x4", "SSE3", 2, false },
+        { "shuffle1", "int64x4", "SSE4.1", 2, false },
+        { "shuffle1", "int64x4", "SSSE3", 2, false },
+        { "shuffle1", "uint64x2", "ALTIVEC", 0, true },
+        { "shuffle1", "uint64x2", "NEON", 0, true },
+        { "shuffle1", "uint64x4", "ALTIVEC", 0, true },
+        { "shuffle1", "uint64x4", "AVX", 2, false },
+        { "shuffle1", "uint64x4", "NEON", 0, true },
+        { "shuffle1", "uint64x4", "SSE2", 2, false },
+        { "shuffle1", "uint64x4", "SSE3", 2, false },
+        { "shuffle1", "uint64x4", "SSE4.1", 2, false },
+        { "shuffle1", "uint64x4", "SSSE3", 2, false },
+        { "shuffle2", "float32x4", "ALTIVEC", 2, false },
+        { "shuffle2", "float32x4", "NEON", 4, false },
+        { "shuffle2", "float32x8", "ALTIVEC", 3, false },
+        { "shuffle2", "float32x8", "AVX", 2, false },
+        { "shuffle2", "float32x8", "NEON", 8, false },
+        { "shuffle2", "float32x8", "SSE2", 2, false },
+        { "shuffle2", "float32x8", "SSE3", 2, false },
+        { "shuffle2", "float32x8", "SSE4.1", 2, false },
+        { "shuffle2", "float32x8", "SSSE3", 2, false },
+        { "shuffle2", "int32x4", "ALTIVEC", 2, false },
+        { "shuffle2", "int32x4", "NEON", 4, false },
+        { "shuffle2", "int32x8", "ALTIVEC", 3, false },
+        { "shuffle2", "int32x8", "AVX", 2, false },
+        { "shuffle2", "int32x8", "NEON", 8, false },
+        { "shuffle2", "int32x8", "SSE2", 2, false },
+        { "shuffle2", "int32x8", "SSE3", 2, false },
+        { "shuffle2", "int32x8", "SSE4.1", 2, false },
+        { "shuffle2", "int32x8", "SSSE3", 2, false },
+        { "shuffle2", "uint32x4", "ALTIVEC", 2, false },
+        { "shuffle2", "uint32x4", "NEON", 4, false },
+        { "shuffle2", "uint32x8", "ALTIVEC", 3, false },
+        { "shuffle2", "uint32x8", "AVX", 2, false },
+        { "shuffle2", "uint32x8", "NEON", 8, false },
+        { "shuffle2", "uint32x8", "SSE2", 2, false },
+        { "shuffle2", "uint32x8", "SSE3", 2, false },
+        { "shuffle2", "uint32x8", "SSE4.1", 2, false },
+        { "shuffle2", "uint32x8", "SSSE3", 2, false },
+        { "shuffle_bytes16", "uint8x16", "AVX", 4, false },
+        { "shuffle_bytes16", "uint8x16", "AVX2", 4, false },
+        { "shuffle_bytes16", "uint8x16", "NEON", 2, false },
+        { "shuffle_bytes16", "uint8x16", "SSE4.1", 4, false },
+        { "shuffle_bytes16", "uint8x16", "SSSE3", 6, false },
+        { "shuffle_bytes16", "uint8x32", "ALTIVEC", 2, false },
+        { "shuffle_bytes16", "uint8x32", "AVX", 8, false },
+        { "shuffle_bytes16", "uint8x32", "NEON", 4, false },
+        { "shuffle_bytes16", "uint8x32", "SSE4.1", 8, false },
+        { "shuffle_bytes16", "uint8x32", "SSSE3", 12, false },
+        { "shuffle_zbytes16", "uint8x16", "ALTIVEC", 2, false },
+        { "shuffle_zbytes16", "uint8x16", "AVX", 6, false },
+        { "shuffle_zbytes16", "uint8x16", "AVX2", 6, false },
+        { "shuffle_zbytes16", "uint8x16", "NEON", 2, false },
+        { "shuffle_zbytes16", "uint8x16", "SSE4.1", 6, false },
+        { "shuffle_zbytes16", "uint8x16", "SSSE3", 9, false },
+        { "shuffle_zbytes16", "uint8x32", "ALTIVEC", 3, false },
+        { "shuffle_zbytes16", "uint8x32", "AVX", 12, false },
+        { "shuffle_zbytes16", "uint8x32", "AVX2", 6, false },
+        { "shuffle_zbytes16", "uint8x32", "NEON", 4, false },
+        { "shuffle_zbytes16", "uint8x32", "SSE4.1", 12, false },
+        { "shuffle_zbytes16", "uint8x32", "SSSE3", 18, false },
+        { "sign", "float32x4", "ALTIVEC", 2, false },
+        { "sign", "float32x4", "NEON", 2, false },
+        { "sign", "float32x4", "SSE2", 2, false },
+        { "sign", "float32x4", "SSE3", 2, false },
+        { "sign", "float32x4", "SSE4.1", 2, false },
+        { "sign", "float32x4", "SSSE3", 2, false },
+        { "sign", "float32x8", "ALTIVEC", 3, false },
+        { "sign", "float32x8", "AVX", 2, false },
+        { "sign", "float32x8", "AVX2", 2, false },
+        { "sign", "float32x8", "NEON", 3, false },
+        { "sign", "float32x8", "SSE2", 3, false },
+        { "sign", "float32x8", "SSE3", 3, false },
+        { "sign", "float32x8", "SSE4.1", 3, false },
+        { "sign", "float32x8", "SSSE3", 3, false },
+        { "sign", "float64x2", "ALTIVEC", 0, true },
+        { "sign", "float64x2", "AVX", 2, false },
+        { "sign", "float64x2", "AVX2", 2, false },
+        { "sign", "float64x2", "NEON", 0, true },
+        { "sign", "float64x2", "SSE2", 2, false },
+        { "sign", "float64x2", "SSE3", 2, false },
+        { "sign", "float64x2", "SSE4.1", 2, false },
+        { "sign", "float64x2", "SSSE3", 2, false },
+        { "sign", "float64x4", "ALTIVEC", 0, true },
+        { "sign", "float64x4", "AVX", 2, false },
+        { "sign", "float64x4", "AVX2", 2, false },
+        { "sign", "float64x4", "NEON", 0, true },
+        { "sign", "float64x4", "SSE2", 3, false },
+        { "sign", "float64x4", "SSE3", 3, false },
+        { "sign", "float64x4", "SSE4.1", 3, false },
+        { "sign", "float64x4", "SSSE3", 3, false },
+        { "splat", "float32x4", "ALTIVEC", 0, true },
+        { "splat", "float32x4", "AVX", 5, false },
+        { "splat", "float32x4", "AVX2", 2, false },
+        { "splat", "float32x4", "NEON", 0, true },
+        { "splat", "float32x4", "SSE2", 5, false },
+        { "splat", "float32x4", "SSE3", 5, false },
+        { "splat", "float32x4", "SSE4.1", 5, false },
+        { "splat", "float32x4", "SSSE3", 5, false },
+        { "splat", "float32x8", "ALTIVEC", 0, true },
+        { "splat", "float32x8", "AVX", 6, false },
+        { "splat", "float32x8", "NEON", 0, true },
+        { "splat", "float32x8", "SSE2", 6, false },
+        { "splat", "float32x8", "SSE3", 6, false },
+        { "splat", "float32x8", "SSE4.1", 6, false },
+        { "splat", "float32x8", "SSSE3", 6, false },
+        { "splat", "float64x2", "ALTIVEC", 0, true },
+        { "splat", "float64x2", "AVX", 5, false },
+        { "splat", "float64x2", "AVX2", 2, false },
+        { "splat", "float64x2", "NEON", 0, true },
+        { "splat", "float64x2", "SSE2", 5, false },
+        { "splat", "float64x2", "SSE3", 5, false },
+        { "splat", "float64x2", "SSE4.1", 5, false },
+        { "splat", "float64x2", "SSSE3", 5, false },
+        { "splat", "float64x4", "ALTIVEC", 0, true },
+        { "splat", "float64x4", "AVX", 6, false },
+        { "splat", "float64x4", "NEON", 0, true },
+        { "splat", "float64x4", "SSE2", 6, false },
+        { "splat", "float64x4", "SSE3", 6, false },
+        { "splat", "float64x4", "SSE4.1", 6, false },
+        { "splat", "float64x4", "SSSE3", 6, false },
+        { "splat", "int16x16", "ALTIVEC", 0, true },
+        { "splat", "int16x16", "AVX", 6, false },
+        { "splat", "int16x16", "NEON", 0, true },
+        { "splat", "int16x16", "SSE2", 6, false },
+        { "splat", "int16x16", "SSE3", 6, false },
+        { "splat", "int16x16", "SSE4.1", 6, false },
+        { "splat", "int16x16", "SSSE3", 6, false },
+        { "splat", "int16x8", "ALTIVEC", 0, true },
+        { "splat", "int16x8", "AVX", 5, false },
+        { "splat", "int16x8", "AVX2", 2, false },
+        { "splat", "int16x8", "NEON", 0, true },
+        { "splat", "int16x8", "SSE2", 5, false },
+        { "splat", "int16x8", "SSE3", 5, false },
+        { "splat", "int16x8", "SSE4.1", 5, false },
+        { "splat", "int16x8", "SSSE3", 5, false },
+        { "splat", "int32x4", "ALTIVEC", 0, true },
+        { "splat", "int32x4", "AVX", 5, false },
+        { "splat", "int32x4", "AVX2", 2, false },
+        { "splat", "int32x4", "NEON", 0, true },
+        { "splat", "int32x4", "SSE2", 5, false },
+        { "splat", "int32x4", "SSE3", 5, false },
+        { "splat", "int32x4", "SSE4.1", 5, false },
+        { "splat", "int32x4", "SSSE3", 5, false },
+        { "splat", "int32x8", "ALTIVEC", 0, true },
+        { "splat", "int32x8", "AVX", 6, false },
+        { "splat", "int32x8", "NEON", 0, true },
+        { "splat", "int32x8", "SSE2", 6, false },
+        { "splat", "int32x8", "SSE3", 6, false },
+        { "splat", "int32x8", "SSE4.1", 6, false },
+        { "splat", "int32x8", "SSSE3", 6, false },
+        { "splat", "int64x2", "ALTIVEC", 0, true },
+        { "splat", "int64x2", "AVX", 5, false },
+        { "splat", "int64x2", "AVX2", 2, false },
+        { "splat", "int64x2", "NEON", 0, true },
+        { "splat", "int64x2", "SSE2", 5, false },
+        { "splat", "int64x2", "SSE3", 5, false },
+        { "splat", "int64x2", "SSE4.1", 5, false },
+        { "splat", "int64x2", "SSSE3", 5, false },
+        { "splat", "int64x4", "ALTIVEC", 0, true },
+        { "splat", "int64x4", "AVX", 6, false },
+        { "splat", "int64x4", "NEON", 0, true },
+        { "splat", "int64x4", "SSE2", 6, false },
+        { "splat", "int64x4", "SSE3", 6, false },
+        { "splat", "int64x4", "SSE4.1", 6, false },
+        { "splat", "int64x4", "SSSE3", 6, false },
+        { "splat", "int8x16", "ALTIVEC", 0, true },
+        { "splat", "int8x16", "AVX", 5, false },
+        { "splat", "int8x16", "AVX2", 2, false },
+        { "splat", "int8x16", "NEON", 0, true },
+        { "splat", "int8x16", "SSE2", 5, false },
+        { "splat", "int8x16", "SSE3", 5, false },
+        { "splat", "int8x16", "SSE4.1", 5, false },
+        { "splat", "int8x16", "SSSE3", 5, false },
+        { "splat", "int8x32", "ALTIVEC", 0, true },
+        { "splat", "int8x32", "AVX", 6, false },
+        { "splat", "int8x32", "NEON", 0, true },
+        { "splat", "int8x32", "SSE2", 6, false },
+        { "splat", "int8x32", "SSE3", 6, false },
+        { "splat", "int8x32", "SSE4.1", 6, false },
+        { "splat", "int8x32", "SSSE3", 6, false },
+        { "splat", "uint16x16", "ALTIVEC", 0, true },
+        { "splat", "uint16x16", "AVX", 6, false },
+        { "splat", "uint16x16", "NEON", 0, true },
+        { "splat", "uint16x16", "SSE2", 6, false },
+        { "splat", "uint16x16", "SSE3", 6, false },
+        { "splat", "uint16x16", "SSE4.1", 6, false },
+        { "splat", "uint16x16", "SSSE3", 6, false },
+        { "splat", "uint16x8", "ALTIVEC", 0, true },
+        { "splat", "uint16x8", "AVX", 5, false },
+        { "splat", "uint16x8", "AVX2", 2, false },
+        { "splat", "uint16x8", "NEON", 0, true },
+        { "splat", "uint16x8", "SSE2", 5, false },
+        { "splat", "uint16x8", "SSE3", 5, false },
+        { "splat", "uint16x8", "SSE4.1", 5, false },
+        { "splat", "uint16x8", "SSSE3", 5, false },
+        { "splat", "uint32x4", "ALTIVEC", 0, true },
+        { "splat", "uint32x4", "AVX", 5, false },
+        { "splat", "uint32x4", "AVX2", 2, false },
+        { "splat", "uint32x4", "NEON", 0, true },
+        { "splat", "uint32x4", "SSE2", 5, false },
+        { "splat", "uint32x4", "SSE3", 5, false },
+        { "splat", "uint32x4", "SSE4.1", 5, false },
+        { "splat", "uint32x4", "SSSE3", 5, false },
+        { "splat", "uint32x8", "ALTIVEC", 0, true },
+        { "splat", "uint32x8", "AVX", 6, false },
+        { "splat", "uint32x8", "NEON", 0, true },
+        { "splat", "uint32x8", "SSE2", 6, false },
+        { "splat", "uint32x8", "SSE3", 6, false },
+        { "splat", "uint32x8", "SSE4.1", 6, false },
+        { "splat", "uint32x8", "SSSE3", 6, false },
+        { "splat", "uint64x2", "ALTIVEC", 0, true },
+        { "splat", "uint64x2", "AVX", 5, false },
+        { "splat", "uint64x2", "AVX2", 2, false },
+        { "splat", "uint64x2", "NEON", 0, true },
+        { "splat", "uint64x2", "SSE2", 5, false },
+        { "splat", "uint64x2", "SSE3", 5, false },
+        { "splat", "uint64x2", "SSE4.1", 5, false },
+        { "splat", "uint64x2", "SSSE3", 5, false },
+        { "splat", "uint64x4", "ALTIVEC", 0, true },
+        { "splat", "uint64x4", "AVX", 6, false },
+        { "splat", "uint64x4", "NEON", 0, true },
+        { "splat", "uint64x4", "SSE2", 6, false },
+        { "splat", "uint64x4", "SSE3", 6, false },
+        { "splat", "uint64x4", "SSE4.1", 6, false },
+        { "splat", "uint64x4", "SSSE3", 6, false },
+        { "splat", "uint8x16", "ALTIVEC", 0, true },
+        { "splat", "uint8x16", "AVX", 5, false },
+        { "splat", "uint8x16", "AVX2", 2, false },
+        { "splat", "uint8x16", "NEON", 0, true },
+        { "splat", "uint8x16", "SSE2", 5, false },
+        { "splat", "uint8x16", "SSE3", 5, false },
+        { "splat", "uint8x16", "SSE4.1", 5, false },
+        { "splat", "uint8x16", "SSSE3", 5, false },
+        { "splat", "uint8x32", "ALTIVEC", 0, true },
+        { "splat", "uint8x32", "AVX", 6, false },
+        { "splat", "uint8x32", "NEON", 0, true },
+        { "splat", "uint8x32", "SSE2", 6, false },
+        { "splat", "uint8x32", "SSE3", 6, false },
+        { "splat", "uint8x32", "SSE4.1", 6, false },
+        { "splat", "uint8x32", "SSSE3", 6, false },
+        { "splat16", "int8x16", "AVX", 2, false },
+        { "splat16", "int8x16", "AVX2", 2, false },
+        { "splat16", "int8x16", "SSE2", 7, false },
+        { "splat16", "int8x16", "SSE3", 7, false },
+        { "splat16", "int8x16", "SSE4.1", 2, false },
+        { "splat16", "int8x16", "SSSE3", 2, false },
+        { "splat16", "int8x32", "ALTIVEC", 2, false },
+        { "splat16", "int8x32", "AVX", 3, false },
+        { "splat16", "int8x32", "NEON", 2, false },
+        { "splat16", "int8x32", "SSE2", 14, false },
+        { "splat16", "int8x32", "SSE3", 14, false },
+        { "splat16", "int8x32", "SSE4.1", 3, false },
+        { "splat16", "int8x32", "SSSE3", 3, false },
+        { "splat16", "uint8x16", "AVX", 2, false },
+        { "splat16", "uint8x16", "AVX2", 2, false },
+        { "splat16", "uint8x16", "SSE2", 7, false },
+        { "splat16", "uint8x16", "SSE3", 7, false },
+        { "splat16", "uint8x16", "SSE4.1", 2, false },
+        { "splat16", "uint8x16", "SSSE3", 2, false },
+        { "splat16", "uint8x32", "ALTIVEC", 2, false },
+        { "splat16", "uint8x32", "AVX", 3, false },
+        { "splat16", "uint8x32", "NEON", 2, false },
+        { "splat16", "uint8x32", "SSE2", 14, false },
+        { "splat16", "uint8x32", "SSE3", 14, false },
+        { "splat16", "uint8x32", "SSE4.1", 3, false },
+        { "splat16", "uint8x32", "SSSE3", 3, false },
+        { "splat2", "float64x2", "ALTIVEC", 0, true },
+        { "splat2", "float64x2", "NEON", 0, true },
+        { "splat2", "float64x4", "ALTIVEC", 0, true },
+        { "splat2", "float64x4", "AVX", 2, false },
+        { "splat2", "float64x4", "NEON", 0, true },
+        { "splat2", "float64x4", "SSE2", 2, false },
+        { "splat2", "float64x4", "SSE3", 2, false },
+        { "splat2", "float64x4", "SSE4.1", 2, false },
+        { "splat2", "float64x4", "SSSE3", 2, false },
+        { "splat2", "int64x2", "ALTIVEC", 2, false },
+        { "splat2", "int64x4", "ALTIVEC", 3, false },
+        { "splat2", "int64x4", "AVX", 2, false },
+        { "splat2", "int64x4", "NEON", 2, false },
+        { "splat2", "int64x4", "SSE2", 2, false },
+        { "splat2", "int64x4", "SSE3", 2, false },
+        { "splat2", "int64x4", "SSE4.1", 2, false },
+        { "splat2", "int64x4", "SSSE3", 2, false },
+        { "splat2", "uint64x2", "ALTIVEC", 2, false },
+        { "splat2", "uint64x4", "ALTIVEC", 3, false },
+        { "splat2", "uint64x4", "AVX", 2, false },
+        { "splat2", "uint64x4", "NEON", 2, false },
+        { "splat2", "uint64x4", "SSE2", 2, false },
+        { "splat2", "uint64x4", "SSE3", 2, false },
+        { "splat2", "uint64x4", "SSE4.1", 2, false },
+        { "splat2", "uint64x4", "SSSE3", 2, false },
+        { "splat4", "float32x8", "ALTIVEC", 2, false },
+        { "splat4", "float32x8", "AVX", 2, false },
+        { "splat4", "float32x8", "NEON", 2, false },
+        { "splat4", "float32x8", "SSE2", 2, false },
+        { "splat4", "float32x8", "SSE3", 2, false },
+        { "splat4", "float32x8", "SSE4.1", 2, false },
+        { "splat4", "float32x8", "SSSE3", 2, false },
+        { "splat4", "int32x8", "ALTIVEC", 2, false },
+        { "splat4", "int32x8", "NEON", 2, false },
+        { "splat4", "uint32x8", "ALTIVEC", 2, false },
+        { "splat4", "uint32x8", "NEON", 2, false },
+        { "splat8", "int16x16", "ALTIVEC", 2, false },
+        { "splat8", "int16x16", "AVX", 3, false },
+        { "splat8", "int16x16", "AVX2", 2, false },
+        { "splat8", "int16x16", "NEON", 2, false },
+        { "splat8", "int16x16", "SSE2", 6, false },
+        { "splat8", "int16x16", "SSE3", 6, false },
+        { "splat8", "int16x16", "SSE4.1", 3, false },
+        { "splat8", "int16x16", "SSSE3", 3, false },
+        { "splat8", "int16x8", "AVX", 2, false },
+        { "splat8", "int16x8", "AVX2", 2, false },
+        { "splat8", "int16x8", "SSE2", 3, false },
+        { "splat8", "int16x8", "SSE3", 3, false },
+        { "splat8", "int16x8", "SSE4.1", 2, false },
+        { "splat8", "int16x8", "SSSE3", 2, false },
+        { "splat8", "uint16x16", "ALTIVEC", 2, false },
+        { "splat8", "uint16x16", "AVX", 3, false },
+        { "splat8", "uint16x16", "AVX2", 2, false },
+        { "splat8", "uint16x16", "NEON", 2, false },
+        { "splat8", "uint16x16", "SSE2", 6, false },
+        { "splat8", "uint16x16", "SSE3", 6, false },
+        { "splat8", "uint16x16", "SSE4.1", 3, false },
+        { "splat8", "uint16x16", "SSSE3", 3, false },
+        { "splat8", "uint16x8", "AVX", 2, false },
+        { "splat8", "uint16x8", "AVX2", 2, false },
+        { "splat8", "uint16x8", "SSE2", 3, false },
+        { "splat8", "uint16x8", "SSE3", 3, false },
+        { "splat8", "uint16x8", "SSE4.1", 2, false },
+        { "splat8", "uint16x8", "SSSE3", 2, false },
+        { "sqrt", "float32x4", "ALTIVEC", 7, false },
+        { "sqrt", "float32x4", "NEON", 5, false },
+        { "sqrt", "float32x8", "ALTIVEC", 12, false },
+        { "sqrt", "float32x8", "NEON", 10, false },
+        { "sqrt", "float32x8", "SSE2", 2, false },
+        { "sqrt", "float32x8", "SSE3", 2, false },
+        { "sqrt", "float32x8", "SSE4.1", 2, false },
+        { "sqrt", "float32x8", "SSSE3", 2, false },
+        { "sqrt", "float64x2", "ALTIVEC", 0, true },
+        { "sqrt", "float64x2", "NEON", 0, true },
+        { "sqrt", "float64x4", "ALTIVEC", 0, true },
+        { "sqrt", "float64x4", "NEON", 0, true },
+        { "sqrt", "float64x4", "SSE2", 2, false },
+        { "sqrt", "float64x4", "SSE3", 2, false },
+        { "sqrt", "float64x4", "SSE4.1", 2, false },
+        { "sqrt", "float64x4", "SSSE3", 2, false },
+        { "store", "float32x8", "ALTIVEC", 2, false },
+        { "store", "float32x8", "NEON", 2, false },
+        { "store", "float32x8", "SSE2", 2, false },
+        { "store", "float32x8", "SSE3", 2, false },
+        { "store", "float32x8", "SSE4.1", 2, false },
+        { "store", "float32x8", "SSSE3", 2, false },
+        { "store", "float64x4", "ALTIVEC", 2, false },
+        { "store", "float64x4", "NEON", 2, false },
+        { "store", "float64x4", "SSE2", 2, false },
+        { "store", "float64x4", "SSE3", 2, false },
+        { "store", "float64x4", "SSE4.1", 2, false },
+        { "store", "float64x4", "SSSE3", 2, false },
+        { "store", "int16x16", "ALTIVEC", 2, false },
+        { "store", "int16x16", "NEON", 2, false },
+        { "store", "int16x16", "SSE2", 2, false },
+        { "store", "int16x16", "SSE3", 2, false },
+        { "store", "int16x16", "SSE4.1", 2, false },
+        { "store", "int16x16", "SSSE3", 2, false },
+        { "store", "int32x8", "ALTIVEC", 2, false },
+        { "store", "int32x8", "NEON", 2, false },
+        { "store", "int32x8", "SSE2", 2, false },
+        { "store", "int32x8", "SSE3", 2, false },
+        { "store", "int32x8", "SSE4.1", 2, false },
+        { "store", "int32x8", "SSSE3", 2, false },
+        { "store", "int64x4", "ALTIVEC", 2, false },
+        { "store", "int64x4", "NEON", 2, false },
+        { "store", "int64x4", "SSE2", 2, false },
+        { "store", "int64x4", "SSE3", 2, false },
+        { "store", "int64x4", "SSE4.1", 2, false },
+        { "store", "int64x4", "SSSE3", 2, false },
+        { "store", "int8x32", "ALTIVEC", 2, false },
+        { "store", "int8x32", "NEON", 2, false },
+        { "store", "int8x32", "SSE2", 2, false },
+        { "store", "int8x32", "SSE3", 2, false },
+        { "store", "int8x32", "SSE4.1", 2, false },
+        { "store", "int8x32", "SSSE3", 2, false },
+        { "store", "uint16x16", "ALTIVEC", 2, false },
+        { "store", "uint16x16", "NEON", 2, false },
+        { "store", "uint16x16", "SSE2", 2, false },
+        { "store", "uint16x16", "SSE3", 2, false },
+        { "store", "uint16x16", "SSE4.1", 2, false },
+        { "store", "uint16x16", "SSSE3", 2, false },
+        { "store", "uint32x8", "ALTIVEC", 2, false },
+        { "store", "uint32x8", "NEON", 2, false },
+        { "store", "uint32x8", "SSE2", 2, false },
+        { "store", "uint32x8", "SSE3", 2, false },
+        { "store", "uint32x8", "SSE4.1", 2, false },
+        { "store", "uint32x8", "SSSE3", 2, false },
+        { "store", "uint64x4", "ALTIVEC", 2, false },
+        { "store", "uint64x4", "NEON", 2, false },
+        { "store", "uint64x4", "SSE2", 2, false },
+        { "store", "uint64x4", "SSE3", 2, false },
+        { "store", "uint64x4", "SSE4.1", 2, false },
+        { "store", "uint64x4", "SSSE3", 2, false },
+        { "store", "uint8x32", "ALTIVEC", 2, false },
+        { "store", "uint8x32", "NEON", 2, false },
+        { "store", "uint8x32", "SSE2", 2, false },
+        { "store", "uint8x32", "SSE3", 2, false },
+        { "store", "uint8x32", "SSE4.1", 2, false },
+        { "store", "uint8x32", "SSSE3", 2, false },
+        { "store_compress", "float32x4", "ALTIVEC", 0, true },
+        { "store_compress", "float32x4", "NEON", 0, true },
+        { "store_compress", "float32x4", "SSE2", 0, true },
+        { "store_compress", "float64x2", "ALTIVEC", 0, true },
+        { "store_compress", "float64x2", "NEON", 0, true },
+        { "store_compress", "float64x2", "SSE2", 0, true },
+        { "store_compress", "int16x8", "ALTIVEC", 0, true },
+        { "store_compress", "int16x8", "NEON", 0, true },
+        { "store_compress", "int16x8", "SSE2", 0, true },
+        { "store_compress", "int32x4", "ALTIVEC", 0, true },
+        { "store_compress", "int32x4", "NEON", 0, true },
+        { "store_compress", "int32x4", "SSE2", 0, true },
+        { "store_compress", "int64x2", "ALTIVEC", 0, true },
+        { "store_compress", "int64x2", "NEON", 0, true },
+        { "store_compress", "int64x2", "SSE2", 0, true },
+        { "store_compress", "int8x16", "ALTIVEC", 0, true },
+        { "store_compress", "int8x16", "NEON", 0, true },
+        { "store_compress", "int8x16", "SSE2", 0, true },
+        { "store_compress", "uint16x8", "ALTIVEC", 0, true },
+        { "store_compress", "uint16x8", "NEON", 0, true },
+        { "store_compress", "uint16x8", "SSE2", 0, true },
+        { "store_compress", "uint32x4", "ALTIVEC", 0, true },
+        { "store_compress", "uint32x4", "NEON", 0, true },
+        { "store_compress", "uint32x4", "SSE2", 0, true },
+        { "store_compress", "uint64x2", "ALTIVEC", 0, true },
+        { "store_compress", "uint64x2", "NEON", 0, true },
+        { "store_compress", "uint64x2", "SSE2", 0, true },
+        { "store_compress", "uint8x16", "ALTIVEC", 0, true },
+        { "store_compress", "uint8x16", "NEON", 0, true },
+        { "store_compress", "uint8x16", "SSE2", 0, true },
+        { "stream", "float32x8", "ALTIVEC", 2, false },
+        { "stream", "float32x8", "NEON", 2, false },
+        { "stream", "float32x8", "SSE2", 2, false },
+        { "stream", "float32x8", "SSE3", 2, false },
+        { "stream", "float32x8", "SSE4.1", 2, false },
+        { "stream", "float32x8", "SSSE3", 2, false },
+        { "stream", "float64x4", "ALTIVEC", 2, false },
+        { "stream", "float64x4", "NEON", 2, false },
+        { "stream", "float64x4", "SSE2", 2, false },
+        { "stream", "float64x4", "SSE3", 2, false },
+        { "stream", "float64x4", "SSE4.1", 2, false },
+        { "stream", "float64x4", "SSSE3", 2, false },
+        { "stream", "int16x16", "ALTIVEC", 2, false },
+        { "stream", "int16x16", "NEON", 2, false },
+        { "stream", "int16x16", "SSE2", 2, false },
+        { "stream", "int16x16", "SSE3", 2, false },
+        { "stream", "int16x16", "SSE4.1", 2, false },
+        { "stream", "int16x16", "SSSE3", 2, false },
+        { "stream", "int32x8", "ALTIVEC", 2, false },
+        { "stream", "int32x8", "NEON", 2, false },
+        { "stream", "int32x8", "SSE2", 2, false },
+        { "stream", "int32x8", "SSE3", 2, false },
+        { "stream", "int32x8", "SSE4.1", 2, false },
+        { "stream", "int32x8", "SSSE3", 2, false },
+        { "stream", "int64x4", "ALTIVEC", 2, false },
+        { "stream", "int64x4", "NEON", 2, false },
+        { "stream", "int64x4", "SSE2", 2, false },
+        { "stream", "int64x4", "SSE3", 2, false },
+        { "stream", "int64x4", "SSE4.1", 2, false },
+        { "stream", "int64x4", "SSSE3", 2, false },
+        { "stream", "int8x32", "ALTIVEC", 2, false },
+        { "stream", "int8x32", "NEON", 2, false },
+        { "stream", "int8x32", "SSE2", 2, false },
+        { "stream", "int8x32", "SSE3", 2, false },
+        { "stream", "int8x32", "SSE4.1", 2, false },
+        { "stream", "int8x32", "SSSE3", 2, false },
+        { "stream", "uint16x16", "ALTIVEC", 2, false },
+        { "stream", "uint16x16", "NEON", 2, false },
+        { "stream", "uint16x16", "SSE2", 2, false },
+        { "stream", "uint16x16", "SSE3", 2, false },
+        { "stream", "uint16x16", "SSE4.1", 2, false },
+        { "stream", "uint16x16", "SSSE3", 2, false },
+        { "stream", "uint32x8", "ALTIVEC", 2, false },
+        { "stream", "uint32x8", "NEON", 2, false },
+        { "stream", "uint32x8", "SSE2", 2, false },
+        { "stream", "uint32x8", "SSE3", 2, false },
+        { "stream", "uint32x8", "SSE4.1", 2, false },
+        { "stream", "uint32x8", "SSSE3", 2, false },
+        { "stream", "uint64x4", "ALTIVEC", 2, false },
+        { "stream", "uint64x4", "NEON", 2, false },
+        { "stream", "uint64x4", "SSE2", 2, false },
+        { "stream", "uint64x4", "SSE3", 2, false },
+        { "stream", "uint64x4", "SSE4.1", 2, false },
+        { "stream", "uint64x4", "SSSE3", 2, false },
+        { "stream", "uint8x32", "ALTIVEC", 2, false },
+        { "stream", "uint8x32", "NEON", 2, false },
+        { "stream", "uint8x32", "SSE2", 2, false },
+        { "stream", "uint8x32", "SSE3", 2, false },
+        { "stream", "uint8x32", "SSE4.1", 2, false },
+        { "stream", "uint8x32", "SSSE3", 2, false },
+        { "sub", "float32x8", "ALTIVEC", 2, false },
+        { "sub", "float32x8", "NEON", 2, false },
+        { "sub", "float32x8", "SSE2", 2, false },
+        { "sub", "float32x8", "SSE3", 2, false },
+        { "sub", "float32x8", "SSE4.1", 2, false },
+        { "sub", "float32x8", "SSSE3", 2, false },
+        { "sub", "float64x2", "ALTIVEC", 0, true },
+        { "sub", "float64x2", "NEON", 0, true },
+        { "sub", "float64x4", "ALTIVEC", 0, true },
+        { "sub", "float64x4", "NEON", 0, true },
+        { "sub", "float64x4", "SSE2", 2, false },
+        { "sub", "float64x4", "SSE3", 2, false },
+        { "sub", "float64x4", "SSE4.1", 2, false },
+        { "sub", "float64x4", "SSSE3", 2, false },
+        { "sub", "int16x16", "ALTIVEC", 2, false },
+        { "sub", "int16x16", "AVX", 2, false },
+        { "sub", "int16x16", "NEON", 2, false },
+        { "sub", "int16x16", "SSE2", 2, false },
+        { "sub", "int16x16", "SSE3", 2, false },
+        { "sub", "int16x16", "SSE4.1", 2, false },
+        { "sub", "int16x16", "SSSE3", 2, false },
+        { "sub", "int32x8", "ALTIVEC", 2, false },
+        { "sub", "int32x8", "AVX", 2, false },
+        { "sub", "int32x8", "NEON", 2, false },
+        { "sub", "int32x8", "SSE2", 2, false },
+        { "sub", "int32x8", "SSE3", 2, false },
+        { "sub", "int32x8", "SSE4.1", 2, false },
+        { "sub", "int32x8", "SSSE3", 2, false },
+        { "sub", "int64x2", "ALTIVEC", 6, false },
+        { "sub", "int64x4", "ALTIVEC", 11, false },
+        { "sub", "int64x4", "AVX", 2, false },
+        { "sub", "int64x4", "NEON", 2, false },
+        { "sub", "int64x4", "SSE2", 2, false },
+        { "sub", "int64x4", "SSE3", 2, false },
+        { "sub", "int64x4", "SSE4.1", 2, false },
+        { "sub", "int64x4", "SSSE3", 2, false },
+        { "sub", "int8x32", "ALTIVEC", 2, false },
+        { "sub", "int8x32", "AVX", 2, false },
+        { "sub", "int8x32", "NEON", 2, false },
+        { "sub", "int8x32", "SSE2", 2, false },
+        { "sub", "int8x32", "SSE3", 2, false },
+        { "sub", "int8x32", "SSE4.1", 2, false },
+        { "sub", "int8x32", "SSSE3", 2, false },
+        { "sub", "uint16x16", "ALTIVEC", 2, false },
+        { "sub", "uint16x16", "AVX", 2, false },
+        { "sub", "uint16x16", "NEON", 2, false },
+        { "sub", "uint16x16", "SSE2", 2, false },
+        { "sub", "uint16x16", "SSE3", 2, false },
+        { "sub", "uint16x16", "SSE4.1", 2, false },
+        { "sub", "uint16x16", "SSSE3", 2, false },
+        { "sub", "uint32x8", "ALTIVEC", 2, false },
+        { "sub", "uint32x8", "AVX", 2, false },
+        { "sub", "uint32x8", "NEON", 2, false },
+        { "sub", "uint32x8", "SSE2", 2, false },
+        { "sub", "uint32x8", "SSE3", 2, false },
+        { "sub", "uint32x8", "SSE4.1", 2, false },
+        { "sub", "uint32x8", "SSSE3", 2, false },
+        { "sub", "uint64x2", "ALTIVEC", 6, false },
+        { "sub", "uint64x4", "ALTIVEC", 11, false },
+        { "sub", "uint64x4", "AVX", 2, false },
+        { "sub", "uint64x4", "NEON", 2, false },
+        { "sub", "uint64x4", "SSE2", 2, false },
+        { "sub", "uint64x4", "SSE3", 2, false },
+        { "sub", "uint64x4", "SSE4.1", 2, false },
+        { "sub", "uint64x4", "SSSE3", 2, false },
+        { "sub", "uint8x32", "ALTIVEC", 2, false },
+        { "sub", "uint8x32", "AVX", 2, false },
+        { "sub", "uint8x32", "NEON", 2, false },
+        { "sub", "uint8x32", "SSE2", 2, false },
+        { "sub", "uint8x32", "SSE3", 2, false },
+        { "sub", "uint8x32", "SSE4.1", 2, false },
+        { "sub", "uint8x32", "SSSE3", 2, false },
+        { "subs", "int16x16", "ALTIVEC", 2, false },
+        { "subs", "int16x16", "AVX", 2, false },
+        { "subs", "int16x16", "NEON", 2, false },
+        { "subs", "int16x16", "SSE2", 2, false },
+        { "subs", "int16x16", "SSE3", 2, false },
+        { "subs", "int16x16", "SSE4.1", 2, false },
+        { "subs", "int16x16", "SSSE3", 2, false },
+        { "subs", "int8x32", "ALTIVEC", 2, false },
+        { "subs", "int8x32", "AVX", 2, false },
+        { "subs", "int8x32", "NEON", 2, false },
+        { "subs", "int8x32", "SSE2", 2, false },
+        { "subs", "int8x32", "SSE3", 2, false },
+        { "subs", "int8x32", "SSE4.1", 2, false },
+        { "subs", "int8x32", "SSSE3", 2, false },
+        { "subs", "uint16x16", "ALTIVEC", 2, false },
+        { "subs", "uint16x16", "AVX", 2, false },
+        { "subs", "uint16x16", "NEON", 2, false },
+        { "subs", "uint16x16", "SSE2", 2, false },
+        { "subs", "uint16x16", "SSE3", 2, false },
+        { "subs", "uint16x16", "SSE4.1", 2, false },
+        { "subs", "uint16x16", "SSSE3", 2, false },
+        { "subs", "uint8x32", "ALTIVEC", 2, false },
+        { "subs", "uint8x32", "AVX", 2, false },
+        { "subs", "uint8x32", "NEON", 2, false },
+        { "subs", "uint8x32", "SSE2", 2, false },
+        { "subs", "uint8x32", "SSE3", 2, false },
+        { "subs", "uint8x32", "SSE4.1", 2, false },
+        { "subs", "uint8x32", "SSSE3", 2, false },
+        { "to_float32", "float64x4", "ALTIVEC", 0, true },
+        { "to_float32", "float64x4", "NEON", 0, true },
+        { "to_float32", "float64x4", "SSE2", 3, false },
+        { "to_float32", "float64x4", "SSE3", 3, false },
+        { "to_float32", "float64x4", "SSE4.1", 3, false },
+        { "to_float32", "float64x4", "SSSE3", 3, false },
+        { "to_float32", "int32x8", "ALTIVEC", 2, false },
+        { "to_float32", "int32x8", "NEON", 2, false },
+        { "to_float32", "int32x8", "SSE2", 2, false },
+        { "to_float32", "int32x8", "SSE3", 2, false },
+        { "to_float32", "int32x8", "SSE4.1", 2, false },
+        { "to_float32", "int32x8", "SSSE3", 2, false },
+        { "to_float64", "float32x8", "ALTIVEC", 0, true },
+        { "to_float64", "float32x8", "NEON", 0, true },
+        { "to_float64", "float32x8", "SSE2", 3, false },
+        { "to_float64", "float32x8", "SSE3", 3, false },
+        { "to_float64", "float32x8", "SSE4.1", 3, false },
+        { "to_float64", "float32x8", "SSSE3", 3, false },
+        { "to_float64", "int32x8", "ALTIVEC", 0, true },
+        { "to_float64", "int32x8", "NEON", 0, true },
+        { "to_float64", "int32x8", "SSE2", 3, false },
+        { "to_float64", "int32x8", "SSE3", 3, false },
+        { "to_float64", "int32x8", "SSE4.1", 3, false },
+        { "to_float64", "int32x8", "SSSE3", 3, false },
+        { "to_int16", "int8x16", "ALTIVEC", 2, false },
+        { "to_int16", "int8x16", "AVX", 3, false },
+        { "to_int16", "int8x16", "NEON", 2, false },
+        { "to_int16", "int8x16", "SSE2", 4, false },
+        { "to_int16", "int8x16", "SSE3", 4, false },
+        { "to_int16", "int8x16", "SSE4.1", 3, false },
+        { "to_int16", "int8x16", "SSSE3", 4, false },
+        { "to_int16", "uint8x16", "ALTIVEC", 2, false },
+        { "to_int16", "uint8x16", "AVX", 2, false },
+        { "to_int16", "uint8x16", "NEON", 2, false },
+        { "to_int16", "uint8x16", "SSE2", 2, false },
+        { "to_int16", "uint8x16", "SSE3", 2, false },
+        { "to_int16", "uint8x16", "SSE4.1", 2, false },
+        { "to_int16", "uint8x16", "SSSE3", 2, false },
+        { "to_int32", "int16x8", "ALTIVEC", 2, false },
+        { "to_int32", "int16x8", "AVX", 3, false },
+        { "to_int32", "int16x8", "NEON", 2, false },
+        { "to_int32", "int16x8", "SSE2", 4, false },
+        { "to_int32", "int16x8", "SSE3", 4, false },
+        { "to_int32", "int16x8", "SSE4.1", 3, false },
+        { "to_int32", "int16x8", "SSSE3", 4, false },
+        { "to_int64", "int32x4", "ALTIVEC", 4, false },
+        { "to_int64", "int32x4", "AVX", 3, false },
+        { "to_int64", "int32x4", "NEON", 2, false },
+        { "to_int64", "int32x4", "SSE2", 5, false },
+        { "to_int64", "int32x4", "SSE3", 5, false },
+        { "to_int64", "int32x4", "SSE4.1", 3, false },
+        { "to_int64", "int32x4", "SSSE3", 5, false },
+        { "to_int64", "uint32x4", "ALTIVEC", 2, false },
+        { "to_int64", "uint32x4", "AVX", 3, false },
+        { "to_int64", "uint32x4", "NEON", 2, false },
+        { "to_int64", "uint32x4", "SSE2", 3, false },
+        { "to_int64", "uint32x4", "SSE3", 3, false },
+        { "to_int64", "uint32x4", "SSE4.1", 3, false },
+        { "to_int64", "uint32x4", "SSSE3", 3, false },
+        { "transpose2", "float32x4", "ALTIVEC", 4, false },
+        { "transpose2", "float32x4", "AVX", 4, false },
+        { "transpose2", "float32x4", "AVX2", 4, false },
+        { "transpose2", "float32x4", "SSE2", 4, false },
+        { "transpose2", "float32x4", "SSE3", 4, false },
+        { "transpose2", "float32x4", "SSE4.1", 4, false },
+        { "transpose2", "float32x4", "SSSE3", 4, false },
+        { "transpose2", "float32x8", "ALTIVEC", 6, false },
+        { "transpose2", "float32x8", "AVX", 4, false },
+        { "transpose2", "float32x8", "AVX2", 4, false },
+        { "transpose2", "float32x8", "NEON", 2, false },
+        { "transpose2", "float32x8", "SSE2", 8, false },
+        { "transpose2", "float32x8", "SSE3", 8, false },
+        { "transpose2", "float32x8", "SSE4.1", 8, false },
+        { "transpose2", "float32x8", "SSSE3", 8, false },
+        { "transpose2", "float64x2", "ALTIVEC", 0, true },
+        { "transpose2", "float64x2", "AVX", 2, false },
+        { "transpose2", "float64x2", "AVX2", 2, false },
+        { "transpose2", "float64x2", "NEON", 0, true },
+        { "transpose2", "float64x2", "SSE2", 2, false },
+        { "transpose2", "float64x2", "SSE3", 2, false },
+        { "transpose2", "float64x2", "SSE4.1", 2, false },
+        { "transpose2", "float64x2", "SSSE3", 2, false },
+        { "transpose2", "float64x4", "ALTIVEC", 0, true },
+        { "transpose2", "float64x4", "AVX", 2, false },
+        { "transpose2", "float64x4", "AVX2", 2, false },
+        { "transpose2", "float64x4", "NEON", 0, true },
+        { "transpose2", "float64x4", "SSE2", 4, false },
+        { "transpose2", "float64x4", "SSE3", 4, false },
+        { "transpose2", "float64x4", "SSE4.1", 4, false },
+        { "transpose2", "float64x4", "SSSE3", 4, false },
+        { "transpose2", "int16x16", "ALTIVEC", 6, false },
+        { "transpose2", "int16x16", "AVX", 8, false },
+        { "transpose2", "int16x16", "AVX2", 4, false },
+        { "transpose2", "int16x16", "NEON", 2, false },
+        { "transpose2", "int16x16", "SSE2", 8, false },
+        { "transpose2", "int16x16", "SSE3", 8, false },
+        { "transpose2", "int16x16", "SSE4.1", 8, false },
+        { "transpose2", "int16x16", "SSSE3", 8, false },
+        { "transpose2", "int16x8", "ALTIVEC", 4, false },
+        { "transpose2", "int16x8", "AVX", 4, false },
+        { "transpose2", "int16x8", "AVX2", 4, false },
+        { "transpose2", "int16x8", "SSE2", 4, false },
+        { "transpose2", "int16x8", "SSE3", 4, false },
+        { "transpose2", "int16x8", "SSE4.1", 4, false },
+        { "transpose2", "int16x8", "SSSE3", 4, false },
+        { "transpose2", "int32x4", "ALTIVEC", 4, false },
+        { "transpose2", "int32x4", "AVX", 4, false },
+        { "transpose2", "int32x4", "AVX2", 4, false },
+        { "transpose2", "int32x4", "SSE2", 4, false },
+        { "transpose2", "int32x4", "SSE3", 4, false },
+        { "transpose2", "int32x4", "SSE4.1", 4, false },
+        { "transpose2", "int32x4", "SSSE3", 4, false },
+        { "transpose2", "int32x8", "ALTIVEC", 6, false },
+        { "transpose2", "int32x8", "AVX", 8, false },
+        { "transpose2", "int32x8", "AVX2", 4, false },
+        { "transpose2", "int32x8", "NEON", 2, false },
+        { "transpose2", "int32x8", "SSE2", 8, false },
+        { "transpose2", "int32x8", "SSE3", 8, false },
+        { "transpose2", "int32x8", "SSE4.1", 8, false },
+        { "transpose2", "int32x8", "SSSE3", 8, false },
+        { "transpose2", "int64x2", "ALTIVEC", 4, false },
+        { "transpose2", "int64x2", "AVX", 2, false },
+        { "transpose2", "int64x2", "AVX2", 2, false },
+        { "transpose2", "int64x2", "SSE2", 2, false },
+        { "transpose2", "int64x2", "SSE3", 2, false },
+        { "transpose2", "int64x2", "SSE4.1", 2, false },
+        { "transpose2", "int64x2", "SSSE3", 2, false },
+        { "transpose2", "int64x4", "ALTIVEC", 6, false },
+        { "transpose2", "int64x4", "AVX", 4, false },
+        { "transpose2", "int64x4", "AVX2", 2, false },
+        { "transpose2", "int64x4", "NEON", 2, false },
+        { "transpose2", "int64x4", "SSE2", 4, false },
+        { "transpose2", "int64x4", "SSE3", 4, false },
+        { "transpose2", "int64x4", "SSE4.1", 4, false },
+        { "transpose2", "int64x4", "SSSE3", 4, false },
+        { "transpose2", "uint16x16", "ALTIVEC", 6, false },
+        { "transpose2", "uint16x16", "AVX", 8, false },
+        { "transpose2", "uint16x16", "AVX2", 4, false },
+        { "transpose2", "uint16x16", "NEON", 2, false },
+        { "transpose2", "uint16x16", "SSE2", 8, false },
+        { "transpose2", "uint16x16", "SSE3", 8, false },
+        { "transpose2", "uint16x16", "SSE4.1", 8, false },
+        { "transpose2", "uint16x16", "SSSE3", 8, false },
+        { "transpose2", "uint16x8", "ALTIVEC", 4, false },
+        { "transpose2", "uint16x8", "AVX", 4, false },
+        { "transpose2", "uint16x8", "AVX2", 4, false },
+        { "transpose2", "uint16x8", "SSE2", 4, false },
+        { "transpose2", "uint16x8", "SSE3", 4, false },
+        { "transpose2", "uint16x8", "SSE4.1", 4, false },
+        { "transpose2", "uint16x8", "SSSE3", 4, false },
+        { "transpose2", "uint32x4", "ALTIVEC", 4, false },
+        { "transpose2", "uint32x4", "AVX", 4, false },
+        { "transpose2", "uint32x4", "AVX2", 4, false },
+        { "transpose2", "uint32x4", "SSE2", 4, false },
+        { "transpose2", "uint32x4", "SSE3", 4, false },
+        { "transpose2", "uint32x4", "SSE4.1", 4, false },
+        { "transpose2", "uint32x4", "SSSE3", 4, false },
+        { "transpose2", "uint32x8", "ALTIVEC", 6, false },
+        { "transpose2", "uint32x8", "AVX", 8, false },
+        { "transpose2", "uint32x8", "AVX2", 4, false },
+        { "transpose2", "uint32x8", "NEON", 2, false },
+        { "transpose2", "uint32x8", "SSE2", 8, false },
+        { "transpose2", "uint32x8", "SSE3", 8, false },
+        { "transpose2", "uint32x8", "SSE4.1", 8, false },
+        { "transpose2", "uint32x8", "SSSE3", 8, false },
+        { "transpose2", "uint64x2", "ALTIVEC", 4, false },
+        { "transpose2", "uint64x2", "AVX", 2, false },
+        { "transpose2", "uint64x2", "AVX2", 2, false },
+        { "transpose2", "uint64x2", "SSE2", 2, false },
+        { "transpose2", "uint64x2", "SSE3", 2, false },
+        { "transpose2", "uint64x2", "SSE4.1", 2, false },
+        { "transpose2", "uint64x2", "SSSE3", 2, false },
+        { "transpose2", "uint64x4", "ALTIVEC", 6, false },
+        { "transpose2", "uint64x4", "AVX", 4, false },
+        { "transpose2", "uint64x4", "AVX2", 2, false },
+        { "transpose2", "uint64x4", "NEON", 2, false },
+        { "transpose2", "uint64x4", "SSE2", 4, false },
+        { "transpose2", "uint64x4", "SSE3", 4, false },
+        { "transpose2", "uint64x4", "SSE4.1", 4, false },
+        { "transpose2", "uint64x4", "SSSE3", 4, false },
+        { "transpose4", "float32x4", "ALTIVEC", 12, false },
+        { "transpose4", "float32x4", "AVX", 12, false },
+        { "transpose4", "float32x4", "AVX2", 12, false },
+        { "transpose4", "float32x4", "NEON", 4, false },
+        { "transpose4", "float32x4", "SSE2", 12, false },
+        { "transpose4", "float32x4", "SSE3", 12, false },
+        { "transpose4", "float32x4", "SSE4.1", 12, false },
+        { "transpose4", "float32x4", "SSSE3", 12, false },
+        { "transpose4", "float32x8", "ALTIVEC", 20, false },
+        { "transpose4", "float32x8", "AVX", 12, false },
+        { "transpose4", "float32x8", "AVX2", 12, false },
+        { "transpose4", "float32x8", "NEON", 8, false },
+        { "transpose4", "float32x8", "SSE2", 24, false },
+        { "transpose4", "float32x8", "SSE3", 24, false },
+        { "transpose4", "float32x8", "SSE4.1", 24, false },
+        { "transpose4", "float32x8", "SSSE3", 24, false },
+        { "transpose4", "int16x16", "ALTIVEC", 20, false },
+        { "transpose4", "int16x16", "AVX", 24, false },
+        { "transpose4", "int16x16", "AVX2", 12, false },
+        { "transpose4", "int16x16", "NEON", 8, false },
+        { "transpose4", "int16x16", "SSE2", 24, false },
+        { "transpose4", "int16x16", "SSE3", 24, false },
+        { "transpose4", "int16x16", "SSE4.1", 24, false },
+        { "transpose4", "int16x16", "SSSE3", 24, false },
+        { "transpose4", "int16x8", "ALTIVEC", 12, false },
+        { "transpose4", "int16x8", "AVX", 12, false },
+        { "transpose4", "int16x8", "AVX2", 12, false },
+        { "transpose4", "int16x8", "NEON", 4, false },
+        { "transpose4", "int16x8", "SSE2", 12, false },
+        { "transpose4", "int16x8", "SSE3", 12, false },
+        { "transpose4", "int16x8", "SSE4.1", 12, false },
+        { "transpose4", "int16x8", "SSSE3", 12, false },
+        { "transpose4", "int32x4", "ALTIVEC", 12, false },
+        { "transpose4", "int32x4", "AVX", 12, false },
+        { "transpose4", "int32x4", "AVX2", 12, false },
+        { "transpose4", "int32x4", "NEON", 4, false },
+        { "transpose4", "int32x4", "SSE2", 12, false },
+        { "transpose4", "int32x4", "SSE3", 12, false },
+        { "transpose4", "int32x4", "SSE4.1", 12, false },
+        { "transpose4", "int32x4", "SSSE3", 12, false },
+        { "transpose4", "int32x8", "ALTIVEC", 20, false },
+        { "transpose4", "int32x8", "AVX", 24, false },
+        { "transpose4", "int32x8", "AVX2", 12, false },
+        { "transpose4", "int32x8", "NEON", 8, false },
+        { "transpose4", "int32x8", "SSE2", 24, false },
+        { "transpose4", "int32x8", "SSE3", 24, false },
+        { "transpose4", "int32x8", "SSE4.1", 24, false },
+        { "transpose4", "int32x8", "SSSE3", 24, false },
+        { "transpose4", "int8x16", "ALTIVEC", 12, false },
+        { "transpose4", "int8x16", "AVX", 16, false },
+        { "transpose4", "int8x16", "AVX2", 16, false },
+        { "transpose4", "int8x16", "NEON", 4, false },
+        { "transpose4", "int8x16", "SSE2", 16, false },
+        { "transpose4", "int8x16", "SSE3", 16, false },
+        { "transpose4", "int8x16", "SSE4.1", 16, false },
+        { "transpose4", "int8x16", "SSSE3", 16, false },
+        { "transpose4", "int8x32", "ALTIVEC", 20, false },
+        { "transpose4", "int8x32", "AVX", 32, false },
+        { "transpose4", "int8x32", "AVX2", 16, false },
+        { "transpose4", "int8x32", "NEON", 8, false },
+        { "transpose4", "int8x32", "SSE2", 32, false },
+        { "transpose4", "int8x32", "SSE3", 32, false },
+        { "transpose4", "int8x32", "SSE4.1", 32, false },
+        { "transpose4", "int8x32", "SSSE3", 32, false },
+        { "transpose4", "uint16x16", "ALTIVEC", 20, false },
+        { "transpose4", "uint16x16", "AVX", 24, false },
+        { "transpose4", "uint16x16", "AVX2", 12, false },
+        { "transpose4", "uint16x16", "NEON", 8, false },
+        { "transpose4", "uint16x16", "SSE2", 24, false },
+        { "transpose4", "uint16x16", "SSE3", 24, false },
+        { "transpose4", "uint16x16", "SSE4.1", 24, false },
+        { "transpose4", "uint16x16", "SSSE3", 24, false },
+        { "transpose4", "uint16x8", "ALTIVEC", 12, false },
+        { "transpose4", "uint16x8", "AVX", 12, false },
+        { "transpose4", "uint16x8", "AVX2", 12, false },
+        { "transpose4", "uint16x8", "NEON", 4, false },
+        { "transpose4", "uint16x8", "SSE2", 12, false },
+        { "transpose4", "uint16x8", "SSE3", 12, false },
+        { "transpose4", "uint16x8", "SSE4.1", 12, false },
+        { "transpose4", "uint16x8", "SSSE3", 12, false },
+        { "transpose4", "uint32x4", "ALTIVEC", 12, false },
+        { "transpose4", "uint32x4", "AVX", 12, false },
+        { "transpose4", "uint32x4", "AVX2", 12, false },
+        { "transpose4", "uint32x4", "NEON", 4, false },
+        { "transpose4", "uint32x4", "SSE2", 12, false },
+        { "transpose4", "uint32x4", "SSE3", 12, false },
+        { "transpose4", "uint32x4", "SSE4.1", 12, false },
+        { "transpose4", "uint32x4", "SSSE3", 12, false },
+        { "transpose4", "uint32x8", "ALTIVEC", 20, false },
+        { "transpose4", "uint32x8", "AVX", 24, false },
+        { "transpose4", "uint32x8", "AVX2", 12, false },
+        { "transpose4", "uint32x8", "NEON", 8, false },
+        { "transpose4", "uint32x8", "SSE2", 24, false },
+        { "transpose4", "uint32x8", "SSE3", 24, false },
+        { "transpose4", "uint32x8", "SSE4.1", 24, false },
+        { "transpose4", "uint32x8", "SSSE3", 24, false },
+        { "transpose4", "uint8x16", "ALTIVEC", 12, false },
+        { "transpose4", "uint8x16", "AVX", 16, false },
+        { "transpose4", "uint8x16", "AVX2", 16, false },
+        { "transpose4", "uint8x16", "NEON", 4, false },
+        { "transpose4", "uint8x16", "SSE2", 16, false },
+        { "transpose4", "uint8x16", "SSE3", 16, false },
+        { "transpose4", "uint8x16", "SSE4.1", 16, false },
+        { "transpose4", "uint8x16", "SSSE3", 16, false },
+        { "transpose4", "uint8x32", "ALTIVEC", 20, false },
+        { "transpose4", "uint8x32", "AVX", 32, false },
+        { "transpose4", "uint8x32", "AVX2", 16, false },
+        { "transpose4", "uint8x32", "NEON", 8, false },
+        { "transpose4", "uint8x32", "SSE2", 32, false },
+        { "transpose4", "uint8x32", "SSE3", 32, false },
+        { "transpose4", "uint8x32", "SSE4.1", 32, false },
+        { "transpose4", "uint8x32", "SSSE3", 32, false },
+        { "transpose8", "int16x16", "AVX", 48, false },
+        { "transpose8", "int16x16", "AVX2", 24, false },
+        { "transpose8", "int16x16", "NEON", 24, false },
+        { "transpose8", "int16x16", "SSE2", 48, false },
+        { "transpose8", "int16x16", "SSE3", 48, false },
+        { "transpose8", "int16x16", "SSE4.1", 48, false },
+        { "transpose8", "int16x16", "SSSE3", 48, false },
+        { "transpose8", "int16x8", "AVX", 24, false },
+        { "transpose8", "int16x8", "AVX2", 24, false },
+        { "transpose8", "int16x8", "NEON", 12, false },
+        { "transpose8", "int16x8", "SSE2", 24, false },
+        { "transpose8", "int16x8", "SSE3", 24, false },
+        { "transpose8", "int16x8", "SSE4.1", 24, false },
+        { "transpose8", "int16x8", "SSSE3", 24, false },
+        { "transpose8", "int8x16", "ALTIVEC", 30, false },
+        { "transpose8", "int8x16", "AVX", 32, false },
+        { "transpose8", "int8x16", "AVX2", 32, false },
+        { "transpose8", "int8x16", "NEON", 12, false },
+        { "transpose8", "int8x16", "SSE2", 32, false },
+        { "transpose8", "int8x16", "SSE3", 32, false },
+        { "transpose8", "int8x16", "SSE4.1", 32, false },
+        { "transpose8", "int8x16", "SSSE3", 32, false },
+        { "transpose8", "int8x32", "ALTIVEC", 54, false },
+        { "transpose8", "int8x32", "AVX", 64, false },
+        { "transpose8", "int8x32", "AVX2", 32, false },
+        { "transpose8", "int8x32", "NEON", 24, false },
+        { "transpose8", "int8x32", "SSE2", 64, false },
+        { "transpose8", "int8x32", "SSE3", 64, false },
+        { "transpose8", "int8x32", "SSE4.1", 64, false },
+        { "transpose8", "int8x32", "SSSE3", 64, false },
+        { "transpose8", "uint16x16", "AVX", 48, false },
+        { "transpose8", "uint16x16", "AVX2", 24, false },
+        { "transpose8", "uint16x16", "NEON", 24, false },
+        { "transpose8", "uint16x16", "SSE2", 48, false },
+        { "transpose8", "uint16x16", "SSE3", 48, false },
+        { "transpose8", "uint16x16", "SSE4.1", 48, false },
+        { "transpose8", "uint16x16", "SSSE3", 48, false },
+        { "transpose8", "uint16x8", "AVX", 24, false },
+        { "transpose8", "uint16x8", "AVX2", 24, false },
+        { "transpose8", "uint16x8", "NEON", 12, false },
+        { "transpose8", "uint16x8", "SSE2", 24, false },
+        { "transpose8", "uint16x8", "SSE3", 24, false },
+        { "transpose8", "uint16x8", "SSE4.1", 24, false },
+        { "transpose8", "uint16x8", "SSSE3", 24, false },
+        { "transpose8", "uint8x16", "ALTIVEC", 30, false },
+        { "transpose8", "uint8x16", "AVX", 32, false },
+        { "transpose8", "uint8x16", "AVX2", 32, false },
+        { "transpose8", "uint8x16", "NEON", 12, false },
+        { "transpose8", "uint8x16", "SSE2", 32, false },
+        { "transpose8", "uint8x16", "SSE3", 32, false },
+        { "transpose8", "uint8x16", "SSE4.1", 32, false },
+        { "transpose8", "uint8x16", "SSSE3", 32, false },
+        { "transpose8", "uint8x32", "ALTIVEC", 54, false },
+        { "transpose8", "uint8x32", "AVX", 64, false },
+        { "transpose8", "uint8x32", "AVX2", 32, false },
+        { "transpose8", "uint8x32", "NEON", 24, false },
+        { "transpose8", "uint8x32", "SSE2", 64, false },
+        { "transpose8", "uint8x32", "SSE3", 64, false },
+        { "transpose8", "uint8x32", "SSE4.1", 64, false },
+        { "transpose8", "uint8x32", "SSSE3", 64, false },
+        { "trunc", "float32x4", "NEON", 6, false },
+        { "trunc", "float32x4", "SSE2", 9, false },
+        { "trunc", "float32x4", "SSE3", 9, false },
+        { "trunc", "float32x4", "SSSE3", 9, false },
+        { "trunc", "float32x8", "ALTIVEC", 2, false },
+        { "trunc", "float32x8", "NEON", 11, false },
+        { "trunc", "float32x8", "SSE2", 16, false },
+        { "trunc", "float32x8", "SSE3", 16, false },
+        { "trunc", "float32x8", "SSE4.1", 2, false },
+        { "trunc", "float32x8", "SSSE3", 16, false },
+        { "unzip16_hi", "uint8x16", "AVX", 3, false },
+        { "unzip16_hi", "uint8x16", "AVX2", 3, false },
+        { "unzip16_hi", "uint8x16", "SSE2", 3, false },
+        { "unzip16_hi", "uint8x16", "SSE3", 3, false },
+        { "unzip16_hi", "uint8x16", "SSE4.1", 3, false },
+        { "unzip16_hi", "uint8x16", "SSSE3", 3, false },
+        { "unzip16_hi", "uint8x32", "ALTIVEC", 2, false },
+        { "unzip16_hi", "uint8x32", "AVX", 6, false },
+        { "unzip16_hi", "uint8x32", "AVX2", 3, false },
+        { "unzip16_hi", "uint8x32", "NEON", 2, false },
+        { "unzip16_hi", "uint8x32", "SSE2", 6, false },
+        { "unzip16_hi", "uint8x32", "SSE3", 6, false },
+        { "unzip16_hi", "uint8x32", "SSE4.1", 6, false },
+        { "unzip16_hi", "uint8x32", "SSSE3", 6, false },
+        { "unzip16_lo", "uint8x16", "ALTIVEC", 2, false },
+        { "unzip16_lo", "uint8x16", "AVX", 5, false },
+        { "unzip16_lo", "uint8x16", "AVX2", 5, false },
+        { "unzip16_lo", "uint8x16", "SSE2", 5, false },
+        { "unzip16_lo", "uint8x16", "SSE3", 5, false },
+        { "unzip16_lo", "uint8x16", "SSE4.1", 5, false },
+        { "unzip16_lo", "uint8x16", "SSSE3", 5, false },
+        { "unzip16_lo", "uint8x32", "ALTIVEC", 3, false },
+        { "unzip16_lo", "uint8x32", "AVX", 9, false },
+        { "unzip16_lo", "uint8x32", "AVX2", 5, false },
+        { "unzip16_lo", "uint8x32", "NEON", 2, false },
+        { "unzip16_lo", "uint8x32", "SSE2", 9, false },
+        { "unzip16_lo", "uint8x32", "SSE3", 9, false },
+        { "unzip16_lo", "uint8x32", "SSE4.1", 9, false },
+        { "unzip16_lo", "uint8x32", "SSSE3", 9, false },
+        { "unzip2_hi", "float64x2", "ALTIVEC", 0, true },
+        { "unzip2_hi", "float64x2", "NEON", 0, true },
+        { "unzip2_hi", "float64x4", "ALTIVEC", 0, true },
+        { "unzip2_hi", "float64x4", "AVX", 2, false },
+        { "unzip2_hi", "float64x4", "NEON", 0, true },
+        { "unzip2_hi", "float64x4", "SSE2", 2, false },
+        { "unzip2_hi", "float64x4", "SSE3", 2, false },
+        { "unzip2_hi", "float64x4", "SSE4.1", 2, false },
+        { "unzip2_hi", "float64x4", "SSSE3", 2, false },
+        { "unzip2_hi", "uint64x2", "ALTIVEC", 2, false },
+        { "unzip2_hi", "uint64x4", "ALTIVEC", 3, false },
+        { "unzip2_hi", "uint64x4", "AVX", 2, false },
+        { "unzip2_hi", "uint64x4", "NEON", 2, false },
+        { "unzip2_hi", "uint64x4", "SSE2", 2, false },
+        { "unzip2_hi", "uint64x4", "SSE3", 2, false },
+        { "unzip2_hi", "uint64x4", "SSE4.1", 2, false },
+        { "unzip2_hi", "uint64x4", "SSSE3", 2, false },
+        { "unzip2_lo", "float64x2", "ALTIVEC", 0, true },
+        { "unzip2_lo", "float64x2", "NEON", 0, true },
+        { "unzip2_lo", "float64x4", "ALTIVEC", 0, true },
+        { "unzip2_lo", "float64x4", "AVX", 2, false },
+        { "unzip2_lo", "float64x4", "NEON", 0, true },
+        { "unzip2_lo", "float64x4", "SSE2", 2, false },
+        { "unzip2_lo", "float64x4", "SSE3", 2, false },
+        { "unzip2_lo", "float64x4", "SSE4.1", 2, false },
+        { "unzip2_lo", "float64x4", "SSSE3", 2, false },
+        { "unzip2_lo", "uint64x4", "ALTIVEC", 2, false },
+        { "unzip2_lo", "uint64x4", "AVX", 2, false },
+        { "unzip2_lo", "uint64x4", "NEON", 2, false },
+        { "unzip2_lo", "uint64x4", "SSE2", 2, false },
+        { "unzip2_lo", "uint64x4", "SSE3", 2, false },
+        { "unzip2_lo", "uint64x4", "SSE4.1", 2, false },
+        { "unzip2_lo", "uint64x4", "SSSE3", 2, false },
+        { "unzip4_hi", "float32x8", "ALTIVEC", 2, false },
+        { "unzip4_hi", "float32x8", "NEON", 2, false },
+        { "unzip4_hi", "float32x8", "SSE2", 2, false },
+        { "unzip4_hi", "float32x8", "SSE3", 2, false },
+        { "unzip4_hi", "float32x8", "SSE4.1", 2, false },
+        { "unzip4_hi", "float32x8", "SSSE3", 2, false },
+        { "unzip4_hi", "uint32x4", "ALTIVEC", 2, false },
+        { "unzip4_hi", "uint32x8", "ALTIVEC", 3, false },
+        { "unzip4_hi", "uint32x8", "AVX", 2, false },
+        { "unzip4_hi", "uint32x8", "NEON", 2, false },
+        { "unzip4_hi", "uint32x8", "SSE2", 2, false },
+        { "unzip4_hi", "uint32x8", "SSE3", 2, false },
+        { "unzip4_hi", "uint32x8", "SSE4.1", 2, false },
+        { "unzip4_hi", "uint32x8", "SSSE3", 2, false },
+        { "unzip4_lo", "float32x8", "ALTIVEC", 2, false },
+        { "unzip4_lo", "float32x8", "NEON", 2, false },
+        { "unzip4_lo", "float32x8", "SSE2", 2, false },
+        { "unzip4_lo", "float32x8", "SSE3", 2, false },
+        { "unzip4_lo", "float32x8", "SSE4.1", 2, false },
+        { "unzip4_lo", "float32x8", "SSSE3", 2, false },
+        { "unzip4_lo", "uint32x4", "ALTIVEC", 2, false },
+        { "unzip4_lo", "uint32x8", "ALTIVEC", 3, false },
+        { "unzip4_lo", "uint32x8", "AVX", 2, false },
+        { "unzip4_lo", "uint32x8", "NEON", 2, false },
+        { "unzip4_lo", "uint32x8", "SSE2", 2, false },
+        { "unzip4_lo", "uint32x8", "SSE3", 2, false },
+        { "unzip4_lo", "uint32x8", "SSE4.1", 2, false },
+        { "unzip4_lo", "uint32x8", "SSSE3", 2, false },
+        { "unzip8_hi", "uint16x16", "ALTIVEC", 2, false },
+        { "unzip8_hi", "uint16x16", "AVX", 6, false },
+        { "unzip8_hi", "uint16x16", "AVX2", 3, false },
+        { "unzip8_hi", "uint16x16", "NEON", 2, false },
+        { "unzip8_hi", "uint16x16", "SSE2", 6, false },
+        { "unzip8_hi", "uint16x16", "SSE3", 6, false },
+        { "unzip8_hi", "uint16x16", "SSE4.1", 6, false },
+        { "unzip8_hi", "uint16x16", "SSSE3", 6, false },
+        { "unzip8_hi", "uint16x8", "AVX", 3, false },
+        { "unzip8_hi", "uint16x8", "AVX2", 3, false },
+        { "unzip8_hi", "uint16x8", "SSE2", 3, false },
+        { "unzip8_hi", "uint16x8", "SSE3", 3, false },
+        { "unzip8_hi", "uint16x8", "SSE4.1", 3, false },
+        { "unzip8_hi", "uint16x8", "SSSE3", 3, false },
+        { "unzip8_lo", "uint16x16", "ALTIVEC", 3, false },
+        { "unzip8_lo", "uint16x16", "AVX", 9, false },
+        { "unzip8_lo", "uint16x16", "AVX2", 5, false },
+        { "unzip8_lo", "uint16x16", "NEON", 2, false },
+        { "unzip8_lo", "uint16x16", "SSE2", 5, false },
+        { "unzip8_lo", "uint16x16", "SSE3", 5, false },
+        { "unzip8_lo", "uint16x16", "SSE4.1", 9, false },
+        { "unzip8_lo", "uint16x16", "SSSE3", 5, false },
+        { "unzip8_lo", "uint16x8", "ALTIVEC", 2, false },
+        { "unzip8_lo", "uint16x8", "AVX", 5, false },
+        { "unzip8_lo", "uint16x8", "AVX2", 5, false },
+        { "unzip8_lo", "uint16x8", "SSE2", 5, false },
+        { "unzip8_lo", "uint16x8", "SSE3", 5, false },
+        { "unzip8_lo", "uint16x8", "SSE4.1", 5, false },
+        { "unzip8_lo", "uint16x8", "SSSE3", 5, false },
+        { "zip16_hi", "int8x32", "ALTIVEC", 2, false },
+        { "zip16_hi", "int8x32", "NEON", 2, false },
+        { "zip16_hi", "uint8x32", "ALTIVEC", 2, false },
+        { "zip16_hi", "uint8x32", "NEON", 2, false },
+        { "zip16_lo", "int8x32", "ALTIVEC", 2, false },
+        { "zip16_lo", "int8x32", "AVX", 2, false },
+        { "zip16_lo", "int8x32", "NEON", 2, false },
+        { "zip16_lo", "int8x32", "SSE2", 2, false },
+        { "zip16_lo", "int8x32", "SSE3", 2, false },
+        { "zip16_lo", "int8x32", "SSE4.1", 2, false },
+        { "zip16_lo", "int8x32", "SSSE3", 2, false },
+        { "zip16_lo", "uint8x32", "ALTIVEC", 2, false },
+        { "zip16_lo", "uint8x32", "AVX", 2, false },
+        { "zip16_lo", "uint8x32", "NEON", 2, false },
+        { "zip16_lo", "uint8x32", "SSE2", 2, false },
+        { "zip16_lo", "uint8x32", "SSE3", 2, false },
+        { "zip16_lo", "uint8x32", "SSE4.1", 2, false },
+        { "zip16_lo", "uint8x32", "SSSE3", 2, false },
+    };
+    size = sizeof(costs) / sizeof(costs[0]);
+    return costs;
+}
+
+} // namespace detail
+} // namespace simdpp
+
+#endif
@@ -30,6 +30,16 @@
 
 #include <cstdint>
 
+/*  Forces the inlining of the functions that are used by the IFUNC resolvers.
+    The resolvers run while the dynamic loader processes relocations, thus
+    they must not call other functions that might go through the PLT.
+*/
+#if __GNUC__
+#define SIMDPP_DISPATCH_INLINE inline __attribute__((always_inline))
+#else
+#define SIMDPP_DISPATCH_INLINE inline
+#endif
+
 namespace simdpp {
 
 /** @defgroup simd_dispatcher Dispatching support
@@ -42,9 +52,13 @@ namespace simdpp {
 */
 /*  The values are assigned in such a way that the result of comparison of two
     ORed flag sets is likely identify which instruction set the binary is more
-    likely to run faster on.
+    likely to run faster on. The values of the existing flags are kept when
+    new ones are added, thus the flags added later have higher values
+    regardless of the processor generation that introduced them.
 
-    detail::select_version depends on this.
+    detail::select_version depends on this. It compares the vector
+    instruction sets first and uses the rest of the flags only to break ties,
+    thus e.g. FMA3 or BMI2 does not make a version outrank an AVX2 one.
 */
 enum class Arch : std::uint32_t {
     /// Indicates that no SIMD instructions are supported
@@ -67,6 +81,22 @@ enum class Arch : std::uint32_t {
     X86_FMA4 = 1 << 8,
     /// Indicates x86 XOP (AMD) support
     X86_XOP = 1 << 9,
+    /// Indicates x86 POPCNT instruction support
+    X86_POPCNT = 1 << 10,
+    /// Indicates x86 SSE4.2 support
+    X86_SSE4_2 = 1 << 11,
+    /// Indicates x86 PCLMULQDQ (carry-less multiplication) support
+    X86_PCLMULQDQ = 1 << 12,
+    /// Indicates x86 F16C (half-precision conversion) support
+    X86_F16C = 1 << 13,
+    /// Indicates x86 LZCNT instruction support
+    X86_LZCNT = 1 << 14,
+    /// Indicates x86 BMI1 support
+    X86_BMI1 = 1 << 15,
+    /// Indicates x86 BMI2 support
+    X86_BMI2 = 1 << 16,
+    /// Indicates x86 AVX-512 Foundation support
+    X86_AVX512F = 1 << 17,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
@@ -81,33 +111,33 @@ enum class Arch : std::uint32_t {
 
 /// Bitwise operators for @c Arch
 /// @{
-inline Arch& operator|=(Arch& x, const Arch& y)
+SIMDPP_DISPATCH_INLINE Arch& operator|=(Arch& x, const Arch& y)
 {
     using T = std::uint32_t;
     x = static_cast<Arch>(static_cast<T>(x) | static_cast<T>(y));
     return x;
 }
 
-inline Arch& operator&=(Arch& x, const Arch& y)
+SIMDPP_DISPATCH_INLINE Arch& operator&=(Arch& x, const Arch& y)
 {
     using T = std::uint32_t;
     x = static_cast<Arch>(static_cast<T>(x) & static_cast<T>(y));
     return x;
 }
 
-inline Arch operator|(const Arch& x, const Arch& y)
+SIMDPP_DISPATCH_INLINE Arch operator|(const Arch& x, const Arch& y)
 {
     using T = std::uint32_t;
     return static_cast<Arch>(static_cast<T>(x) | static_cast<T>(y));
 }
 
-inline Arch operator&(const Arch& x, const Arch& y)
+SIMDPP_DISPATCH_INLINE Arch operator&(const Arch& x, const Arch& y)
 {
     using T = std::uint32_t;
     return static_cast<Arch>(static_cast<T>(x) & static_cast<T>(y));
 }
 
-inline Arch operator~(const Arch& x)
+SIMDPP_DISPATCH_INLINE Arch operator~(const Arch& x)
 {
     using T = std::uint32_t;
     return static_cast<Arch>(~static_cast<T>(x));
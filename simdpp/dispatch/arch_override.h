@@ -0,0 +1,259 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_ARCH_OVERRIDE_H
+#define LIBSIMDPP_DISPATCH_ARCH_OVERRIDE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <simdpp/dispatch/arch.h>
+
+namespace simdpp {
+
+/** @ingroup simd_dispatcher
+    Identifies how the architecture reported by the @c SIMDPP_USER_ARCH_INFO
+    callback is modified before selecting a version of a dispatched function.
+*/
+enum class ArchOverride : unsigned {
+    /// The reported architecture is used as is
+    NONE = 0,
+    /// The reported architecture is intersected with the given mask. Versions
+    /// that are not supported by the processor are never selected.
+    CAP,
+    /// The reported architecture is replaced by the given architecture. The
+    /// user is responsible for making sure that the processor supports it.
+    PIN
+};
+
+namespace detail {
+
+struct ArchOverrideState {
+    std::atomic<unsigned> mode;
+    std::atomic<std::uint32_t> arch;
+};
+
+/*  Objects with static storage duration are zero-initialized, thus the state
+    is valid (mode NONE) even before any dynamic initialization takes place.
+*/
+inline ArchOverrideState& get_arch_override_state()
+{
+    static ArchOverrideState state;
+    return state;
+}
+
+struct ArchName {
+    const char* name;
+    Arch arch;
+};
+
+/*  Returns the flags identified by a single architecture name of the given
+    length, including the flags of the instruction sets that it implies.
+    Names of instruction sets of other processor families are not recognized.
+*/
+inline bool get_arch_by_name(const char* name, std::size_t length, Arch& arch)
+{
+#if defined(__i386__) || defined(__amd64__) || defined(_M_IX86) || defined(_M_X64)
+    Arch a_sse2 = Arch::X86_SSE2;
+    Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
+    Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
+    Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
+    Arch a_avx = a_sse4_1 | Arch::X86_AVX;
+    Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
+    Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
+    Arch a_xop = a_sse3 | Arch::X86_XOP;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
+    Arch a_pclmulqdq = a_sse2 | Arch::X86_PCLMULQDQ;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
+    Arch a_avx512f = a_avx2 | Arch::X86_FMA3 | Arch::X86_AVX512F;
+
+    const ArchName names[] = {
+        { "NONE_NULL", Arch::NONE_NULL },
+        { "X86_SSE2", a_sse2 },
+        { "X86_SSE3", a_sse3 },
+        { "X86_SSSE3", a_ssse3 },
+        { "X86_SSE4_1", a_sse4_1 },
+        { "X86_AVX", a_avx },
+        { "X86_AVX2", a_avx2 },
+        { "X86_FMA3", a_fma3 },
+        { "X86_FMA4", a_fma4 },
+        { "X86_XOP", a_xop },
+        { "X86_AVX512F", a_avx512f },
+        { "X86_POPCNT", Arch::X86_POPCNT },
+        { "X86_SSE4_2", a_sse4_2 },
+        { "X86_PCLMULQDQ", a_pclmulqdq },
+        { "X86_F16C", a_f16c },
+        { "X86_LZCNT", Arch::X86_LZCNT },
+        { "X86_BMI1", Arch::X86_BMI1 },
+        { "X86_BMI2", Arch::X86_BMI2 },
+    };
+#elif defined(__arm__) || defined(__aarch64__)
+    const ArchName names[] = {
+        { "NONE_NULL", Arch::NONE_NULL },
+        { "ARM_NEON", Arch::ARM_NEON },
+        { "ARM_NEON_FLT_SP", Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP },
+    };
+#elif defined(__powerpc__) || defined(__powerpc64__)
+    const ArchName names[] = {
+        { "NONE_NULL", Arch::NONE_NULL },
+        { "POWER_ALTIVEC", Arch::POWER_ALTIVEC },
+    };
+#else
+    const ArchName names[] = {
+        { "NONE_NULL", Arch::NONE_NULL },
+    };
+#endif
+
+    for (const ArchName& n : names) {
+        if (std::strlen(n.name) == length &&
+            std::strncmp(n.name, name, length) == 0) {
+            arch = n.arch;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace detail
+
+/** @ingroup simd_dispatcher
+    Parses a comma-separated list of architecture names, e.g.
+    @c "X86_AVX,X86_FMA3". The names are the same as the identifiers of
+    @c Arch. Each name implies the instruction sets it depends on, e.g.
+    @c X86_AVX implies @c X86_SSE2 to @c X86_SSE4_1. Names of instruction sets
+    of other processor families are not recognized.
+
+    @param list the list to parse
+    @param arch the parsed architecture. Set only on success
+    @return true on success, false if the list contains unknown names
+*/
+inline bool parse_arch_list(const char* list, Arch& arch)
+{
+    Arch res = Arch::NONE_NULL;
+    const char* p = list;
+    while (true) {
+        while (*p == ' ') {
+            ++p;
+        }
+        const char* end = p;
+        while (*end != '\0' && *end != ',' && *end != ' ') {
+            ++end;
+        }
+        Arch item;
+        if (!detail::get_arch_by_name(p, end - p, item)) {
+            return false;
+        }
+        res |= item;
+
+        while (*end == ' ') {
+            ++end;
+        }
+        if (*end == '\0') {
+            break;
+        }
+        if (*end != ',') {
+            return false;
+        }
+        p = end + 1;
+    }
+    arch = res;
+    return true;
+}
+
+/** @ingroup simd_dispatcher
+    Sets how the architecture reported by @c SIMDPP_USER_ARCH_INFO is modified
+    when dispatchers are resolved. The setting takes precedence over the
+    environment variables described in @c get_arch_override.
+
+    The dispatchers that have already been resolved are not affected. Use
+    @c reset_dispatchers to make them select the version again. The functions
+    dispatched in the IFUNC mode (see @c SIMDPP_DISPATCHER_IFUNC) are never
+    affected.
+
+    @param mode the override mode
+    @param arch the mask for @c ArchOverride::CAP or the architecture for
+        @c ArchOverride::PIN. Ignored for @c ArchOverride::NONE.
+*/
+inline void set_arch_override(ArchOverride mode, Arch arch = Arch::NONE_NULL)
+{
+    auto& state = detail::get_arch_override_state();
+    state.arch.store(static_cast<std::uint32_t>(arch));
+    // +1 distinguishes "set to NONE" from "not set" (zero)
+    state.mode.store(static_cast<unsigned>(mode) + 1);
+}
+
+/** @ingroup simd_dispatcher
+    Applies the architecture override to @a arch and returns the result.
+
+    If the override has been set by @c set_arch_override, it is used.
+    Otherwise the following environment variables are consulted:
+
+    - @c SIMDPP_FORCE_ARCH: a list of architecture names as accepted by
+        @c parse_arch_list. The reported architecture is replaced by the
+        given one (@c ArchOverride::PIN).
+
+    - @c SIMDPP_CAP_ARCH: a list of architecture names as accepted by
+        @c parse_arch_list. The reported architecture is intersected with the
+        given one (@c ArchOverride::CAP).
+
+    Environment variables that can't be parsed are ignored.
+
+    This function is called by the dispatcher each time a version of a
+    dispatched function is selected. It is not called by the resolvers of the
+    functions dispatched in the IFUNC mode (see @c SIMDPP_DISPATCHER_IFUNC).
+*/
+inline Arch get_arch_override(Arch arch)
+{
+    auto& state = detail::get_arch_override_state();
+    unsigned mode = state.mode.load();
+    if (mode != 0) {
+        Arch o_arch = static_cast<Arch>(state.arch.load());
+        switch (static_cast<ArchOverride>(mode - 1)) {
+        case ArchOverride::NONE: return arch;
+        case ArchOverride::CAP: return arch & o_arch;
+        case ArchOverride::PIN: return o_arch;
+        }
+        return arch;
+    }
+
+    Arch o_arch;
+    const char* env = std::getenv("SIMDPP_FORCE_ARCH");
+    if (env != nullptr && parse_arch_list(env, o_arch)) {
+        return o_arch;
+    }
+    env = std::getenv("SIMDPP_CAP_ARCH");
+    if (env != nullptr && parse_arch_list(env, o_arch)) {
+        return arch & o_arch;
+    }
+    return arch;
+}
+
+} // namespace simdpp
+
+#endif
@@ -33,11 +33,19 @@
 #endif
 
 #include <atomic>
-#include <algorithm>
+#include <cstdlib>
 #include <mutex>
 #include <functional>
+#include <utility>
 #include <vector>
 #include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/arch_override.h>
+
+#if defined(SIMDPP_DISPATCHER_IFUNC)
+#if !defined(__ELF__) || !defined(__GNUC__)
+    #error "SIMDPP_DISPATCHER_IFUNC is supported only on ELF targets with GCC or Clang"
+#endif
+#endif
 
 namespace simdpp {
 
@@ -68,10 +76,63 @@ using GetArchCb = std::function<Arch()>;
 s
     The @c simdpp/dispatch/get_arch_*.h files provide several ready
     implementations of CPU features detection.
+
+    The returned information may be overridden at runtime by
+    @c set_arch_override or the @c SIMDPP_FORCE_ARCH and @c SIMDPP_CAP_ARCH
+    environment variables. See @c get_arch_override.
+*/
+
+/** @def SIMDPP_DISPATCHER_IFUNC
+    If defined, the @c SIMDPP_MAKE_DISPATCHER_* macros bind the dispatched
+    functions using the GNU indirect function (IFUNC) mechanism instead of
+    caching a function pointer at the first call. The dynamic loader invokes a
+    resolver when it processes the relocations of the binary and the dispatched
+    function is subsequently called through the PLT with no additional
+    overhead. The mode does not depend on @c std::mutex or the threading
+    library.
+
+    The mode is available only on ELF targets when compiling with GCC or
+    Clang. The macro must be defined consistently in all translation units
+    that contain the versions of the same function.
+
+    The following restrictions apply:
+
+    * @c SIMDPP_USER_ARCH_INFO is invoked by the dynamic loader before the
+      static objects are constructed, thus it must not rely on them or on the
+      C++ runtime being initialized. @c get_arch_raw_cpuid is suitable.
+
+    * Dispatched functions can't be overloaded and the unqualified name of each
+      dispatched function must be unique within the binary.
+
+    * The architecture reported by @c SIMDPP_USER_ARCH_INFO is used as is.
+      @c set_arch_override and the @c SIMDPP_FORCE_ARCH and
+      @c SIMDPP_CAP_ARCH environment variables are ignored, and
+      @c reset_dispatchers has no effect.
 */
 
 /// @} -- end defgroup
 
+/** @ingroup simd_dispatcher
+    Describes a function dispatched via the default dispatcher mode. See
+    @c get_dispatcher_info.
+*/
+struct DispatcherInfo {
+    /** The name of the dispatched function as given to
+        @c SIMDPP_MAKE_DISPATCHER_*, or the name of the tag type as given to
+        @c SIMDPP_DISPATCH_VERSION. Empty if not known.
+    */
+    const char* name;
+
+    /// The instruction sets needed by each registered version
+    std::vector<Arch> versions;
+
+    /// Whether a version has been selected
+    bool resolved;
+
+    /// The instruction sets needed by the selected version, if resolved
+    Arch selected;
+};
+
 namespace detail {
 
 using VoidFunPtr = void (*)();
@@ -95,22 +156,57 @@ struct FnVersion {
     VoidFunPtr fun_ptr;
 };
 
+/*  Returns whether a version needing the instruction sets @a a should be
+    preferred over one needing @a b. The vector instruction sets are compared
+    first. The other extensions, such as FMA3 or BMI2, only break ties, so
+    that e.g. an AVX+FMA3 version does not outrank an AVX2 version.
+*/
+SIMDPP_DISPATCH_INLINE bool is_arch_preferred(Arch a, Arch b)
+{
+    const Arch vector_archs = Arch::X86_SSE2 | Arch::X86_SSE3 |
+            Arch::X86_SSSE3 | Arch::X86_SSE4_1 | Arch::X86_AVX |
+            Arch::X86_AVX2 | Arch::X86_AVX512F | Arch::ARM_NEON |
+            Arch::ARM_NEON_FLT_SP | Arch::POWER_ALTIVEC;
+    Arch va = a & vector_archs;
+    Arch vb = b & vector_archs;
+    if (va != vb) {
+        return va > vb;
+    }
+    return a > b;
+}
+
+/*  Returns the index of the version within @a versions that should be used on
+    a processor supporting @a arch, or @a count if none of the versions can run
+    on it. @a V must have a member @a needed_arch of type @c Arch.
+
+    The versions requiring "larger" set of instruction sets are preferred, as
+    determined by is_arch_preferred. The function does not allocate, so that
+    it can be used from IFUNC resolvers.
+*/
+template<class V>
+SIMDPP_DISPATCH_INLINE
+unsigned select_version_index(const V* versions, unsigned count, Arch arch)
+{
+    unsigned best = count;
+    for (unsigned i = 0; i < count; ++i) {
+        if ((versions[i].needed_arch & ~arch) != Arch::NONE_NULL) {
+            continue;
+        }
+        if (best == count || is_arch_preferred(versions[i].needed_arch,
+                                               versions[best].needed_arch)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
 inline unsigned select_version_any(std::vector<FnVersion>& versions,
                                    const GetArchCb& get_info_cb)
 {
     // No need to try to be very efficient here.
-    Arch arch = get_info_cb();
-    std::sort(versions.begin(), versions.end(),
-              [](const FnVersion& lhs, const FnVersion& rhs) {
-                  return lhs.needed_arch > rhs.needed_arch;
-              });
-
-    unsigned i;
-    for (i = 0; i < versions.size(); ++i) {
-        if ((versions[i].needed_arch & ~arch) == Arch::NONE_NULL) {
-            break;
-        }
-    }
+    Arch arch = get_arch_override(get_info_cb());
+
+    unsigned i = select_version_index(versions.data(), versions.size(), arch);
     if (i == versions.size()) {
         // The user didn't provide the NONE_NULL version and no SIMD
         // architecture is supported. We can't do anything except to abort
@@ -138,6 +234,34 @@ inline void gcc_linker_bug_workaround()
 }
 #endif
 
+// Protects the selection of versions of all dispatched functions
+inline std::mutex& get_dispatcher_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/*  Describes a dispatcher that has at least one version registered. The
+    functions operate on the corresponding Dispatcher instantiation.
+*/
+struct DispatcherEntry {
+    // Forgets the selected version. Must be called with the mutex held
+    void (*reset)();
+    // Selects the version if not done yet. Must be called without the mutex
+    void (*resolve)(const GetArchCb& get_info_cb);
+    // Retrieves the information. Must be called with the mutex held
+    void (*get_info)(DispatcherInfo& info);
+};
+
+/*  All dispatchers that have at least one version registered. Populated during
+    static initialization, thus may be read without synchronization afterwards.
+*/
+inline std::vector<DispatcherEntry>& get_dispatcher_registry()
+{
+    static std::vector<DispatcherEntry> entries;
+    return entries;
+}
+
 /*  Tracks versions of one particular function. @a Tag must be an unique type
     for each different function. The same @a Tag and @a FunPtr must be used
     when registering versions of the function to be dispatched.
@@ -149,26 +273,22 @@ public:
     /** Returns a pointer to the most efficient function for the current
         architecture. This function must not be called before initialization of
         all static objects has finished (i.e. before main() has started).
+
+        @a cb may be any object callable as @c Arch(), for example a plain
+        function. It is taken by reference and is converted to @c GetArchCb
+        only on the first call, so once the function pointer has been resolved
+        each call costs one relaxed atomic load.
     */
-    static FunPtr get_fun_ptr(const GetArchCb& cb)
+    template<class Cb>
+    static FunPtr get_fun_ptr(const Cb& cb)
     {
-#if __GNUC__ && !defined(__clang__)
-        gcc_linker_bug_workaround();
-#endif
-        /*  There are no problems with concurrent initialization, because even
-            local static variables are guaranteed to be initialized to zero
-            before main() runs.
-        */
-        static std::atomic<FunPtr> static_fun_ptr{nullptr};
-
         /*  We can use relaxed memory ordering since there's only single
             transition of the value stored within @a static_fun_ptr. The body
             of the if statement is already protected from data races.
         */
         FunPtr fun_ptr = static_fun_ptr.load(std::memory_order_relaxed);
         if (fun_ptr == nullptr) {
-            fun_ptr = reinterpret_cast<FunPtr>(select_version(cb));
-            static_fun_ptr.store(fun_ptr, std::memory_order_seq_cst);
+            fun_ptr = resolve(cb);
         }
         return fun_ptr;
     }
@@ -177,34 +297,89 @@ public:
         may only be called from within a constructor of a non-local static
         object.
     */
-    static void add_fun_ptr(Arch compile_info, FunPtr fun_ptr)
+    static void add_fun_ptr(Arch compile_info, FunPtr fun_ptr,
+                            const char* name = nullptr)
     {
         FnVersion fn_version;
         fn_version.needed_arch = compile_info;
         fn_version.fun_ptr = reinterpret_cast<VoidFunPtr>(fun_ptr);
-        get_all_versions().push_back(fn_version);
+        auto& versions = get_all_versions();
+        if (versions.empty()) {
+            DispatcherEntry entry;
+            entry.reset = &reset;
+            entry.resolve = &resolve_default;
+            entry.get_info = &get_info;
+            get_dispatcher_registry().push_back(entry);
+        }
+        versions.push_back(fn_version);
+        if (name != nullptr) {
+            get_name() = name;
+        }
     }
 
 private:
-    static VoidFunPtr select_version(const GetArchCb& cb)
+    /*  Out-of-line slow path of @a get_fun_ptr. Kept separate so that the
+        construction of the std::function object and the locking are not
+        inlined into each dispatched call site.
+    */
+    template<class Cb>
+#if __GNUC__
+    __attribute__((noinline))
+#endif
+    static FunPtr resolve(const Cb& cb)
     {
-        /*  This is pretty much the same what we do in @a get_fun_ptr,
-            just that we don't use relaxed ordering. This way we incur
-            synchronization overhead only on the first call to the dispatched
-            function.
+#if __GNUC__ && !defined(__clang__)
+        gcc_linker_bug_workaround();
+#endif
+        /*  A mutex is used instead of std::call_once, because the selection
+            may be repeated after reset_dispatchers() is called.
         */
-        static std::once_flag flag;
-        static std::atomic<VoidFunPtr> void_ptr{nullptr};
-        std::call_once(flag, select_version_impl, std::ref(void_ptr), cb);
-        return void_ptr;
+        std::lock_guard<std::mutex> lock(get_dispatcher_mutex());
+        FunPtr fun_ptr = static_fun_ptr.load(std::memory_order_relaxed);
+        if (fun_ptr == nullptr) {
+            auto& v = get_all_versions();
+            unsigned id = select_version_any(v, GetArchCb(cb));
+            fun_ptr = reinterpret_cast<FunPtr>(v[id].fun_ptr);
+            static_fun_ptr.store(fun_ptr, std::memory_order_seq_cst);
+        }
+        return fun_ptr;
     }
 
-    static void select_version_impl(std::atomic<VoidFunPtr>& fun_ptr,
-                                    const GetArchCb& cb)
+    static void resolve_default(const GetArchCb& get_info_cb)
     {
-        auto& v = get_all_versions();
-        unsigned id = select_version_any(v, cb);
-        fun_ptr = v[id].fun_ptr;
+        if (static_fun_ptr.load(std::memory_order_relaxed) == nullptr) {
+            resolve(get_info_cb);
+        }
+    }
+
+    // Forgets the selected version. Called with the dispatcher mutex held.
+    static void reset()
+    {
+        static_fun_ptr.store(nullptr, std::memory_order_seq_cst);
+    }
+
+    // Called with the dispatcher mutex held.
+    static void get_info(DispatcherInfo& info)
+    {
+        FunPtr fun_ptr = static_fun_ptr.load(std::memory_order_relaxed);
+        info.name = get_name();
+        info.resolved = false;
+        info.selected = Arch::NONE_NULL;
+        info.versions.clear();
+        for (const auto& v : get_all_versions()) {
+            info.versions.push_back(v.needed_arch);
+            if (fun_ptr != nullptr &&
+                reinterpret_cast<FunPtr>(v.fun_ptr) == fun_ptr) {
+                info.resolved = true;
+                info.selected = v.needed_arch;
+            }
+        }
+    }
+
+    static const char*& get_name()
+    {
+        static const char* name = "";
+        return name;
     }
 
     static std::vector<FnVersion>& get_all_versions()
@@ -212,8 +387,53 @@ private:
         static std::vector<FnVersion> versions;
         return versions;
     }
+
+    /*  There are no problems with concurrent initialization, because the
+        variable is constant-initialized to zero before any dynamic
+        initialization takes place.
+    */
+    static std::atomic<FunPtr> static_fun_ptr;
+};
+
+template<class Tag, class FunPtr>
+std::atomic<FunPtr> Dispatcher<Tag,FunPtr>::static_fun_ptr{nullptr};
+
+/*  Describes a version of a function dispatched via the GNU IFUNC mechanism.
+    The objects of this type are placed into a dedicated ELF section for each
+    dispatched function and are constant-initialized, so that they are
+    available to the IFUNC resolver which runs during relocation processing,
+    before any static constructors.
+*/
+template<class FunPtr>
+struct IfuncVersion {
+    Arch needed_arch;
+    FunPtr fun_ptr;
 };
 
+/*  Selects the version of a function to bind from the [first, last) range of
+    versions. Used by the IFUNC resolvers generated by the
+    SIMDPP_MAKE_DISPATCHER_* macros. The same ranking as in the default
+    dispatcher mode is used. Everything is inlined into the resolver, so that
+    it does not call any function except @a cb.
+*/
+template<class FunPtr, class Cb>
+SIMDPP_DISPATCH_INLINE
+FunPtr select_ifunc_version(const IfuncVersion<FunPtr>* first,
+                            const IfuncVersion<FunPtr>* last, const Cb& cb)
+{
+    unsigned count = last - first;
+    unsigned i = select_version_index(first, count, cb());
+    if (i == count) {
+#if __GNUC__
+        // std::abort may not be relocated yet
+        __builtin_trap();
+#else
+        std::abort();
+#endif
+    }
+    return first[i].fun_ptr;
+}
+
 /*  Registers a version of a function. @a Tag must be an unique type for each
     function with different name. The same @a Tag and @a FunPtr must be used
     when registering versions of the function to be dispatched.
@@ -221,15 +441,173 @@ private:
 template<class Tag, class FunPtr>
 class DispatchRegistrator {
 public:
-    DispatchRegistrator(Arch this_compile_info, FunPtr f)
+    DispatchRegistrator(Arch this_compile_info, FunPtr f,
+                        const char* name = nullptr)
     {
-        Dispatcher<Tag,FunPtr>::add_fun_ptr(this_compile_info, f);
+        Dispatcher<Tag,FunPtr>::add_fun_ptr(this_compile_info, f, name);
+    }
+};
+
+} // namespace detail
+
+/** @ingroup simd_dispatcher
+    Makes all dispatchers select the version of the dispatched function again
+    on their next invocation. Combined with @c set_arch_override this allows
+    to run all compiled versions of the dispatched functions within the same
+    process, e.g. for benchmarking.
+
+    The function is thread-safe. The threads that are concurrently executing a
+    dispatched function may finish executing the previously selected version.
+
+    Has no effect on functions dispatched in the IFUNC mode (see
+    @c SIMDPP_DISPATCHER_IFUNC), as these are bound once by the dynamic loader.
+*/
+inline void reset_dispatchers()
+{
+    std::lock_guard<std::mutex> lock(detail::get_dispatcher_mutex());
+    for (const auto& entry : detail::get_dispatcher_registry()) {
+        entry.reset();
+    }
+}
+
+/** @ingroup simd_dispatcher
+    Selects the versions of all dispatched functions that have not been
+    selected yet, so that the cost of the selection is not incurred by the
+    first invocation of each function. @a get_info_cb identifies the function
+    that is invoked to determine the supported architecture, usually
+    @c SIMDPP_USER_ARCH_INFO. It is called once for each dispatcher.
+
+    Must not be called before initialization of all static objects has
+    finished. The function is thread-safe.
+
+    The functions dispatched in the IFUNC mode (see
+    @c SIMDPP_DISPATCHER_IFUNC) are already resolved by the dynamic loader and
+    are not affected.
+*/
+inline void resolve_all_dispatchers(const GetArchCb& get_info_cb)
+{
+    for (const auto& entry : detail::get_dispatcher_registry()) {
+        entry.resolve(get_info_cb);
     }
+}
+
+/** @ingroup simd_dispatcher
+    Returns the description of all dispatched functions: their names, the
+    versions available and the version that has been selected, if any. The
+    list can be used for example to log the dispatching decisions at startup,
+    after calling @c resolve_all_dispatchers.
+
+    Must not be called before initialization of all static objects has
+    finished. The function is thread-safe.
+
+    The functions dispatched in the IFUNC mode (see
+    @c SIMDPP_DISPATCHER_IFUNC) are not listed.
+*/
+inline std::vector<DispatcherInfo> get_dispatcher_info()
+{
+    const auto& registry = detail::get_dispatcher_registry();
+    std::vector<DispatcherInfo> res(registry.size());
+
+    std::lock_guard<std::mutex> lock(detail::get_dispatcher_mutex());
+    for (unsigned i = 0; i < registry.size(); ++i) {
+        registry[i].get_info(res[i]);
+    }
+    return res;
+}
+
+namespace detail {
+
+// Maps a function type to the corresponding function pointer type
+template<class Sig> struct DispatchSig;
+
+template<class R, class... Args>
+struct DispatchSig<R(Args...)> {
+    using fun_ptr = R(*)(Args...);
+    using result = R;
 };
 
 } // namespace detail
+
+/** @ingroup simd_dispatcher
+    Calls the most efficient version of a function registered with
+    @c SIMDPP_DISPATCH_VERSION using the same @a Tag and @a Sig.
+
+    @a Sig is the function type of the dispatched function, e.g.
+    @c void(float*,unsigned). @a cb identifies the function that is invoked to
+    determine the supported architecture, usually @c SIMDPP_USER_ARCH_INFO.
+
+    The arguments are perfect-forwarded to the selected version, thus unlike the
+    @c SIMDPP_MAKE_DISPATCHER_* macros, no additional copies are made and there
+    is no limit on the number of arguments. The function is typically used to
+    implement the dispatching function by hand:
+
+    @code
+    // common.h
+    struct process_tag;
+
+    template<class T>
+    void process(T* p, unsigned n)
+    {
+        simdpp::dispatch_call<process_tag, void(T*,unsigned)>(
+                SIMDPP_USER_ARCH_INFO, p, n);
+    }
+
+    // process.cc, compiled for each architecture
+    namespace SIMDPP_ARCH_NAMESPACE {
+
+    template<class T>
+    void process(T* p, unsigned n) { ... }
+
+    } // namespace SIMDPP_ARCH_NAMESPACE
+
+    SIMDPP_DISPATCH_VERSION(process_tag, void(float*,unsigned), process<float>)
+    SIMDPP_DISPATCH_VERSION(process_tag, void(double*,unsigned), process<double>)
+    @endcode
+
+    The same restrictions as for the functions defined by
+    @c SIMDPP_MAKE_DISPATCHER_* apply. This facility always uses the default
+    dispatcher mode even if @c SIMDPP_DISPATCHER_IFUNC is defined.
+*/
+template<class Tag, class Sig, class Cb, class... Args>
+typename detail::DispatchSig<Sig>::result dispatch_call(const Cb& cb,
+                                                        Args&&... args)
+{
+    using FunPtr = typename detail::DispatchSig<Sig>::fun_ptr;
+    return detail::Dispatcher<Tag,FunPtr>::get_fun_ptr(cb)(
+                std::forward<Args>(args)...);
+}
+
 } // namespace simdpp
 
+/** @def SIMDPP_DISPATCH_VERSION(TAG, SIG, ...)
+    Registers a version of a function to be dispatched with
+    @c simdpp::dispatch_call. Must be used in the same context as the
+    @c SIMDPP_MAKE_DISPATCHER_* macros, that is, one level up from the
+    @c SIMDPP_ARCH_NAMESPACE namespace containing the function.
+
+    * TAG: an unique type identifying the dispatched function. The same
+      type must be passed to @c dispatch_call.
+
+    * SIG: the function type of the dispatched function. Parentheses protect
+      the commas within the parameter list.
+
+    * ...: the name of the function relative to @c SIMDPP_ARCH_NAMESPACE. May
+      be a template specialization, e.g. @c process<float,4>.
+
+    The macro may be used at most once per source line.
+*/
+#define SIMDPP_DISPATCH_VERSION(TAG, SIG, ...)                                \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static ::simdpp::detail::DispatchRegistrator<                                 \
+        TAG, ::simdpp::detail::DispatchSig<SIG>::fun_ptr                      \
+> SIMDPP_CONCAT(simdpp_dispatch_version_registrator_, __LINE__) (             \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast< ::simdpp::detail::DispatchSig<SIG>::fun_ptr>(            \
+            &__VA_ARGS__), #TAG);                                             \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
 #include <simdpp/dispatch/macros.h>
 
 #endif
@@ -33,12 +33,13 @@
 namespace simdpp {
 
 /** Retrieves supported architecture using GCC __builtin_cpu_supports function.
-    Works only on x86.
+    Works only on x86. The PCLMULQDQ, F16C and LZCNT extensions are detected
+    only with GCC 11 or newer, BMI1, BMI2 and AVX-512F with GCC 5 or newer.
 */
 inline Arch get_arch_gcc_builtin_cpu_supports()
 {
-    Arch arch_info;
-#if (__GNUC__ >= 4) && (__GNUC_MINOR__ >= 8)
+    Arch arch_info = Arch::NONE_NULL;
+#if (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8))
 #if __i386__ || __amd64__
     if (__builtin_cpu_supports("avx2")) {
         arch_info |= Arch::X86_SSE2;
@@ -68,6 +69,39 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
     } else if (__builtin_cpu_supports("sse2")) {
         arch_info |= Arch::X86_SSE2;
     }
+    if (__builtin_cpu_supports("sse4.2") &&
+        (arch_info & Arch::X86_SSE4_1) != Arch::NONE_NULL) {
+        arch_info |= Arch::X86_SSE4_2;
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        arch_info |= Arch::X86_POPCNT;
+    }
+#if __GNUC__ >= 5
+    if (__builtin_cpu_supports("bmi")) {
+        arch_info |= Arch::X86_BMI1;
+    }
+    if (__builtin_cpu_supports("bmi2")) {
+        arch_info |= Arch::X86_BMI2;
+    }
+    if (__builtin_cpu_supports("avx512f") &&
+        (arch_info & Arch::X86_AVX2) != Arch::NONE_NULL) {
+        arch_info |= Arch::X86_FMA3;
+        arch_info |= Arch::X86_AVX512F;
+    }
+#endif
+#if __GNUC__ >= 11
+    if (__builtin_cpu_supports("pclmul") &&
+        (arch_info & Arch::X86_SSE2) != Arch::NONE_NULL) {
+        arch_info |= Arch::X86_PCLMULQDQ;
+    }
+    if (__builtin_cpu_supports("f16c") &&
+        (arch_info & Arch::X86_AVX) != Arch::NONE_NULL) {
+        arch_info |= Arch::X86_F16C;
+    }
+    if (__builtin_cpu_supports("lzcnt")) {
+        arch_info |= Arch::X86_LZCNT;
+    }
+#endif
 #endif
 #endif
     return arch_info;
@@ -46,7 +46,7 @@ namespace simdpp {
 */
 inline Arch get_arch_linux_cpuinfo()
 {
-    Arch res;
+    Arch res = Arch::NONE_NULL;
 
     std::map<std::string, Arch> features;
     std::string ident;
@@ -65,6 +65,10 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
+    Arch a_pclmulqdq = a_sse2 | Arch::X86_PCLMULQDQ;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
+    Arch a_avx512f = a_avx2 | a_fma3 | Arch::X86_AVX512F;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
@@ -76,6 +80,15 @@ inline Arch get_arch_linux_cpuinfo()
     features["fma"] = a_fma3;
     features["fma4"] = a_fma4;
     features["xop"] = a_xop;
+    features["avx512f"] = a_avx512f;
+    features["sse4_2"] = a_sse4_2;
+    features["popcnt"] = Arch::X86_POPCNT;
+    features["pclmulqdq"] = a_pclmulqdq;
+    features["f16c"] = a_f16c;
+    // LZCNT is reported as a part of the advanced bit manipulation extension
+    features["abm"] = Arch::X86_LZCNT;
+    features["bmi1"] = Arch::X86_BMI1;
+    features["bmi2"] = Arch::X86_BMI2;
 #else
     return res;
 #endif
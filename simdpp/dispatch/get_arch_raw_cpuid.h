@@ -0,0 +1,223 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_GET_ARCH_RAW_CPUID_H
+#define LIBSIMDPP_DISPATCH_GET_ARCH_RAW_CPUID_H
+
+#include <cstdint>
+#include <simdpp/dispatch/arch.h>
+
+#if defined(__i386__) || defined(__amd64__)
+#if __GNUC__
+#include <cpuid.h>
+#endif
+#elif defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace simdpp {
+namespace detail {
+
+#if defined(__i386__) || defined(__amd64__) || defined(_M_IX86) || defined(_M_X64)
+
+/*  Executes the CPUID instruction for the given leaf and subleaf. The results
+    are stored to @a regs in EAX, EBX, ECX, EDX order.
+*/
+inline void get_cpuid(std::uint32_t level, std::uint32_t subleaf,
+                      std::uint32_t* regs)
+{
+#if __GNUC__
+    __cpuid_count(level, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#else
+    int iregs[4];
+    __cpuidex(iregs, level, subleaf);
+    for (unsigned i = 0; i < 4; ++i) {
+        regs[i] = iregs[i];
+    }
+#endif
+}
+
+/*  Returns the lower 32 bits of the XCR0 extended control register. Must only
+    be called if CPUID reports OSXSAVE support, otherwise the instruction
+    faults.
+*/
+inline std::uint32_t get_xcr0()
+{
+#if __GNUC__
+    // The xgetbv mnemonic requires -mxsave, thus we use the raw encoding
+    std::uint32_t eax, edx;
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0"
+                         : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+#else
+    return static_cast<std::uint32_t>(_xgetbv(0));
+#endif
+}
+
+#endif
+
+} // namespace detail
+
+/** @ingroup simdpp_dispatcher
+    Retrieves supported architecture by executing the CPUID and XGETBV
+    instructions directly. The operating system support for saving the AVX
+    register state is checked, thus AVX, AVX2, AVX-512F, F16C, FMA3, FMA4 and
+    XOP are reported only if they can actually be used.
+
+    The function does not allocate memory nor access the filesystem.
+
+    Works only on x86. On other architectures returns @c Arch::NONE_NULL.
+*/
+inline Arch get_arch_raw_cpuid()
+{
+    Arch res = Arch::NONE_NULL;
+
+#if defined(__i386__) || defined(__amd64__) || defined(_M_IX86) || defined(_M_X64)
+    std::uint32_t regs[4];
+
+    ::simdpp::detail::get_cpuid(0, 0, regs);
+    std::uint32_t max_level = regs[0];
+    if (max_level < 1) {
+        return res;
+    }
+
+    ::simdpp::detail::get_cpuid(1, 0, regs);
+    std::uint32_t ecx1 = regs[2];
+    std::uint32_t edx1 = regs[3];
+
+    // EDX bit 26: SSE2
+    if (!(edx1 & (1u << 26))) {
+        return res;
+    }
+    res |= Arch::X86_SSE2;
+
+    // ECX bit 0: SSE3
+    if (ecx1 & (1u << 0)) {
+        res |= Arch::X86_SSE3;
+    }
+    // ECX bit 9: SSSE3
+    if ((ecx1 & (1u << 9)) && (ecx1 & (1u << 0))) {
+        res |= Arch::X86_SSSE3;
+    }
+    // ECX bit 19: SSE4.1
+    if ((ecx1 & (1u << 19)) && (ecx1 & (1u << 9)) && (ecx1 & (1u << 0))) {
+        res |= Arch::X86_SSE4_1;
+    }
+    // ECX bit 20: SSE4.2
+    if ((ecx1 & (1u << 20)) && (res & Arch::X86_SSE4_1) != Arch::NONE_NULL) {
+        res |= Arch::X86_SSE4_2;
+    }
+    // ECX bit 23: POPCNT
+    if (ecx1 & (1u << 23)) {
+        res |= Arch::X86_POPCNT;
+    }
+    // ECX bit 1: PCLMULQDQ
+    if (ecx1 & (1u << 1)) {
+        res |= Arch::X86_PCLMULQDQ;
+    }
+
+    /*  VEX-encoded instructions may be used only if the OS saves and restores
+        both the XMM (bit 1 of XCR0) and YMM (bit 2 of XCR0) state. ECX bit 27
+        indicates that the OS has enabled XGETBV.
+    */
+    /*  EVEX-encoded instructions additionally require the opmask (bit 5),
+        upper ZMM0-15 (bit 6) and ZMM16-31 (bit 7) state to be enabled.
+    */
+    bool os_avx = false;
+    bool os_avx512 = false;
+    if (ecx1 & (1u << 27)) {
+        std::uint32_t xcr0 = ::simdpp::detail::get_xcr0();
+        os_avx = (xcr0 & 0x6) == 0x6;
+        os_avx512 = (xcr0 & 0xe6) == 0xe6;
+    }
+
+    bool has_sse3 = (res & Arch::X86_SSE3) != Arch::NONE_NULL;
+    bool has_sse4_1 = (res & Arch::X86_SSE4_1) != Arch::NONE_NULL;
+
+    // ECX bit 28: AVX
+    bool has_avx = os_avx && has_sse4_1 && (ecx1 & (1u << 28));
+    if (has_avx) {
+        res |= Arch::X86_AVX;
+    }
+    // ECX bit 29: F16C
+    if (has_avx && (ecx1 & (1u << 29))) {
+        res |= Arch::X86_F16C;
+    }
+    // ECX bit 12: FMA3
+    if (os_avx && has_sse3 && (ecx1 & (1u << 12))) {
+        res |= Arch::X86_FMA3;
+    }
+
+    if (max_level >= 7) {
+        ::simdpp::detail::get_cpuid(7, 0, regs);
+        std::uint32_t ebx7 = regs[1];
+        // EBX bit 5: AVX2
+        if (has_avx && (ebx7 & (1u << 5))) {
+            res |= Arch::X86_AVX2;
+        }
+        // EBX bit 3: BMI1
+        if (ebx7 & (1u << 3)) {
+            res |= Arch::X86_BMI1;
+        }
+        // EBX bit 8: BMI2
+        if (ebx7 & (1u << 8)) {
+            res |= Arch::X86_BMI2;
+        }
+        // EBX bit 16: AVX-512F. All such processors support FMA3 and AVX2,
+        // which the library requires
+        if (os_avx512 && (ebx7 & (1u << 16)) &&
+            (res & Arch::X86_AVX2) != Arch::NONE_NULL &&
+            (res & Arch::X86_FMA3) != Arch::NONE_NULL) {
+            res |= Arch::X86_AVX512F;
+        }
+    }
+
+    ::simdpp::detail::get_cpuid(0x80000000, 0, regs);
+    std::uint32_t max_ext_level = regs[0];
+    if (max_ext_level >= 0x80000001) {
+        ::simdpp::detail::get_cpuid(0x80000001, 0, regs);
+        std::uint32_t ecx81 = regs[2];
+        // ECX bit 5: LZCNT (ABM)
+        if (ecx81 & (1u << 5)) {
+            res |= Arch::X86_LZCNT;
+        }
+        // ECX bit 16: FMA4
+        if (os_avx && has_sse3 && (ecx81 & (1u << 16))) {
+            res |= Arch::X86_FMA4;
+        }
+        // ECX bit 11: XOP
+        if (os_avx && has_sse3 && (ecx81 & (1u << 11))) {
+            res |= Arch::X86_XOP;
+        }
+    }
+#endif
+    return res;
+}
+
+} // namespace simdpp
+
+#endif
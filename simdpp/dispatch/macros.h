@@ -66,9 +66,919 @@
     function in the namespace the macro is used. The body of that function
     implements the dispatch mechanism. The function must not be called before
     main() starts.
+
+    If @c SIMDPP_DISPATCHER_IFUNC is defined, the function is instead declared
+    as a GNU indirect function which is bound by the dynamic loader. In that
+    case, the function may be called at any time.
 */
 /// @{
-#ifdef SIMDPP_USE_NULL
+#if defined(SIMDPP_DISPATCHER_IFUNC) && defined(SIMDPP_USE_NULL)
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID0(NAME)                                    \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)()>                        \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)()>                        \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())()                              \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME()                                                                   \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)()>                        \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)()>(&NAME)                                         \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID1(NAME,T1)                                 \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1)>                      \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1)>                      \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1)                            \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1)                                                                 \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1)>                      \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1)>(&NAME)                                       \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID2(NAME,T1,T2)                              \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2)>                   \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2)>                   \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2)                         \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2)                                                              \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2)>                   \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2)>(&NAME)                                    \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID3(NAME,T1,T2,T3)                           \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3)>                \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3)>                \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3)                      \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3)                                                           \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3)>                \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3)>(&NAME)                                 \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID4(NAME,T1,T2,T3,T4)                        \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4)>             \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4)>             \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4)                   \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3,T4)                                                        \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4)>             \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4)>(&NAME)                              \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID5(NAME,T1,T2,T3,T4,T5)                     \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5)>          \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5)>          \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5)                \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3,T4,T5)                                                     \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5)>          \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME)                           \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID6(NAME,T1,T2,T3,T4,T5,T6)                  \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6)>       \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6)>       \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6)             \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3,T4,T5,T6)                                                  \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6)>       \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME)                        \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID7(NAME,T1,T2,T3,T4,T5,T6,T7)               \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7)>    \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7)>    \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6,T7)          \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3,T4,T5,T6,T7)                                               \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7)>    \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME)                     \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID8(NAME,T1,T2,T3,T4,T5,T6,T7,T8)            \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)> \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)> \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6,T7,T8)       \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3,T4,T5,T6,T7,T8)                                            \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)> \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME)                  \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID9(NAME,T1,T2,T3,T4,T5,T6,T7,T8,T9)         \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>\
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>\
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static void (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6,T7,T8,T9)    \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1,T2,T3,T4,T5,T6,T7,T8,T9)                                         \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>\
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME)               \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET0(NAME,R)                                   \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)()>                           \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)()>                           \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())()                                 \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME()                                                                      \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)()>                           \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)()>(&NAME)                                            \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET1(NAME,R,T1)                                \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1)>                         \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1)>                         \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1)                               \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1)                                                                    \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1)>                         \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1)>(&NAME)                                          \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET2(NAME,R,T1,T2)                             \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2)>                      \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2)>                      \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2)                            \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2)                                                                 \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2)>                      \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2)>(&NAME)                                       \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET3(NAME,R,T1,T2,T3)                          \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3)>                   \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3)>                   \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3)                         \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3)                                                              \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3)>                   \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3)>(&NAME)                                    \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET4(NAME,R,T1,T2,T3,T4)                       \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4)>                \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4)>                \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4)                      \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3,T4)                                                           \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4)>                \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4)>(&NAME)                                 \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET5(NAME,R,T1,T2,T3,T4,T5)                    \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5)>             \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5)>             \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5)                   \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3,T4,T5)                                                        \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5)>             \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME)                              \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET6(NAME,R,T1,T2,T3,T4,T5,T6)                 \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6)>          \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6)>          \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6)                \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3,T4,T5,T6)                                                     \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6)>          \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME)                           \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET7(NAME,R,T1,T2,T3,T4,T5,T6,T7)              \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7)>       \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7)>       \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6,T7)             \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3,T4,T5,T6,T7)                                                  \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7)>       \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME)                        \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET8(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8)           \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>    \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>    \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6,T7,T8)          \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3,T4,T5,T6,T7,T8)                                               \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>    \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME)                     \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET9(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8,T9)        \
+                                                                              \
+extern "C" {                                                                  \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)> \
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));    \
+extern const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)> \
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));     \
+                                                                              \
+static R (*simdpp_ifunc_resolve_ ## NAME())(T1,T2,T3,T4,T5,T6,T7,T8,T9)       \
+{                                                                             \
+    return ::simdpp::detail::select_ifunc_version(                            \
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,          \
+        SIMDPP_USER_ARCH_INFO);                                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1,T2,T3,T4,T5,T6,T7,T8,T9)                                            \
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)> \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME)                  \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#elif defined(SIMDPP_DISPATCHER_IFUNC)
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID0(NAME)                                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)()>                        \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)()>(&NAME)                                         \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID1(NAME,T1)                                 \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1)>                      \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1)>(&NAME)                                       \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID2(NAME,T1,T2)                              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2)>                   \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2)>(&NAME)                                    \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID3(NAME,T1,T2,T3)                           \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3)>                \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3)>(&NAME)                                 \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID4(NAME,T1,T2,T3,T4)                        \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4)>             \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4)>(&NAME)                              \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID5(NAME,T1,T2,T3,T4,T5)                     \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5)>          \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME)                           \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID6(NAME,T1,T2,T3,T4,T5,T6)                  \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6)>       \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME)                        \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID7(NAME,T1,T2,T3,T4,T5,T6,T7)               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7)>    \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME)                     \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID8(NAME,T1,T2,T3,T4,T5,T6,T7,T8)            \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)> \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME)                  \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID9(NAME,T1,T2,T3,T4,T5,T6,T7,T8,T9)         \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>\
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME)               \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET0(NAME,R)                                   \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)()>                           \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)()>(&NAME)                                            \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET1(NAME,R,T1)                                \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1)>                         \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1)>(&NAME)                                          \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET2(NAME,R,T1,T2)                             \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2)>                      \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2)>(&NAME)                                       \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET3(NAME,R,T1,T2,T3)                          \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3)>                   \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3)>(&NAME)                                    \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET4(NAME,R,T1,T2,T3,T4)                       \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4)>                \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4)>(&NAME)                                 \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET5(NAME,R,T1,T2,T3,T4,T5)                    \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5)>             \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME)                              \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET6(NAME,R,T1,T2,T3,T4,T5,T6)                 \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6)>          \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME)                           \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET7(NAME,R,T1,T2,T3,T4,T5,T6,T7)              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7)>       \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME)                        \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET8(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8)           \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>    \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME)                     \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET9(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8,T9)        \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)> \
+    simdpp_ifunc_version_ ## NAME                                             \
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {                 \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME)                  \
+    };                                                                        \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#elif defined(SIMDPP_USE_NULL)
 
 
 #define SIMDPP_MAKE_DISPATCHER_VOID0(NAME)                                    \
@@ -89,7 +999,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)()                                     \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)()>(&NAME));                                       \
+        static_cast<void(*)()>(&NAME), #NAME);                                \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -112,7 +1022,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1)                                   \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1)>(&NAME));                                     \
+        static_cast<void(*)(T1)>(&NAME), #NAME);                              \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -135,7 +1045,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2)                                \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2)>(&NAME));                                  \
+        static_cast<void(*)(T1,T2)>(&NAME), #NAME);                           \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -158,7 +1068,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3)                             \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3)>(&NAME));                               \
+        static_cast<void(*)(T1,T2,T3)>(&NAME), #NAME);                        \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -181,7 +1091,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4)                          \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4)>(&NAME));                            \
+        static_cast<void(*)(T1,T2,T3,T4)>(&NAME), #NAME);                     \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -204,7 +1114,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5)                       \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME));                         \
+        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME), #NAME);                  \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -227,7 +1137,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6)                    \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                      \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME), #NAME);               \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -250,7 +1160,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7)                 \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                   \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME), #NAME);            \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -273,7 +1183,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8)              \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME), #NAME);         \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -296,7 +1206,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)           \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));             \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME), #NAME);      \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -319,7 +1229,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)()                                        \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)()>(&NAME));                                          \
+        static_cast<R(*)()>(&NAME), #NAME);                                   \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -342,7 +1252,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1)                                      \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1)>(&NAME));                                        \
+        static_cast<R(*)(T1)>(&NAME), #NAME);                                 \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -365,7 +1275,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2)                                   \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2)>(&NAME));                                     \
+        static_cast<R(*)(T1,T2)>(&NAME), #NAME);                              \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -388,7 +1298,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3)                                \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3)>(&NAME));                                  \
+        static_cast<R(*)(T1,T2,T3)>(&NAME), #NAME);                           \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -411,7 +1321,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4)                             \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4)>(&NAME));                               \
+        static_cast<R(*)(T1,T2,T3,T4)>(&NAME), #NAME);                        \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -434,7 +1344,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5)                          \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME));                            \
+        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME), #NAME);                     \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -457,7 +1367,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6)                       \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME), #NAME);                  \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -480,7 +1390,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7)                    \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                      \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME), #NAME);               \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -503,7 +1413,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8)                 \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                   \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME), #NAME);            \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -526,7 +1436,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)              \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));                \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME), #NAME);         \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -543,7 +1453,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)()                                     \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)()>(&NAME));                                       \
+        static_cast<void(*)()>(&NAME), #NAME);                                \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -557,7 +1467,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1)                                   \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1)>(&NAME));                                     \
+        static_cast<void(*)(T1)>(&NAME), #NAME);                              \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -571,7 +1481,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2)                                \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2)>(&NAME));                                  \
+        static_cast<void(*)(T1,T2)>(&NAME), #NAME);                           \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -585,7 +1495,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3)                             \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3)>(&NAME));                               \
+        static_cast<void(*)(T1,T2,T3)>(&NAME), #NAME);                        \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -599,7 +1509,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4)                          \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4)>(&NAME));                            \
+        static_cast<void(*)(T1,T2,T3,T4)>(&NAME), #NAME);                     \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -613,7 +1523,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5)                       \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME));                         \
+        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME), #NAME);                  \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -627,7 +1537,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6)                    \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                      \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME), #NAME);               \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -641,7 +1551,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7)                 \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                   \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME), #NAME);            \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -655,7 +1565,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8)              \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME), #NAME);         \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -669,7 +1579,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)           \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));             \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME), #NAME);      \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -683,7 +1593,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)()                                        \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)()>(&NAME));                                          \
+        static_cast<R(*)()>(&NAME), #NAME);                                   \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -697,7 +1607,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1)                                      \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1)>(&NAME));                                        \
+        static_cast<R(*)(T1)>(&NAME), #NAME);                                 \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -711,7 +1621,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2)                                   \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2)>(&NAME));                                     \
+        static_cast<R(*)(T1,T2)>(&NAME), #NAME);                              \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -725,7 +1635,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3)                                \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3)>(&NAME));                                  \
+        static_cast<R(*)(T1,T2,T3)>(&NAME), #NAME);                           \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -739,7 +1649,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4)                             \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4)>(&NAME));                               \
+        static_cast<R(*)(T1,T2,T3,T4)>(&NAME), #NAME);                        \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -753,7 +1663,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5)                          \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME));                            \
+        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME), #NAME);                     \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -767,7 +1677,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6)                       \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME), #NAME);                  \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -781,7 +1691,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7)                    \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                      \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME), #NAME);               \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -795,7 +1705,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8)                 \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                   \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME), #NAME);            \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -809,7 +1719,7 @@ static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)              \
 > simdpp_dispatch_registrator_ ## NAME (                                      \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
-        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));                \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME), #NAME);         \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
@@ -127,6 +127,36 @@
     #endif
 #endif
 
+#ifdef SIMDPP_ARCH_X86_AVX512F
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_AVX
+        #define SIMDPP_USE_AVX 1
+    #endif
+    #ifndef SIMDPP_USE_AVX2
+        #define SIMDPP_USE_AVX2 1
+    #endif
+    #ifndef SIMDPP_USE_FMA3
+        #define SIMDPP_USE_FMA3 1
+    #endif
+    #ifndef SIMDPP_USE_AVX512F
+        #define SIMDPP_USE_AVX512F 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
 #ifdef SIMDPP_ARCH_X86_FMA3
     #ifndef SIMDPP_USE_FMA3
         #define SIMDPP_USE_FMA3 1
@@ -172,6 +202,87 @@
     #endif
 #endif
 
+#ifdef SIMDPP_ARCH_X86_POPCNT
+    #ifndef SIMDPP_USE_POPCNT
+        #define SIMDPP_USE_POPCNT 1
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_SSE4_2
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_PCLMULQDQ
+    #ifndef SIMDPP_USE_PCLMULQDQ
+        #define SIMDPP_USE_PCLMULQDQ 1
+    #endif
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_F16C
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_AVX
+        #define SIMDPP_USE_AVX 1
+    #endif
+    #ifndef SIMDPP_USE_F16C
+        #define SIMDPP_USE_F16C 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_LZCNT
+    #ifndef SIMDPP_USE_LZCNT
+        #define SIMDPP_USE_LZCNT 1
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_BMI1
+    #ifndef SIMDPP_USE_BMI1
+        #define SIMDPP_USE_BMI1 1
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_BMI2
+    #ifndef SIMDPP_USE_BMI2
+        #define SIMDPP_USE_BMI2 1
+    #endif
+#endif
+
 #ifdef SIMDPP_ARCH_ARM_NEON
     #ifndef SIMDPP_USE_NEON
         #define SIMDPP_USE_NEON 1
@@ -276,6 +387,62 @@
     #define SIMDPP_PP_XOP
 #endif
 
+#ifdef SIMDPP_USE_POPCNT
+    #define SIMDPP_PP_POPCNT _popcnt
+    #include <nmmintrin.h>
+#else
+    #define SIMDPP_PP_POPCNT
+#endif
+
+#ifdef SIMDPP_USE_SSE4_2
+    #define SIMDPP_PP_SSE4_2 _sse4p2
+    #include <nmmintrin.h>
+#else
+    #define SIMDPP_PP_SSE4_2
+#endif
+
+#ifdef SIMDPP_USE_PCLMULQDQ
+    #define SIMDPP_PP_PCLMULQDQ _pclmul
+    #include <wmmintrin.h>
+#else
+    #define SIMDPP_PP_PCLMULQDQ
+#endif
+
+#ifdef SIMDPP_USE_F16C
+    #define SIMDPP_PP_F16C _f16c
+    #include <immintrin.h>
+#else
+    #define SIMDPP_PP_F16C
+#endif
+
+#ifdef SIMDPP_USE_LZCNT
+    #define SIMDPP_PP_LZCNT _lzcnt
+    #include <immintrin.h>
+#else
+    #define SIMDPP_PP_LZCNT
+#endif
+
+#ifdef SIMDPP_USE_BMI1
+    #define SIMDPP_PP_BMI1 _bmi1
+    #include <immintrin.h>
+#else
+    #define SIMDPP_PP_BMI1
+#endif
+
+#ifdef SIMDPP_USE_BMI2
+    #define SIMDPP_PP_BMI2 _bmi2
+    #include <immintrin.h>
+#else
+    #define SIMDPP_PP_BMI2
+#endif
+
+#ifdef SIMDPP_USE_AVX512F
+    #define SIMDPP_PP_AVX512F _avx512f
+    #include <immintrin.h>
+#else
+    #define SIMDPP_PP_AVX512F
+#endif
+
 #ifdef SIMDPP_USE_NEON
     #define SIMDPP_PP_NEON _neon
     #include <arm_neon.h>
@@ -317,11 +484,19 @@
 #define SIMDPP_PP_ARCH_CONCAT7  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT6, SIMDPP_PP_FMA3)
 #define SIMDPP_PP_ARCH_CONCAT8  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT7, SIMDPP_PP_FMA4)
 #define SIMDPP_PP_ARCH_CONCAT9  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT8, SIMDPP_PP_XOP)
-#define SIMDPP_PP_ARCH_CONCAT10 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT9, SIMDPP_PP_NEON)
-#define SIMDPP_PP_ARCH_CONCAT11 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT10, SIMDPP_PP_NEON_FLT_SP)
-#define SIMDPP_PP_ARCH_CONCAT12 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT11, SIMDPP_PP_ALTIVEC)
-
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_ARCH_CONCAT12
+#define SIMDPP_PP_ARCH_CONCAT10 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT9, SIMDPP_PP_POPCNT)
+#define SIMDPP_PP_ARCH_CONCAT11 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT10, SIMDPP_PP_SSE4_2)
+#define SIMDPP_PP_ARCH_CONCAT12 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT11, SIMDPP_PP_PCLMULQDQ)
+#define SIMDPP_PP_ARCH_CONCAT13 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT12, SIMDPP_PP_F16C)
+#define SIMDPP_PP_ARCH_CONCAT14 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT13, SIMDPP_PP_LZCNT)
+#define SIMDPP_PP_ARCH_CONCAT15 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT14, SIMDPP_PP_BMI1)
+#define SIMDPP_PP_ARCH_CONCAT16 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT15, SIMDPP_PP_BMI2)
+#define SIMDPP_PP_ARCH_CONCAT17 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT16, SIMDPP_PP_AVX512F)
+#define SIMDPP_PP_ARCH_CONCAT18 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT17, SIMDPP_PP_NEON)
+#define SIMDPP_PP_ARCH_CONCAT19 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT18, SIMDPP_PP_NEON_FLT_SP)
+#define SIMDPP_PP_ARCH_CONCAT20 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT19, SIMDPP_PP_ALTIVEC)
+
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_ARCH_CONCAT20
 
 /** @def SIMDPP_ARCH_NAME
     Usable in contexts where a string is required
@@ -119,6 +119,56 @@
 
         Macro: @c SIMDPP_ARCH_X86_XOP.
 
+    - @c X86_AVX512F:
+
+        The x86/x86_64 AVX-512 Foundation instruction set is used. The SSE,
+        SSE2, SSE3, SSSE3, SSE4.1, AVX, AVX2 and FMA3 instruction set support
+        is required implicitly (no need to define the macros for these
+        instruction sets). 32-bit and 64-bit element vectors become 512-bit
+        wide.
+
+        Macro: @c SIMDPP_ARCH_X86_AVX512F.
+
+    - @c X86_POPCNT:
+
+        The x86/x86_64 POPCNT instruction is used for population count of
+        scalar values. Does not imply any vector instruction set, thus it is
+        usually combined with one.
+
+        Macro: @c SIMDPP_ARCH_X86_POPCNT.
+
+    - @c X86_SSE4_2:
+
+        The x86/x86_64 SSE4.2 instruction set is used. The SSE, SSE2, SSE3,
+        SSSE3 and SSE4.1 instruction set support is required implicitly (no
+        need to define the macros for these instruction sets).
+
+        Macro: @c SIMDPP_ARCH_X86_SSE4_2.
+
+    - @c X86_PCLMULQDQ:
+
+        The x86/x86_64 PCLMULQDQ (carry-less multiplication) instruction is
+        used. The SSE and SSE2 instruction set support is required implicitly.
+
+        Macro: @c SIMDPP_ARCH_X86_PCLMULQDQ.
+
+    - @c X86_F16C:
+
+        The x86/x86_64 F16C (half-precision floating-point conversion)
+        instruction set is used. The AVX instruction set support and its
+        prerequisites are required implicitly.
+
+        Macro: @c SIMDPP_ARCH_X86_F16C.
+
+    - @c X86_LZCNT, @c X86_BMI1, @c X86_BMI2:
+
+        The x86/x86_64 LZCNT instruction and the BMI1 and BMI2 bit
+        manipulation instruction sets are used for scalar values. These do not
+        imply any vector instruction set.
+
+        Macros: @c SIMDPP_ARCH_X86_LZCNT, @c SIMDPP_ARCH_X86_BMI1,
+        @c SIMDPP_ARCH_X86_BMI2.
+
     - @c ARM_NEON:
 
         The ARM NEON instruction set. The VFP co-processor is used for any
@@ -273,12 +323,20 @@
         supported by the compiler.
      - @c simdpp_get_runnable_archs: checks what architectures are supported by
         both the compiler and the current processor.
-     - @c simdpp_multiversion: given a list of architectures (possibly
+     - @c simdpp_multiarch: given a list of architectures (possibly
         generated by @c simdpp_get_compilable_archs or
         @c simdpp_get_runnable_archs), automatically configures compilation of
         additional objects. The user only needs to add the returned list of
         source files to @c add_library or @c add_executable.
 
+    Each source file passed to @c simdpp_multiarch is compiled once per
+    architecture. To limit the compile time and the size of the binary, only
+    the hot kernels should be placed into such files; the rest of the program
+    is compiled once. Compiling the versions for several architectures within
+    a single translation unit (e.g. via the GCC @c target attribute) is not
+    supported, as the implementation of the libsimdpp types is selected per
+    translation unit by the @c SIMDPP_ARCH_* macros.
+
     The above example may be build with @c CMakeLists.txt as simple as follows:
     @code
     cmake_minimum_required(VERSION 2.8.0)
@@ -302,6 +360,7 @@
 #include <cstdlib>
 
 
+#include <simdpp/adv/stream_copy.h>
 #include <simdpp/adv/transpose.h>
 #include <simdpp/altivec/load1.h>
 #include <simdpp/core/align.h>
@@ -320,6 +379,7 @@
 #include <simdpp/core/cmp_le.h>
 #include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/compress.h>
 #include <simdpp/core/extract.h>
 #include <simdpp/core/f_abs.h>
 #include <simdpp/core/f_add.h>
@@ -342,6 +402,7 @@
 #include <simdpp/core/f_sqrt.h>
 #include <simdpp/core/f_sub.h>
 #include <simdpp/core/f_trunc.h>
+#include <simdpp/core/gather.h>
 #include <simdpp/core/i_abs.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_adds.h>
@@ -362,6 +423,7 @@
 #include <simdpp/core/load_packed2.h>
 #include <simdpp/core/load_packed3.h>
 #include <simdpp/core/load_packed4.h>
+#include <simdpp/core/load_partial.h>
 #include <simdpp/core/load_splat.h>
 #include <simdpp/core/load_u.h>
 #include <simdpp/core/make_float.h>
@@ -374,6 +436,8 @@
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/permute_bytes16.h>
 #include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/prefetch_cursor.h>
+#include <simdpp/core/scatter.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
@@ -383,11 +447,14 @@
 #include <simdpp/core/splat_n.h>
 #include <simdpp/core/store_first.h>
 #include <simdpp/core/store.h>
+#include <simdpp/core/store_compress.h>
 #include <simdpp/core/store_last.h>
 #include <simdpp/core/store_packed2.h>
 #include <simdpp/core/store_packed3.h>
 #include <simdpp/core/store_packed4.h>
+#include <simdpp/core/store_partial.h>
 #include <simdpp/core/stream.h>
+#include <simdpp/core/stream_load.h>
 #include <simdpp/core/to_float32.h>
 #include <simdpp/core/to_float64.h>
 #include <simdpp/core/to_int16.h>
@@ -432,11 +499,15 @@
 #include <simdpp/types/float32x4.inl>
 #include <simdpp/types/float32x8.h>
 #include <simdpp/types/float32x8.inl>
+#include <simdpp/types/float32x16.h>
+#include <simdpp/types/float32x16.inl>
 #include <simdpp/types/float64.h>
 #include <simdpp/types/float64x2.h>
 #include <simdpp/types/float64x2.inl>
 #include <simdpp/types/float64x4.h>
 #include <simdpp/types/float64x4.inl>
+#include <simdpp/types/float64x8.h>
+#include <simdpp/types/float64x8.inl>
 #include <simdpp/types/fwd.h>
 #include <simdpp/types/int16.h>
 #include <simdpp/types/int16.inl>
@@ -446,6 +517,8 @@
 #include <simdpp/types/int16x8.inl>
 #include <simdpp/types/int32.h>
 #include <simdpp/types/int32.inl>
+#include <simdpp/types/int32x16.h>
+#include <simdpp/types/int32x16.inl>
 #include <simdpp/types/int32x4.h>
 #include <simdpp/types/int32x4.inl>
 #include <simdpp/types/int32x8.h>
@@ -456,6 +529,8 @@
 #include <simdpp/types/int64x2.inl>
 #include <simdpp/types/int64x4.h>
 #include <simdpp/types/int64x4.inl>
+#include <simdpp/types/int64x8.h>
+#include <simdpp/types/int64x8.inl>
 #include <simdpp/types/int8.h>
 #include <simdpp/types/int8.inl>
 #include <simdpp/types/int8x16.h>
@@ -47,34 +47,68 @@ namespace SIMDPP_ARCH_NAMESPACE {
 /** Returns the instruction set flags that will be required by the currently
     compiled code
 */
-inline Arch this_compile_arch()
+constexpr Arch this_compile_arch()
 {
-    Arch res = Arch::NONE_NULL;
+    // A single expression is needed for the function to be constexpr in C++11
+    return static_cast<Arch>(0u
 #if SIMDPP_USE_SSE2
-    res |= Arch::X86_SSE2;
+        | static_cast<std::uint32_t>(Arch::X86_SSE2)
 #endif
 #if SIMDPP_USE_SSE3
-    res |= Arch::X86_SSE3;
+        | static_cast<std::uint32_t>(Arch::X86_SSE3)
 #endif
 #if SIMDPP_USE_SSSE3
-    res |= Arch::X86_SSSE3;
+        | static_cast<std::uint32_t>(Arch::X86_SSSE3)
 #endif
 #if SIMDPP_USE_SSE4_1
-    res |= Arch::X86_SSE4_1;
+        | static_cast<std::uint32_t>(Arch::X86_SSE4_1)
 #endif
 #if SIMDPP_USE_AVX
-    res |= Arch::X86_AVX;
+        | static_cast<std::uint32_t>(Arch::X86_AVX)
 #endif
 #if SIMDPP_USE_AVX2
-    res |= Arch::X86_AVX2;
+        | static_cast<std::uint32_t>(Arch::X86_AVX2)
+#endif
+#if SIMDPP_USE_FMA3
+        | static_cast<std::uint32_t>(Arch::X86_FMA3)
+#endif
+#if SIMDPP_USE_FMA4
+        | static_cast<std::uint32_t>(Arch::X86_FMA4)
+#endif
+#if SIMDPP_USE_XOP
+        | static_cast<std::uint32_t>(Arch::X86_XOP)
+#endif
+#if SIMDPP_USE_AVX512F
+        | static_cast<std::uint32_t>(Arch::X86_AVX512F)
+#endif
+#if SIMDPP_USE_POPCNT
+        | static_cast<std::uint32_t>(Arch::X86_POPCNT)
+#endif
+#if SIMDPP_USE_SSE4_2
+        | static_cast<std::uint32_t>(Arch::X86_SSE4_2)
+#endif
+#if SIMDPP_USE_PCLMULQDQ
+        | static_cast<std::uint32_t>(Arch::X86_PCLMULQDQ)
+#endif
+#if SIMDPP_USE_F16C
+        | static_cast<std::uint32_t>(Arch::X86_F16C)
+#endif
+#if SIMDPP_USE_LZCNT
+        | static_cast<std::uint32_t>(Arch::X86_LZCNT)
+#endif
+#if SIMDPP_USE_BMI1
+        | static_cast<std::uint32_t>(Arch::X86_BMI1)
+#endif
+#if SIMDPP_USE_BMI2
+        | static_cast<std::uint32_t>(Arch::X86_BMI2)
 #endif
 #if SIMDPP_USE_NEON
-    res |= Arch::ARM_NEON;
+        | static_cast<std::uint32_t>(Arch::ARM_NEON)
 #endif
 #if SIMDPP_USE_NEON_FLT_SP
-    res |= Arch::ARM_NEON_FLT_SP;
+        | static_cast<std::uint32_t>(Arch::ARM_NEON_FLT_SP)
 #endif
-    return res;
+    );
 }
 
 /// @} -- end defgroup
@@ -35,6 +35,7 @@
 
 #include <simdpp/expr.h>
 #include <simdpp/types/fwd.h>
+#include <simdpp/detail/profile.h>
 #include <simdpp/types/any.h>
 #include <simdpp/types/int8x16.h>
 #include <simdpp/types/int16x8.h>
@@ -48,6 +49,10 @@
 #include <simdpp/types/int64x4.h>
 #include <simdpp/types/float32x8.h>
 #include <simdpp/types/float64x4.h>
+#include <simdpp/types/int32x16.h>
+#include <simdpp/types/int64x8.h>
+#include <simdpp/types/float32x16.h>
+#include <simdpp/types/float64x8.h>
 #include <simdpp/types/int8.h>
 #include <simdpp/types/int16.h>
 #include <simdpp/types/int32.h>
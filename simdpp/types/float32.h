@@ -38,6 +38,7 @@
 #include <simdpp/core/cast.h>
 #include <simdpp/types/float32x4.h>
 #include <simdpp/types/float32x8.h>
+#include <simdpp/types/float32x16.h>
 #include <simdpp/detail/construct_eval.h>
 
 namespace simdpp {
@@ -0,0 +1,161 @@
+/*  libsimdpp
+    Copyright (C) 2011  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT32X16_H
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT32X16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/any.h>
+#include <simdpp/types/int32x16.h>
+#include <simdpp/types/float32x8.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/construct_eval.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+#if SIMDPP_USE_AVX512F || DOXYGEN_SHOULD_READ_THIS
+
+/// @ingroup simd_vec_fp
+/// @{
+
+/// Class representing float32x16 vector
+template<>
+class float32<16, void> : public any_float32<16, float32<16,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_FLOAT;
+    using base_vector_type = float32<16,void>;
+    using expr_type = void;
+    using native_type = __m512;
+
+    float32<16>() = default;
+    float32<16>(const float32<16> &) = default;
+    float32<16> &operator=(const float32<16> &) = default;
+
+    template<class E> float32<16>(const float32<16,E>& d) { *this = d.eval(); }
+    template<class V> explicit float32<16>(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<float32<16>>(d.vec().eval());
+    }
+    template<class V> float32<16>& operator=(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<float32<16>>(d.vec().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    float32<16>(const native_type& d) : d_(d) {}
+    float32<16>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    template<class E> float32<16>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> float32<16>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const float32<16>& operator[](unsigned) const { return *this; }
+          float32<16>& operator[](unsigned)       { return *this; }
+    /// @}
+
+    float32<16> eval() const { return *this; }
+
+    /** Creates a float32x16 vector with the contents set to zero
+
+        @code
+        r0 = 0.0f
+        ...
+        r15 = 0.0f
+        @endcode
+    */
+    static float32x16 zero();
+
+private:
+    native_type d_;
+};
+
+/// Class representing possibly optimized mask data for 16x 32-bit floating point
+/// vector. The mask is stored in an AVX-512 opmask register, one bit per
+/// element.
+template<>
+class mask_float32<16, void> : public any_float32<16, mask_float32<16,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_MASK_FLOAT;
+    using base_vector_type = mask_float32<16,void>;
+    using expr_type = void;
+    using native_type = __mmask16;
+
+    mask_float32<16>() = default;
+    mask_float32<16>(const mask_float32<16> &) = default;
+    mask_float32<16> &operator=(const mask_float32<16> &) = default;
+
+    mask_float32<16>(const native_type& d) : d_(d) {}
+    /// Converts a vector with each element either all-ones or all-zeros
+    mask_float32<16>(const float32<16>& d) : d_(_mm512_test_epi32_mask(_mm512_castps_si512(d), _mm512_castps_si512(d))) {}
+
+    /// Access the opmask register
+    operator native_type() const { return d_; }
+
+    /// Access the underlying type
+    float32<16> unmask() const;
+
+    const mask_float32<16>& operator[](unsigned) const { return *this; }
+          mask_float32<16>& operator[](unsigned)       { return *this; }
+
+    mask_float32<16> eval() const { return *this; }
+
+private:
+    native_type d_;
+};
+
+/// @} -- end ingroup
+
+#endif // SIMDPP_USE_AVX512F || DOXYGEN_SHOULD_READ_THIS
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -37,6 +37,7 @@
 #include <simdpp/types/any.h>
 #include <simdpp/types/int32x8.h>
 #include <simdpp/types/float32x4.h>
+#include <simdpp/core/cast.h>
 #include <simdpp/detail/construct_eval.h>
 
 namespace simdpp {
@@ -49,40 +50,38 @@ namespace SIMDPP_ARCH_NAMESPACE {
 /// @ingroup simd_vec_fp
 /// @{
 
-/// Class representing a float32x8 vector
+/// Class representing float32x8 vector
 template<>
 class float32<8, void> : public any_float32<8, float32<8,void>> {
 public:
-
-    using element_type = float;
-    using uint_element_type = uint32_t;
-    using int_vector_type = uint32x8;
-    using uint_vector_type = uint32x8;
-    using base_vector_type = float32x8;
-    using mask_vector_type = mask_float32x8;
-
-    static constexpr unsigned vec_length = 1;
-    static constexpr unsigned length = 8;
-    static constexpr unsigned num_bits = 32;
-    static constexpr uint_element_type all_bits = 0xffffffff;
+    static const unsigned type_tag = SIMDPP_TAG_FLOAT;
+    using base_vector_type = float32<8,void>;
+    using expr_type = void;
+    using native_type = __m256;
 
     float32<8>() = default;
-    float32<8>(const float32x8&) = default;
-    float32<8>& operator=(const float32x8&) = default;
-
-    /// Construct from the underlying vector type
-    float32<8>(__m256 d) : d_(d) {}
-    float32<8>& operator=(__m256 d) { d_ = d; return *this; }
+    float32<8>(const float32<8> &) = default;
+    float32<8> &operator=(const float32<8> &) = default;
 
-    /// Convert to underlying vector type
-    operator __m256() const { return d_; }
+    template<class E> float32<8>(const float32<8,E>& d) { *this = d.eval(); }
+    template<class V> explicit float32<8>(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<float32<8>>(d.vec().eval());
+    }
+    template<class V> float32<8>& operator=(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<float32<8>>(d.vec().eval()); return *this;
+    }
 
     /// @{
-    /// Construct from compatible int32x8 integer vector type
-    float32<8>(uint32<8> d)              { *this = bit_cast<float32<8>>(d); }
-    float32<8>& operator=(uint32<8> d)   { *this = bit_cast<float32<8>>(d); return *this; }
+    /// Construct from the underlying vector type
+    float32<8>(const native_type& d) : d_(d) {}
+    float32<8>& operator=(const native_type& d) { d_ = d; return *this; }
     /// @}
 
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     template<class E> float32<8>(const expr_vec_construct<E>& e)
     {
@@ -96,8 +95,8 @@ public:
 
     /// @{
     /// Access base vectors
-    const float32x8& operator[](unsigned) const { return *this; }
-          float32x8& operator[](unsigned)       { return *this; }
+    const float32<8>& operator[](unsigned) const { return *this; }
+          float32<8>& operator[](unsigned)       { return *this; }
     /// @}
 
     float32<8> eval() const { return *this; }
@@ -106,67 +105,43 @@ public:
 
         @code
         r0 = 0.0f
-        r1 = 0.0f
-        r2 = 0.0f
-        r3 = 0.0f
+        ...
+        r7 = 0.0f
         @endcode
     */
     static float32x8 zero();
 
 private:
-    __m256 d_;
+    native_type d_;
 };
 
 /// Class representing possibly optimized mask data for 8x 32-bit floating point
 /// vector
 template<>
-class maskdata_float32<8> {
+class mask_float32<8, void> : public any_float32<8, mask_float32<8,void>> {
 public:
-    using base_vector_type = maskdata_float32<8>;
-    static constexpr unsigned length = 8;
-    static constexpr unsigned vec_length = 1;
-
-    maskdata_float32<8>() = default;
-    maskdata_float32<8>(const maskdata_float32<8> &) = default;
-    maskdata_float32<8> &operator=(const maskdata_float32<8> &) = default;
-
-    maskdata_float32<8>(float32<8> d) : d_(d) {}
+    static const unsigned type_tag = SIMDPP_TAG_MASK_FLOAT;
+    using base_vector_type = mask_float32<8,void>;
+    using expr_type = void;
+    using native_type = __m256;
 
-    /// Convert to bitmask
-    operator float32<8>() const;
-
-    /// @{
-    /// Access base vectors
-    const maskdata_float32<8>& operator[](unsigned) const { return *this; }
-          maskdata_float32<8>& operator[](unsigned)       { return *this; }
-    /// @}
-
-private:
-    float32<8> d_;
-};
-
-
-/// Class representing a mask for 8x 32-bit floating-point vector
-template<>
-class mask_float32<8, void> : public any_float32<8, float32<8,void>> {
-public:
     mask_float32<8>() = default;
     mask_float32<8>(const mask_float32<8> &) = default;
     mask_float32<8> &operator=(const mask_float32<8> &) = default;
-    mask_float32<8>(const maskdata_float32<8>& d);
 
-    /// @{
-    /// Construct from the underlying vector type
-    mask_float32<8>(__m256 d);
-    mask_float32<8>(float32<8> d);
-    /// @}
+    mask_float32<8>(const native_type& d) : d_(d) {}
+    mask_float32<8>(const float32<8>& d) : d_(d) {}
 
-    mask_float32<8> eval() const { return *this; }
+    /// Access the underlying type
+    float32<8> unmask() const;
+
+    const mask_float32<8>& operator[](unsigned) const { return *this; }
+          mask_float32<8>& operator[](unsigned)       { return *this; }
 
-    const maskdata_float32<8>& mask() const { return mask_; }
+    mask_float32<8> eval() const { return *this; }
 
 private:
-    maskdata_float32<8> mask_;
+    native_type d_;
 };
 
 /// @} -- end ingroup
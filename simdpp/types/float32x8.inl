@@ -33,8 +33,7 @@
 #endif
 
 #include <simdpp/types/float32x8.h>
-#include <simdpp/core/bit_xor.h>
-#include <simdpp/null/mask.h>
+#include <simdpp/core/make_uint.h>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -43,21 +42,15 @@ namespace SIMDPP_ARCH_NAMESPACE {
 
 #if SIMDPP_USE_AVX
 
-inline float32x8 float32x8::zero()
-{
-    float32x8 r;
-    r = bit_xor(r, r);
-    return r;
-}
+inline float32<8> float32<8>::zero() { return make_uint(0); }
 
-inline maskdata_float32x8::operator float32x8() const
+inline float32<8> mask_float32<8>::unmask() const
 {
-    return d_;
+    return float32<8>(d_);
 }
 
 #endif // SIMDPP_USE_AVX
 
-
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
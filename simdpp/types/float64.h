@@ -38,6 +38,7 @@
 #include <simdpp/core/cast.h>
 #include <simdpp/types/float64x2.h>
 #include <simdpp/types/float64x4.h>
+#include <simdpp/types/float64x8.h>
 #include <simdpp/detail/construct_eval.h>
 
 namespace simdpp {
@@ -33,8 +33,7 @@
 #endif
 
 #include <simdpp/types/float64x4.h>
-#include <simdpp/core/bit_xor.h>
-#include <simdpp/null/mask.h>
+#include <simdpp/core/make_uint.h>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -43,21 +42,11 @@ namespace SIMDPP_ARCH_NAMESPACE {
 
 #if SIMDPP_USE_AVX
 
-inline float64x4 float64x4::zero()
-{
-    float64x4 r;
-    r = bit_xor(r, r);
-    return r;
-}
-
-inline float64x4::float64x4(uint64x4 d)
-{
-    *this = bit_cast<float64x4(d);
-}
+inline float64<4> float64<4>::zero() { return make_uint(0); }
 
-inline maskdata_float64x4::operator float64x4() const
+inline float64<4> mask_float64<4>::unmask() const
 {
-    return d_;
+    return float64<4>(d_);
 }
 
 #endif // SIMDPP_USE_AVX
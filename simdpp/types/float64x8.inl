@@ -1,5 +1,5 @@
 /*  libsimdpp
-    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    Copyright (C) 2012-2012  Povilas Kanapickas tir5c3@yahoo.co.uk
     All rights reserved.
 
     Redistribution and use in source and binary forms, with or without
@@ -25,8 +25,35 @@
     POSSIBILITY OF SUCH DAMAGE.
 */
 
-#define SIMDPP_ARCH_X86_SSSE3
-#include <simdpp/simd.h>
-#include "perf.h"
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT64X8_INL
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT64X8_INL
 
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
 
+#include <simdpp/types/float64x8.h>
+#include <simdpp/core/make_uint.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+#if SIMDPP_USE_AVX512F
+
+inline float64<8> float64<8>::zero() { return make_uint(0); }
+
+inline float64<8> mask_float64<8>::unmask() const
+{
+    return _mm512_castsi512_pd(_mm512_maskz_set1_epi64(d_, -1));
+}
+
+#endif // SIMDPP_USE_AVX512F
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
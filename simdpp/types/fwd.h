@@ -52,16 +52,20 @@ template<unsigned N, class E = void> class mask_float32;
 
 using float32x4 = float32<4>;
 using float32x8 = float32<8>;
+using float32x16 = float32<16>;
 using mask_float32x4 = mask_float32<4>;
 using mask_float32x8 = mask_float32<8>;
+using mask_float32x16 = mask_float32<16>;
 
 template<unsigned N, class E = void> class float64;
 template<unsigned N, class E = void> class mask_float64;
 
 using float64x2 = float64<2>;
 using float64x4 = float64<4>;
+using float64x8 = float64<8>;
 using mask_float64x2 = mask_float64<2>;
 using mask_float64x4 = mask_float64<4>;
+using mask_float64x8 = mask_float64<8>;
 
 template<unsigned N, class E = void> class int8;
 template<unsigned N, class E = void> class uint8;
@@ -91,10 +95,13 @@ template<unsigned N, class E = void> class mask_int32;
 
 using int32x4 = int32<4>;
 using int32x8 = int32<8>;
+using int32x16 = int32<16>;
 using uint32x4 = uint32<4>;
 using uint32x8 = uint32<8>;
+using uint32x16 = uint32<16>;
 using mask_int32x4 = mask_int32<4>;
 using mask_int32x8 = mask_int32<8>;
+using mask_int32x16 = mask_int32<16>;
 
 template<unsigned N, class E = void> class int64;
 template<unsigned N, class E = void> class uint64;
@@ -102,19 +109,30 @@ template<unsigned N, class E = void> class mask_int64;
 
 using int64x2 = int64<2>;
 using int64x4 = int64<4>;
+using int64x8 = int64<8>;
 using uint64x2 = uint64<2>;
 using uint64x4 = uint64<4>;
+using uint64x8 = uint64<8>;
 using mask_int64x2 = mask_int64<2>;
 using mask_int64x4 = mask_int64<4>;
+using mask_int64x8 = mask_int64<8>;
 
-#if SIMDPP_USE_AVX
+#if SIMDPP_USE_AVX512F
+#define SIMDPP_FAST_FLOAT32_SIZE 16
+#define SIMDPP_FAST_FLOAT64_SIZE 8
+#elif SIMDPP_USE_AVX
 #define SIMDPP_FAST_FLOAT32_SIZE 8
 #define SIMDPP_FAST_FLOAT64_SIZE 4
 #elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_NULL
 #define SIMDPP_FAST_FLOAT32_SIZE 4
 #define SIMDPP_FAST_FLOAT64_SIZE 2
 #endif
-#if SIMDPP_USE_AVX2
+#if SIMDPP_USE_AVX512F
+#define SIMDPP_FAST_INT8_SIZE 32
+#define SIMDPP_FAST_INT16_SIZE 16
+#define SIMDPP_FAST_INT32_SIZE 16
+#define SIMDPP_FAST_INT64_SIZE 8
+#elif SIMDPP_USE_AVX2
 #define SIMDPP_FAST_INT8_SIZE 32
 #define SIMDPP_FAST_INT16_SIZE 16
 #define SIMDPP_FAST_INT32_SIZE 8
@@ -49,99 +49,40 @@ namespace SIMDPP_ARCH_NAMESPACE {
 /// @ingroup simd_vec_int
 /// @{
 
-/** Generic class representing 16x 16-bit integer vector.
-    To be used where the signedness of the underlying element type is not important
+/** Class representing 16x 16-bit signed integer vector
 */
 template<>
-class uint16<16, void> {
+class int16<16, void> : public any_int16<16, int16<16,void>> {
 public:
+    static const unsigned type_tag = SIMDPP_TAG_INT;
+    using element_type = int16_t;
+    using base_vector_type = int16<16,void>;
+    using expr_type = void;
+    using native_type = __m256i;
 
-    using element_type = uint16_t;
-    using uint_element_type = uint16_t;
-    using int_vector_type = uint16x16;
-    using uint_vector_type = uint16x16;
-    using mask_vector_type = mask_int16x16;
-    using base_vector_type = uint16x16;
-
-    static constexpr unsigned length = 16;
-    static constexpr unsigned vec_length = 1;
-    static constexpr unsigned num_bits = 16;
-    static constexpr uint_element_type all_bits = 0xffff;
-
-    uint16<16>() = default;
-    uint16<16>(const uint16x16 &) = default;
-    uint16<16> &operator=(const uint16x16 &) = default;
-
-    /// @{
-    /// Construct from the underlying vector type
-    uint16<16>(__m256i d) : d_(d) {}
-    uint16<16>& operator=(__m256i d) { d_ = d; return *this; }
-    /// @}
-
-    template<class E> explicit uint16<16>(const  uint8<32,E>& d);
-    template<class E>          uint16<16>(const uint16<16,E>& d);
-    template<class E> explicit uint16<16>(const uint32<8,E>& d);
-    template<class E> explicit uint16<16>(const uint64<4,E>& d);
-    template<class E> uint16<16>& operator=(const  uint8<32,E>& d);
-    template<class E> uint16<16>& operator=(const uint16<16,E>& d);
-    template<class E> uint16<16>& operator=(const uint32<8,E>& d);
-    template<class E> uint16<16>& operator=(const uint64<4,E>& d);
+    int16<16>() = default;
+    int16<16>(const int16<16> &) = default;
+    int16<16> &operator=(const int16<16> &) = default;
 
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-    template<class E> uint16<16>(const expr_vec_construct<E>& e)
+    template<class E> int16<16>(const int16<16,E>& d) { *this = d.eval(); }
+    template<class E> int16<16>(const uint16<16,E>& d) { *this = d.eval(); }
+    template<class V> explicit int16<16>(const any_vec<32,V>& d)
     {
-        detail::construct_eval_wrapper(*this, e.expr());
+        *this = bit_cast<int16<16>>(d.vec().eval());
     }
-    template<class E> uint16<16>& operator=(const expr_vec_construct<E>& e)
+    template<class V> int16<16>& operator=(const any_vec<32,V>& d)
     {
-        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+        *this = bit_cast<int16<16>>(d.vec().eval()); return *this;
     }
-#endif
-
-    /// @{
-    /// Access base vectors
-    const uint16x16& operator[](unsigned) const   { return *this; }
-          uint16x16& operator[](unsigned)         { return *this; }
-    /// @}
-
-    uint16<16> eval() const { return *this; }
-
-    /// Creates a int16x16 vector with the contents set to zero
-    static uint16x16 zero();
-
-    /// Creates a int16x16 vector with the contents set to ones
-    static uint16x16 ones();
-
-private:
-    __m256i d_;
-};
-
-/** Class representing 16x 16-bit signed integer vector
-*/
-template<>
-class int16<16, void> : public uint16x16 {
-public:
-    using base_vector_type = int16x16;
-    using element_type = int16_t;
-
-    int16<16>() = default;
-    int16<16>(const int16x16 &) = default;
-    int16<16> &operator=(const int16x16 &) = default;
 
     /// @{
     /// Construct from the underlying vector type
-    int16<16>(__m256i d) : uint16x16(d) {}
-    int16<16>& operator=(__m256i d) { uint16x16::operator=(d); return *this; }
+    int16<16>(const native_type& d) : d_(d) {}
+    int16<16>& operator=(const native_type& d) { d_ = d; return *this; }
     /// @}
 
-    template<class E> explicit int16<16>(const  uint8<32,E>& d);
-    template<class E>          int16<16>(const uint16<16,E>& d);
-    template<class E> explicit int16<16>(const uint32<8,E>& d);
-    template<class E> explicit int16<16>(const uint64<4,E>& d);
-    template<class E> int16<16>& operator=(const  uint8<32,E>& d);
-    template<class E> int16<16>& operator=(const uint16<16,E>& d);
-    template<class E> int16<16>& operator=(const uint32<8,E>& d);
-    template<class E> int16<16>& operator=(const uint64<4,E>& d);
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     template<class E> int16<16>(const expr_vec_construct<E>& e)
@@ -156,38 +97,53 @@ public:
 
     /// @{
     /// Access base vectors
-    const int16x16& operator[](unsigned) const   { return *this; }
-          int16x16& operator[](unsigned)         { return *this; }
+    const int16<16>& operator[](unsigned) const { return *this; }
+          int16<16>& operator[](unsigned)       { return *this; }
     /// @}
 
     int16<16> eval() const { return *this; }
+
+    static int16<16> zero();
+    static int16<16> ones();
+
+private:
+    native_type d_;
 };
 
-/** Class representing 8x 16-bit unsigned integer vector
+/** Class representing 16x 16-bit unsigned integer vector
 */
 template<>
-class uint16<16, void> : public uint16x16 {
+class uint16<16, void> : public any_int16<16, uint16<16,void>> {
 public:
-    using base_vector_type = uint16x16;
+    static const unsigned type_tag = SIMDPP_TAG_UINT;
+    using element_type = uint16_t;
+    using base_vector_type = uint16<16,void>;
+    using expr_type = void;
+    using native_type = __m256i;
 
     uint16<16>() = default;
-    uint16<16>(const uint16x16 &) = default;
-    uint16<16> &operator=(const uint16x16 &) = default;
+    uint16<16>(const uint16<16> &) = default;
+    uint16<16> &operator=(const uint16<16> &) = default;
+
+    template<class E> uint16<16>(const uint16<16,E>& d) { *this = d.eval(); }
+    template<class E> uint16<16>(const int16<16,E>& d) { *this = d.eval(); }
+    template<class V> explicit uint16<16>(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<uint16<16>>(d.vec().eval());
+    }
+    template<class V> uint16<16>& operator=(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<uint16<16>>(d.vec().eval()); return *this;
+    }
 
     /// @{
     /// Construct from the underlying vector type
-    uint16<16>(__m256i d) : uint16x16(d) {}
-    uint16<16>& operator=(__m256i d) { uint16x16::operator=(d); return *this; }
+    uint16<16>(const native_type& d) : d_(d) {}
+    uint16<16>& operator=(const native_type& d) { d_ = d; return *this; }
     /// @}
 
-    template<class E> explicit uint16<16>(const  uint8<32,E>& d);
-    template<class E>          uint16<16>(const uint16<16,E>& d);
-    template<class E> explicit uint16<16>(const uint32<8,E>& d);
-    template<class E> explicit uint16<16>(const uint64<4,E>& d);
-    template<class E> uint16<16>& operator=(const  uint8<32,E>& d);
-    template<class E> uint16<16>& operator=(const uint16<16,E>& d);
-    template<class E> uint16<16>& operator=(const uint32<8,E>& d);
-    template<class E> uint16<16>& operator=(const uint64<4,E>& d);
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     template<class E> uint16<16>(const expr_vec_construct<E>& e)
@@ -202,63 +158,50 @@ public:
 
     /// @{
     /// Access base vectors
-    const uint16x16& operator[](unsigned) const   { return *this; }
-          uint16x16& operator[](unsigned)         { return *this; }
+    const uint16<16>& operator[](unsigned) const { return *this; }
+          uint16<16>& operator[](unsigned)       { return *this; }
     /// @}
 
     uint16<16> eval() const { return *this; }
-};
-
-/// Class representing possibly optimized mask data for 16x 16-bit integer vector
-template<>
-class maskdata_int16<16> {
-public:
-    using base_vector_type = maskdata_int16<16>;
-    static constexpr unsigned length = 16;
-    static constexpr unsigned vec_length = 1;
-
-    maskdata_int16<16>() = default;
-    maskdata_int16<16>(const maskdata_int16<16> &) = default;
-    maskdata_int16<16> &operator=(const maskdata_int16<16> &) = default;
 
-    maskdata_int16<16>(int16<16> d) : d_(d) {}
-
-    /// Convert to bitmask
-    operator uint16<16>() const;
-
-    /// @{
-    /// Access base vectors
-    const maskdata_int16<16>& operator[](unsigned) const { return *this; }
-          maskdata_int16<16>& operator[](unsigned)       { return *this; }
-    /// @}
+    static uint16<16> zero();
+    static uint16<16> ones();
 
 private:
-    uint16<16> d_;
+    native_type d_;
 };
 
-
-/// Class representing a mask for 16x 16-bit integer vector
+/// Class representing possibly optimized mask data for 16x 16-bit integer
+/// vector
 template<>
-class mask_int16<16, void> : public uint16<16, void> {
+class mask_int16<16, void> : public any_int16<16, mask_int16<16,void>> {
 public:
+    static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
+    using base_vector_type = mask_int16<16,void>;
+    using expr_type = void;
+    using native_type = __m256i;
+
     mask_int16<16>() = default;
     mask_int16<16>(const mask_int16<16> &) = default;
     mask_int16<16> &operator=(const mask_int16<16> &) = default;
-    mask_int16<16>(const maskdata_int16<16>& d);
 
-    /// @{
-    /// Construct from the underlying vector type
-    mask_int16<16>(__m256i d);
-    mask_int16<16>(uint16<16> d);
-    /// @}
+    mask_int16<16>(const native_type& d) : d_(d) {}
 
-    mask_int16<16> eval() const { return *this; }
+    mask_int16<16>(const uint16<16>& d) : d_(d) {}
+
+    /// Access the underlying type
+    uint16<16> unmask() const;
 
-    const maskdata_int16<16>& mask() const { return mask_; }
+
+    const mask_int16<16>& operator[](unsigned) const { return *this; }
+          mask_int16<16>& operator[](unsigned)       { return *this; }
+
+    mask_int16<16> eval() const { return *this; }
 
 private:
-    maskdata_int16<16> mask_;
+    native_type d_;
 };
+
 /// @} -- end ingroup
 
 #endif // SIMDPP_USE_AVX2 || DOXYGEN_SHOULD_READ_THIS
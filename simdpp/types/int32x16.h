@@ -0,0 +1,218 @@
+/*  libsimdpp
+    Copyright (C) 2011  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_INT32X16_H
+#define LIBSIMDPP_SIMDPP_TYPES_INT32X16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/any.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/construct_eval.h>
+#include <cstdint>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+#if SIMDPP_USE_AVX512F || DOXYGEN_SHOULD_READ_THIS
+
+/// @ingroup simd_vec_int
+/// @{
+
+/** Class representing 16x 32-bit signed integer vector
+*/
+template<>
+class int32<16, void> : public any_int32<16, int32<16,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_INT;
+    using element_type = int32_t;
+    using base_vector_type = int32<16,void>;
+    using expr_type = void;
+    using native_type = __m512i;
+
+    int32<16>() = default;
+    int32<16>(const int32<16> &) = default;
+    int32<16> &operator=(const int32<16> &) = default;
+
+    template<class E> int32<16>(const int32<16,E>& d) { *this = d.eval(); }
+    template<class E> int32<16>(const uint32<16,E>& d) { *this = d.eval(); }
+    template<class V> explicit int32<16>(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<int32<16>>(d.vec().eval());
+    }
+    template<class V> int32<16>& operator=(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<int32<16>>(d.vec().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    int32<16>(const native_type& d) : d_(d) {}
+    int32<16>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    template<class E> int32<16>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> int32<16>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const int32<16>& operator[](unsigned) const { return *this; }
+          int32<16>& operator[](unsigned)       { return *this; }
+    /// @}
+
+    int32<16> eval() const { return *this; }
+
+    static int32<16> zero();
+    static int32<16> ones();
+
+private:
+    native_type d_;
+};
+
+/** Class representing 16x 32-bit unsigned integer vector
+*/
+template<>
+class uint32<16, void> : public any_int32<16, uint32<16,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_UINT;
+    using element_type = uint32_t;
+    using base_vector_type = uint32<16,void>;
+    using expr_type = void;
+    using native_type = __m512i;
+
+    uint32<16>() = default;
+    uint32<16>(const uint32<16> &) = default;
+    uint32<16> &operator=(const uint32<16> &) = default;
+
+    template<class E> uint32<16>(const uint32<16,E>& d) { *this = d.eval(); }
+    template<class E> uint32<16>(const int32<16,E>& d) { *this = d.eval(); }
+    template<class V> explicit uint32<16>(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<uint32<16>>(d.vec().eval());
+    }
+    template<class V> uint32<16>& operator=(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<uint32<16>>(d.vec().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    uint32<16>(const native_type& d) : d_(d) {}
+    uint32<16>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    template<class E> uint32<16>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> uint32<16>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const uint32<16>& operator[](unsigned) const { return *this; }
+          uint32<16>& operator[](unsigned)       { return *this; }
+    /// @}
+
+    uint32<16> eval() const { return *this; }
+
+    static uint32<16> zero();
+    static uint32<16> ones();
+
+private:
+    native_type d_;
+};
+
+/// Class representing possibly optimized mask data for 16x 32-bit integer
+/// vector. The mask is stored in an AVX-512 opmask register, one bit per
+/// element.
+template<>
+class mask_int32<16, void> : public any_int32<16, mask_int32<16,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
+    using base_vector_type = mask_int32<16,void>;
+    using expr_type = void;
+    using native_type = __mmask16;
+
+    mask_int32<16>() = default;
+    mask_int32<16>(const mask_int32<16> &) = default;
+    mask_int32<16> &operator=(const mask_int32<16> &) = default;
+
+    mask_int32<16>(const native_type& d) : d_(d) {}
+
+    /// Converts a vector with each element either all-ones or all-zeros
+    mask_int32<16>(const uint32<16>& d) : d_(_mm512_test_epi32_mask(d, d)) {}
+
+    /// Access the opmask register
+    operator native_type() const { return d_; }
+
+    /// Access the underlying type
+    uint32<16> unmask() const;
+
+    const mask_int32<16>& operator[](unsigned) const { return *this; }
+          mask_int32<16>& operator[](unsigned)       { return *this; }
+
+    mask_int32<16> eval() const { return *this; }
+
+private:
+    native_type d_;
+};
+
+/// @} -- end ingroup
+
+#endif // SIMDPP_USE_AVX512F || DOXYGEN_SHOULD_READ_THIS
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -1,5 +1,5 @@
 /*  libsimdpp
-    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    Copyright (C) 2011  Povilas Kanapickas tir5c3@yahoo.co.uk
     All rights reserved.
 
     Redistribution and use in source and binary forms, with or without
@@ -25,6 +25,38 @@
     POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <simdpp/simd.h>
-#include "perf.h"
+#ifndef LIBSIMDPP_SIMDPP_TYPES_INT32X16_INL
+#define LIBSIMDPP_SIMDPP_TYPES_INT32X16_INL
 
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types/int32x16.h>
+#include <simdpp/core/make_uint.h>
+
+namespace simdpp {
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+#if SIMDPP_USE_AVX512F
+
+inline int32<16> int32<16>::zero() { return make_uint(0); }
+inline uint32<16> uint32<16>::zero() { return make_uint(0); }
+inline int32<16> int32<16>::ones() { return make_uint(0xffffffff); }
+inline uint32<16> uint32<16>::ones() { return make_uint(0xffffffff); }
+
+inline uint32<16> mask_int32<16>::unmask() const
+{
+    return _mm512_maskz_set1_epi32(d_, -1);
+}
+
+#endif // SIMDPP_USE_AVX512F
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
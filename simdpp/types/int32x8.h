@@ -35,6 +35,7 @@
 #include <simdpp/setup_arch.h>
 #include <simdpp/types/fwd.h>
 #include <simdpp/types/any.h>
+#include <simdpp/core/cast.h>
 #include <simdpp/detail/construct_eval.h>
 #include <cstdint>
 
@@ -48,139 +49,40 @@ namespace SIMDPP_ARCH_NAMESPACE {
 /// @ingroup simd_vec_int
 /// @{
 
-/** Generic class representing 4x 32-bit integer vector.
-    To be used where the signedness of the underlying element type is not important
+/** Class representing 8x 32-bit signed integer vector
 */
 template<>
-class uint32<8, void> {
+class int32<8, void> : public any_int32<8, int32<8,void>> {
 public:
+    static const unsigned type_tag = SIMDPP_TAG_INT;
+    using element_type = int32_t;
+    using base_vector_type = int32<8,void>;
+    using expr_type = void;
+    using native_type = __m256i;
 
-    using element_type = uint32_t;
-    using uint_element_type = uint32_t;
-    using int_vector_type = uint32x8;
-    using uint_vector_type = uint32x8;
-    using half_vector_type = uint32x4;
-    using mask_vector_type = mask_int32x8;
-    using base_vector_type = uint32x8;
-
-    static constexpr unsigned vec_length = 1;
-    static constexpr unsigned length = 8;
-    static constexpr unsigned num_bits = 32;
-    static constexpr uint_element_type all_bits = 0xffffffff;
-
-    uint32<8>() = default;
-    uint32<8>(const uint32x8&) = default;
-    uint32<8>& operator=(const uint32x8&) = default;
-
-    /// @{
-    /// Construct from the underlying vector type
-    uint32<8>(__m256i d) : d_(d) {}
-    uint32<8>& operator=(__m256i d) { d_ = d; return *this; }
-    /// @}
-
-    /// @{
-    /// Construct from compatible integer type
-    uint32<8>(const uint8x32& d);
-    uint32<8>(const uint16x16& d);
-    uint32<8>(const uint64x4& d);
-    uint32<8>& operator=(const uint8x32& d);
-    uint32<8>& operator=(const uint16x16& d);
-    uint32<8>& operator=(const uint64x4& d);
-    /// @}
-
-    /// @{
-    /// Construct from compatible float32x8 integer vector type
-    explicit uint32<8>(const float32x8& d);
-    uint32<8>& operator=(const float32x8& d) { operator=(uint32x8(d)); return *this; }
-    /// @}
+    int32<8>() = default;
+    int32<8>(const int32<8> &) = default;
+    int32<8> &operator=(const int32<8> &) = default;
 
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-    template<class E> uint32<8>(const expr_vec_construct<E>& e)
+    template<class E> int32<8>(const int32<8,E>& d) { *this = d.eval(); }
+    template<class E> int32<8>(const uint32<8,E>& d) { *this = d.eval(); }
+    template<class V> explicit int32<8>(const any_vec<32,V>& d)
     {
-        detail::construct_eval_wrapper(*this, e.expr());
+        *this = bit_cast<int32<8>>(d.vec().eval());
     }
-    template<class E> uint32<8>& operator=(const expr_vec_construct<E>& e)
+    template<class V> int32<8>& operator=(const any_vec<32,V>& d)
     {
-        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+        *this = bit_cast<int32<8>>(d.vec().eval()); return *this;
     }
-#endif
-
-    /// @{
-    /// Access base vectors
-    const uint32x8& operator[](unsigned) const   { return *this; }
-          uint32x8& operator[](unsigned)         { return *this; }
-    /// @}
-
-    uint32<8> eval() const { return *this; }
-
-    /// Creates a int32x8 vector with the contents set to zero
-    static uint32x8 zero();
-
-    /// Creates a int32x8 vector with the contents set to ones
-    static uint32x8 ones();
-
-protected:
-
-#if SIMDPP_USE_AVX2
-#else
-    // For internal use only
-    const uint32x4& u32(unsigned i) const    { return du_[i]; }
-          uint32x4& u32(unsigned i)          { return du_[i]; }
-    const int32x4& i32(unsigned i) const    { return d_[i]; }
-          int32x4& i32(unsigned i)          { return d_[i]; }
-#endif
-
-private:
-
-#if SIMDPP_USE_AVX2
-    __m256i d_;
-#else
-    union {
-        uint32x4 du_[2];
-        int32x4 d_[2];
-    };
-#endif
-};
-
-/** Class representing 4x 32-bit signed integer vector
-*/
-template<>
-class int32<8, void> : public uint32x8 {
-public:
-
-    using element_type = int32_t;
-    using half_vector_type = int32x4;
-    using base_vector_type = int32x8;
-
-    int32<8>() = default;
-    int32<8>(const int32x8&) = default;
-    int32<8>& operator=(const int32x8&) = default;
 
     /// @{
     /// Construct from the underlying vector type
-#if SIMDPP_USE_AVX2
-    int32<8>(__m256i d) : uint32x8(d) {}
-    int32<8>& operator=(__m256i d) { uint32x8::operator=(d); return *this; }
-#endif
+    int32<8>(const native_type& d) : d_(d) {}
+    int32<8>& operator=(const native_type& d) { d_ = d; return *this; }
     /// @}
 
-    /// @{
-    /// Construct from compatible integer type
-    int32<8>(const uint8x32& d);
-    int32<8>(const uint16x16& d);
-    int32<8>(const uint32x8& d);
-    int32<8>(const uint64x4& d);
-    int32<8>& operator=(const uint8x32& d);
-    int32<8>& operator=(const uint16x16& d);
-    int32<8>& operator=(const uint32x8& d);
-    int32<8>& operator=(const uint64x4& d);
-    /// @}
-
-    /// @{
-    /// Construct from compatible float32x8 integer vector type
-    explicit int32<8>(const float32x8& d) : uint32x8(d) {}
-    int32<8>& operator=(const float32x8& d) { uint32x8::operator=(d); return *this; }
-    /// @}
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     template<class E> int32<8>(const expr_vec_construct<E>& e)
@@ -195,49 +97,53 @@ public:
 
     /// @{
     /// Access base vectors
-    const int32x8& operator[](unsigned) const   { return *this; }
-          int32x8& operator[](unsigned)         { return *this; }
+    const int32<8>& operator[](unsigned) const { return *this; }
+          int32<8>& operator[](unsigned)       { return *this; }
     /// @}
 
     int32<8> eval() const { return *this; }
+
+    static int32<8> zero();
+    static int32<8> ones();
+
+private:
+    native_type d_;
 };
 
-/** Class representing 4x 32-bit unsigned integer vector
+/** Class representing 8x 32-bit unsigned integer vector
 */
 template<>
-class uint32<8, void> : public uint32x8 {
+class uint32<8, void> : public any_int32<8, uint32<8,void>> {
 public:
-
-    using half_vector_type = uint32x4;
-    using base_vector_type = uint32x8;
+    static const unsigned type_tag = SIMDPP_TAG_UINT;
+    using element_type = uint32_t;
+    using base_vector_type = uint32<8,void>;
+    using expr_type = void;
+    using native_type = __m256i;
 
     uint32<8>() = default;
-    uint32<8>(const uint32x8&) = default;
-    uint32<8>& operator=(const uint32x8&) = default;
+    uint32<8>(const uint32<8> &) = default;
+    uint32<8> &operator=(const uint32<8> &) = default;
+
+    template<class E> uint32<8>(const uint32<8,E>& d) { *this = d.eval(); }
+    template<class E> uint32<8>(const int32<8,E>& d) { *this = d.eval(); }
+    template<class V> explicit uint32<8>(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<uint32<8>>(d.vec().eval());
+    }
+    template<class V> uint32<8>& operator=(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<uint32<8>>(d.vec().eval()); return *this;
+    }
 
     /// @{
     /// Construct from the underlying vector type
-    uint32<8>(__m256i d) : uint32x8(d) {}
-    uint32<8>& operator=(__m256i d) { uint32x8::operator=(d); return *this; }
+    uint32<8>(const native_type& d) : d_(d) {}
+    uint32<8>& operator=(const native_type& d) { d_ = d; return *this; }
     /// @}
 
-    /// @{
-    /// Construct from compatible integer type
-    uint32<8>(const uint8x32& d);
-    uint32<8>(const uint16x16& d);
-    uint32<8>(const uint32x8& d);
-    uint32<8>(const uint64x4& d);
-    uint32<8>& operator=(const uint8x32& d);
-    uint32<8>& operator=(const uint16x16& d);
-    uint32<8>& operator=(const uint32x8& d);
-    uint32<8>& operator=(const uint64x4& d);
-    /// @}
-
-    /// @{
-    /// Construct from compatible float32x8 integer vector type
-    explicit uint32<8>(const float32x8& d) : uint32x8(d) {}
-    uint32<8>& operator=(const float32x8& d) { uint32x8::operator=(d); return *this; }
-    /// @}
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     template<class E> uint32<8>(const expr_vec_construct<E>& e)
@@ -252,62 +158,48 @@ public:
 
     /// @{
     /// Access base vectors
-    const uint32x8& operator[](unsigned) const   { return *this; }
-          uint32x8& operator[](unsigned)         { return *this; }
+    const uint32<8>& operator[](unsigned) const { return *this; }
+          uint32<8>& operator[](unsigned)       { return *this; }
     /// @}
 
     uint32<8> eval() const { return *this; }
-};
-
-/// Class representing possibly optimized mask data for 8x 32-bit integer vector
-template<>
-class maskdata_int32<8> {
-public:
-    using base_vector_type = maskdata_int32<8>;
-    static constexpr unsigned length = 8;
-    static constexpr unsigned vec_length = 1;
-
-    maskdata_int32<8>() = default;
-    maskdata_int32<8>(const maskdata_int32<8> &) = default;
-    maskdata_int32<8> &operator=(const maskdata_int32<8> &) = default;
 
-    maskdata_int32<8>(int32<8> d) : d_(d) {}
-
-    /// Convert to bitmask
-    operator uint32<8>() const;
-
-    /// @{
-    /// Access base vectors
-    const maskdata_int32<8>& operator[](unsigned) const { return *this; }
-          maskdata_int32<8>& operator[](unsigned)       { return *this; }
-    /// @}
+    static uint32<8> zero();
+    static uint32<8> ones();
 
 private:
-    uint32<8> d_;
+    native_type d_;
 };
 
-
-/// Class representing a mask for 4x 32-bit integer vector
+/// Class representing possibly optimized mask data for 8x 32-bit integer
+/// vector
 template<>
-class mask_int32<8, void> : public uint32<8, void> {
+class mask_int32<8, void> : public any_int32<8, mask_int32<8,void>> {
 public:
+    static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
+    using base_vector_type = mask_int32<8,void>;
+    using expr_type = void;
+    using native_type = __m256i;
+
     mask_int32<8>() = default;
     mask_int32<8>(const mask_int32<8> &) = default;
     mask_int32<8> &operator=(const mask_int32<8> &) = default;
-    mask_int32<8>(const maskdata_int32<8>& d);
 
-    /// @{
-    /// Construct from the underlying vector type
-    mask_int32<8>(__m256i d);
-    mask_int32<8>(uint32<8> d);
-    /// @}
+    mask_int32<8>(const native_type& d) : d_(d) {}
+
+    mask_int32<8>(const uint32<8>& d) : d_(d) {}
+
+    /// Access the underlying type
+    uint32<8> unmask() const;
 
-    mask_int32<8> eval() const { return *this; }
 
-    const maskdata_int32<8>& mask() const { return mask_; }
+    const mask_int32<8>& operator[](unsigned) const { return *this; }
+          mask_int32<8>& operator[](unsigned)       { return *this; }
+
+    mask_int32<8> eval() const { return *this; }
 
 private:
-    maskdata_int32<8> mask_;
+    native_type d_;
 };
 
 /// @} -- end ingroup
@@ -33,7 +33,7 @@
 #endif
 
 #include <simdpp/types/int64x4.h>
-#include <simdpp/types/float64x4.h>
+#include <simdpp/core/make_uint.h>
 
 namespace simdpp {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -42,19 +42,14 @@ namespace SIMDPP_ARCH_NAMESPACE {
 
 #if SIMDPP_USE_AVX2
 
-inline uint64x4 uint64x4::zero()
-{
-    return make_uint(0);
-}
-
-inline uint64x4 uint64x4::ones()
-{
-    return make_uint(0xffffffffffffffff);
-}
+inline int64<4> int64<4>::zero() { return make_uint(0); }
+inline uint64<4> uint64<4>::zero() { return make_uint(0); }
+inline int64<4> int64<4>::ones() { return make_uint(0xffffffffffffffff); }
+inline uint64<4> uint64<4>::ones() { return make_uint(0xffffffffffffffff); }
 
-inline mask_int64x4::operator uint64x4() const
+inline uint64<4> mask_int64<4>::unmask() const
 {
-    return d_;
+    return uint64<4>(d_);
 }
 
 #endif // SIMDPP_USE_AVX2
@@ -68,6 +68,12 @@ struct Vectors {
         simdpp::int64x4 di64[L/32];
         simdpp::float32x8 df32[L/32];
         simdpp::float64x4 df64[L/32];
+        simdpp::uint32x16 qu32[L/64];
+        simdpp::uint64x8 qu64[L/64];
+        simdpp::int32x16 qi32[L/64];
+        simdpp::int64x8 qi64[L/64];
+        simdpp::float32x16 qf32[L/64];
+        simdpp::float64x8 qf64[L/64];
     };
 
     Vectors() { reset(); }
@@ -26,6 +26,9 @@
 */
 
 #include "tests/dispatcher.h"
+#include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
 #include <algorithm>
 #include <iostream>
 #include <cstdlib>
@@ -37,6 +40,25 @@ simdpp::Arch get_supported_arch()
     return g_supported_arch;
 }
 
+template<class T>
+simdpp::Arch test_dispatcher_tmpl(T& out, const T& a, T b)
+{
+    return simdpp::dispatch_call<test_dispatcher_tmpl_tag,
+                                 simdpp::Arch(T&, const T&, T)>(
+                get_supported_arch, out, a, b);
+}
+
+int test_dispatcher_many(int a1, int a2, int a3, int a4, int a5, int a6,
+                         int a7, int a8, int a9, int a10, int a11,
+                         const TestDispatcherBig& big)
+{
+    return simdpp::dispatch_call<test_dispatcher_many_tag,
+                                 int(int, int, int, int, int, int, int, int,
+                                     int, int, int, const TestDispatcherBig&)>(
+                get_supported_arch, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10,
+                a11, big);
+}
+
 /*  We test the dispatcher by compiling a
 */
 int main(int argc, char** argv)
@@ -67,6 +89,14 @@ int main(int argc, char** argv)
     } else if (arch_name == "X86_AVX2") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                 Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2;
+    } else if (arch_name == "X86_AVX2_FMA3") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+                Arch::X86_FMA3;
+    } else if (arch_name == "X86_AVX512F") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+                Arch::X86_FMA3 | Arch::X86_AVX512F;
     } else if (arch_name == "ARM_NEON") {
         g_supported_arch = Arch::ARM_NEON;
     } else if (arch_name == "ARM_NEON_FLT_SP") {
@@ -76,11 +106,23 @@ int main(int argc, char** argv)
         return EXIT_FAILURE;
     }
 
+    /*  The version compiled for the supported architecture is expected to be
+        selected. The exception is AVX2+FMA3: there are versions for SSE3+FMA3
+        and AVX+FMA3, but not for AVX2+FMA3. The extensions must not make
+        these outrank the AVX2 version.
+    */
+    Arch expected_arch = g_supported_arch;
+    if (arch_name == "X86_AVX2_FMA3") {
+        expected_arch = g_supported_arch & ~Arch::X86_FMA3;
+    }
+
     Arch selected = test_dispatcher();
-    if (selected != g_supported_arch) {
+    if (selected != expected_arch) {
         std::cerr << "Wrong architecture selected: \n"
                   << "  Supported: "
                   << std::hex << static_cast<unsigned>(g_supported_arch)
+                  << "\n  Expected: "
+                  << std::hex << static_cast<unsigned>(expected_arch)
                   << "\n  Selected: "
                   << std::hex << static_cast<unsigned>(selected) << "\n";
         return EXIT_FAILURE;
@@ -99,6 +141,118 @@ int main(int argc, char** argv)
     if (test_dispatcher4(1, 2, 3, 4) != 1+2+3+4) {
         err |= 8;
     }
+
+    int ires;
+    if (test_dispatcher_tmpl<int>(ires, 1, 2) != expected_arch || ires != 3) {
+        err |= 16;
+    }
+    float fres;
+    if (test_dispatcher_tmpl<float>(fres, 1.0f, 2.0f) != expected_arch ||
+        fres != 3.0f) {
+        err |= 32;
+    }
+    TestDispatcherBig big;
+    for (int& v : big.v) {
+        v = 1;
+    }
+    if (test_dispatcher_many(1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, big) != 11+64) {
+        err |= 64;
+    }
+
+#if !defined(_WIN32)
+    // The environment variables are used while no override has been set
+    setenv("SIMDPP_FORCE_ARCH", "NONE_NULL", 1);
+    simdpp::reset_dispatchers();
+    if (test_dispatcher() != Arch::NONE_NULL) {
+        err |= 16384;
+    }
+    // Lists with unknown names are ignored
+    setenv("SIMDPP_FORCE_ARCH", "NONE_NULL,NO_SUCH_ARCH", 1);
+    simdpp::reset_dispatchers();
+    if (test_dispatcher() != expected_arch) {
+        err |= 32768;
+    }
+    unsetenv("SIMDPP_FORCE_ARCH");
+    setenv("SIMDPP_CAP_ARCH", "NONE_NULL", 1);
+    simdpp::reset_dispatchers();
+    if (test_dispatcher() != Arch::NONE_NULL) {
+        err |= 65536;
+    }
+#if defined(__i386__) || defined(__amd64__)
+    setenv("SIMDPP_CAP_ARCH", "X86_SSE2, X86_FMA3", 1);
+    if (simdpp::get_arch_override(Arch::X86_SSE2 | Arch::X86_SSE3 |
+                                  Arch::X86_AVX) !=
+            (Arch::X86_SSE2 | Arch::X86_SSE3)) {
+        err |= 131072;
+    }
+    // SIMDPP_FORCE_ARCH takes precedence
+    setenv("SIMDPP_FORCE_ARCH", "X86_SSE2,X86_POPCNT", 1);
+    if (simdpp::get_arch_override(Arch::X86_SSE3) !=
+            (Arch::X86_SSE2 | Arch::X86_POPCNT)) {
+        err |= 262144;
+    }
+    unsetenv("SIMDPP_FORCE_ARCH");
+#endif
+    unsetenv("SIMDPP_CAP_ARCH");
+#endif
+
+    // Override the architecture and check that the selection is redone
+    simdpp::set_arch_override(simdpp::ArchOverride::PIN, Arch::NONE_NULL);
+    simdpp::reset_dispatchers();
+    if (test_dispatcher() != Arch::NONE_NULL) {
+        err |= 128;
+    }
+    simdpp::set_arch_override(simdpp::ArchOverride::NONE);
+    simdpp::reset_dispatchers();
+    if (test_dispatcher() != expected_arch) {
+        err |= 256;
+    }
+
+    Arch parsed;
+    if (!simdpp::parse_arch_list("NONE_NULL", parsed) ||
+        parsed != Arch::NONE_NULL) {
+        err |= 512;
+    }
+    if (simdpp::parse_arch_list("NO_SUCH_ARCH", parsed)) {
+        err |= 1024;
+    }
+
+    // Check that all dispatchers are resolved eagerly and are listed
+    simdpp::reset_dispatchers();
+    simdpp::resolve_all_dispatchers(get_supported_arch);
+    bool found = false;
+    for (const auto& info : simdpp::get_dispatcher_info()) {
+        if (!info.resolved || info.selected != expected_arch) {
+            err |= 2048;
+        }
+        if (std::string(info.name) == "test_dispatcher") {
+            found = true;
+        }
+    }
+    if (!found) {
+        err |= 4096;
+    }
+
+#if defined(__linux__) && (defined(__i386__) || defined(__amd64__))
+    // CPUID and the kernel must agree on the features that both report
+    Arch common = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+            Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
+            Arch::X86_FMA3 | Arch::X86_FMA4 | Arch::X86_XOP |
+            Arch::X86_AVX512F | Arch::X86_SSE4_2 | Arch::X86_POPCNT |
+            Arch::X86_PCLMULQDQ | Arch::X86_F16C | Arch::X86_LZCNT |
+            Arch::X86_BMI1 | Arch::X86_BMI2;
+    Arch cpuid_arch = simdpp::get_arch_raw_cpuid() & common;
+    Arch cpuinfo_arch = simdpp::get_arch_linux_cpuinfo() & common;
+    if (cpuid_arch != cpuinfo_arch) {
+        std::cerr << "CPUID and /proc/cpuinfo disagree: \n"
+                  << "  CPUID: "
+                  << std::hex << static_cast<unsigned>(cpuid_arch)
+                  << "\n  /proc/cpuinfo: "
+                  << std::hex << static_cast<unsigned>(cpuinfo_arch) << "\n";
+        err |= 8192;
+    }
+#endif
+
     if (err != 0) {
         std::cout << "ERR: " << err << "\n";
         return EXIT_FAILURE;
@@ -0,0 +1,73 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "tests/dispatcher.h"
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <iostream>
+#include <cstdlib>
+
+/*  In IFUNC mode this is called by the dynamic loader, before main() runs, thus
+    the supported architecture can't be supplied on the command line.
+*/
+simdpp::Arch get_supported_arch()
+{
+    return simdpp::get_arch_raw_cpuid();
+}
+
+int main()
+{
+    using simdpp::Arch;
+
+    Arch supported = simdpp::get_arch_raw_cpuid();
+    Arch selected = test_dispatcher();
+    if ((selected & ~supported) != Arch::NONE_NULL) {
+        std::cerr << "Unsupported architecture selected: \n"
+                  << "  Supported: "
+                  << std::hex << static_cast<unsigned>(supported)
+                  << "\n  Selected: "
+                  << std::hex << static_cast<unsigned>(selected) << "\n";
+        return EXIT_FAILURE;
+    }
+
+    unsigned err = 0;
+    if (test_dispatcher1(1) != 1) {
+        err |= 1;
+    }
+    if (test_dispatcher2(1, 2) != 1+2) {
+        err |= 2;
+    }
+    if (test_dispatcher3(1, 2, 3) != 1+2+3) {
+        err |= 4;
+    }
+    if (test_dispatcher4(1, 2, 3, 4) != 1+2+3+4) {
+        err |= 8;
+    }
+    if (err != 0) {
+        std::cout << "ERR: " << err << "\n";
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,158 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests the operation counters of the SIMDPP_PROFILE_OPS mode. This file is
+    compiled for NONE_NULL, profile_ops_x86.cc for X86_SSE2 if available.
+*/
+
+#include <simdpp/simd.h>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#ifndef SIMDPP_PROFILE_OPS
+#error "SIMDPP_PROFILE_OPS must be defined"
+#endif
+
+#if SIMDPP_TEST_PROFILE_X86
+bool test_profile_ops_x86(std::ostream& err);
+#endif
+
+namespace {
+
+const simdpp::OpProfileEntry* find_entry(
+        const std::vector<simdpp::OpProfileEntry>& entries,
+        const char* op, const char* type)
+{
+    for (const simdpp::OpProfileEntry& e : entries) {
+        if (e.op == op && e.type == type && e.arch == SIMDPP_ARCH_NAME) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+bool check_calls(const std::vector<simdpp::OpProfileEntry>& entries,
+                 const char* op, const char* type, std::uint64_t calls)
+{
+    const simdpp::OpProfileEntry* e = find_entry(entries, op, type);
+    std::uint64_t actual = e ? e->calls : 0;
+    if (actual != calls) {
+        std::cerr << op << '/' << type << ": " << actual
+                  << " calls, expected " << calls << '\n';
+        return false;
+    }
+    return true;
+}
+
+void add_vectors(std::uint32_t* r, const std::uint32_t* a,
+                 const std::uint32_t* b, unsigned n)
+{
+    using namespace simdpp;
+    for (unsigned i = 0; i < n; i += 4) {
+        uint32<4> va = load(a + i);
+        uint32<4> vb = load(b + i);
+        // the ops used internally by the evaluation of the nested expression
+        // must not be counted
+        store(r + i, add(bit_and(va, vb), shift_l<1>(vb)));
+    }
+}
+
+} // namespace
+
+int main()
+{
+    using namespace simdpp;
+
+    alignas(16) std::uint32_t a[16], b[16], r[16];
+    for (unsigned i = 0; i < 16; ++i) {
+        a[i] = i;
+        b[i] = 3*i + 1;
+    }
+
+    bool ok = true;
+    reset_op_profile();
+    add_vectors(r, a, b, 16);
+    for (unsigned i = 0; i < 16; ++i) {
+        if (r[i] != (a[i] & b[i]) + (b[i] << 1)) {
+            std::cerr << "Wrong result at " << i << '\n';
+            ok = false;
+        }
+    }
+
+    std::vector<OpProfileEntry> entries = get_op_profile();
+    ok &= check_calls(entries, "load", "uint32x4", 8);
+    ok &= check_calls(entries, "add", "uint32x4", 4);
+    ok &= check_calls(entries, "bit_and", "uint32x4", 4);
+    ok &= check_calls(entries, "shift_l", "uint32x4", 4);
+    ok &= check_calls(entries, "store", "uint32x4", 4);
+    if (entries.size() != 5) {
+        std::cerr << "Unexpected operations counted:\n";
+        dump_op_profile(std::cerr);
+        ok = false;
+    }
+
+    // NONE_NULL executes everything element by element
+    const OpProfileEntry* e = find_entry(entries, "add", "uint32x4");
+    if (e && (!e->emulated || e->cost != 4 || e->weighted() != 16)) {
+        std::cerr << "add/uint32x4: unexpected cost " << e->cost << '\n';
+        ok = false;
+    }
+
+    // the counters of the exited threads are merged
+    std::thread t([&]() { add_vectors(r, a, b, 16); });
+    t.join();
+    entries = get_op_profile();
+    ok &= check_calls(entries, "add", "uint32x4", 8);
+
+    std::ostringstream dump;
+    dump_op_profile(dump);
+    if (dump.str().find("add/uint32x4") == std::string::npos) {
+        std::cerr << "add/uint32x4 is missing in the dump:\n" << dump.str();
+        ok = false;
+    }
+
+    // the ops that return a vector instead of an expression count themselves
+    reset_op_profile();
+    uint32<4> s = stream_load<uint32<4>>(a);
+    store(r, s);
+    entries = get_op_profile();
+    ok &= check_calls(entries, "stream_load", "uint32x4", 1);
+    ok &= check_calls(entries, "store", "uint32x4", 1);
+
+    reset_op_profile();
+    if (!get_op_profile().empty()) {
+        std::cerr << "The counters have not been reset\n";
+        ok = false;
+    }
+
+#if SIMDPP_TEST_PROFILE_X86
+    ok &= test_profile_ops_x86(std::cerr);
+#endif
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,75 @@
+/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The part of the SIMDPP_PROFILE_OPS test that is compiled for X86_SSE2.
+    Verifies that the documented instruction counts are used.
+*/
+
+#include <simdpp/simd.h>
+#include <iostream>
+
+bool test_profile_ops_x86(std::ostream& err)
+{
+    using namespace simdpp;
+
+    alignas(32) std::uint8_t a[32] = { 0 };
+    reset_op_profile();
+    uint8<32> va = load(a);
+    uint8<16> vb = load(a);
+    store(a, add(va, va));
+    store(a, add(vb, vb));
+
+    bool ok = true;
+    bool found32 = false, found16 = false;
+    for (const OpProfileEntry& e : get_op_profile()) {
+        if (e.op != "add" || e.arch != SIMDPP_ARCH_NAME || e.calls != 1) {
+            continue;
+        }
+        // 256-bit add is documented as two instructions
+        if (e.type == "uint8x32") {
+            found32 = true;
+            if (!e.documented || e.emulated || e.cost != 2) {
+                err << "add/uint8x32: unexpected cost " << e.cost << '\n';
+                ok = false;
+            }
+        }
+        // not documented, one native vector
+        if (e.type == "uint8x16") {
+            found16 = true;
+            if (e.documented || e.emulated || e.cost != 1) {
+                err << "add/uint8x16: unexpected cost " << e.cost << '\n';
+                ok = false;
+            }
+        }
+    }
+    if (!found32 || !found16) {
+        err << "add has not been counted:\n";
+        dump_op_profile(err);
+        ok = false;
+    }
+    return ok;
+}
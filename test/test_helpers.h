@@ -113,6 +113,24 @@ void test_push_internal(TestCase& t, simdpp::float64<N> data, unsigned line)
     test_push_internal_vec(t.push(TestCase::TYPE_FLOAT64, N, line), data);
 }
 // @}
+
+/*  Pushes each element of the vector as the first element of a separate
+    result. Integer results are compared only by their first element, thus
+    this is needed to check the placement of the other elements.
+*/
+template<class V>
+void test_push_elements_internal(TestCase& t, const V& data, unsigned line)
+{
+    simdpp::detail::mem_block<V> block(data);
+    for (unsigned i = 0; i < V::length; i++) {
+        simdpp::detail::mem_block<V> r;
+        for (unsigned j = 0; j < V::length; j++) {
+            r[j] = (i + j < V::length) ? block[i + j] : 0;
+        }
+        test_push_internal(t, V(r), line);
+    }
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 
 // we are supposed to call this from within the test function which is in
@@ -128,6 +146,9 @@ void test_push_internal(TestCase& t, simdpp::float64<N> data, unsigned line)
 */
 #define TEST_PUSH(TC,T,D)   { test_push_internal((TC), (T)(D), __LINE__); }
 
+#define TEST_PUSH_ELEMENTS(TC,T,D)                                      \
+    { test_push_elements_internal((TC), (T)(D), __LINE__); }
+
 #define NEW_TEST_CASE(R, NAME) ((R).new_test_case((NAME), __FILE__))
 
 #define TEST_ARRAY_PUSH(TC, T, A)                                       \
@@ -245,9 +266,9 @@ void test_push_internal(TestCase& t, simdpp::float64<N> data, unsigned line)
         for (unsigned rot0 = 0; rot0 < sizeof(T)/EL_SIZE % 4; rot0++) { \
             for (unsigned rot1 = 0; rot1 < sizeof(T)/EL_SIZE % 4; rot1++) { \
                 TEST_PUSH(TC, T, OP(v0, v1, v2));                       \
-                v0 = simdpp::align<1>(v0, v0);                          \
+                v0 = simdpp::detail::align_v128<1>(v0, v0);             \
             }                                                           \
-            v1 = simdpp::align<1>(v1, v1);                              \
+            v1 = simdpp::detail::align_v128<1>(v1, v1);                 \
         }                                                               \
     }}}                                                                 \
 }
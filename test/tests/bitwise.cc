@@ -125,6 +125,64 @@ void test_bitwise(TestResults& res)
         TEST_PUSH(tc, float32x8, bit_not(m.df32[i]));
         TEST_PUSH(tc, float64x4, bit_not(m.df64[i]));
     }
+
+    // 512-bit masks
+    {
+        uint32x16 u1 = make_uint(0x00000000, 0x00000001, 0x80000000, 0xffffffff);
+        uint32x16 u2 = make_uint(0x00000001, 0x00000001, 0x7fffffff, 0x00000000);
+        uint64x8 l1 = make_uint(0x0000000000000001, 0xffffffffffffffff);
+        uint64x8 l2 = make_uint(0x0000000000000001, 0x0000000000000000);
+        float32x16 f1 = make_float(1.0f, -2.0f, 3.0f, 0.5f);
+        float32x16 f2 = make_float(1.0f, 2.0f, -3.0f, 0.0f);
+        float64x8 d1 = make_float(1.0, -2.0);
+        float64x8 d2 = make_float(1.0, 2.0);
+
+        mask_int32x16 mu1 = cmp_eq(u1, u2), mu2 = cmp_lt(u1, u2);
+        mask_int64x8 ml1 = cmp_eq(l1, l2), ml2 = cmp_neq(l1, l2);
+        mask_float32x16 mf1 = cmp_eq(f1, f2), mf2 = cmp_lt(f1, f2);
+        mask_float64x8 md1 = cmp_eq(d1, d2), md2 = cmp_lt(d1, d2);
+
+        TEST_PUSH(tc, uint32x16, bit_and(u1, mu1));
+        TEST_PUSH(tc, uint64x8, bit_and(l1, ml1));
+        TEST_PUSH(tc, float32x16, bit_and(f1, mf1));
+        TEST_PUSH(tc, float64x8, bit_and(d1, md1));
+
+        TEST_PUSH(tc, uint32x16, bit_andnot(u1, mu1));
+        TEST_PUSH(tc, uint64x8, bit_andnot(l1, ml1));
+        TEST_PUSH(tc, float32x16, bit_andnot(f1, mf1));
+        TEST_PUSH(tc, float64x8, bit_andnot(d1, md1));
+
+        TEST_PUSH(tc, uint32x16, bit_and(mu1, mu2));
+        TEST_PUSH(tc, uint64x8, bit_and(ml1, ml2));
+        TEST_PUSH(tc, float32x16, bit_and(mf1, mf2));
+        TEST_PUSH(tc, float64x8, bit_and(md1, md2));
+
+        TEST_PUSH(tc, uint32x16, bit_andnot(mu1, mu2));
+        TEST_PUSH(tc, uint64x8, bit_andnot(ml1, ml2));
+        TEST_PUSH(tc, float32x16, bit_andnot(mf1, mf2));
+        TEST_PUSH(tc, float64x8, bit_andnot(md1, md2));
+
+        TEST_PUSH(tc, uint32x16, bit_or(mu1, mu2));
+        TEST_PUSH(tc, uint64x8, bit_or(ml1, ml2));
+        TEST_PUSH(tc, float32x16, bit_or(mf1, mf2));
+        TEST_PUSH(tc, float64x8, bit_or(md1, md2));
+
+        TEST_PUSH(tc, uint32x16, bit_xor(mu1, mu2));
+        TEST_PUSH(tc, uint64x8, bit_xor(ml1, ml2));
+        TEST_PUSH(tc, float32x16, bit_xor(mf1, mf2));
+        TEST_PUSH(tc, float64x8, bit_xor(md1, md2));
+
+        TEST_PUSH(tc, uint32x16, bit_not(mu1));
+        TEST_PUSH(tc, uint64x8, bit_not(ml1));
+        TEST_PUSH(tc, float32x16, bit_not(mf1));
+        TEST_PUSH(tc, float64x8, bit_not(md1));
+
+        TEST_PUSH(tc, uint32x16, blend(u1, u2, mu2));
+        TEST_PUSH(tc, uint64x8, blend(l1, l2, ml2));
+        TEST_PUSH(tc, float32x16, blend(f1, f2, mf2));
+        TEST_PUSH(tc, float64x8, blend(d1, d2, md2));
+        TEST_PUSH(tc, float32x16, blend(add(f1, f2), f1, cmp_lt(f1, f2)));
+    }
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -96,7 +96,24 @@ void test_compare(TestResults& res)
         TEST_COMPARE_TESTER_HELPER(tc, uint32x8, sl, sr);
     }
 
-    //int64x2 not available
+    //int64x4, cmp_lt and cmp_gt not available
+    {
+        uint64x4 sl[] = {
+            (uint64x4) make_uint(0x1111111122222222, 0x1111111122222222),
+            (uint64x4) make_uint(0x1111111122222222, 0x3333333322222222),
+            (uint64x4) make_uint(0x1111111122222222, 0x3333333344444444),
+            (uint64x4) make_uint(0x0000000000000000, 0xffffffffffffffff),
+        };
+        uint64x4 sr[] = {
+            (uint64x4) make_uint(0x1111111122222222, 0x1111111133333333),
+            (uint64x4) make_uint(0x1111111122222222, 0x1111111122222222),
+            (uint64x4) make_uint(0x3333333344444444, 0x3333333344444444),
+            (uint64x4) make_uint(0xffffffffffffffff, 0x0000000000000000),
+        };
+
+        TEST_ARRAY_HELPER2(tc, uint64x4, cmp_eq, sl, sr);
+        TEST_ARRAY_HELPER2(tc, uint64x4, cmp_neq, sl, sr);
+    }
 
     float nanf = std::numeric_limits<float>::quiet_NaN();
     double nan = std::numeric_limits<double>::quiet_NaN();
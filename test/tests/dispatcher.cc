@@ -56,6 +56,24 @@ int test_dispatcher4(int arg, int arg2, int arg3, int arg4)
     return arg + arg2 + arg3 + arg4;
 }
 
+template<class T>
+simdpp::Arch test_dispatcher_tmpl(T& out, const T& a, T b)
+{
+    out = a + b;
+    return simdpp::this_compile_arch();
+}
+
+int test_dispatcher_many(int a1, int a2, int a3, int a4, int a5, int a6,
+                         int a7, int a8, int a9, int a10, int a11,
+                         const TestDispatcherBig& big)
+{
+    int r = a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11;
+    for (int v : big.v) {
+        r += v;
+    }
+    return r;
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 
 SIMDPP_MAKE_DISPATCHER_RET0(test_dispatcher, simdpp::Arch)
@@ -63,3 +81,14 @@ SIMDPP_MAKE_DISPATCHER_RET1(test_dispatcher1, int, int)
 SIMDPP_MAKE_DISPATCHER_RET2(test_dispatcher2, int, int, int)
 SIMDPP_MAKE_DISPATCHER_RET3(test_dispatcher3, int, int, int, int)
 SIMDPP_MAKE_DISPATCHER_RET4(test_dispatcher4, int, int, int, int, int)
+
+SIMDPP_DISPATCH_VERSION(test_dispatcher_tmpl_tag,
+                        simdpp::Arch(int&, const int&, int),
+                        test_dispatcher_tmpl<int>)
+SIMDPP_DISPATCH_VERSION(test_dispatcher_tmpl_tag,
+                        simdpp::Arch(float&, const float&, float),
+                        test_dispatcher_tmpl<float>)
+SIMDPP_DISPATCH_VERSION(test_dispatcher_many_tag,
+                        int(int, int, int, int, int, int, int, int, int, int,
+                            int, const TestDispatcherBig&),
+                        test_dispatcher_many)
@@ -34,3 +34,11 @@ int test_dispatcher1(int arg);
 int test_dispatcher2(int arg, int arg2);
 int test_dispatcher3(int arg, int arg2, int arg3);
 int test_dispatcher4(int arg, int arg2, int arg3, int arg4);
+
+// Functions dispatched via simdpp::dispatch_call
+struct test_dispatcher_tmpl_tag;
+struct test_dispatcher_many_tag;
+
+struct TestDispatcherBig {
+    int v[64];
+};
@@ -142,6 +142,18 @@ void test_math_int(TestResults& res)
         TEST_ALL_COMB_HELPER1_T(tc, int32<16>, int16x16, mull, s, 2);
         TEST_ALL_COMB_HELPER1_T(tc, uint32<16>, uint16x16, mull, s, 2);
 
+        // the results must keep the element order across the 128-bit lanes
+        uint16x16 l1 = combine((uint16x8) make_uint(0x0001, 0x0002, 0x0003, 0x0004,
+                                                    0x0005, 0x0006, 0x0007, 0x0008),
+                               (uint16x8) make_uint(0x0009, 0x000a, 0x000b, 0x000c,
+                                                    0x000d, 0x000e, 0x000f, 0x0010));
+        uint16x16 l2 = combine((uint16x8) make_uint(0x1111, 0x2222, 0x3333, 0x4444,
+                                                    0x5555, 0x6666, 0x7777, 0x8888),
+                               (uint16x8) make_uint(0x9999, 0xaaaa, 0xbbbb, 0xcccc,
+                                                    0xdddd, 0xeeee, 0xffff, 0x0000));
+        TEST_PUSH_ELEMENTS(tc, int32<16>, mull(int16x16(l1), int16x16(l2)));
+        TEST_PUSH_ELEMENTS(tc, uint32<16>, mull(l1, l2));
+
         TEST_ARRAY_HELPER1(tc, int16x16, neg, s);
         TEST_ARRAY_HELPER1(tc, int16x16, abs, s);
 
@@ -220,12 +232,48 @@ void test_math_int(TestResults& res)
 #if !(SIMDPP_USE_ALTIVEC)
         TEST_ALL_COMB_HELPER1_T(tc, uint64<8>, uint32x8, mull, s, 4);
         TEST_ALL_COMB_HELPER1_T(tc, uint32x8, uint32x8, mul_lo, s, 4);
+
+        // the results must keep the element order across the 128-bit lanes
+        uint32x8 l1 = combine((uint32x4) make_uint(0x00000001, 0x00000002, 0x00000003, 0x00000004),
+                              (uint32x4) make_uint(0x00000005, 0x00000006, 0x00000007, 0x00000008));
+        uint32x8 l2 = combine((uint32x4) make_uint(0x11111111, 0x22222222, 0x33333333, 0x44444444),
+                              (uint32x4) make_uint(0xcccccccc, 0xdddddddd, 0xeeeeeeee, 0xffffffff));
+        TEST_PUSH_ELEMENTS(tc, uint64<8>, mull(l1, l2));
 #endif
 
         TEST_ARRAY_HELPER1(tc, int32x8, neg, s);
         TEST_ARRAY_HELPER1(tc, int32x8, abs, s);
     }
 
+    // 512-bit vectors with 32-bit integer elements
+    {
+        uint32x16 s[] = {
+            (uint32<16>) make_uint(0x11111111, 0x22222222, 0x33333333, 0x44444444),
+            (uint32<16>) make_uint(0xcccccccc, 0xdddddddd, 0xeeeeeeee, 0xffffffff),
+            (uint32<16>) make_uint(0x00000000, 0x00000001, 0x00000002, 0x00000003),
+            (uint32<16>) make_uint(0xfffffffc, 0xfffffffd, 0xfffffffe, 0xffffffff),
+            (uint32<16>) make_uint(0x7ffffffe, 0x7fffffff, 0x80000000, 0x80000001),
+        };
+
+        TEST_ALL_COMB_HELPER2(tc, int32x16, add, s, 4);
+        TEST_ALL_COMB_HELPER2(tc, int32x16, sub, s, 4);
+        TEST_ALL_COMB_HELPER2(tc, int32x16, min, s, 4);
+        TEST_ALL_COMB_HELPER2(tc, int32x16, max, s, 4);
+
+        TEST_ALL_COMB_HELPER2(tc, uint32x16, add, s, 4);
+        TEST_ALL_COMB_HELPER2(tc, uint32x16, sub, s, 4);
+        TEST_ALL_COMB_HELPER2(tc, uint32x16, min, s, 4);
+        TEST_ALL_COMB_HELPER2(tc, uint32x16, max, s, 4);
+
+#if !(SIMDPP_USE_ALTIVEC)
+        TEST_ALL_COMB_HELPER1_T(tc, uint64<16>, uint32x16, mull, s, 4);
+        TEST_ALL_COMB_HELPER1_T(tc, uint32x16, uint32x16, mul_lo, s, 4);
+#endif
+
+        TEST_ARRAY_HELPER1(tc, int32x16, neg, s);
+        TEST_ARRAY_HELPER1(tc, int32x16, abs, s);
+    }
+
     // Vectors with 64-bit integer elements
     {
         uint64x4 s[] = {
@@ -262,6 +310,25 @@ void test_math_int(TestResults& res)
         TEST_ARRAY_HELPER1(tc, int64x4, neg, s);
         TEST_ARRAY_HELPER1(tc, int64x4, abs, s);
     }
+
+    // 512-bit vectors with 64-bit integer elements
+    {
+        uint64x8 s[] = {
+            (uint64<8>) make_uint(0x1111111111111111, 0x2222222222222222),
+            (uint64<8>) make_uint(0xcccccccccccccccc, 0xffffffffffffffff),
+            (uint64<8>) make_uint(0x0000000000000000, 0x0000000000000001),
+            (uint64<8>) make_uint(0xfffffffffffffffe, 0xffffffffffffffff),
+            (uint64<8>) make_uint(0x7fffffffffffffff, 0x8000000000000000),
+        };
+
+        TEST_ALL_COMB_HELPER2(tc, int64x8, add, s, 2);
+        TEST_ALL_COMB_HELPER2(tc, int64x8, sub, s, 2);
+        TEST_ALL_COMB_HELPER2(tc, uint64x8, add, s, 2);
+        TEST_ALL_COMB_HELPER2(tc, uint64x8, sub, s, 2);
+
+        TEST_ARRAY_HELPER1(tc, int64x8, neg, s);
+        TEST_ARRAY_HELPER1(tc, int64x8, abs, s);
+    }
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -81,9 +81,35 @@ void test_load_helper(TestCase& tc, void* sv_p)
         TEST_PUSH(tc, V, r);
     }
 
+    for (unsigned i = 0; i < vnum; i++) {
+        V r = simdpp::stream_load<V>(sdata + i*V::length);
+        TEST_PUSH(tc, V, r);
+    }
+
+    simdpp::prefetch_cursor<V> cursor(sdata, 64);
+    for (unsigned i = 0; i < vnum; i++) {
+        V r = cursor.load();
+        TEST_PUSH(tc, V, r);
+    }
+
+    simdpp::prefetch_cursor<V, simdpp::prefetch_hint::nt> cursor_u(sdata+1, 128,
+                                                            sizeof(E)*3);
+    for (unsigned i = 0; i < vnum; i++) {
+        V r = cursor_u.load_u();
+        TEST_PUSH(tc, V, r);
+    }
+
+    tc.reset_seq();
+    for (unsigned i = 0; i <= V::length; i++) {
+        V r;
+        load_partial(r, sdata+1, i);
+        TEST_PUSH(tc, V, r);
+    }
+
     rzero();
     load_packed2(rv[0], rv[1], sdata);
-    TEST_ARRAY_PUSH(tc, V, rv);
+    TEST_PUSH_ELEMENTS(tc, V, rv[0]);
+    TEST_PUSH_ELEMENTS(tc, V, rv[1]);
 
     rzero();
     load_packed3(rv[0], rv[1], rv[2], sdata);
@@ -95,6 +121,74 @@ void test_load_helper(TestCase& tc, void* sv_p)
 }
 
 
+template<class V, unsigned P, unsigned N>
+void test_load_lane_helper(TestCase& tc, void* sv_p)
+{
+    using E = typename V::element_type;
+    auto sdata = reinterpret_cast<E*>(sv_p);
+
+    V r = simdpp::load(sdata + 4*V::length);
+#if SIMDPP_USE_SSE2
+    simdpp::sse::load_lane<P,N>(r, sdata);
+#else
+    // loads of a half of the vector keep the other half, smaller loads zero
+    // the rest of the vector
+    union {
+        E e[V::length];
+        V align;
+    };
+    simdpp::store(e, r);
+    for (unsigned i = 0; i < V::length; i++) {
+        if (i >= P && i < P+N) {
+            e[i] = sdata[i-P];
+        } else if (N*2 != V::length) {
+            e[i] = 0;
+        }
+    }
+    r = simdpp::load(e);
+#endif
+    TEST_PUSH_ELEMENTS(tc, V, r);
+}
+
+template<class V, class I>
+void test_gather_helper(TestCase& tc, void* sv_p, unsigned size)
+{
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+    auto sdata = reinterpret_cast<E*>(sv_p);
+    unsigned count = size / sizeof(E);
+
+    union {
+        IE idata[V::length];
+        I align1;
+    };
+    union {
+        E mdata[V::length];
+        V align2;
+    };
+    for (unsigned i = 0; i < V::length; i++) {
+        idata[i] = (i*7 + 3) % count;
+        mdata[i] = i % 3 == 1 ? 0 : 1;
+    }
+
+    I index = simdpp::load(idata);
+    V r = simdpp::gather<V>(sdata, index);
+    TEST_PUSH(tc, V, r);
+
+    // indices relative to the middle of the data
+    for (unsigned i = 0; i < V::length; i++) {
+        idata[i] = IE(int(i*5 % count) - int(count / 2));
+    }
+    index = simdpp::load(idata);
+    r = simdpp::gather<V>(sdata + count / 2, index);
+    TEST_PUSH(tc, V, r);
+
+    V mv = simdpp::load(mdata);
+    typename V::mask_vector_type mask = cmp_neq(mv, V::zero());
+    r = simdpp::gather<V>(sdata + count / 2, index, mask);
+    TEST_PUSH(tc, V, r);
+}
+
 void test_memory_load(TestResults& res)
 {
     TestCase& tc = NEW_TEST_CASE(res, "memory_load");
@@ -102,12 +196,14 @@ void test_memory_load(TestResults& res)
     using namespace simdpp;
 
     constexpr unsigned vnum = 4;
-    constexpr unsigned size = 32*vnum;
+    constexpr unsigned size = 64*vnum;
 
     union {
         uint8_t sdata[size];
         uint8x32 align1;
         float32x8 align2;
+        uint32x16 align3;
+        float64x8 align4;
     };
 
     for (unsigned i = 0; i < size; i++) {
@@ -129,6 +225,44 @@ void test_memory_load(TestResults& res)
     test_load_helper<uint64x4, 4>(tc, sdata);
     test_load_helper<float32x8, 4>(tc, sdata);
     test_load_helper<float64x4, 4>(tc, sdata);
+
+    // 64-byte vectors
+    test_load_helper<uint32x16, 4>(tc, sdata);
+    test_load_helper<uint64x8, 4>(tc, sdata);
+    test_load_helper<float32x16, 4>(tc, sdata);
+    test_load_helper<float64x8, 4>(tc, sdata);
+
+    // sse::load_lane, emulated on other architectures
+    test_load_lane_helper<uint8x16, 0, 4>(tc, sdata);
+    test_load_lane_helper<uint8x16, 0, 8>(tc, sdata);
+    test_load_lane_helper<uint8x16, 8, 8>(tc, sdata);
+    test_load_lane_helper<uint16x8, 0, 2>(tc, sdata);
+    test_load_lane_helper<uint16x8, 0, 4>(tc, sdata);
+    test_load_lane_helper<uint16x8, 4, 4>(tc, sdata);
+    test_load_lane_helper<uint32x4, 0, 1>(tc, sdata);
+    test_load_lane_helper<uint32x4, 0, 2>(tc, sdata);
+    test_load_lane_helper<uint32x4, 2, 2>(tc, sdata);
+    test_load_lane_helper<uint64x2, 0, 1>(tc, sdata);
+    test_load_lane_helper<uint64x2, 1, 1>(tc, sdata);
+    test_load_lane_helper<float32x4, 0, 1>(tc, sdata);
+    test_load_lane_helper<float32x4, 0, 2>(tc, sdata);
+    test_load_lane_helper<float32x4, 2, 2>(tc, sdata);
+    test_load_lane_helper<float64x2, 0, 1>(tc, sdata);
+    test_load_lane_helper<float64x2, 1, 1>(tc, sdata);
+
+    // gather
+    test_gather_helper<uint32x4, uint32x4>(tc, sdata, size);
+    test_gather_helper<float32x4, int32x4>(tc, sdata, size);
+    test_gather_helper<uint64x2, uint64x2>(tc, sdata, size);
+    test_gather_helper<float64x2, int64x2>(tc, sdata, size);
+    test_gather_helper<uint32x8, int32x8>(tc, sdata, size);
+    test_gather_helper<float32x8, uint32x8>(tc, sdata, size);
+    test_gather_helper<uint64x4, int32x4>(tc, sdata, size);
+    test_gather_helper<float64x4, uint64x4>(tc, sdata, size);
+    test_gather_helper<uint32x16, int32x16>(tc, sdata, size);
+    test_gather_helper<float32x16, int32x16>(tc, sdata, size);
+    test_gather_helper<uint64x8, uint32x8>(tc, sdata, size);
+    test_gather_helper<float64x8, int64x8>(tc, sdata, size);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -73,7 +73,13 @@ void test_store_helper(TestCase& tc, V* sv)
     for (unsigned i = 0; i < V::length; i++) {
         rzero(rv);
         store_last(rdata, sv[0], i);
-        TEST_PUSH(tc, V, rv[0]);
+        TEST_PUSH_ELEMENTS(tc, V, rv[0]);
+    }
+
+    for (unsigned i = 0; i <= V::length; i++) {
+        rzero(rv);
+        store_partial(rdata+1, sv[0], i);
+        TEST_ARRAY_PUSH(tc, V, rv);
     }
 
     rzero(rv);
@@ -89,6 +95,87 @@ void test_store_helper(TestCase& tc, V* sv)
     TEST_ARRAY_PUSH(tc, V, rv);
 }
 
+template<class V, class I, unsigned vnum>
+void test_scatter_helper(TestCase& tc, V* sv)
+{
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+    constexpr unsigned count = V::length * vnum;
+
+    union {
+        E rdata[count];
+        V rv[vnum];
+    };
+    union {
+        IE idata[V::length];
+        I align1;
+    };
+    union {
+        E mdata[V::length];
+        V align2;
+    };
+    for (unsigned i = 0; i < V::length; i++) {
+        // the multiplier is odd, thus the indices are unique
+        idata[i] = IE(int((i*5 + 1) % count) - int(count / 2));
+        mdata[i] = i % 3 == 1 ? 0 : 1;
+    }
+
+    for (unsigned i = 0; i < vnum; i++) {
+        rv[i] = V::zero();
+    }
+    I index = simdpp::load(idata);
+    scatter(rdata + count / 2, index, sv[0]);
+    TEST_ARRAY_PUSH(tc, V, rv);
+
+    for (unsigned i = 0; i < vnum; i++) {
+        rv[i] = V::zero();
+    }
+    V mv = simdpp::load(mdata);
+    typename V::mask_vector_type mask = cmp_neq(mv, V::zero());
+    scatter(rdata + count / 2, index, sv[1], mask);
+    TEST_ARRAY_PUSH(tc, V, rv);
+}
+
+template<class V, unsigned vnum>
+void test_compress_helper(TestCase& tc, V* sv)
+{
+    using E = typename V::element_type;
+
+    union {
+        E rdata[V::length * vnum];
+        V rv[vnum];
+    };
+    union {
+        E mdata[V::length];
+        V align;
+    };
+
+    for (unsigned k = 0; k < vnum; k++) {
+        // none, all, and two irregular selections of the elements
+        for (unsigned i = 0; i < V::length; i++) {
+            switch (k) {
+            case 0: mdata[i] = 0; break;
+            case 1: mdata[i] = 1; break;
+            case 2: mdata[i] = i % 3 == 1 ? 0 : 1; break;
+            default: mdata[i] = (i*7 + 3) % 5 < 2 ? 1 : 0; break;
+            }
+        }
+        V mv = simdpp::load(mdata);
+        typename V::mask_vector_type mask = cmp_neq(mv, V::zero());
+
+        V r = compress(sv[k], mask);
+        TEST_PUSH(tc, V, r);
+
+        for (unsigned i = 0; i < vnum; i++) {
+            rv[i] = V::zero();
+        }
+        unsigned n = store_compress(rdata+1, sv[k], mask);
+        TEST_ARRAY_PUSH(tc, V, rv);
+        simdpp::uint32x4 c = simdpp::make_uint(n);
+        TEST_PUSH(tc, simdpp::uint32x4, c);
+    }
+}
+
 void test_memory_store(TestResults& res)
 {
     TestCase& tc = NEW_TEST_CASE(res, "memory_store");
@@ -96,7 +183,7 @@ void test_memory_store(TestResults& res)
     using namespace simdpp;
 
     constexpr unsigned vnum = 4;
-    constexpr unsigned size = 32*vnum;
+    constexpr unsigned size = 64*vnum;
 
     Vectors<size> v;
 
@@ -115,6 +202,57 @@ void test_memory_store(TestResults& res)
     test_store_helper<uint64x4, 4>(tc, v.du64);
     test_store_helper<float32x8, 4>(tc, v.df32);
     test_store_helper<float64x4, 4>(tc, v.df64);
+
+    // 64-byte vectors
+    test_store_helper<uint32x16, 4>(tc, v.qu32);
+    test_store_helper<uint64x8, 4>(tc, v.qu64);
+    test_store_helper<float32x16, 4>(tc, v.qf32);
+    test_store_helper<float64x8, 4>(tc, v.qf64);
+
+    // scatter
+    test_scatter_helper<uint32x4, uint32x4, 4>(tc, v.u32);
+    test_scatter_helper<float32x4, int32x4, 4>(tc, v.f32);
+    test_scatter_helper<uint64x2, uint64x2, 4>(tc, v.u64);
+    test_scatter_helper<float64x2, int64x2, 4>(tc, v.f64);
+    test_scatter_helper<uint32x8, int32x8, 4>(tc, v.du32);
+    test_scatter_helper<float32x8, uint32x8, 4>(tc, v.df32);
+    test_scatter_helper<uint64x4, int32x4, 4>(tc, v.du64);
+    test_scatter_helper<float64x4, uint64x4, 4>(tc, v.df64);
+    test_scatter_helper<uint32x16, int32x16, 4>(tc, v.qu32);
+    test_scatter_helper<float32x16, int32x16, 4>(tc, v.qf32);
+    test_scatter_helper<uint64x8, uint32x8, 4>(tc, v.qu64);
+    test_scatter_helper<float64x8, int64x8, 4>(tc, v.qf64);
+
+    // compress
+    test_compress_helper<uint8x16, 4>(tc, v.u8);
+    test_compress_helper<uint16x8, 4>(tc, v.u16);
+    test_compress_helper<uint32x4, 4>(tc, v.u32);
+    test_compress_helper<uint64x2, 4>(tc, v.u64);
+    test_compress_helper<float32x4, 4>(tc, v.f32);
+    test_compress_helper<float64x2, 4>(tc, v.f64);
+    test_compress_helper<uint8x32, 4>(tc, v.du8);
+    test_compress_helper<uint16x16, 4>(tc, v.du16);
+    test_compress_helper<uint32x8, 4>(tc, v.du32);
+    test_compress_helper<uint64x4, 4>(tc, v.du64);
+    test_compress_helper<float32x8, 4>(tc, v.df32);
+    test_compress_helper<float64x4, 4>(tc, v.df64);
+    test_compress_helper<uint32x16, 4>(tc, v.qu32);
+    test_compress_helper<uint64x8, 4>(tc, v.qu64);
+    test_compress_helper<float32x16, 4>(tc, v.qf32);
+    test_compress_helper<float64x8, 4>(tc, v.qf64);
+
+    // stream_copy
+    alignas(64) uint32x16 sv[vnum], rv[vnum];
+    for (unsigned i = 0; i < vnum; i++) {
+        sv[i] = v.qu32[i];
+    }
+    for (unsigned n : { 0u, 1u, 64u, 100u, size }) {
+        for (unsigned i = 0; i < vnum; i++) {
+            rv[i] = uint32x16::zero();
+        }
+        stream_copy(rv, sv, n);
+        TEST_ARRAY_PUSH(tc, uint32x16, rv);
+    }
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
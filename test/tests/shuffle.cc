@@ -47,11 +47,10 @@ template<unsigned S, unsigned N> simdpp::uint64<N> move_v128_r(simdpp::uint64<N>
 template<unsigned S, unsigned N> simdpp::float32<N> move_v128_r(simdpp::float32<N> a) { return simdpp::move4_r<S>(a); }
 template<unsigned S, unsigned N> simdpp::float64<N> move_v128_r(simdpp::float64<N> a) { return simdpp::move2_r<S>(a); }
 
-// shuffles within 256-bit vectors are limited to 128-bit halves
+// shuffles within wider vectors are limited to 128-bit lanes
 template<class V>
 struct Shuffle_width {
-    static constexpr bool is_256 = (V::length * V::num_bits) == 256 ? true : false;
-    static constexpr unsigned value = is_256 ? V::length / 2 : V::length;
+    static constexpr unsigned value = 128 / V::num_bits;
 };
 
 template<class V, unsigned i>
@@ -239,6 +238,10 @@ void test_shuffle(TestResults& res)
     TemplateTestHelper<Test_splat4, float32x8>::run(tc, v.df32[0]);
     TemplateTestHelper<Test_splat2, float64x4>::run(tc, v.df64[0]);
 
+    // vectors wider than the native ones
+    uint32<16> wu32 = load(v.pu32);
+    TemplateTestHelper<Test_splat4, uint32<16>>::run(tc, wu32);
+
     // blend
     test_blend<uint8x16>(tc, v.u8[0], v.u8[1], test_blend_make_sel_vec<uint8x16>());
     test_blend<uint16x8>(tc, v.u16[0], v.u16[1], test_blend_make_sel_vec<uint16x8>());
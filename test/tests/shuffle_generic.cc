@@ -141,6 +141,11 @@ void test_shuffle_generic(TestResults& res)
     // float64x4
     TemplateTestHelper<Test_permute2, float64x4>::run(tc, v.df64[0]);
     TemplateTestHelper<Test_shuffle21, float64x4>::run(tc, v.df64[0], v.df64[1]);
+
+    // vectors wider than the native ones
+    Vectors<64*2> w;
+    float32<16> wf32a = load(w.pf32), wf32b = load(w.pf32 + 16);
+    TemplateTestHelper<Test_shuffle42, float32<16>>::run(tc, wf32a, wf32b);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
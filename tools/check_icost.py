@@ -0,0 +1,432 @@
+#!/usr/bin/env python3
+
+#   Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+#   All rights reserved.
+#
+#   Redistribution and use in source and binary forms, with or without
+#   modification, are permitted provided that the following conditions are met:
+#
+#   * Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   * Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#   POSSIBILITY OF SUCH DAMAGE.
+
+# Verifies the instruction counts documented with @icost in the public API.
+#
+# Each documented (function, type, instruction set) combination is compiled
+# into a separate function. The object file is disassembled and the vector
+# instructions of each function are counted. The check fails if a count
+# exceeds the documented bound.
+#
+# Use as
+# $ ./tools/check_icost.py [--cxx=g++] [--objdump=objdump] [--arch=X86_AVX2 ...]
+#
+# The known discrepancies are recorded in tools/icost_exceptions.txt together
+# with the instruction count at the time of recording. A count above both the
+# documented and the recorded value is a failure. Use --update-exceptions to
+# rewrite the file after the documentation or the implementation is fixed.
+#
+# Only x86 instruction sets are checked. The vector loads and stores, which
+# move the arguments and the results to and from memory, and register to
+# register copies are not counted. The combinations that fail to compile
+# (declared, but not implemented) are reported, but don't fail the check.
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import gen_perf_ops as gen
+
+root_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+exceptions_path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               'icost_exceptions.txt')
+
+# The checked headers. The loads, stores and constructors are not
+# expressible as a function of vector arguments and are skipped
+headers = ([os.path.join('core', f) for f in
+            sorted(os.listdir(os.path.join(root_dir, 'simdpp', 'core')))
+            if f.endswith('.h') and f not in gen.skip_headers] +
+           ['adv/transpose.h'])
+
+# The x86 instruction sets in the order in which they imply each other, as
+# named in the documentation, with the compiler flags
+x86_archs = [
+    ('SSE2', 'X86_SSE2', '-msse2 -DSIMDPP_ARCH_X86_SSE2'),
+    ('SSE3', 'X86_SSE3', '-msse3 -DSIMDPP_ARCH_X86_SSE3'),
+    ('SSSE3', 'X86_SSSE3', '-mssse3 -DSIMDPP_ARCH_X86_SSSE3'),
+    ('SSE4.1', 'X86_SSE4_1', '-msse4.1 -DSIMDPP_ARCH_X86_SSE4_1'),
+    ('AVX', 'X86_AVX', '-mavx -DSIMDPP_ARCH_X86_AVX'),
+    ('AVX2', 'X86_AVX2', '-mavx2 -DSIMDPP_ARCH_X86_AVX2'),
+    ('AVX512F', 'X86_AVX512F', '-mavx512f -DSIMDPP_ARCH_X86_AVX512F'),
+]
+doc_arch_names = [a[0] for a in x86_archs]
+
+def expand_archs(spec):
+    ''' Expands an architecture specification of @icost, e.g. SSE2-AVX, to a
+        list of the x86 instruction set names. Returns an empty list for the
+        other architectures and for qualified entries such as
+        'AVX (integer vectors)' or 'SSE2_32bit'.
+    '''
+    spec = spec.strip().replace('SSE4_1', 'SSE4.1')
+    if not re.match(r'^[A-Z0-9.]+(-[A-Z0-9.]+)?$', spec):
+        return []
+    parts = spec.split('-')
+    if any(p not in doc_arch_names for p in parts):
+        return []
+    first = doc_arch_names.index(parts[0])
+    last = doc_arch_names.index(parts[-1])
+    return doc_arch_names[first:last+1]
+
+def section_accepts(section, family, width):
+    ''' Returns whether the costs listed in the given @par section of the
+        documentation apply to the vector type
+    '''
+    if section is None:
+        return width == 128
+    s = section.rstrip(':').strip()
+    if s == '128-bit version':
+        return width == 128
+    if s == '256-bit version':
+        return width == 256
+    if s == 'integer':
+        return not family.startswith('float')
+    if s == 'floating-point':
+        return family.startswith('float')
+    m = re.match(r'^(int|float)(8|16|32|64)$', s)
+    if m:
+        return family.endswith(s) and width == 128
+    return False
+
+def parse_icost(doc, expand=expand_archs):
+    ''' Returns a list of (section, [arch...], max_cost) tuples. @a expand
+        maps an architecture specification to a list of architecture names
+    '''
+    res = []
+    section = None
+    for line in doc.split('\n'):
+        m = re.search(r'@par\s+(.*)$', line)
+        if m:
+            section = m.group(1).strip()
+        for m in re.finditer(r'@icost\{([^}]*)\}', line):
+            parts = [p.strip() for p in m.group(1).split(',')]
+            cost = re.match(r'^(\d+)(?:-(\d+))?$', parts[-1])
+            if not cost:
+                continue
+            bound = int(cost.group(2) or cost.group(1))
+            archs = []
+            for p in parts[:-1]:
+                archs += expand(p)
+            if archs:
+                res.append((section, archs, bound))
+    return res
+
+def parse_functions(path):
+    ''' Yields (name, template_args, [param...], returns_void, icost) for each
+        function definition that follows a documentation comment with
+        @icost. The comment applies to the following overloads of the same
+        function up to the next documentation comment.
+    '''
+    text = open(path).read()
+    # Drop the preprocessor lines, but keep the comments
+    text = re.sub(r'^\s*#[^\n]*', '', text, flags=re.M)
+    pos = 0
+    docs = list(re.finditer(r'/\*\*(.*?)\*/', text, re.S))
+    for i, m in enumerate(docs):
+        icost = parse_icost(m.group(1))
+        if not icost:
+            continue
+        end = docs[i+1].start() if i + 1 < len(docs) else len(text)
+        body = gen.strip_source(text[m.end():end])
+        first_name = None
+        for tpl, ret, name, params in gen.find_functions(body):
+            if first_name is None:
+                first_name = name
+            if name != first_name:
+                break
+            yield name, tpl, ret, params, icost
+
+def make_checks(arch):
+    ''' Returns a list of (function, type, bound, code) tuples for the
+        instruction set
+    '''
+    checks = []
+    seen = set()
+    for h in headers:
+        path = os.path.join(root_dir, 'simdpp', h)
+        for name, tpl, ret, params, icost in parse_functions(path):
+            ret_words = ret.replace('inline', '').split()
+            returns_void = ret_words == ['void']
+            if not returns_void and len(ret_words) == 1 and \
+                    ret_words[0] in gen.scalar_types:
+                continue
+
+            tpl_args = []
+            tpl_params = gen.split_top_level(tpl)
+            for t in tpl_params:
+                kind, ident = t.rsplit(None, 1)
+                if kind == 'unsigned' and ident != 'N':
+                    tpl_args.append('1')
+            if tpl_args and tpl_params[0].endswith(' N'):
+                continue
+
+            params = gen.split_top_level(params)
+            accepted = None
+            out_params = []
+            for p in params:
+                types = gen.param_types(p)
+                if types is None:
+                    accepted = None
+                    break
+                if '&' in p and not p.strip().startswith('const'):
+                    out_params.append(len(out_params))
+                accepted = types if accepted is None else \
+                    [t for t in accepted if t in types]
+            if not accepted or (returns_void and not out_params):
+                continue
+
+            fn = name + ('<' + ','.join(tpl_args) + '>' if tpl_args else '')
+            for family, width in accepted:
+                for w in gen.widths:
+                    if width is not None and width != w:
+                        continue
+                    if w == 512 and arch != 'AVX512F':
+                        continue
+                    if not gen.width_available(family, w):
+                        continue
+                    bounds = [b for s, archs, b in icost
+                              if arch in archs and section_accepts(s, family, w)]
+                    if not bounds:
+                        continue
+                    t = gen.type_name(family, w)
+                    key = (fn, t)
+                    if key in seen:
+                        continue
+                    seen.add(key)
+                    checks.append((fn, t, max(bounds), len(params),
+                                   returns_void))
+    return checks
+
+def emit_source(checks):
+    ''' Returns the source code and a list of the line ranges of the
+        functions
+    '''
+    lines = ['#include <simdpp/simd.h>',
+             'using namespace simdpp;',
+             'template<class V> void chk_store(char* p, const V& v)',
+             '{ store(p, bit_cast<uint8<V::length_bytes>>(v.eval())); }',
+             '']
+    ranges = []
+    for i, (fn, t, bound, arity, returns_void) in enumerate(checks):
+        begin = len(lines) + 1
+        lines.append('void chk_{0}(const char* p, char* r)'.format(i))
+        lines.append('{')
+        args = []
+        for a in range(arity):
+            lines.append('    {0} a{1} = load(p + {1} * sizeof({0}));'.format(t, a))
+            args.append('a{0}'.format(a))
+        call = '{0}({1})'.format(fn, ', '.join(args))
+        if returns_void:
+            lines.append('    {0};'.format(call))
+            for a in range(arity):
+                lines.append('    chk_store(r + {1} * sizeof({0}), a{1});'.format(t, a))
+        else:
+            lines.append('    chk_store(r, {0});'.format(call))
+        lines.append('}')
+        lines.append('')
+        ranges.append((begin, len(lines)))
+    return '\n'.join(lines) + '\n', ranges
+
+vector_reg = re.compile(r'%[xyz]mm\d+|%k[0-7]')
+plain_move = re.compile(r'^v?mov(dq[au]|dq[au](8|16|32|64)|ap[sd]|up[sd])\b')
+
+constant_idiom = re.compile(r'^v?(pxor|xorp[sd]|pcmpeq[bwdq])\s+'
+                            r'(%[xyz]mm\d+),\2(,\2)?$')
+
+def counts_as_vector_insn(insn):
+    ''' Returns whether the instruction is counted. The plain vector moves
+        (loads, stores and register copies) are not counted, unless they
+        are masked. The all-zeros and all-ones idioms are not counted either,
+        as the constants are usually hoisted out of loops.
+    '''
+    if not vector_reg.search(insn):
+        return False
+    mnemonic = insn.split(None, 1)[0]
+    if plain_move.match(mnemonic) and '{%k' not in insn:
+        return False
+    if constant_idiom.match(insn):
+        return False
+    return mnemonic != 'vzeroupper'
+
+def count_instructions(objdump, obj):
+    ''' Returns a dict that maps function names to the lists of their counted
+        instructions
+    '''
+    out = subprocess.check_output([objdump, '-d', '--no-show-raw-insn',
+                                   '-C', obj]).decode()
+    res = {}
+    cur = None
+    for line in out.split('\n'):
+        m = re.match(r'^[0-9a-f]+ <(.*)>:$', line)
+        if m:
+            fm = re.match(r'^chk_(\d+)\(', m.group(1))
+            cur = int(fm.group(1)) if fm else None
+            if cur is not None:
+                res[cur] = []
+            continue
+        if cur is None:
+            continue
+        m = re.match(r'^\s*[0-9a-f]+:\s+(.*)$', line)
+        if m and counts_as_vector_insn(m.group(1).strip()):
+            res[cur].append(m.group(1).strip())
+    return res
+
+def compile_checks(args, flags, checks, tmpdir, name):
+    ''' Compiles the checks. The checks that fail to compile are removed and
+        the rest is compiled again. Returns (object file, compiled checks,
+        failed checks)
+    '''
+    failed = []
+    while True:
+        src, ranges = emit_source(checks)
+        src_path = os.path.join(tmpdir, name + '.cc')
+        obj_path = os.path.join(tmpdir, name + '.o')
+        with open(src_path, 'w') as f:
+            f.write(src)
+        cmd = [args.cxx, '-std=c++11', '-O2', '-c', '-I', root_dir] + \
+            flags.split() + [src_path, '-o', obj_path]
+        p = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT)
+        out = p.communicate()[0].decode()
+        if p.returncode == 0:
+            return obj_path, checks, failed
+
+        bad = set()
+        for m in re.finditer(re.escape(src_path) + r':(\d+):', out):
+            line = int(m.group(1))
+            for i, (b, e) in enumerate(ranges):
+                if b <= line <= e:
+                    bad.add(i)
+        if not bad:
+            sys.stderr.write(out)
+            return None, checks, failed
+        failed += [checks[i] for i in sorted(bad)]
+        checks = [c for i, c in enumerate(checks) if i not in bad]
+
+def load_exceptions():
+    ''' Returns a dict that maps (arch, function, type) to the recorded
+        instruction count
+    '''
+    res = {}
+    if not os.path.exists(exceptions_path):
+        return res
+    for line in open(exceptions_path):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        arch, op, count = line.split()
+        fn, t = op.rsplit('/', 1)
+        res[(arch, fn, t)] = int(count)
+    return res
+
+def write_exceptions(items):
+    with open(exceptions_path, 'w') as f:
+        f.write('# Known differences between the documented @icost and the '
+                'actual number of\n'
+                '# instructions. Generated by tools/check_icost.py '
+                '--update-exceptions.\n'
+                '# Format: <arch> <function>/<type> <instruction count>\n')
+        for arch, fn, t, count in items:
+            f.write('{0} {1}/{2} {3}\n'.format(arch, fn, t, count))
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Verifies the @icost documentation')
+    parser.add_argument('--cxx', default='g++', help='the C++ compiler')
+    parser.add_argument('--objdump', default='objdump',
+                        help='the objdump program')
+    parser.add_argument('--arch', action='append',
+                        help='check only the given instruction set, e.g. '
+                             'X86_AVX2. May be given several times')
+    parser.add_argument('--verbose', action='store_true',
+                        help='print the counted instructions of failures and '
+                             'the skipped combinations')
+    parser.add_argument('--update-exceptions', action='store_true',
+                        help='record the current differences in ' +
+                             exceptions_path)
+    args = parser.parse_args()
+
+    tmpdir = tempfile.mkdtemp(prefix='simdpp_icost')
+    try:
+        return check(args, tmpdir)
+    finally:
+        shutil.rmtree(tmpdir)
+
+def check(args, tmpdir):
+    exceptions = load_exceptions()
+    differences = []
+    num_checked = 0
+    num_skipped = 0
+    failures = []
+    for doc_name, arch_id, flags in x86_archs:
+        if args.arch and arch_id not in args.arch:
+            continue
+        checks = make_checks(doc_name)
+        obj, checks, failed = compile_checks(args, flags, checks, tmpdir,
+                                             arch_id.lower())
+        if obj is None:
+            sys.stderr.write('Could not compile the checks for {0}\n'.format(
+                             doc_name))
+            return 2
+        num_skipped += len(failed)
+        if args.verbose:
+            for fn, t, bound, arity, returns_void in failed:
+                print('{0}: {1}/{2}: does not compile, skipped'.format(
+                      doc_name, fn, t))
+        counts = count_instructions(args.objdump, obj)
+        for i, (fn, t, bound, arity, returns_void) in enumerate(checks):
+            insns = counts.get(i, [])
+            num_checked += 1
+            if len(insns) > bound:
+                differences.append((doc_name, fn, t, len(insns)))
+                known = exceptions.get((doc_name, fn, t), 0)
+                if len(insns) > known:
+                    failures.append((doc_name, fn, t, max(bound, known),
+                                     insns))
+
+    if args.update_exceptions:
+        write_exceptions(differences)
+        print('{0} differences recorded'.format(len(differences)))
+        return 0
+
+    for arch, fn, t, bound, insns in failures:
+        print('{0}: {1}/{2}: {3} instructions, expected at most {4}'.format(
+              arch, fn, t, len(insns), bound))
+        if args.verbose:
+            for insn in insns:
+                print('    ' + insn)
+    print('{0} checked, {1} skipped, {2} known differences, {3} failures'.format(
+          num_checked, num_skipped, len(differences) - len(failures),
+          len(failures)))
+    return 1 if failures else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -76,13 +76,57 @@ static ::simdpp::detail::DispatchRegistrator<                               $n$
         simdpp_ ## NAME ## _tag,$ret_type$(*)($types$)                      $n$
 > simdpp_dispatch_registrator_ ## NAME (                                    $n$
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),               $n$
-        static_cast<$ret_type$(*)($types$)>(&NAME));                        $n$
+        static_cast<$ret_type$(*)($types$)>(&NAME), #NAME);                 $n$
+                                                                            $n$
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+'''
+
+# IFUNC mode. Each version is described by a constant-initialized object in a
+# section that is specific to the dispatched function. The linker defines the
+# __start_ and __stop_ symbols for such sections, thus the resolver can iterate
+# over all versions without any registration code running.
+
+template_ifunc_head = '''
+#define SIMDPP_MAKE_DISPATCHER_$macro_end$(NAME$ret_param$$type_params$)    $n$
+                                                                            $n$'''
+
+template_ifunc_fn = '''
+extern "C" {                                                                $n$
+extern const ::simdpp::detail::IfuncVersion<$ret_type$(*)($types$)>        $n$
+    __start_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));  $n$
+extern const ::simdpp::detail::IfuncVersion<$ret_type$(*)($types$)>        $n$
+    __stop_simdpp_ifunc_ ## NAME[] __attribute__((visibility("hidden")));   $n$
+                                                                            $n$
+$ret_type$ (*simdpp_ifunc_resolve_ ## NAME())($types$)                      $n$
+{                                                                           $n$
+    return ::simdpp::detail::select_ifunc_version(                          $n$
+        __start_simdpp_ifunc_ ## NAME, __stop_simdpp_ifunc_ ## NAME,        $n$
+        SIMDPP_USER_ARCH_INFO);                                             $n$
+}                                                                           $n$
+} /* extern "C" */                                                          $n$
+                                                                            $n$
+$ret_type$ NAME($types$)                                                    $n$
+    __attribute__((ifunc("simdpp_ifunc_resolve_" #NAME)));                  $n$
+                                                                            $n$'''
+
+template_ifunc_registration = '''
+namespace SIMDPP_ARCH_NAMESPACE {                                           $n$
+                                                                            $n$
+static const ::simdpp::detail::IfuncVersion<$ret_type$(*)($types$)>        $n$
+    simdpp_ifunc_version_ ## NAME                                           $n$
+    __attribute__((used, section("simdpp_ifunc_" #NAME))) = {              $n$
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),               $n$
+        static_cast<$ret_type$(*)($types$)>(&NAME)                          $n$
+    };                                                                      $n$
                                                                             $n$
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 '''
 
 template_null = template_head + template_fn + template_registration
 template_not_null = template_head + template_registration
+template_ifunc_null = (template_ifunc_head + template_ifunc_fn +
+                       template_ifunc_registration)
+template_ifunc_not_null = template_ifunc_head + template_ifunc_registration
 
 # Prints a template substituting the given variables with given replacements
 def output_template(template, vars):
@@ -238,9 +282,21 @@ print('''/*  libsimdpp
     function in the namespace the macro is used. The body of that function
     implements the dispatch mechanism. The function must not be called before
     main() starts.
+
+    If @c SIMDPP_DISPATCHER_IFUNC is defined, the function is instead declared
+    as a GNU indirect function which is bound by the dynamic loader. In that
+    case, the function may be called at any time.
 */
 /// @{
-#ifdef SIMDPP_USE_NULL
+#if defined(SIMDPP_DISPATCHER_IFUNC) && defined(SIMDPP_USE_NULL)
+''')
+do_template(template_ifunc_null)
+print('''
+#elif defined(SIMDPP_DISPATCHER_IFUNC)
+''')
+do_template(template_ifunc_not_null)
+print('''
+#elif defined(SIMDPP_USE_NULL)
 ''')
 do_template(template_null)
 print('''
@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+
+#   Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+#   All rights reserved.
+#
+#   Redistribution and use in source and binary forms, with or without
+#   modification, are permitted provided that the following conditions are met:
+#
+#   * Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   * Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+
+# Generates the list of benchmarked operations perf/perf_ops.inl from the
+# declarations of the public API in simdpp/core
+# Use as $ ./tools/gen_perf_ops.py > perf/perf_ops.inl
+
+import os
+import re
+import sys
+
+core_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                        '..', 'simdpp', 'core')
+
+# Headers that don't declare value-to-value vector operations
+skip_headers = [
+    'aligned_allocator.h', 'cache.h', 'cast.h', 'compress.h', 'extract.h',
+    'gather.h', 'insert.h', 'load.h', 'load_packed2.h', 'load_packed3.h',
+    'load_packed4.h', 'load_partial.h', 'load_splat.h', 'load_u.h',
+    'make_float.h', 'make_int.h', 'make_uint.h', 'make_shuffle_bytes_mask.h',
+    'prefetch_cursor.h', 'scatter.h', 'set_splat.h', 'store.h',
+    'store_compress.h', 'store_first.h', 'store_last.h', 'store_packed2.h',
+    'store_packed3.h', 'store_packed4.h', 'store_partial.h', 'stream.h',
+    'stream_load.h',
+]
+
+# (operation, type) pairs that are declared, but not implemented. The value
+# is the preprocessor condition under which the operation is available, or
+# None if it's not available at all. The type '*' matches all types.
+exclude = {
+    # the public functions pass the wrong number of arguments to the
+    # implementation
+    ('sqrt', '*') : None,
+    ('rcp_rh', '*') : None,
+    ('rsqrt_rh', '*') : None,
+    # the 256-bit conversions are implemented only for AVX512F
+    ('to_float64', 'int32x8') : 'SIMDPP_USE_AVX512F',
+    ('to_float64', 'float32x8') : 'SIMDPP_USE_AVX512F',
+    # the 64-bit permute4 needs at least four elements
+    ('permute4<1,1,1,1>', 'uint64x2') : None,
+    ('permute4<1,1,1,1>', 'float64x2') : None,
+    # missing AVX (without AVX2) implementations
+    ('to_int32x8', 'float32x8') : '!SIMDPP_USE_AVX || SIMDPP_USE_AVX2',
+    ('permute4<1,1,1,1>', 'float64x4') : '!SIMDPP_USE_AVX || SIMDPP_USE_AVX2',
+    # not implemented on the older instruction sets
+    ('permute_bytes16', '*') : '!SIMDPP_USE_SSE2 || SIMDPP_USE_SSSE3',
+    ('permute_zbytes16', '*') : '!SIMDPP_USE_SSE2 || SIMDPP_USE_SSSE3',
+    ('mull', 'int32x4') : '(!SIMDPP_USE_SSE2 || SIMDPP_USE_SSE4_1) && !SIMDPP_USE_ALTIVEC',
+    ('mull', 'int32x8') : '(!SIMDPP_USE_SSE2 || SIMDPP_USE_SSE4_1) && !SIMDPP_USE_ALTIVEC',
+}
+
+# The element permutation operations are implemented only for the unsigned
+# and floating-point types. The signed types use the same instructions.
+for fn in ['permute2<1,1>', 'permute4<1,1,1,1>', 'shuffle1<1,1>',
+           'shuffle2<1,1>', 'shuffle2<1,1,1,1>', 'splat<1>', 'splat2<1>',
+           'splat4<1>', 'splat8<1>', 'splat16<1>']:
+    for t in ['int8', 'int16', 'int32', 'int64']:
+        for n in [128, 256, 512]:
+            exclude[(fn, '{0}x{1}'.format(t, n // int(t[3:])))] = None
+
+families = ['int8', 'uint8', 'int16', 'uint16', 'int32', 'uint32',
+            'int64', 'uint64', 'float32', 'float64']
+
+elem_bits = {
+    'int8' : 8, 'uint8' : 8, 'int16' : 16, 'uint16' : 16,
+    'int32' : 32, 'uint32' : 32, 'int64' : 64, 'uint64' : 64,
+    'float32' : 32, 'float64' : 64
+}
+
+# Vector widths in bits. The 512-bit vectors are measured only when they are
+# native, and only for the element sizes that AVX512F supports
+widths = [128, 256, 512]
+
+def type_name(family, width):
+    return '{0}x{1}'.format(family, width // elem_bits[family])
+
+def width_available(family, width):
+    return width != 512 or elem_bits[family] >= 32
+
+# The families that the generic parameter types of the public API accept
+any_families = {
+    'any_vec' : families,
+    'any_vec8' : ['int8', 'uint8'],
+    'any_vec16' : ['int16', 'uint16'],
+    'any_vec32' : ['int32', 'uint32', 'float32'],
+    'any_vec64' : ['int64', 'uint64', 'float64'],
+    'any_int8' : ['int8', 'uint8'],
+    'any_int16' : ['int16', 'uint16'],
+    'any_int32' : ['int32', 'uint32'],
+    'any_int64' : ['int64', 'uint64'],
+    'any_float32' : ['float32'],
+    'any_float64' : ['float64'],
+}
+
+scalar_types = ['void', 'bool', 'int', 'unsigned', 'float', 'double',
+                'int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'int32_t',
+                'uint32_t', 'int64_t', 'uint64_t']
+
+def strip_source(text):
+    ''' Removes comments, preprocessor directives and the contents of the
+        detail namespace
+    '''
+    text = re.sub(r'//[^\n]*', '', text)
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'^\s*#[^\n]*', '', text, flags=re.M)
+    while True:
+        m = re.search(r'namespace\s+detail\s*\{', text)
+        if not m:
+            return text
+        depth = 0
+        for i in range(m.end() - 1, len(text)):
+            if text[i] == '{':
+                depth += 1
+            elif text[i] == '}':
+                depth -= 1
+                if depth == 0:
+                    break
+        text = text[:m.start()] + text[i+1:]
+
+def split_top_level(s):
+    ''' Splits s by commas that are not within angle brackets '''
+    res = []
+    depth = 0
+    cur = ''
+    for c in s:
+        if c == '<':
+            depth += 1
+        elif c == '>':
+            depth -= 1
+        if c == ',' and depth == 0:
+            res.append(cur.strip())
+            cur = ''
+        else:
+            cur += c
+    if cur.strip() != '':
+        res.append(cur.strip())
+    return res
+
+def find_functions(text):
+    ''' Yields (template_params, return_type, name, params) for each function
+        definition at the namespace level
+    '''
+    depth = 0
+    start = 0
+    i = 0
+    while i < len(text):
+        c = text[i]
+        if c == '{':
+            if depth == 0:
+                decl = text[start:i].strip()
+                if re.match(r'^namespace\b', decl):
+                    # namespaces don't affect the nesting level
+                    start = i + 1
+                    i += 1
+                    continue
+                m = re.match(r'(?:template\s*<(?P<tpl>[^{}]*?)>)?\s*'
+                             r'(?P<ret>[^(){};]*?)\s*\b(?P<name>[a-z_][a-z0-9_]*)'
+                             r'\s*\((?P<params>[^(){};]*)\)\s*$', decl, re.S)
+                if m:
+                    yield (m.group('tpl') or '', m.group('ret'),
+                           m.group('name'), m.group('params'))
+            depth += 1
+        elif c == '}':
+            if depth > 0:
+                depth -= 1
+            if depth == 0:
+                start = i + 1
+        elif c == ';' and depth == 0:
+            start = i + 1
+        i += 1
+
+def param_types(param):
+    ''' Returns a list of (family, width or None) tuples that the parameter
+        accepts. Width None means any width. Returns None if the parameter is
+        not a vector taken by value or const reference.
+    '''
+    p = re.sub(r'\s+', ' ', param).strip()
+    m = re.match(r'^(?:const )?(any_[a-z0-9]+)<N, ?\w+> ?& ?\w+$', p)
+    if m:
+        if m.group(1) not in any_families:
+            return None
+        return [(f, None) for f in any_families[m.group(1)]]
+    m = re.match(r'^(?:const )?((?:u?int|float)(?:8|16|32|64))<N, ?\w+> ?&? ?\w+$', p)
+    if m:
+        return [(m.group(1), None)]
+    m = re.match(r'^(?:const )?((?:u?int|float)(?:8|16|32|64))x(\d+) ?&? ?\w+$', p)
+    if not m:
+        m = re.match(r'^(?:const )?((?:u?int|float)(?:8|16|32|64))<(\d+)> ?&? ?\w+$', p)
+    if m:
+        family = m.group(1)
+        return [(family, int(m.group(2)) * elem_bits[family])]
+    return None
+
+def parse_header(path):
+    ''' Returns a list of (name, template_args, arity, [type...]) tuples '''
+    text = strip_source(open(path).read())
+    ops = []
+    for tpl, ret, name, params in find_functions(text):
+        ret_words = ret.replace('SIMDPP_INL', '').replace('inline', '').split()
+        if len(ret_words) == 1 and ret_words[0] in scalar_types:
+            continue
+
+        tpl_args = []
+        for t in split_top_level(tpl):
+            kind, ident = t.rsplit(None, 1)
+            if kind == 'unsigned' and ident != 'N':
+                tpl_args.append('1')
+        if tpl_args and split_top_level(tpl)[0].endswith(' N'):
+            continue    # the explicit arguments must come first
+
+        params = split_top_level(params)
+        if len(params) not in [1, 2]:
+            continue
+        accepted = None
+        for p in params:
+            types = param_types(p)
+            if types is None:
+                accepted = None
+                break
+            accepted = types if accepted is None else \
+                [t for t in accepted if t in types]
+        if not accepted:
+            continue
+
+        types = []
+        for family, width in accepted:
+            for w in widths:
+                if width is not None and width != w:
+                    continue
+                if width_available(family, w):
+                    types.append(type_name(family, w))
+        ops.append((name, tpl_args, len(params), types))
+    return ops
+
+def merge_ops(headers):
+    ''' Merges the overloads of each operation. Returns a list of
+        (name, template_args, arity, [type...]) tuples in the order of the
+        first declaration
+    '''
+    res = []
+    index = {}
+    for h in headers:
+        for name, tpl_args, arity, types in parse_header(h):
+            key = (name, tuple(tpl_args), arity)
+            if key not in index:
+                index[key] = len(res)
+                res.append((name, tpl_args, arity, []))
+            cur = res[index[key]][3]
+            for t in types:
+                if t not in cur:
+                    cur.append(t)
+    return res
+
+def type_sort_key(t):
+    family, length = t.split('x')
+    width = int(length) * elem_bits[family]
+    return (width, families.index(family))
+
+def main():
+    headers = sorted(os.path.join(core_dir, f) for f in os.listdir(core_dir)
+                     if f.endswith('.h') and f not in skip_headers)
+
+    print('''/*  libsimdpp
+    Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright notice,
+      this list of conditions and the following disclaimer in the documentation
+      and/or other materials provided with the distribution.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+    POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// This file is generated by tools/gen_perf_ops.py. Do not edit.
+''')
+
+    for name, tpl_args, arity, types in merge_ops(headers):
+        fn = name
+        if tpl_args:
+            fn += '<' + ','.join(tpl_args) + '>'
+        entries = []
+        for t in sorted(types, key=type_sort_key):
+            cond = exclude.get((fn, '*'), exclude.get((fn, t), True))
+            if cond is not None:
+                entries.append((t, cond))
+        if not entries:
+            continue
+        print('// ' + fn)
+        for t, cond in entries:
+            if type_sort_key(t)[0] == 512:
+                cond = 'SIMDPP_USE_AVX512F' if cond is True else \
+                    'SIMDPP_USE_AVX512F && ' + cond
+            line = 'TEST_PERF_T{0}(ctx, {1}, {2})'.format(arity, t, fn)
+            if cond is True:
+                print(line)
+            else:
+                print('#if ' + cond)
+                print(line)
+                print('#endif')
+        print('')
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+
+#   Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+#   All rights reserved.
+#
+#   Redistribution and use in source and binary forms, with or without
+#   modification, are permitted provided that the following conditions are met:
+#
+#   * Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   * Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#   POSSIBILITY OF SUCH DAMAGE.
+
+
+# Generates simdpp/detail/profile_costs.h, the table of the instruction costs
+# documented with @icost and @novec in the public API, which weights the
+# operation counters of the SIMDPP_PROFILE_OPS mode.
+# Use as $ ./tools/gen_profile_costs.py > simdpp/detail/profile_costs.h
+#
+# Each row lists the cost of an operation on the given vector type on the
+# given instruction set. The type is the type of the first vector argument.
+# The upper bound is used if the documentation gives a range. The operations
+# documented with @novec are executed element by element; they are flagged
+# instead.
+
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import check_icost as icost
+import gen_perf_ops as gen
+
+root_dir = icost.root_dir
+
+headers = ([os.path.join('core', f) for f in
+            sorted(os.listdir(os.path.join(root_dir, 'simdpp', 'core')))
+            if f.endswith('.h')] + ['adv/transpose.h'])
+
+# The instruction sets that are not part of the x86 sequence, as named in the
+# documentation
+other_archs = ['NEON', 'ALTIVEC']
+
+archs = icost.doc_arch_names + other_archs
+
+def expand_archs(spec):
+    spec = spec.strip()
+    if spec in other_archs:
+        return [spec]
+    return icost.expand_archs(spec)
+
+def parse_novec(doc):
+    ''' Returns a list of (section, [arch...], None) tuples '''
+    res = []
+    section = None
+    for line in doc.split('\n'):
+        m = re.search(r'@par\s+(.*)$', line)
+        if m:
+            section = m.group(1).strip()
+        for m in re.finditer(r'@novec\{([^}]*)\}', line):
+            names = []
+            for p in m.group(1).split(','):
+                names += expand_archs(p)
+            if names:
+                res.append((section, names, None))
+    return res
+
+def parse_functions(path):
+    ''' Yields (name, [param...], costs) for each function definition that
+        follows a documentation comment with @icost or @novec. See
+        check_icost.parse_functions
+    '''
+    text = open(path).read()
+    text = re.sub(r'^\s*#[^\n]*', '', text, flags=re.M)
+    docs = list(re.finditer(r'/\*\*(.*?)\*/', text, re.S))
+    for i, m in enumerate(docs):
+        costs = icost.parse_icost(m.group(1), expand_archs) + \
+            parse_novec(m.group(1))
+        if not costs:
+            continue
+        end = docs[i+1].start() if i + 1 < len(docs) else len(text)
+        body = gen.strip_source(text[m.end():end])
+        first_name = None
+        for tpl, ret, name, params in gen.find_functions(body):
+            if first_name is None:
+                first_name = name
+            if name != first_name:
+                break
+            yield name, gen.split_top_level(params), costs
+
+def make_rows():
+    ''' Returns a sorted list of (op, type, arch, cost, novec) tuples '''
+    rows = {}
+    for h in headers:
+        path = os.path.join(root_dir, 'simdpp', h)
+        for name, params, costs in parse_functions(path):
+            accepted = None
+            for p in params:
+                accepted = gen.param_types(p.replace('&', ' &'))
+                if accepted is not None:
+                    break
+            if accepted is None:
+                continue
+            for family, width in accepted:
+                for w in gen.widths:
+                    if width is not None and width != w:
+                        continue
+                    if not gen.width_available(family, w):
+                        continue
+                    t = gen.type_name(family, w)
+                    for arch in archs:
+                        found = [c for s, a, c in costs
+                                 if arch in a and
+                                 icost.section_accepts(s, family, w)]
+                        if not found:
+                            continue
+                        # @novec takes precedence over the costs of the
+                        # other instruction sets listed in the same section
+                        if None in found:
+                            cost = (0, True)
+                        else:
+                            cost = (max(found), False)
+                        key = (name, t, arch)
+                        if key not in rows:
+                            rows[key] = cost
+    return sorted(k + v for k, v in rows.items())
+
+def main():
+    rows = make_rows()
+    lic = open(os.path.join(root_dir, 'simdpp', 'simd.h')).read()
+    lic = lic[:lic.index('*/') + 2]
+    print(lic)
+    print('''
+// Generated by tools/gen_profile_costs.py. Do not edit.
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_PROFILE_COSTS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_PROFILE_COSTS_H
+
+namespace simdpp {
+namespace detail {
+
+/** The documented number of instructions of an operation. If @a novec is
+    set, the operation is executed element by element.
+*/
+struct ProfileCost {
+    const char* op;
+    const char* type;
+    const char* arch;
+    unsigned cost;
+    bool novec;
+};
+
+/** Returns the table of the documented costs and stores the number of the
+    rows to @a size. The rows are sorted by the operation, the type and the
+    instruction set.
+*/
+inline const ProfileCost* get_profile_costs(unsigned& size)
+{
+    static const ProfileCost costs[] = {''')
+    for op, t, arch, cost, novec in rows:
+        print('        {{ "{0}", "{1}", "{2}", {3}, {4} }},'.format(
+              op, t, arch, cost, 'true' if novec else 'false'))
+    print('''    };
+    size = sizeof(costs) / sizeof(costs[0]);
+    return costs;
+}
+
+} // namespace detail
+} // namespace simdpp
+
+#endif''')
+
+if __name__ == '__main__':
+    main()
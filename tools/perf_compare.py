@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+
+#   Copyright (C) 2013  Povilas Kanapickas tir5c3@yahoo.co.uk
+#   All rights reserved.
+#
+#   Redistribution and use in source and binary forms, with or without
+#   modification, are permitted provided that the following conditions are met:
+#
+#   * Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+#
+#   * Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#   POSSIBILITY OF SUCH DAMAGE.
+
+# Compares two sets of results produced by the perf programs with
+# --format=json or --format=csv and fails if any operation got slower.
+# Use as $ ./tools/perf_compare.py baseline.json current.json
+#
+# The results are matched by the architecture, the operation, the type and the
+# mode. An operation regresses if its cost grew by more than --threshold
+# percent and by more than --min-delta cycles. The latter filters out the
+# noise of operations that take less than a cycle. The exit status is 1 if
+# there are regressions, 2 on invalid input and 0 otherwise.
+
+import argparse
+import csv
+import json
+import sys
+
+def load_results(path):
+    ''' Loads a result file. Returns a dict mapping (arch, op, type, mode) to
+        the record. Several JSON objects or CSV tables may be concatenated
+        in one file.
+    '''
+    with open(path) as f:
+        text = f.read()
+
+    records = []
+    if text.lstrip().startswith('{'):
+        decoder = json.JSONDecoder()
+        pos = 0
+        while True:
+            while pos < len(text) and text[pos].isspace():
+                pos += 1
+            if pos == len(text):
+                break
+            obj, pos = decoder.raw_decode(text, pos)
+            records += obj['results']
+    else:
+        header = None
+        for row in csv.reader(text.splitlines()):
+            if not row:
+                continue
+            if row[0] == 'arch':
+                header = row
+                continue
+            if header is None:
+                raise ValueError('{0}: missing CSV header'.format(path))
+            rec = dict(zip(header, row))
+            for key in ['cycles', 'min', 'stddev', 'instructions']:
+                rec[key] = float(rec[key]) if rec.get(key, '') != '' else None
+            records.append(rec)
+
+    res = {}
+    for r in records:
+        res[(r['arch'], r['op'], r['type'], r['mode'])] = r
+    return res
+
+def format_key(key):
+    arch, op, type, mode = key
+    return '{0} {1}/{2} {3}'.format(arch, op, type, mode)
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compares two perf result files')
+    parser.add_argument('baseline', help='the reference results')
+    parser.add_argument('current', help='the results to check')
+    parser.add_argument('--threshold', type=float, default=10,
+                        help='allowed slowdown in percent (default: 10)')
+    parser.add_argument('--min-delta', type=float, default=0.25,
+                        help='allowed slowdown in cycles (default: 0.25)')
+    parser.add_argument('--metric', choices=['cycles', 'min'],
+                        default='cycles',
+                        help='compare the median (cycles, default) or the '
+                             'minimum (min)')
+    parser.add_argument('--arch', action='append',
+                        help='compare only the given architecture, e.g. '
+                             'x86_avx2. May be given several times')
+    parser.add_argument('--verbose', action='store_true',
+                        help='print the improvements too')
+    args = parser.parse_args()
+
+    try:
+        base = load_results(args.baseline)
+        cur = load_results(args.current)
+    except (IOError, ValueError, KeyError) as e:
+        sys.stderr.write('Could not load results: {0}\n'.format(e))
+        return 2
+
+    regressions = []
+    improvements = []
+    missing = []
+    compared = 0
+    for key in sorted(base):
+        if args.arch and key[0] not in args.arch:
+            continue
+        if key not in cur:
+            missing.append(key)
+            continue
+        old = base[key][args.metric]
+        new = cur[key][args.metric]
+        compared += 1
+        delta = new - old
+        if abs(delta) <= args.min_delta:
+            continue
+        ratio = delta / old * 100 if old > 0 else float('inf')
+        if ratio > args.threshold:
+            regressions.append((key, old, new, ratio))
+        elif -ratio > args.threshold:
+            improvements.append((key, old, new, ratio))
+
+    def print_list(title, items):
+        print('{0}:'.format(title))
+        for key, old, new, ratio in items:
+            print('  {0}: {1:.3f} -> {2:.3f} ({3:+.1f}%)'.format(
+                  format_key(key), old, new, ratio))
+
+    if regressions:
+        print_list('Regressions', regressions)
+    if args.verbose and improvements:
+        print_list('Improvements', improvements)
+    if missing:
+        print('Missing in {0}:'.format(args.current))
+        for key in missing:
+            print('  ' + format_key(key))
+
+    print('{0} compared, {1} regressed, {2} improved, {3} missing'.format(
+          compared, len(regressions), len(improvements), len(missing)))
+    if compared == 0:
+        sys.stderr.write('No results to compare\n')
+        return 2
+    return 1 if regressions else 0
+
+if __name__ == '__main__':
+    sys.exit(main())